@@ -0,0 +1,312 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#include "blis.h"
+
+// Check the operands, partition the rows of O among the threads, and spawn
+// the threads. The operands are those of the first of h heads.
+static void bao_attn_launch
+     (
+             uplo_t  mask,
+             dim_t   h,
+             inc_t   hs_q,
+             inc_t   hs_k,
+             inc_t   hs_v,
+             inc_t   hs_o,
+       const obj_t*  alpha,
+       const obj_t*  q,
+       const obj_t*  k,
+       const obj_t*  v,
+       const obj_t*  o,
+       const cntx_t* cntx,
+             rntm_t* rntm
+     )
+{
+	bli_init_once();
+
+	// Initialize a local runtime with global settings if necessary. Note
+	// that in the case that a runtime is passed in, we make a local copy.
+	rntm_t rntm_l;
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); rntm = &rntm_l; }
+	else                { rntm_l = *rntm;                       rntm = &rntm_l; }
+
+	// Obtain a valid (native) context from the gks if necessary.
+	// NOTE: This must be done before calling the _check() function, since
+	// that function assumes the context pointer is valid.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bao_attn_check( mask, alpha, q, k, v, o, cntx );
+
+	// If O has a zero dimension, or if there are no heads, return early.
+	if ( bli_obj_has_zero_dim( o ) || h == 0 )
+	{
+		return;
+	}
+
+	// Alias Q, K, and V so that any transpositions may be induced.
+	obj_t q_local, k_local, v_local, o_local;
+
+	bli_obj_alias_to( q, &q_local );
+	bli_obj_alias_to( k, &k_local );
+	bli_obj_alias_to( v, &v_local );
+	bli_obj_alias_to( o, &o_local );
+
+	if ( bli_obj_has_trans( &q_local ) )
+	{
+		bli_obj_induce_trans( &q_local );
+		bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, &q_local );
+	}
+	if ( bli_obj_has_trans( &k_local ) )
+	{
+		bli_obj_induce_trans( &k_local );
+		bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, &k_local );
+	}
+	if ( bli_obj_has_trans( &v_local ) )
+	{
+		bli_obj_induce_trans( &v_local );
+		bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, &v_local );
+	}
+
+	const num_t dt = bli_obj_dt( o );
+	const dim_t m  = bli_obj_length( o );
+	const dim_t n  = bli_obj_length( &k_local );
+	const dim_t d  = bli_obj_width( &k_local );
+
+	// Parse and interpret the contents of the rntm_t object to determine
+	// the total number of threads. The threads claim blocks of rows of O
+	// (within each head) dynamically (see bao_attn_var1()), so all of the
+	// parallelism is assigned to the outermost loop, for which the root
+	// thrinfo_t nodes are created.
+	bli_rntm_set_ways_for_op
+	(
+	  BLIS_GEMM,
+	  BLIS_LEFT, // ignored for gemm/hemm/symm
+	  m, n, d,
+	  rntm
+	);
+
+	const dim_t nt = bli_rntm_num_threads( rntm );
+
+	bli_rntm_set_ways_only( nt, 1, 1, 1, 1, rntm );
+
+	// Choose the number of rows in each block: at most MC, but small enough
+	// that there are (if possible) at least two blocks for each thread.
+	const dim_t MR    = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx );
+	const dim_t MC    = bli_cntx_get_blksz_def_dt( dt, BLIS_MC, cntx );
+	const dim_t n_min = ( 2 * nt + h - 1 ) / h;
+	const dim_t n_blk = bli_max( ( m + MC - 1 ) / MC, n_min );
+	const dim_t mb    = bli_min( bli_align_dim_to_mult( ( m + n_blk - 1 ) / n_blk, MR ),
+	                             bli_max( MC, MR ) );
+
+	attn_state_t state;
+
+	state.mask = mask;
+	state.h    = h;
+	state.hs_q = hs_q;
+	state.hs_k = hs_k;
+	state.hs_v = hs_v;
+	state.hs_o = hs_o;
+	state.v    = &v_local;
+	state.mb   = mb;
+	state.next = 0;
+
+	// Pass the state along with O.
+	bli_obj_set_ker_params( &state, &o_local );
+
+	// Spawn threads (if applicable), where bao_attn_int() is the thread
+	// entry point function for each thread.
+	bli_l3_sup_thread_decorator
+	(
+	  bao_attn_int,
+	  BLIS_GEMM, // operation family id
+	  alpha,
+	  &q_local,
+	  &k_local,
+	  &BLIS_ZERO,
+	  &o_local,
+	  cntx,
+	  rntm
+	);
+}
+
+//
+// -- Define the attention operation's object API ------------------------------
+//
+
+void bao_attn
+     (
+             uplo_t  mask,
+       const obj_t*  alpha,
+       const obj_t*  q,
+       const obj_t*  k,
+       const obj_t*  v,
+       const obj_t*  o
+     )
+{
+	bao_attn_ex
+	(
+	  mask,
+	  alpha,
+	  q,
+	  k,
+	  v,
+	  o,
+	  NULL,
+	  NULL
+	);
+}
+
+void bao_attn_ex
+     (
+             uplo_t  mask,
+       const obj_t*  alpha,
+       const obj_t*  q,
+       const obj_t*  k,
+       const obj_t*  v,
+       const obj_t*  o,
+       const cntx_t* cntx,
+             rntm_t* rntm
+     )
+{
+	bao_attn_launch
+	(
+	  mask,
+	  1, 0, 0, 0, 0,
+	  alpha,
+	  q,
+	  k,
+	  v,
+	  o,
+	  cntx,
+	  rntm
+	);
+}
+
+//
+// -- Define the attention operation's thread entry point ----------------------
+//
+
+err_t bao_attn_int
+     (
+       const obj_t*     alpha,
+       const obj_t*     q,
+       const obj_t*     k,
+       const obj_t*     beta,
+       const obj_t*     o,
+       const cntx_t*    cntx,
+             rntm_t*    rntm,
+             thrinfo_t* thread
+     )
+{
+	( void )beta;
+
+	// There is only one variant.
+	bao_attn_var1
+	(
+	  alpha,
+	  q,
+	  k,
+	  o,
+	  bli_obj_ker_params( o ),
+	  cntx,
+	  rntm,
+	  thread
+	);
+
+	return BLIS_SUCCESS;
+}
+
+//
+// -- Define the attention operation's typed API -------------------------------
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+       uplo_t  mask, \
+       dim_t   h, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   d, \
+       dim_t   dv, \
+       ctype*  alpha, \
+       ctype*  q, inc_t rs_q, inc_t cs_q, inc_t hs_q, \
+       ctype*  k, inc_t rs_k, inc_t cs_k, inc_t hs_k, \
+       ctype*  v, inc_t rs_v, inc_t cs_v, inc_t hs_v, \
+       ctype*  o, inc_t rs_o, inc_t cs_o, inc_t hs_o  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	/* Determine the datatype (e.g. BLIS_FLOAT, BLIS_DOUBLE, etc.) based on
+	   the macro parameter 'ch' (e.g. s, d, etc). */ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	obj_t       alphao, qo, ko, vo, oo; \
+\
+	/* Create bufferless scalar objects and attach the provided scalar
+	   pointers to them. */ \
+	bli_obj_create_1x1_with_attached_buffer( dt, alpha, &alphao ); \
+\
+	/* Create bufferless matrix objects and attach the provided matrix
+	   pointers (of the first head) to them. */ \
+	bli_obj_create_with_attached_buffer( dt, m, d,  q, rs_q, cs_q, &qo ); \
+	bli_obj_create_with_attached_buffer( dt, n, d,  k, rs_k, cs_k, &ko ); \
+	bli_obj_create_with_attached_buffer( dt, n, dv, v, rs_v, cs_v, &vo ); \
+	bli_obj_create_with_attached_buffer( dt, m, dv, o, rs_o, cs_o, &oo ); \
+\
+	bao_attn_launch \
+	( \
+	  mask, \
+	  h, hs_q, hs_k, hs_v, hs_o, \
+	  &alphao, \
+	  &qo, \
+	  &ko, \
+	  &vo, \
+	  &oo, \
+	  NULL, \
+	  NULL  \
+	); \
+}
+
+GENTFUNC( float,  s, attn )
+GENTFUNC( double, d, attn )
+
@@ -0,0 +1,156 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+//
+// -- Fused attention definitions ----------------------------------------------
+//
+
+// The attention operation
+//
+//   O := softmax( alpha * Q K^T ) V
+//
+// (where the softmax is taken along each row) is computed without forming
+// the m x n matrix of scores. Each thread claims blocks of rows of Q (and
+// of O) in turn. For each block, the scores against a block of KC rows of
+// K are computed by the gemm microkernel directly into the format of a
+// packed block of A, so that they can be exponentiated in place and then
+// multiplied by a packed block of V, accumulating into a block of O that
+// is rescaled as the running maximum of each row grows ("online softmax").
+// Thus the scores only ever occupy a cache-resident block.
+
+// State shared by all of the threads that cooperate on one operation. It
+// is passed to the thread entry point along with O.
+typedef struct
+{
+	// BLIS_LOWER for a causal mask (see bao_attn()), BLIS_DENSE otherwise.
+	uplo_t       mask;
+
+	// The number of heads and the strides between them in each operand.
+	dim_t        h;
+	inc_t        hs_q;
+	inc_t        hs_k;
+	inc_t        hs_v;
+	inc_t        hs_o;
+
+	// V, which does not fit in the thread decorator's list of operands.
+	const obj_t* v;
+
+	// The number of rows of Q in each block claimed by a thread.
+	dim_t        mb;
+
+	// The next unclaimed block. This counter is incremented atomically.
+	dim_t        next;
+
+} attn_state_t;
+
+//
+// -- Prototype the attention operation's object API ---------------------------
+//
+
+// Compute O := softmax( alpha * Q K^T ) V, where Q is m x d, K is n x d, V
+// is n x dv, and O is m x dv. If mask is BLIS_LOWER, then query i only
+// attends to keys j <= i + n - m (a causal mask, aligned so that the last
+// query attends to all keys); rows of O with no keys to attend to are set
+// to zero. Only real datatypes are supported.
+
+BLIS_EXPORT_ADDON void bao_attn
+     (
+             uplo_t  mask,
+       const obj_t*  alpha,
+       const obj_t*  q,
+       const obj_t*  k,
+       const obj_t*  v,
+       const obj_t*  o
+     );
+
+BLIS_EXPORT_ADDON void bao_attn_ex
+     (
+             uplo_t  mask,
+       const obj_t*  alpha,
+       const obj_t*  q,
+       const obj_t*  k,
+       const obj_t*  v,
+       const obj_t*  o,
+       const cntx_t* cntx,
+             rntm_t* rntm
+     );
+
+//
+// -- Prototype the attention operation's thread entry point -------------------
+//
+
+err_t bao_attn_int
+     (
+       const obj_t*     alpha,
+       const obj_t*     q,
+       const obj_t*     k,
+       const obj_t*     beta,
+       const obj_t*     o,
+       const cntx_t*    cntx,
+             rntm_t*    rntm,
+             thrinfo_t* thread
+     );
+
+//
+// -- Prototype the attention operation's typed API ----------------------------
+//
+
+// Compute the attention operation for h heads at once, where the operands
+// of head i are located at q + i*hs_q, k + i*hs_k, and so on. The heads are
+// processed by the same team of threads.
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_ADDON void PASTECH2(bao_,ch,opname) \
+     ( \
+       uplo_t  mask, \
+       dim_t   h, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   d, \
+       dim_t   dv, \
+       ctype*  alpha, \
+       ctype*  q, inc_t rs_q, inc_t cs_q, inc_t hs_q, \
+       ctype*  k, inc_t rs_k, inc_t cs_k, inc_t hs_k, \
+       ctype*  v, inc_t rs_v, inc_t cs_v, inc_t hs_v, \
+       ctype*  o, inc_t rs_o, inc_t cs_o, inc_t hs_o  \
+     );
+
+GENTPROT( float,  s, attn )
+GENTPROT( double, d, attn )
+
@@ -0,0 +1,114 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#include "blis.h"
+
+void bao_attn_check
+     (
+             uplo_t  mask,
+       const obj_t*  alpha,
+       const obj_t*  q,
+       const obj_t*  k,
+       const obj_t*  v,
+       const obj_t*  o,
+       const cntx_t* cntx
+     )
+{
+	err_t e_val;
+
+	( void )cntx;
+
+	// Check the mask.
+
+	if ( mask != BLIS_DENSE && mask != BLIS_LOWER )
+		bli_check_error_code( BLIS_INVALID_UPLO );
+
+	// Check object datatypes. The softmax is only defined for real scores.
+
+	e_val = bli_check_real_object( o );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_floating_object( o );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_consistent_object_datatypes( o, q );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_consistent_object_datatypes( o, k );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_consistent_object_datatypes( o, v );
+	bli_check_error_code( e_val );
+
+	// Check object dimensions.
+
+	e_val = bli_check_scalar_object( alpha );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_matrix_object( q );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_matrix_object( k );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_matrix_object( v );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_matrix_object( o );
+	bli_check_error_code( e_val );
+
+	if ( bli_obj_length_after_trans( q ) != bli_obj_length( o ) ||
+	     bli_obj_width_after_trans( v )  != bli_obj_width( o )  ||
+	     bli_obj_width_after_trans( k )  != bli_obj_width_after_trans( q ) ||
+	     bli_obj_length_after_trans( k ) != bli_obj_length_after_trans( v ) )
+		bli_check_error_code( BLIS_NONCONFORMAL_DIMENSIONS );
+
+	// Check object buffers (for non-NULLness).
+
+	e_val = bli_check_object_buffer( q );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( k );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( v );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( o );
+	bli_check_error_code( e_val );
+}
+
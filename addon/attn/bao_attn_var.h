@@ -0,0 +1,83 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+//
+// Prototype the object-based variant interfaces.
+//
+
+void bao_attn_var1
+     (
+       const obj_t*        alpha,
+       const obj_t*        q,
+       const obj_t*        k,
+       const obj_t*        o,
+             attn_state_t* state,
+       const cntx_t*       cntx,
+             rntm_t*       rntm,
+             thrinfo_t*    thread
+     );
+
+//
+// Prototype the typed variant interfaces.
+//
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, varname ) \
+\
+void PASTECH2(bao_,ch,varname) \
+     ( \
+             uplo_t     mask, \
+             dim_t      h, \
+             dim_t      m, \
+             dim_t      n, \
+             dim_t      d, \
+             dim_t      dv, \
+             dim_t      mb, \
+             void*      alpha, \
+             void*      q, inc_t rs_q, inc_t cs_q, inc_t hs_q, \
+             void*      k, inc_t rs_k, inc_t cs_k, inc_t hs_k, \
+             void*      v, inc_t rs_v, inc_t cs_v, inc_t hs_v, \
+             void*      o, inc_t rs_o, inc_t cs_o, inc_t hs_o, \
+             dim_t*     next, \
+       const cntx_t*    cntx, \
+             rntm_t*    rntm, \
+             thrinfo_t* thread  \
+     );
+
+GENTPROT( float,  s, attn_var1 )
+GENTPROT( double, d, attn_var1 )
+
@@ -0,0 +1,443 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#include "blis.h"
+
+#define FUNCPTR_T attn_fp
+
+typedef void (*FUNCPTR_T)
+     (
+             uplo_t     mask,
+             dim_t      h,
+             dim_t      m,
+             dim_t      n,
+             dim_t      d,
+             dim_t      dv,
+             dim_t      mb,
+             void*      alpha,
+             void*      q, inc_t rs_q, inc_t cs_q, inc_t hs_q,
+             void*      k, inc_t rs_k, inc_t cs_k, inc_t hs_k,
+             void*      v, inc_t rs_v, inc_t cs_v, inc_t hs_v,
+             void*      o, inc_t rs_o, inc_t cs_o, inc_t hs_o,
+             dim_t*     next,
+       const cntx_t*    cntx,
+             rntm_t*    rntm,
+             thrinfo_t* thread
+     );
+
+// Define a function pointer array named ftypes and initialize its contents
+// with the addresses of the typed functions bao_?attn_var1(). Since only
+// real datatypes are supported, the complex entries are NULL.
+static FUNCPTR_T ftypes[BLIS_NUM_FP_TYPES] =
+{
+	bao_sattn_var1,
+	NULL,
+	bao_dattn_var1,
+	NULL
+};
+
+//
+// -- Fused attention (object interface) ---------------------------------------
+//
+
+void bao_attn_var1
+     (
+       const obj_t*        alpha,
+       const obj_t*        q,
+       const obj_t*        k,
+       const obj_t*        o,
+             attn_state_t* state,
+       const cntx_t*       cntx,
+             rntm_t*       rntm,
+             thrinfo_t*    thread
+     )
+{
+	const num_t dt        = bli_obj_dt( o );
+	const obj_t* v        = state->v;
+
+	const dim_t m         = bli_obj_length( o );
+	const dim_t dv        = bli_obj_width( o );
+	const dim_t n         = bli_obj_length( k );
+	const dim_t d         = bli_obj_width( k );
+
+	void*       buf_alpha = bli_obj_buffer_for_1x1( dt, alpha );
+
+	ftypes[dt]
+	(
+	  state->mask,
+	  state->h,
+	  m, n, d, dv,
+	  state->mb,
+	  buf_alpha,
+	  bli_obj_buffer_at_off( q ), bli_obj_row_stride( q ), bli_obj_col_stride( q ), state->hs_q,
+	  bli_obj_buffer_at_off( k ), bli_obj_row_stride( k ), bli_obj_col_stride( k ), state->hs_k,
+	  bli_obj_buffer_at_off( v ), bli_obj_row_stride( v ), bli_obj_col_stride( v ), state->hs_v,
+	  bli_obj_buffer_at_off( o ), bli_obj_row_stride( o ), bli_obj_col_stride( o ), state->hs_o,
+	  &state->next,
+	  cntx,
+	  rntm,
+	  thread
+	);
+}
+
+//
+// -- Fused attention (typed interface) ----------------------------------------
+//
+
+BLIS_INLINE float  bao_sattn_exp( float  x ) { return expf( x ); }
+BLIS_INLINE double bao_dattn_exp( double x ) { return exp( x );  }
+
+// Each thread repeatedly claims a block of (at most) mb rows of Q in one
+// head, which it packs (scaled by alpha) into MR x d micropanels. Then, for
+// each block of (at most) KC keys, the thread
+//
+//   1. packs the block of K into NR x d micropanels;
+//   2. computes the mb x KC block of scores S with the gemm microkernel,
+//      writing each MR x NR microtile of S into the place it would occupy
+//      in a block of A packed into MR x KC micropanels;
+//   3. applies the online softmax to each row of S: the running maximum m_i
+//      of the row is updated, the scores are replaced (in place) by their
+//      exponentials relative to the new maximum, and the accumulated row of
+//      O and running sum l_i of exponentials are rescaled accordingly;
+//   4. packs the corresponding block of V into KC x NR micropanels; and
+//   5. accumulates the product of the (already packed) exponentials and V
+//      into the mb x dv block of O with the gemm microkernel.
+//
+// Finally, each row of the block of O is divided by its sum l_i and written
+// out. With a causal mask, blocks of keys that lie entirely beyond the last
+// row of the block are skipped, and the blocks of rows are claimed in
+// decreasing order (of cost) to balance the threads.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTECH2(bao_,ch,varname) \
+     ( \
+             uplo_t     mask, \
+             dim_t      h, \
+             dim_t      m, \
+             dim_t      n, \
+             dim_t      d, \
+             dim_t      dv, \
+             dim_t      mb, \
+             void*      alpha, \
+             void*      q, inc_t rs_q, inc_t cs_q, inc_t hs_q, \
+             void*      k, inc_t rs_k, inc_t cs_k, inc_t hs_k, \
+             void*      v, inc_t rs_v, inc_t cs_v, inc_t hs_v, \
+             void*      o, inc_t rs_o, inc_t cs_o, inc_t hs_o, \
+             dim_t*     next, \
+       const cntx_t*    cntx, \
+             rntm_t*    rntm, \
+             thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	/* Query the context for various blocksizes. */ \
+	const dim_t MR     = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx ); \
+	const dim_t NR     = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx ); \
+	const dim_t KC     = bli_cntx_get_blksz_def_dt( dt, BLIS_KC, cntx ); \
+	const dim_t PACKMR = bli_cntx_get_blksz_max_dt( dt, BLIS_MR, cntx ); \
+	const dim_t PACKNR = bli_cntx_get_blksz_max_dt( dt, BLIS_NR, cntx ); \
+\
+	/* Query the context for the microkernels. */ \
+	PASTECH(ch,gemm_ukr_ft) \
+	            gemm_ukr     = bli_cntx_get_ukr_dt( dt, BLIS_GEMM_UKR, cntx ); \
+	PASTECH2(ch,packm_cxk,_ker_ft) \
+	            packm_mr_ker = bli_cntx_get_ukr_dt( dt, BLIS_PACKM_MRXK_KER, cntx ); \
+	PASTECH2(ch,packm_cxk,_ker_ft) \
+	            packm_nr_ker = bli_cntx_get_ukr_dt( dt, BLIS_PACKM_NRXK_KER, cntx ); \
+\
+	ctype* restrict q_cast = q; \
+	ctype* restrict k_cast = k; \
+	ctype* restrict v_cast = v; \
+	ctype* restrict o_cast = o; \
+	ctype* restrict one    = PASTEMAC(ch,1); \
+	ctype* restrict zero   = PASTEMAC(ch,0); \
+\
+	/* A private copy of one to serve as beta when accumulating into O,
+	   since the microkernel's alpha and beta may not alias. */ \
+	ctype           beta1; \
+	PASTEMAC(ch,set1s)( beta1 ); \
+\
+	/* The number of keys in each block, which is a multiple of NR so that
+	   only the last block of scores has a partial micropanel of K. */ \
+	const dim_t nb    = bli_max( KC / NR, 1 ) * NR; \
+\
+	/* The dimensions and strides of the packed blocks. Each is rounded up
+	   to a multiple of the SIMD alignment so that every block is aligned. */ \
+	const dim_t mb_p  = ( ( mb + MR - 1 ) / MR ) * MR; \
+	const dim_t dv_p  = ( ( dv + NR - 1 ) / NR ) * NR; \
+	const dim_t n_ln  = BLIS_SIMD_ALIGN_SIZE / sizeof( ctype ); \
+\
+	const inc_t ps_q  = PACKMR * d; \
+	const inc_t ps_k  = PACKNR * d; \
+	const inc_t ps_s  = PACKMR * nb; \
+	const inc_t ps_v  = PACKNR * nb; \
+	const inc_t ldo   = dv_p; \
+\
+	const siz_t n_q   = bli_align_dim_to_mult( ( mb_p / MR ) * ps_q, n_ln ); \
+	const siz_t n_k   = bli_align_dim_to_mult( ( nb / NR )   * ps_k, n_ln ); \
+	const siz_t n_s   = bli_align_dim_to_mult( ( mb_p / MR ) * ps_s, n_ln ); \
+	const siz_t n_v   = bli_align_dim_to_mult( ( dv_p / NR ) * ps_v, n_ln ); \
+	const siz_t n_o   = bli_align_dim_to_mult( mb_p * ldo, n_ln ); \
+	const siz_t n_ml  = 2 * mb_p; \
+\
+	/* Acquire a buffer private to this thread for all of the blocks. */ \
+	mem_t mem = BLIS_MEM_INITIALIZER; \
+\
+	bli_pba_acquire_m \
+	( \
+	  rntm, \
+	  ( n_q + n_k + n_s + n_v + n_o + n_ml ) * sizeof( ctype ), \
+	  BLIS_BUFFER_FOR_GEN_USE, \
+	  &mem  \
+	); \
+\
+	ctype* restrict qp   = bli_mem_buffer( &mem ); \
+	ctype* restrict kp   = qp + n_q; \
+	ctype* restrict sp   = kp + n_k; \
+	ctype* restrict vp   = sp + n_s; \
+	ctype* restrict oacc = vp + n_v; \
+	ctype* restrict rmax = oacc + n_o; \
+	ctype* restrict rsum = rmax + mb_p; \
+\
+	auxinfo_t aux; \
+	bli_auxinfo_set_schema_a( BLIS_PACKED_ROW_PANELS, &aux ); \
+	bli_auxinfo_set_schema_b( BLIS_PACKED_COL_PANELS, &aux ); \
+\
+	const bool  causal = ( mask == BLIS_LOWER ); \
+	const dim_t n_blk  = ( m + mb - 1 ) / mb; \
+\
+	( void )thread; \
+\
+	for ( ;; ) \
+	{ \
+		const dim_t t = __atomic_fetch_add( next, 1, __ATOMIC_RELAXED ); \
+\
+		if ( t >= h * n_blk ) break; \
+\
+		const dim_t hd = t / n_blk; \
+		const dim_t ib = ( causal ? n_blk - 1 - t % n_blk : t % n_blk ); \
+		const dim_t i0 = ib * mb; \
+		const dim_t mc = bli_min( mb, m - i0 ); \
+\
+		ctype* restrict q1 = q_cast + hd * hs_q + i0 * rs_q; \
+		ctype* restrict k1 = k_cast + hd * hs_k; \
+		ctype* restrict v1 = v_cast + hd * hs_v; \
+		ctype* restrict o1 = o_cast + hd * hs_o + i0 * rs_o; \
+\
+		/* The keys that any row of the block may attend to. */ \
+		const dim_t j_end = ( causal ? bli_max( bli_min( n, i0 + mc + n - m ), 0 ) : n ); \
+\
+		/* Pack the block of Q, scaled by alpha. */ \
+		for ( dim_t ir = 0; ir < mc; ir += MR ) \
+		{ \
+			packm_mr_ker \
+			( \
+			  BLIS_NO_CONJUGATE, \
+			  BLIS_PACKED_ROW_PANELS, \
+			  bli_min( MR, mc - ir ), \
+			  d, \
+			  d, \
+			  alpha, \
+			  q1 + ir * rs_q, rs_q, cs_q, \
+			  qp + ( ir / MR ) * ps_q, PACKMR, \
+			  ( cntx_t* )cntx  \
+			); \
+		} \
+\
+		for ( dim_t i = 0; i < mc; ++i ) \
+		{ \
+			rmax[ i ] = -INFINITY; \
+			PASTEMAC(ch,set0s)( rsum[ i ] ); \
+		} \
+\
+		for ( dim_t i = 0; i < mb_p * ldo; ++i ) \
+			PASTEMAC(ch,set0s)( oacc[ i ] ); \
+\
+		for ( dim_t j0 = 0; j0 < j_end; j0 += nb ) \
+		{ \
+			const dim_t nc = bli_min( nb, j_end - j0 ); \
+\
+			/* 1. Pack the block of K. */ \
+			for ( dim_t jr = 0; jr < nc; jr += NR ) \
+			{ \
+				packm_nr_ker \
+				( \
+				  BLIS_NO_CONJUGATE, \
+				  BLIS_PACKED_COL_PANELS, \
+				  bli_min( NR, nc - jr ), \
+				  d, \
+				  d, \
+				  one, \
+				  k1 + ( j0 + jr ) * rs_k, rs_k, cs_k, \
+				  kp + ( jr / NR ) * ps_k, PACKNR, \
+				  ( cntx_t* )cntx  \
+				); \
+			} \
+\
+			/* 2. Compute the scores directly into packed micropanels. */ \
+			for ( dim_t ir = 0; ir < mc; ir += MR ) \
+			for ( dim_t jr = 0; jr < nc; jr += NR ) \
+			{ \
+				ctype* restrict a1 = qp + ( ir / MR ) * ps_q; \
+				ctype* restrict b1 = kp + ( jr / NR ) * ps_k; \
+\
+				bli_auxinfo_set_next_a( a1, &aux ); \
+				bli_auxinfo_set_next_b( b1, &aux ); \
+\
+				gemm_ukr \
+				( \
+				  bli_min( MR, mc - ir ), \
+				  bli_min( NR, nc - jr ), \
+				  d, \
+				  one, \
+				  a1, \
+				  b1, \
+				  zero, \
+				  sp + ( ir / MR ) * ps_s + jr * PACKMR, 1, PACKMR, \
+				  &aux, \
+				  ( cntx_t* )cntx  \
+				); \
+			} \
+\
+			/* 3. Apply the online softmax to each row. */ \
+			for ( dim_t i = 0; i < mc; ++i ) \
+			{ \
+				ctype* restrict s_i  = sp + ( i / MR ) * ps_s + i % MR; \
+				ctype* restrict o_i  = oacc + i * ldo; \
+\
+				/* With a causal mask, the keys that row i may attend to. */ \
+				const dim_t     nc_i = ( causal ? bli_max( bli_min( nc, i0 + i + n - m + 1 - j0 ), 0 ) : nc ); \
+\
+				ctype mx = rmax[ i ]; \
+				for ( dim_t j = 0; j < nc_i; ++j ) \
+					mx = bli_max( mx, s_i[ j * PACKMR ] ); \
+\
+				/* If the row has no keys yet, its exponentials are all zero. */ \
+				if ( mx == -INFINITY ) \
+				{ \
+					for ( dim_t j = 0; j < nc; ++j ) \
+						PASTEMAC(ch,set0s)( s_i[ j * PACKMR ] ); \
+					continue; \
+				} \
+\
+				ctype sum = 0; \
+				for ( dim_t j = 0; j < nc_i; ++j ) \
+				{ \
+					const ctype e = PASTECH2(bao_,ch,attn_exp)( s_i[ j * PACKMR ] - mx ); \
+					s_i[ j * PACKMR ] = e; \
+					sum += e; \
+				} \
+				for ( dim_t j = nc_i; j < nc; ++j ) \
+					PASTEMAC(ch,set0s)( s_i[ j * PACKMR ] ); \
+\
+				/* Rescale the accumulated row if the maximum has grown. */ \
+				if ( mx != rmax[ i ] ) \
+				{ \
+					const ctype corr = PASTECH2(bao_,ch,attn_exp)( rmax[ i ] - mx ); \
+\
+					for ( dim_t j = 0; j < dv; ++j ) \
+						o_i[ j ] *= corr; \
+\
+					rsum[ i ] *= corr; \
+					rmax[ i ]  = mx; \
+				} \
+\
+				rsum[ i ] += sum; \
+			} \
+\
+			/* 4. Pack the block of V. */ \
+			for ( dim_t jr = 0; jr < dv; jr += NR ) \
+			{ \
+				packm_nr_ker \
+				( \
+				  BLIS_NO_CONJUGATE, \
+				  BLIS_PACKED_COL_PANELS, \
+				  bli_min( NR, dv - jr ), \
+				  nc, \
+				  nc, \
+				  one, \
+				  v1 + j0 * rs_v + jr * cs_v, cs_v, rs_v, \
+				  vp + ( jr / NR ) * ps_v, PACKNR, \
+				  ( cntx_t* )cntx  \
+				); \
+			} \
+\
+			/* 5. Accumulate the product of the exponentials and V. */ \
+			for ( dim_t ir = 0; ir < mc; ir += MR ) \
+			for ( dim_t jr = 0; jr < dv; jr += NR ) \
+			{ \
+				ctype* restrict a1 = sp + ( ir / MR ) * ps_s; \
+				ctype* restrict b1 = vp + ( jr / NR ) * ps_v; \
+\
+				bli_auxinfo_set_next_a( a1, &aux ); \
+				bli_auxinfo_set_next_b( b1, &aux ); \
+\
+				gemm_ukr \
+				( \
+				  bli_min( MR, mc - ir ), \
+				  bli_min( NR, dv - jr ), \
+				  nc, \
+				  one, \
+				  a1, \
+				  b1, \
+				  &beta1, \
+				  oacc + ir * ldo + jr, ldo, 1, \
+				  &aux, \
+				  ( cntx_t* )cntx  \
+				); \
+			} \
+		} \
+\
+		/* Normalize each row and write it out. */ \
+		for ( dim_t i = 0; i < mc; ++i ) \
+		{ \
+			const ctype rcp = ( rsum[ i ] > 0 ? 1 / rsum[ i ] : 0 ); \
+\
+			for ( dim_t j = 0; j < dv; ++j ) \
+				o1[ i * rs_o + j * cs_o ] = oacc[ i * ldo + j ] * rcp; \
+		} \
+	} \
+\
+	bli_pba_release( rntm, &mem ); \
+}
+
+GENTFUNC( float,  s, attn_var1 )
+GENTFUNC( double, d, attn_var1 )
+
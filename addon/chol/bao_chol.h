@@ -0,0 +1,138 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+//
+// -- Cholesky factorization definitions ---------------------------------------
+//
+
+// The algorithmic blocksize (the width of each panel) is derived from the
+// context's KC, rounded down to a multiple of both MR and NR so that every
+// panel but the last consists of whole micropanels. A nonzero value
+// overrides the blocksize for all datatypes at compile-time (rounded in the
+// same way).
+#ifndef BAO_CHOL_NB
+#define BAO_CHOL_NB        0
+#endif
+
+// Diagonal blocks are factored recursively, with subproblems of this size
+// or smaller factored by an unblocked algorithm.
+#ifndef BAO_CHOL_UNB_MAX
+#define BAO_CHOL_UNB_MAX  16
+#endif
+
+// State shared by all of the threads that cooperate on one factorization.
+// It is passed to the thread entry point along with A.
+typedef struct
+{
+	// The algorithmic blocksize.
+	dim_t nb;
+
+	// The order of the first leading minor found not to be positive
+	// definite (or zero if none was found).
+	dim_t info;
+
+	// The next unclaimed block of the trailing update in the current
+	// iteration. This counter is incremented atomically.
+	dim_t next;
+
+} chol_state_t;
+
+//
+// -- Prototype the Cholesky operation's object API ----------------------------
+//
+
+// Compute the Cholesky factor of the Hermitian positive definite matrix A,
+// whose lower or upper triangle (as given by the uplo property of a) is
+// referenced and overwritten with L (A = L L^H) or U (A = U^H U),
+// respectively. The return value is zero on success; otherwise, it is the
+// order i of the first leading minor that is not positive definite, in
+// which case the factorization could not be completed (as with the info
+// parameter of LAPACK's ?potrf).
+
+BLIS_EXPORT_ADDON dim_t bao_chol
+     (
+       const obj_t*  a
+     );
+
+BLIS_EXPORT_ADDON dim_t bao_chol_ex
+     (
+       const obj_t*  a,
+       const cntx_t* cntx,
+             rntm_t* rntm
+     );
+
+//
+// -- Prototype the Cholesky operation's thread entry point --------------------
+//
+
+err_t bao_chol_int
+     (
+       const obj_t*     alpha,
+       const obj_t*     a,
+       const obj_t*     b,
+       const obj_t*     beta,
+       const obj_t*     c,
+       const cntx_t*    cntx,
+             rntm_t*    rntm,
+             thrinfo_t* thread
+     );
+
+//
+// -- Prototype the Cholesky blocksize query -----------------------------------
+//
+
+BLIS_EXPORT_ADDON dim_t bao_chol_nb
+     (
+             num_t   dt,
+       const cntx_t* cntx
+     );
+
+//
+// -- Prototype the Cholesky operation's typed API -----------------------------
+//
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_ADDON dim_t PASTECH2(bao_,ch,opname) \
+     ( \
+       uplo_t  uploa, \
+       dim_t   m, \
+       ctype*  a, inc_t rs_a, inc_t cs_a  \
+     );
+
+INSERT_GENTPROT_BASIC0( chol )
+
@@ -0,0 +1,524 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+#include "blis.h"
+
+#define FUNCPTR_T chol_fp
+
+typedef void (*FUNCPTR_T)
+     (
+             dim_t         m,
+             void*         a, inc_t rs_a, inc_t cs_a,
+             chol_state_t* state,
+             cntx_t*       cntx,
+             rntm_t*       rntm,
+             thrinfo_t*    thread
+     );
+
+//
+// -- Blocked Cholesky with lookahead (object interface) -----------------------
+//
+
+// Define a function pointer array named ftypes and initialize its contents with
+// the addresses of the typed functions defined below, bao_?chol_la_var1().
+static FUNCPTR_T GENARRAY_PREF(ftypes,bao_,chol_la_var1);
+
+void bao_chol_la_var1
+     (
+       const obj_t*     a,
+       const cntx_t*    cntx,
+             rntm_t*    rntm,
+             thrinfo_t* thread
+     )
+{
+	const num_t    dt        = bli_obj_dt( a );
+
+	const dim_t    m         = bli_obj_length( a );
+
+	void* restrict buf_a     = bli_obj_buffer_at_off( a );
+	const inc_t    rs_a      = bli_obj_row_stride( a );
+	const inc_t    cs_a      = bli_obj_col_stride( a );
+
+	// The state shared by all threads is passed in with A.
+	chol_state_t*  state     = bli_obj_ker_params( a );
+
+	// Index into the function pointer array to extract the correct
+	// typed function pointer based on the chosen datatype.
+	FUNCPTR_T f = ftypes[dt];
+
+	// Invoke the function.
+	f
+	(
+	  m,
+	  buf_a, rs_a, cs_a,
+	  state,
+	  ( cntx_t* )cntx,
+	  rntm,
+	  thread
+	);
+}
+
+//
+// -- Trailing update of one block ---------------------------------------------
+//
+
+// Subtract the product of the packed panels, restricted to the lower
+// (upper == FALSE) or upper (upper == TRUE) triangle, from the microtiles
+// of C with row indices in [ia0,ia1) and column indices in [ib0,ib1),
+// where ia0 and ib0 are multiples of mr and nr, respectively, and m is the
+// order of C. Microtiles that lie entirely within the leading d x d
+// submatrix are skipped, since that block is updated separately.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTECH2(bao_,ch,opname) \
+     ( \
+       bool     upper, \
+       dim_t    ia0, \
+       dim_t    ia1, \
+       dim_t    ib0, \
+       dim_t    ib1, \
+       dim_t    d, \
+       dim_t    m, \
+       dim_t    k, \
+       ctype*   ap, inc_t ps_a, \
+       ctype*   bp, inc_t ps_b, \
+       ctype*   c, inc_t rs_c, inc_t cs_c, \
+       cntx_t*  cntx  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	const dim_t MR = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx ); \
+	const dim_t NR = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx ); \
+\
+	PASTECH(ch,gemm_ukr_ft) \
+	            gemm_ukr = bli_cntx_get_ukr_dt( dt, BLIS_GEMM_UKR, cntx ); \
+\
+	/* Temporary microtile for microtiles that intersect the diagonal,
+	   stored according to the microkernel's preference. */ \
+	ctype       ct[ BLIS_STACK_BUF_MAX_SIZE / sizeof( ctype ) ] \
+	                __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+	const bool  col_pref = bli_cntx_ukr_prefers_cols_dt( dt, BLIS_GEMM_UKR, cntx ); \
+	const inc_t rs_ct    = ( col_pref ? 1 : NR ); \
+	const inc_t cs_ct    = ( col_pref ? MR : 1 ); \
+\
+	ctype* restrict one       = PASTEMAC(ch,1); \
+	ctype* restrict zero      = PASTEMAC(ch,0); \
+	ctype* restrict minus_one = PASTEMAC(ch,m1); \
+\
+	auxinfo_t aux; \
+	bli_auxinfo_set_schema_a( BLIS_PACKED_ROW_PANELS, &aux ); \
+	bli_auxinfo_set_schema_b( BLIS_PACKED_COL_PANELS, &aux ); \
+\
+	/* Loop over the columns (NR at a time) and then the rows (MR at a
+	   time), so that the micropanels of A are reused from the L2 cache. */ \
+	for ( dim_t ib = ib0; ib < ib1; ib += NR ) \
+	{ \
+		const dim_t     nr_cur = bli_min( NR, m - ib ); \
+		ctype* restrict b1     = bp + ( ib / NR ) * ps_b; \
+\
+		for ( dim_t ia = ia0; ia < ia1; ia += MR ) \
+		{ \
+			const dim_t     mr_cur = bli_min( MR, m - ia ); \
+			ctype* restrict a1     = ap + ( ia / MR ) * ps_a; \
+			ctype* restrict c11    = c + ia * rs_c + ib * cs_c; \
+\
+			if ( ia < d && ib < d ) continue; \
+\
+			/* Determine whether the microtile lies entirely within the
+			   referenced triangle, entirely outside of it, or intersects
+			   the diagonal. */ \
+			bool full, none; \
+			if ( upper ) \
+			{ \
+				full = ( ia + mr_cur - 1 <= ib ); \
+				none = ( ib + nr_cur - 1 <  ia ); \
+			} \
+			else \
+			{ \
+				full = ( ib + nr_cur - 1 <= ia ); \
+				none = ( ia + mr_cur - 1 <  ib ); \
+			} \
+\
+			if ( none ) continue; \
+\
+			bli_auxinfo_set_next_a( ia + MR < ia1 ? a1 + ps_a : a1, &aux ); \
+			bli_auxinfo_set_next_b( b1, &aux ); \
+\
+			if ( full ) \
+			{ \
+				gemm_ukr \
+				( \
+				  mr_cur, \
+				  nr_cur, \
+				  k, \
+				  minus_one, \
+				  a1, \
+				  b1, \
+				  one, \
+				  c11, rs_c, cs_c, \
+				  &aux, \
+				  cntx  \
+				); \
+			} \
+			else \
+			{ \
+				gemm_ukr \
+				( \
+				  mr_cur, \
+				  nr_cur, \
+				  k, \
+				  minus_one, \
+				  a1, \
+				  b1, \
+				  zero, \
+				  ct, rs_ct, cs_ct, \
+				  &aux, \
+				  cntx  \
+				); \
+\
+				for ( dim_t jj = 0; jj < nr_cur; ++jj ) \
+				for ( dim_t ii = 0; ii < mr_cur; ++ii ) \
+				{ \
+					const bool keep = ( upper ? ia + ii <= ib + jj \
+					                          : ia + ii >= ib + jj ); \
+					if ( keep ) \
+					{ \
+						PASTEMAC(ch,adds)( ct[ ii * rs_ct + jj * cs_ct ], \
+						                   c11[ ii * rs_c + jj * cs_c ] ); \
+					} \
+				} \
+			} \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( chol_upd )
+
+//
+// -- Blocked Cholesky with lookahead (typed interface) ------------------------
+//
+
+// A right-looking blocked algorithm that overwrites the lower triangle of A
+// with L. In each iteration, the trailing part of A is partitioned as
+//
+//   [ A11      ]                 [ D    ]
+//   [ A21  A22 ]    with   A22 = [ E  F ]
+//
+// where A11 and D are nb x nb (and L11 was computed in the previous
+// iteration):
+//
+//   1. All threads compute A21 := A21 L11^-H. Each thread packs its rows of
+//      A21 into the packed format for B (as NR x nb micropanels of A21^T),
+//      solves conj(L11) X = A21^T in place within the packed micropanels
+//      with the gemmtrsm microkernel, which also writes L21 back to A21,
+//      and then packs its rows of conj(L21) into the packed format for A.
+//   2. The chief thread updates D := D - L21 L21^H and factors it (along
+//      with packing the resulting L11 for the next iteration) while the
+//      other threads update E and F. This is the lookahead: the otherwise
+//      serial factorization of the next diagonal block is overlapped with
+//      the bulk of the trailing update. Blocks of rows of E and F are
+//      claimed dynamically, so the chief thread joins in once it is done.
+//
+// Since L21 is packed only once per iteration, the packed micropanels
+// produced by the trsm are consumed directly by the trailing update, and
+// each is shared by all threads. For complex datatypes (and real ones whose
+// storage the microkernel dislikes), the trailing update computes the
+// upper triangle of A22^T = conj(L21) L21^T, so that the packed result of
+// the trsm (L21^T) can be used as is.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTECH2(bao_,ch,varname) \
+     ( \
+             dim_t         m, \
+             void*         a, inc_t rs_a, inc_t cs_a, \
+             chol_state_t* state, \
+             cntx_t*       cntx, \
+             rntm_t*       rntm, \
+             thrinfo_t*    thread  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	/* Query the context for various blocksizes. */ \
+	const dim_t MR     = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx ); \
+	const dim_t NR     = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx ); \
+	const dim_t MC     = bli_cntx_get_blksz_def_dt( dt, BLIS_MC, cntx ); \
+	const dim_t PACKMR = bli_cntx_get_blksz_max_dt( dt, BLIS_MR, cntx ); \
+	const dim_t PACKNR = bli_cntx_get_blksz_max_dt( dt, BLIS_NR, cntx ); \
+	const dim_t NB     = state->nb; \
+\
+	/* Query the context for the kernel addresses and cast them to their
+	   function pointer types. */ \
+	PASTECH(ch,gemmtrsm_ukr_ft) \
+	            gemmtrsm_ukr = bli_cntx_get_ukr_dt( dt, BLIS_GEMMTRSM_L_UKR, cntx ); \
+	PASTECH2(ch,packm_cxk,_ker_ft) \
+	            packm_mr_ker = bli_cntx_get_ukr_dt( dt, BLIS_PACKM_MRXK_KER, cntx ); \
+	PASTECH2(ch,packm_cxk,_ker_ft) \
+	            packm_nr_ker = bli_cntx_get_ukr_dt( dt, BLIS_PACKM_NRXK_KER, cntx ); \
+\
+	/* Decide whether the trailing update computes microtiles of A22 (lower
+	   triangle) or of A22^T (upper triangle); see above. */ \
+	const bool  col_pref = bli_cntx_ukr_prefers_cols_dt( dt, BLIS_GEMM_UKR, cntx ); \
+	const bool  trans_c  = bli_is_complex( dt ) || \
+	                       ( col_pref ? bli_abs( cs_a ) < bli_abs( rs_a ) \
+	                                  : bli_abs( rs_a ) < bli_abs( cs_a ) ); \
+	const inc_t rs_x     = ( trans_c ? cs_a : rs_a ); \
+	const inc_t cs_x     = ( trans_c ? rs_a : cs_a ); \
+	const conj_t conj_ap = ( bli_is_complex( dt ) ? BLIS_CONJUGATE \
+	                                              : BLIS_NO_CONJUGATE ); \
+\
+	ctype* restrict a_cast = a; \
+	ctype* restrict one    = PASTEMAC(ch,1); \
+\
+	/* The diagonal blocks are factored by one thread, so the calls to BLIS
+	   made along the way must be single-threaded. */ \
+	rntm_t rntm_s = BLIS_RNTM_INITIALIZER; \
+	bli_rntm_set_num_threads( 1, &rntm_s ); \
+\
+	/* Acquire a buffer shared by all threads for the packed panel of A
+	   (conj(L21) as MR x nb micropanels), the packed panel of B (L21^T as
+	   nb x NR micropanels), and the packed triangular block L11, each
+	   aligned to a page boundary. */ \
+	const dim_t pg   = BLIS_PAGE_SIZE / sizeof( ctype ); \
+	const dim_t n_ap = ( ( m + MR - 1 ) / MR ) * PACKMR * NB; \
+	const dim_t n_bp = ( ( m + NR - 1 ) / NR ) * PACKNR * NB; \
+	const dim_t n_lp = bao_chol_packm_tri_size( NB, MR, PACKMR ); \
+	const dim_t o_bp = ( ( n_ap + pg - 1 ) / pg ) * pg; \
+	const dim_t o_lp = o_bp + ( ( n_bp + pg - 1 ) / pg ) * pg; \
+\
+	mem_t mem = BLIS_MEM_INITIALIZER; \
+	bao_chol_packm_init_mem( ( o_lp + n_lp ) * sizeof( ctype ), rntm, &mem, thread ); \
+\
+	ctype* restrict ap = ( ctype* )bli_mem_buffer( &mem ); \
+	ctype* restrict bp = ap + o_bp; \
+	ctype* restrict lp = ap + o_lp; \
+\
+	auxinfo_t aux; \
+	bli_auxinfo_set_schema_a( BLIS_PACKED_ROW_PANELS, &aux ); \
+	bli_auxinfo_set_schema_b( BLIS_PACKED_COL_PANELS, &aux ); \
+\
+	/* Each thread solves (and packs) a range of rows of A21 that is a
+	   multiple of both MR and NR, so that no micropanel is shared. */ \
+	const dim_t bf = bli_lcm( MR, NR ); \
+\
+	/* Factor the first diagonal block and pack it. */ \
+	if ( bli_thread_am_ochief( thread ) ) \
+	{ \
+		const dim_t b0 = bli_min( NB, m ); \
+\
+		state->info = PASTECH2(bao_,ch,chol_rec_var1)( b0, a_cast, rs_a, cs_a, \
+		                                               cntx, &rntm_s ); \
+\
+		if ( state->info == 0 && b0 < m ) \
+			PASTECH2(bao_,ch,chol_packm_tri)( b0, MR, PACKMR, \
+			                                  a_cast, rs_a, cs_a, lp ); \
+	} \
+\
+	bli_thread_barrier( thread ); \
+\
+	for ( dim_t j = 0; ; j += NB ) \
+	{ \
+		const dim_t b  = bli_min( NB, m - j ); \
+		const dim_t m2 = m - j - b; \
+\
+		/* Stop once the last diagonal block has been factored, or if some
+		   diagonal block could not be factored. */ \
+		if ( state->info != 0 || m2 == 0 ) break; \
+\
+		ctype* restrict a21 = a_cast + ( j + b ) * rs_a + ( j     ) * cs_a; \
+		ctype* restrict a22 = a_cast + ( j + b ) * rs_a + ( j + b ) * cs_a; \
+\
+		/* Since m2 > 0, b == NB, which is a multiple of both MR and NR. */ \
+		const inc_t ps_a = PACKMR * b; \
+		const inc_t ps_b = PACKNR * b; \
+\
+		/* -- Panel: A21 := A21 L11^-H ------------------------------------- */ \
+\
+		dim_t r_start, r_end; \
+		bli_thread_range_sub( thread, m2, bf, FALSE, &r_start, &r_end ); \
+\
+		for ( dim_t r = r_start; r < r_end; r += NR ) \
+		{ \
+			const dim_t     nr_cur = bli_min( NR, m2 - r ); \
+			ctype* restrict b1     = bp + ( r / NR ) * ps_b; \
+			ctype* restrict c1     = a21 + r * rs_a; \
+			ctype* restrict l1     = lp; \
+\
+			packm_nr_ker \
+			( \
+			  BLIS_NO_CONJUGATE, \
+			  BLIS_PACKED_COL_PANELS, \
+			  nr_cur, \
+			  b, \
+			  b, \
+			  one, \
+			  c1, rs_a, cs_a, \
+			  b1,       PACKNR, \
+			  cntx  \
+			); \
+\
+			/* Solve conj(L11) X = A21^T, one MR x NR block of X at a time,
+			   writing each block of X both to the packed micropanel and
+			   (transposed) to A21. */ \
+			for ( dim_t i = 0; i < b; i += MR ) \
+			{ \
+				inc_t is_l = ( i + MR ) * PACKMR; \
+				is_l += ( bli_is_odd( is_l ) ? 1 : 0 ); \
+\
+				bli_auxinfo_set_next_a( i + MR < b ? l1 + is_l : lp, &aux ); \
+				bli_auxinfo_set_next_b( b1, &aux ); \
+\
+				gemmtrsm_ukr \
+				( \
+				  MR, \
+				  nr_cur, \
+				  i, \
+				  one, \
+				  l1, \
+				  l1 + i * PACKMR, \
+				  b1, \
+				  b1 + i * PACKNR, \
+				  c1 + i * cs_a, cs_a, rs_a, \
+				  &aux, \
+				  cntx  \
+				); \
+\
+				l1 += is_l; \
+			} \
+		} \
+\
+		for ( dim_t r = r_start; r < r_end; r += MR ) \
+		{ \
+			const dim_t mr_cur = bli_min( MR, m2 - r ); \
+\
+			packm_mr_ker \
+			( \
+			  conj_ap, \
+			  BLIS_PACKED_ROW_PANELS, \
+			  mr_cur, \
+			  b, \
+			  b, \
+			  one, \
+			  a21 + r * rs_a, rs_a, cs_a, \
+			  ap + ( r / MR ) * ps_a,   PACKMR, \
+			  cntx  \
+			); \
+		} \
+\
+		if ( bli_thread_am_ochief( thread ) ) state->next = 0; \
+\
+		bli_thread_barrier( thread ); \
+\
+		/* -- Trailing update: A22 := A22 - L21 L21^H ---------------------- */ \
+\
+		const dim_t b2 = bli_min( NB, m2 ); \
+\
+		/* Lookahead: update and factor the next diagonal block, and pack it
+		   for the next iteration. */ \
+		if ( bli_thread_am_ochief( thread ) ) \
+		{ \
+			PASTECH2(bao_,ch,chol_upd) \
+			( \
+			  trans_c, \
+			  0, b2, \
+			  0, b2, \
+			  0, \
+			  m2, \
+			  b, \
+			  ap, ps_a, \
+			  bp, ps_b, \
+			  a22, rs_x, cs_x, \
+			  cntx  \
+			); \
+\
+			const dim_t info = PASTECH2(bao_,ch,chol_rec_var1)( b2, a22, rs_a, cs_a, \
+			                                                    cntx, &rntm_s ); \
+\
+			if ( info != 0 ) \
+				state->info = j + b + info; \
+			else if ( b2 < m2 ) \
+				PASTECH2(bao_,ch,chol_packm_tri)( b2, MR, PACKMR, \
+				                                  a22, rs_a, cs_a, lp ); \
+		} \
+\
+		/* Update the rest of A22 in blocks of MC rows (of the microtiles
+		   computed), claiming the blocks with the most work first. */ \
+		const dim_t n_blk = ( m2 + MC - 1 ) / MC; \
+\
+		while ( TRUE ) \
+		{ \
+			const dim_t t = __atomic_fetch_add( &state->next, 1, __ATOMIC_RELAXED ); \
+\
+			if ( n_blk <= t ) break; \
+\
+			const dim_t i_blk = ( trans_c ? t : n_blk - 1 - t ); \
+			const dim_t ia0   = i_blk * MC; \
+			const dim_t ia1   = bli_min( ia0 + MC, m2 ); \
+\
+			/* Only the microtiles that intersect the referenced triangle
+			   are visited. */ \
+			const dim_t ib0 = ( trans_c ? ( ia0 / NR ) * NR : 0 ); \
+			const dim_t ib1 = ( trans_c ? m2 : bli_min( ( ( ia1 + NR - 1 ) / NR ) * NR, m2 ) ); \
+\
+			PASTECH2(bao_,ch,chol_upd) \
+			( \
+			  trans_c, \
+			  ia0, ia1, \
+			  ib0, ib1, \
+			  b2, \
+			  m2, \
+			  b, \
+			  ap, ps_a, \
+			  bp, ps_b, \
+			  a22, rs_x, cs_x, \
+			  cntx  \
+			); \
+		} \
+\
+		bli_thread_barrier( thread ); \
+	} \
+\
+	/* Release the packing buffer. */ \
+	bao_chol_packm_finalize_mem( rntm, &mem, thread ); \
+}
+
+INSERT_GENTFUNC_BASIC0( chol_la_var1 )
+
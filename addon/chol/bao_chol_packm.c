@@ -0,0 +1,187 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+#include "blis.h"
+
+void bao_chol_packm_init_mem
+     (
+       siz_t      size_needed,
+       rntm_t*    rntm,
+       mem_t*     mem,
+       thrinfo_t* thread
+     )
+{
+	// Acquire a block from the packed block allocator. The acquisition is
+	// done by the chief thread directly into its own passed-in mem_t, which
+	// is then broadcast to the other threads. Since the block holds entire
+	// panels rather than MC x KC blocks, it is requested for general use.
+	if ( bli_thread_am_ochief( thread ) )
+	{
+		bli_pba_acquire_m
+		(
+		  rntm,
+		  size_needed,
+		  BLIS_BUFFER_FOR_GEN_USE,
+		  mem
+		);
+	}
+
+	// Broadcast the address of the chief thread's passed-in mem_t to all
+	// threads.
+	mem_t* mem_p = bli_thread_broadcast( thread, mem );
+
+	// Non-chief threads: Copy the contents of the chief thread's passed-in
+	// mem_t to the passed-in mem_t for this thread.
+	if ( !bli_thread_am_ochief( thread ) )
+	{
+		*mem = *mem_p;
+	}
+}
+
+void bao_chol_packm_finalize_mem
+     (
+       rntm_t*    rntm,
+       mem_t*     mem,
+       thrinfo_t* thread
+     )
+{
+	// Make sure that no thread is still using the block before the chief
+	// thread releases it.
+	bli_thread_barrier( thread );
+
+	if ( bli_thread_am_ochief( thread ) )
+	{
+		if ( bli_mem_is_alloc( mem ) )
+			bli_pba_release( rntm, mem );
+	}
+}
+
+//
+// The triangular block of a panel is packed in the format expected by the
+// lower gemmtrsm microkernel: micropanel i consists of the first (i+1)*mr
+// columns of rows i*mr through (i+1)*mr-1, so that its last mr x mr block
+// is the diagonal block. The size of each micropanel is rounded up to an
+// even number of elements, as in the trsm macrokernels.
+//
+
+dim_t bao_chol_packm_tri_size
+     (
+       dim_t m,
+       dim_t mr,
+       dim_t packmr
+     )
+{
+	dim_t size = 0;
+
+	for ( dim_t i = 0; i < m / mr; ++i )
+	{
+		dim_t is_p = ( i + 1 ) * mr * packmr;
+		size += is_p + ( bli_is_odd( is_p ) ? 1 : 0 );
+	}
+
+	return size;
+}
+
+// Whether the diagonal blocks are inverted when they are packed, which must
+// agree with the trsm microkernels (and the way BLIS packs for trsm).
+#ifdef BLIS_ENABLE_TRSM_PREINVERSION
+static const bool bao_chol_invdiag = TRUE;
+#else
+static const bool bao_chol_invdiag = FALSE;
+#endif
+
+//
+// Pack conj(L), where L is the m x m lower triangular block stored in a
+// (with m a multiple of mr), for solving conj(L) X = B with the lower
+// gemmtrsm microkernel. The strictly upper part of each diagonal block is
+// zeroed and, if trsm preinversion is enabled, the diagonal is inverted.
+// The diagonal of a Cholesky factor is real, so it is not conjugated.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+       dim_t   m, \
+       dim_t   mr, \
+       dim_t   packmr, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  p  \
+     ) \
+{ \
+	for ( dim_t i = 0; i < m / mr; ++i ) \
+	{ \
+		const dim_t k_i  = ( i + 1 ) * mr; \
+		      dim_t is_p = k_i * packmr; \
+\
+		for ( dim_t l = 0; l < k_i; ++l ) \
+		{ \
+			ctype* restrict p_l = p + l * packmr; \
+\
+			for ( dim_t r = 0; r < mr; ++r ) \
+			{ \
+				const dim_t   ir   = i * mr + r; \
+				ctype*        a_rl = a + ir * rs_a + l * cs_a; \
+\
+				if      ( l <  ir ) \
+				{ \
+					PASTEMAC(ch,copyjs)( *a_rl, p_l[ r ] ); \
+				} \
+				else if ( l == ir ) \
+				{ \
+					PASTEMAC(ch,copys)( *a_rl, p_l[ r ] ); \
+					if ( bao_chol_invdiag ) \
+					{ \
+						PASTEMAC(ch,inverts)( p_l[ r ] ); \
+					} \
+				} \
+				else \
+				{ \
+					PASTEMAC(ch,set0s)( p_l[ r ] ); \
+				} \
+			} \
+\
+			for ( dim_t r = mr; r < packmr; ++r ) \
+				PASTEMAC(ch,set0s)( p_l[ r ] ); \
+		} \
+\
+		p += is_p + ( bli_is_odd( is_p ) ? 1 : 0 ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( chol_packm_tri )
+
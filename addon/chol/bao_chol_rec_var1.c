@@ -0,0 +1,171 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+#include "blis.h"
+
+//
+// -- Recursive Cholesky factorization of a diagonal block ---------------------
+//
+
+// The lower triangle of the m x m matrix A is partitioned as
+//
+//   [ A11      ]
+//   [ A21  A22 ]
+//
+// with A11 of order m/2, and overwritten with L according to
+//
+//   A11 := chol( A11 )
+//   A21 := A21 L11^-H
+//   A22 := chol( A22 - A21 A21^H )
+//
+// where the trsm and herk are performed by single-threaded calls to BLIS.
+// This is only used for the (small) diagonal blocks of the blocked
+// algorithm, which are factored by one thread while the others update the
+// trailing matrix.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+dim_t PASTECH2(bao_,ch,varname) \
+     ( \
+       dim_t   m, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	if ( m <= BAO_CHOL_UNB_MAX ) \
+		return PASTECH2(bao_,ch,chol_unb_var1)( m, a, rs_a, cs_a ); \
+\
+	const dim_t m1 = m / 2; \
+	const dim_t m2 = m - m1; \
+\
+	ctype* a11 = a; \
+	ctype* a21 = a + m1 * rs_a; \
+	ctype* a22 = a + m1 * rs_a + m1 * cs_a; \
+\
+	dim_t info = PASTECH2(bao_,ch,varname)( m1, a11, rs_a, cs_a, cntx, rntm ); \
+	if ( info != 0 ) return info; \
+\
+	obj_t l11, a21o, a22o; \
+\
+	bli_obj_create_with_attached_buffer( dt, m1, m1, a11, rs_a, cs_a, &l11 ); \
+	bli_obj_create_with_attached_buffer( dt, m2, m1, a21, rs_a, cs_a, &a21o ); \
+	bli_obj_create_with_attached_buffer( dt, m2, m2, a22, rs_a, cs_a, &a22o ); \
+\
+	bli_obj_set_struc( BLIS_TRIANGULAR, &l11 ); \
+	bli_obj_set_uplo( BLIS_LOWER, &l11 ); \
+	bli_obj_set_conjtrans( BLIS_CONJ_TRANSPOSE, &l11 ); \
+\
+	bli_obj_set_struc( BLIS_HERMITIAN, &a22o ); \
+	bli_obj_set_uplo( BLIS_LOWER, &a22o ); \
+\
+	bli_trsm_ex( BLIS_RIGHT, &BLIS_ONE, &l11, &a21o, cntx, rntm ); \
+\
+	bli_herk_ex( &BLIS_MINUS_ONE, &a21o, &BLIS_ONE, &a22o, cntx, rntm ); \
+\
+	info = PASTECH2(bao_,ch,varname)( m2, a22, rs_a, cs_a, cntx, rntm ); \
+	if ( info != 0 ) return m1 + info; \
+\
+	return 0; \
+}
+
+INSERT_GENTFUNC_BASIC0( chol_rec_var1 )
+
+//
+// -- Unblocked Cholesky factorization -----------------------------------------
+//
+
+// A right-looking algorithm that overwrites the lower triangle of A with L.
+// As with LAPACK, only the real part of each diagonal element is referenced,
+// and the factorization stops at the first diagonal element that is not
+// positive (or is NaN), whose (one-based) index is returned.
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, varname ) \
+\
+dim_t PASTECH2(bao_,ch,varname) \
+     ( \
+       dim_t   m, \
+       ctype*  a, inc_t rs_a, inc_t cs_a  \
+     ) \
+{ \
+	for ( dim_t j = 0; j < m; ++j ) \
+	{ \
+		ctype*  alpha11 = a + j * rs_a + j * cs_a; \
+		ctype_r alpha_r; \
+		ctype_r alpha_i; \
+\
+		PASTEMAC(ch,gets)( *alpha11, alpha_r, alpha_i ); \
+		( void )alpha_i; \
+\
+		if ( !( alpha_r > ( ctype_r )0.0 ) ) \
+			return j + 1; \
+\
+		alpha_r = sqrt( alpha_r ); \
+		PASTEMAC(ch,sets)( alpha_r, 0.0, *alpha11 ); \
+\
+		/* a21 := a21 / alpha11 */ \
+		ctype rho; \
+		PASTEMAC(ch,sets)( 1.0 / alpha_r, 0.0, rho ); \
+\
+		for ( dim_t i = j + 1; i < m; ++i ) \
+		{ \
+			PASTEMAC(ch,scals)( rho, a[ i * rs_a + j * cs_a ] ); \
+		} \
+\
+		/* A22 := A22 - a21 a21^H (lower triangle only) */ \
+		for ( dim_t k = j + 1; k < m; ++k ) \
+		{ \
+			ctype chi; \
+			PASTEMAC(ch,copyjs)( a[ k * rs_a + j * cs_a ], chi ); \
+			PASTEMAC(ch,scals)( *PASTEMAC(ch,m1), chi ); \
+\
+			for ( dim_t i = k; i < m; ++i ) \
+			{ \
+				PASTEMAC(ch,axpys)( chi, a[ i * rs_a + j * cs_a ], \
+				                         a[ i * rs_a + k * cs_a ] ); \
+			} \
+		} \
+	} \
+\
+	return 0; \
+}
+
+INSERT_GENTFUNCR_BASIC0( chol_unb_var1 )
+
@@ -0,0 +1,187 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#include "blis.h"
+
+void bao_conv2d_init
+     (
+       conv2d_layout_t layout,
+       dim_t           n,
+       dim_t           c_in,
+       dim_t           h,
+       dim_t           w,
+       dim_t           c_out,
+       dim_t           kh,
+       dim_t           kw,
+       conv2d_t*       cv
+     )
+{
+	cv->layout = layout;
+	cv->n      = n;
+	cv->c_in   = c_in;
+	cv->h      = h;
+	cv->w      = w;
+	cv->c_out  = c_out;
+	cv->kh     = kh;
+	cv->kw     = kw;
+
+	bao_conv2d_set_stride( 1, 1, cv );
+	bao_conv2d_set_pad( 0, 0, cv );
+	bao_conv2d_set_dilation( 1, 1, cv );
+}
+
+//
+// -- Define the 2D convolution operation's API --------------------------------
+//
+
+void bao_conv2d
+     (
+             num_t     dt,
+       const conv2d_t* cv,
+       const void*     alpha,
+       const void*     x,
+       const void*     w,
+       const void*     beta,
+             void*     y
+     )
+{
+	bao_conv2d_ex
+	(
+	  dt,
+	  cv,
+	  alpha,
+	  x,
+	  w,
+	  beta,
+	  y,
+	  NULL,
+	  NULL
+	);
+}
+
+void bao_conv2d_ex
+     (
+             num_t     dt,
+       const conv2d_t* cv,
+       const void*     alpha,
+       const void*     x,
+       const void*     w,
+       const void*     beta,
+             void*     y,
+       const cntx_t*   cntx,
+             rntm_t*   rntm
+     )
+{
+	bli_init_once();
+
+	// Initialize a local runtime with global settings if necessary. Note
+	// that in the case that a runtime is passed in, we make a local copy.
+	rntm_t rntm_l;
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); rntm = &rntm_l; }
+	else                { rntm_l = *rntm;                       rntm = &rntm_l; }
+
+	// Obtain a valid (native) context from the gks if necessary. Induced
+	// methods are not supported since the packing is done here.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bao_conv2d_check( dt, cv, alpha, x, w, beta, y );
+
+	const dim_t h_out = bao_conv2d_h_out( cv );
+	const dim_t w_out = bao_conv2d_w_out( cv );
+	const dim_t k     = cv->c_in * cv->kh * cv->kw;
+
+	const siz_t dt_size = bli_dt_size( dt );
+
+	// If Y is empty, return early.
+	if ( cv->n == 0 || cv->c_out == 0 || h_out == 0 || w_out == 0 ) return;
+
+	// With the NHWC layout, the pixels of all images form the columns of a
+	// single matrix Y. With the NCHW layout, only the pixels of one image
+	// do, so the images are processed one at a time.
+	const bool  is_nhwc = ( cv->layout == BAO_CONV2D_NHWC );
+	const dim_t n_img   = ( is_nhwc ? 1 : cv->n );
+	const dim_t n_pix   = ( is_nhwc ? cv->n : 1 ) * h_out * w_out;
+
+	inc_t s_n, s_c, s_h, s_w;
+	bao_conv2d_x_strides( cv, &s_n, &s_c, &s_h, &s_w );
+
+	// The packing function sees one batch of n_img images at a time.
+	conv2d_t cv_img = *cv;
+	if ( !is_nhwc ) cv_img.n = 1;
+
+	obj_t alpha_o, beta_o, w_o, x_o, y_o;
+	bli_obj_create_1x1_with_attached_buffer( dt, ( void* )alpha, &alpha_o );
+	bli_obj_create_1x1_with_attached_buffer( dt, ( void* )beta,  &beta_o );
+
+	// W is a c_out x k row-stored matrix in either layout.
+	bli_obj_create_with_attached_buffer( dt, cv->c_out, k, ( void* )w,
+	                                     bli_max( k, 1 ), 1, &w_o );
+
+	// Wrap X in an object representing the k x n_pix im2col matrix. The
+	// object is merely a container for the buffer and the descriptor: its
+	// strides describe a dense matrix and are never used to access elements.
+	// Instead, the custom packing function attached below gathers elements
+	// of X according to the descriptor attached as params.
+	bli_obj_create_without_buffer( dt, k, n_pix, &x_o );
+	bli_obj_set_strides( 1, bli_max( k, 1 ), &x_o );
+	bli_obj_set_pack_fn( bao_conv2d_packm, &x_o );
+	bli_obj_set_pack_params( &cv_img, &x_o );
+
+	// Y is a c_out x n_pix matrix, stored by columns with the NHWC layout
+	// and by rows with the NCHW layout.
+	if ( is_nhwc )
+		bli_obj_create_with_attached_buffer( dt, cv->c_out, n_pix, y,
+		                                     1, cv->c_out, &y_o );
+	else
+		bli_obj_create_with_attached_buffer( dt, cv->c_out, n_pix, y,
+		                                     n_pix, 1, &y_o );
+
+	// The sup code path does not use the packing function attached to the
+	// im2col matrix, so it must be disabled.
+	bli_rntm_disable_l3_sup( rntm );
+
+	for ( dim_t img = 0; img < n_img; ++img )
+	{
+		bli_obj_set_buffer( ( char* )x + img * s_n * dt_size, &x_o );
+		bli_obj_set_buffer( ( char* )y + img * cv->c_out * n_pix * dt_size, &y_o );
+
+		bli_gemm_ex( &alpha_o, &w_o, &x_o, &beta_o, &y_o, cntx, rntm );
+	}
+}
+
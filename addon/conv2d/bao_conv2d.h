@@ -0,0 +1,204 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+//
+// -- 2D convolution definitions -----------------------------------------------
+//
+
+// A 2D convolution (strictly, a cross-correlation, as is conventional)
+//
+//   Y[n,o,y,x] := beta * Y[n,o,y,x] + alpha * sum over c,r,s of
+//                 W[o,c,r,s] * X[n, c, y*stride_h - pad_h + r*dil_h,
+//                                      x*stride_w - pad_w + s*dil_w]
+//
+// (where elements of X outside of its h x w image are taken to be zero) is
+// computed as a gemm in which W is viewed as a c_out x (c_in*kh*kw) matrix
+// and the "im2col" matrix formed from X is viewed as a (c_in*kh*kw) x
+// (n*h_out*w_out) matrix. The im2col matrix is never formed. Instead, a
+// custom packing function gathers the patches of X directly into the
+// micropanels of the packed matrix, and the product is written to Y by the
+// usual gemm macrokernel.
+//
+// The tensors are stored densely in one of two layouts:
+//
+//   layout           X               W                    Y
+//   BAO_CONV2D_NCHW  n x c_in x h x w  c_out x c_in x kh x kw  n x c_out x h_out x w_out
+//   BAO_CONV2D_NHWC  n x h x w x c_in  c_out x kh x kw x c_in  n x h_out x w_out x c_out
+//
+// (with the last index varying fastest). With the NHWC layout, Y is a
+// single matrix and the whole convolution is one gemm. With the NCHW
+// layout, each image of Y is a matrix, so one gemm is performed per image.
+
+typedef enum
+{
+	BAO_CONV2D_NCHW = 0,
+	BAO_CONV2D_NHWC
+} conv2d_layout_t;
+
+typedef struct
+{
+	conv2d_layout_t layout;
+
+	// The batch size and the dimensions of each input image.
+	dim_t n;
+	dim_t c_in;
+	dim_t h;
+	dim_t w;
+
+	// The dimensions of the filter.
+	dim_t c_out;
+	dim_t kh;
+	dim_t kw;
+
+	dim_t stride_h;
+	dim_t stride_w;
+	dim_t pad_h;
+	dim_t pad_w;
+	dim_t dil_h;
+	dim_t dil_w;
+} conv2d_t;
+
+//
+// -- Convolution descriptor query and modification ----------------------------
+//
+
+// Return the height and width of each output image, which are negative if
+// the (dilated) filter does not fit in the (padded) input image.
+
+BLIS_INLINE dim_t bao_conv2d_h_out( const conv2d_t* cv )
+{
+	const dim_t span = cv->dil_h * ( cv->kh - 1 ) + 1;
+	const dim_t room = cv->h + 2 * cv->pad_h - span;
+	return ( room < 0 ? -1 : room / cv->stride_h + 1 );
+}
+
+BLIS_INLINE dim_t bao_conv2d_w_out( const conv2d_t* cv )
+{
+	const dim_t span = cv->dil_w * ( cv->kw - 1 ) + 1;
+	const dim_t room = cv->w + 2 * cv->pad_w - span;
+	return ( room < 0 ? -1 : room / cv->stride_w + 1 );
+}
+
+BLIS_INLINE void bao_conv2d_set_stride( dim_t stride_h, dim_t stride_w, conv2d_t* cv )
+{
+	cv->stride_h = stride_h;
+	cv->stride_w = stride_w;
+}
+
+BLIS_INLINE void bao_conv2d_set_pad( dim_t pad_h, dim_t pad_w, conv2d_t* cv )
+{
+	cv->pad_h = pad_h;
+	cv->pad_w = pad_w;
+}
+
+BLIS_INLINE void bao_conv2d_set_dilation( dim_t dil_h, dim_t dil_w, conv2d_t* cv )
+{
+	cv->dil_h = dil_h;
+	cv->dil_w = dil_w;
+}
+
+// Query the strides of X along its batch, channel, row, and column indices.
+
+BLIS_INLINE void bao_conv2d_x_strides
+     (
+       const conv2d_t* cv,
+             inc_t*    s_n,
+             inc_t*    s_c,
+             inc_t*    s_h,
+             inc_t*    s_w
+     )
+{
+	if ( cv->layout == BAO_CONV2D_NCHW )
+	{
+		*s_w = 1;
+		*s_h = cv->w;
+		*s_c = cv->w * cv->h;
+		*s_n = cv->w * cv->h * cv->c_in;
+	}
+	else
+	{
+		*s_c = 1;
+		*s_w = cv->c_in;
+		*s_h = cv->c_in * cv->w;
+		*s_n = cv->c_in * cv->w * cv->h;
+	}
+}
+
+//
+// -- Prototype the 2D convolution operation's API -----------------------------
+//
+
+// Initialize a convolution descriptor with unit strides and dilations and
+// no padding.
+
+BLIS_EXPORT_ADDON void bao_conv2d_init
+     (
+       conv2d_layout_t layout,
+       dim_t           n,
+       dim_t           c_in,
+       dim_t           h,
+       dim_t           w,
+       dim_t           c_out,
+       dim_t           kh,
+       dim_t           kw,
+       conv2d_t*       cv
+     );
+
+BLIS_EXPORT_ADDON void bao_conv2d
+     (
+             num_t     dt,
+       const conv2d_t* cv,
+       const void*     alpha,
+       const void*     x,
+       const void*     w,
+       const void*     beta,
+             void*     y
+     );
+
+BLIS_EXPORT_ADDON void bao_conv2d_ex
+     (
+             num_t     dt,
+       const conv2d_t* cv,
+       const void*     alpha,
+       const void*     x,
+       const void*     w,
+       const void*     beta,
+             void*     y,
+       const cntx_t*   cntx,
+             rntm_t*   rntm
+     );
+
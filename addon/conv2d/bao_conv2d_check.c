@@ -0,0 +1,101 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#include "blis.h"
+
+void bao_conv2d_check
+     (
+             num_t     dt,
+       const conv2d_t* cv,
+       const void*     alpha,
+       const void*     x,
+       const void*     w,
+       const void*     beta,
+       const void*     y
+     )
+{
+	err_t e_val;
+
+	// Check the datatype.
+
+	e_val = bli_check_floating_datatype( dt );
+	bli_check_error_code( e_val );
+
+	// Check the descriptor, scalars, and tensor buffers (for non-NULLness).
+
+	e_val = bli_check_null_pointer( cv );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_null_pointer( alpha );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_null_pointer( beta );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_null_pointer( x );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_null_pointer( w );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_null_pointer( y );
+	bli_check_error_code( e_val );
+
+	// Check the layout.
+
+	if ( cv->layout != BAO_CONV2D_NCHW && cv->layout != BAO_CONV2D_NHWC )
+		bli_check_error_code( BLIS_NOT_YET_IMPLEMENTED );
+
+	// Check that none of the dimensions are negative, and that the strides
+	// and dilations are positive.
+
+	if ( cv->n  < 0 || cv->c_in  < 0 || cv->h  < 0 || cv->w < 0 ||
+	     cv->c_out < 0 || cv->kh < 0 || cv->kw < 0 ||
+	     cv->pad_h < 0 || cv->pad_w < 0 )
+		bli_check_error_code( BLIS_NEGATIVE_DIMENSION );
+
+	if ( cv->stride_h < 1 || cv->stride_w < 1 ||
+	     cv->dil_h    < 1 || cv->dil_w    < 1 )
+		bli_check_error_code( BLIS_INVALID_DIM_STRIDE_COMBINATION );
+
+	// Check that the (dilated) filter fits in the (padded) input images.
+
+	if ( cv->kh == 0 || cv->kw == 0 ||
+	     bao_conv2d_h_out( cv ) < 0 || bao_conv2d_w_out( cv ) < 0 )
+		bli_check_error_code( BLIS_NONCONFORMAL_DIMENSIONS );
+}
+
@@ -0,0 +1,422 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#include "blis.h"
+
+typedef void (*packm_cxk_fp)
+     (
+             conj_t  conja,
+             pack_t  schema,
+             dim_t   panel_dim,
+             dim_t   panel_len,
+             dim_t   panel_dim_max,
+             dim_t   panel_len_max,
+             void*   kappa,
+             void*   x, dim_t h, dim_t w, inc_t incx,
+             const inc_t* poff, const inc_t* pih, const inc_t* piw,
+             const inc_t* koff, const inc_t* kih, const inc_t* kiw,
+             void*   p, inc_t ldp,
+       const cntx_t* cntx
+     );
+
+// Define a function pointer array named ftypes and initialize its contents
+// with the addresses of the typed functions bao_?conv2d_packm_cxk().
+static packm_cxk_fp GENARRAY_PREF(ftypes,bao_,conv2d_packm_cxk);
+
+// Compute, for output pixels off through off+size-1 (in the order in which
+// they are stored in Y), the row and column of X at which the filter is
+// anchored for each pixel (pih and piw, which may be negative because of
+// padding) and the corresponding offset into X (poff).
+static void bao_conv2d_fill_pixels
+     (
+       const conv2d_t* cv,
+             dim_t     off,
+             dim_t     size,
+             inc_t*    poff,
+             inc_t*    pih,
+             inc_t*    piw
+     )
+{
+	const dim_t h_out = bao_conv2d_h_out( cv );
+	const dim_t w_out = bao_conv2d_w_out( cv );
+
+	inc_t s_n, s_c, s_h, s_w;
+	bao_conv2d_x_strides( cv, &s_n, &s_c, &s_h, &s_w );
+
+	for ( dim_t i = 0; i < size; ++i )
+	{
+		const dim_t pix = off + i;
+		const dim_t ox  = pix % w_out;
+		const dim_t oy  = ( pix / w_out ) % h_out;
+		const dim_t img = pix / ( w_out * h_out );
+
+		pih[ i ]  = oy * cv->stride_h - cv->pad_h;
+		piw[ i ]  = ox * cv->stride_w - cv->pad_w;
+		poff[ i ] = img * s_n + pih[ i ] * s_h + piw[ i ] * s_w;
+	}
+}
+
+// Compute, for filter taps off through off+size-1 (in the order in which
+// they are stored in W), the row and column offsets of the tap relative to
+// the anchor of the filter (kih and kiw) and the corresponding offset into
+// X (koff), which includes the offset of the tap's channel.
+static void bao_conv2d_fill_taps
+     (
+       const conv2d_t* cv,
+             dim_t     off,
+             dim_t     size,
+             inc_t*    koff,
+             inc_t*    kih,
+             inc_t*    kiw
+     )
+{
+	inc_t s_n, s_c, s_h, s_w;
+	bao_conv2d_x_strides( cv, &s_n, &s_c, &s_h, &s_w );
+
+	for ( dim_t j = 0; j < size; ++j )
+	{
+		const dim_t tap = off + j;
+		dim_t       c, r, s;
+
+		if ( cv->layout == BAO_CONV2D_NCHW )
+		{
+			s = tap % cv->kw;
+			r = ( tap / cv->kw ) % cv->kh;
+			c = tap / ( cv->kw * cv->kh );
+		}
+		else
+		{
+			c = tap % cv->c_in;
+			s = ( tap / cv->c_in ) % cv->kw;
+			r = tap / ( cv->c_in * cv->kw );
+		}
+
+		kih[ j ]  = r * cv->dil_h;
+		kiw[ j ]  = s * cv->dil_w;
+		koff[ j ] = c * s_c + kih[ j ] * s_h + kiw[ j ] * s_w;
+	}
+}
+
+void bao_conv2d_packm
+     (
+       const obj_t*     a,
+             obj_t*     p,
+       const cntx_t*    cntx,
+             rntm_t*    rntm,
+             cntl_t*    cntl,
+       const thrinfo_t* thread
+     )
+{
+	// We begin by copying the fields of A.
+	bli_obj_alias_to( a, p );
+
+	num_t   dt           = bli_obj_dt( a );
+	siz_t   dt_size      = bli_dt_size( dt );
+
+	// Extract various fields from the control tree.
+	bszid_t bmult_id_m   = bli_cntl_packm_params_bmid_m( cntl );
+	bszid_t bmult_id_n   = bli_cntl_packm_params_bmid_n( cntl );
+	pack_t  schema       = bli_cntl_packm_params_pack_schema( cntl );
+	dim_t   bmult_m_def  = bli_cntx_get_blksz_def_dt( dt, bmult_id_m, cntx );
+	dim_t   bmult_m_pack = bli_cntx_get_blksz_max_dt( dt, bmult_id_m, cntx );
+	dim_t   bmult_n_def  = bli_cntx_get_blksz_def_dt( dt, bmult_id_n, cntx );
+
+	// Store the pack schema to the object.
+	bli_obj_set_pack_schema( schema, p );
+
+	// Clear the conjugation field from the object since matrix packing
+	// in BLIS is deemed to take care of all conjugation necessary.
+	bli_obj_set_conj( BLIS_NO_CONJUGATE, p );
+
+	// Since we are packing micropanels, mark P as dense.
+	bli_obj_set_uplo( BLIS_DENSE, p );
+
+	// Reset the view offsets to (0,0).
+	bli_obj_set_offs( 0, 0, p );
+
+	// Compute the dimensions padded by the dimension multiples, and save
+	// them into the packed object. (See bli_packm_init() for details.)
+	dim_t   m_p          = bli_obj_length( p );
+	dim_t   n_p          = bli_obj_width( p );
+	dim_t   m_p_pad      = bli_align_dim_to_mult( m_p, bmult_m_def );
+	dim_t   n_p_pad      = bli_align_dim_to_mult( n_p, bmult_n_def );
+
+	bli_obj_set_padded_dims( m_p_pad, n_p_pad, p );
+
+	// Compute the strides of the packed micropanels.
+	inc_t   ldp          = bmult_m_pack;
+	inc_t   ps_p         = ldp * n_p_pad;
+
+	if ( bli_is_odd( ps_p ) ) ps_p += 1;
+
+	// Store the strides and panel dimension in P.
+	bli_obj_set_strides( 1, ldp, p );
+	bli_obj_set_imag_stride( 1, p );
+	bli_obj_set_panel_dim( bmult_m_def, p );
+	bli_obj_set_panel_stride( ps_p, p );
+	bli_obj_set_panel_length( bmult_m_def, p );
+	bli_obj_set_panel_width( n_p, p );
+
+	// Compute the size of the packed buffer.
+	dim_t   n_iter       = m_p_pad / bmult_m_def;
+	siz_t   size_p       = ps_p * n_iter * dt_size;
+
+	if ( size_p == 0 ) return;
+
+	// The pixel and tap offset vectors for the rows and columns of the
+	// current block of the im2col matrix (which is presented here as its
+	// transpose, with one row per output pixel) are stored after the packed
+	// micropanels. Since ps_p is even and dt_size is at least four, no
+	// padding is needed to align them.
+	siz_t   tab_size     = 3 * ( m_p + n_p ) * sizeof( inc_t );
+
+	char*   p_cast       = bli_packm_alloc( size_p + tab_size, rntm, cntl, thread );
+	bli_obj_set_buffer( p_cast, p );
+
+	inc_t*  poff         = ( inc_t* )( p_cast + size_p );
+	inc_t*  pih          = poff + m_p;
+	inc_t*  piw          = pih  + m_p;
+	inc_t*  koff         = piw  + m_p;
+	inc_t*  kih          = koff + n_p;
+	inc_t*  kiw          = kih  + n_p;
+
+	// The offsets into X are computed entirely from the offset vectors, so
+	// we use the buffer at the origin of the image.
+	char*   x_cast       = bli_obj_buffer( a );
+	dim_t   panel_dim_off = bli_obj_row_off( a );
+	dim_t   panel_len_off = bli_obj_col_off( a );
+	conj_t  conja        = bli_obj_conj_status( a );
+
+	const conv2d_t* cv   = bli_obj_pack_params( a );
+
+	inc_t   s_n, s_c, s_h, s_w;
+	bao_conv2d_x_strides( cv, &s_n, &s_c, &s_h, &s_w );
+
+	obj_t   kappa_local;
+	char*   kappa_cast   = bli_packm_scalar( &kappa_local, p );
+
+	packm_cxk_fp f       = ftypes[ dt ];
+
+	// Fill in the offset vectors. This is done by the chief thread only.
+	if ( bli_thread_am_ochief( thread ) )
+	{
+		bao_conv2d_fill_pixels( cv, panel_dim_off, m_p, poff, pih, piw );
+		bao_conv2d_fill_taps( cv, panel_len_off, n_p, koff, kih, kiw );
+	}
+
+	// Wait for the offset vectors to be filled in.
+	bli_thread_barrier( thread );
+
+	// Query the number of threads and thread ids from the current thread's
+	// packm thrinfo_t node.
+	const dim_t nt  = bli_thread_n_way( thread );
+	const dim_t tid = bli_thread_work_id( thread );
+
+	// Suppress warnings in case tid isn't used (ie: as in slab partitioning).
+	( void )nt;
+	( void )tid;
+
+	// Determine the thread range and increment using the current thread's
+	// packm thrinfo_t node.
+	dim_t it_start, it_end, it_inc;
+	bli_thread_range_jrir( thread, n_iter, 1, FALSE, &it_start, &it_end, &it_inc );
+
+	// Iterate over every logical micropanel of the im2col matrix.
+	for ( dim_t ic = 0, it = 0; it < n_iter; ic += bmult_m_def, it += 1 )
+	{
+		if ( bli_packm_my_iter( it, it_start, it_end, tid, nt ) )
+		{
+			dim_t panel_dim_i = bli_min( bmult_m_def, m_p - ic );
+			char* p_begin     = p_cast + it * ps_p * dt_size;
+
+			// If the pixels of the micropanel all lie in the same row of the
+			// same output image (which is the case when the first and last
+			// do), then they are separated by a constant stride in X.
+			inc_t incx = 0;
+			if ( piw[ ic + panel_dim_i - 1 ] - piw[ ic ] ==
+			     ( panel_dim_i - 1 ) * cv->stride_w )
+				incx = cv->stride_w * s_w;
+
+			f
+			(
+			  conja,
+			  schema,
+			  panel_dim_i,
+			  n_p,
+			  bmult_m_def,
+			  n_p_pad,
+			  kappa_cast,
+			  x_cast, cv->h, cv->w, incx,
+			  poff + ic, pih + ic, piw + ic,
+			  koff,      kih,      kiw,
+			  p_begin, ldp,
+			  cntx
+			);
+		}
+	}
+}
+
+//
+// Pack one micropanel of the im2col matrix. If the pixels of the micropanel
+// have a constant stride in X (incx != 0), then each run of taps that also
+// have a constant stride (and lie within the image for every pixel) is
+// packed with the context's packm kernel. Otherwise, elements are gathered
+// individually, with those that fall in the padding set to zero.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+             conj_t  conja, \
+             pack_t  schema, \
+             dim_t   panel_dim, \
+             dim_t   panel_len, \
+             dim_t   panel_dim_max, \
+             dim_t   panel_len_max, \
+             void*   kappa, \
+             void*   x, dim_t h, dim_t w, inc_t incx, \
+             const inc_t* poff, const inc_t* pih, const inc_t* piw, \
+             const inc_t* koff, const inc_t* kih, const inc_t* kiw, \
+             void*   p, inc_t ldp, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	ctype* restrict kappa_cast = kappa; \
+	ctype* restrict x_cast     = x; \
+	ctype* restrict p_cast     = p; \
+\
+	const num_t dt     = PASTEMAC(ch,type); \
+	const ukr_t ker_id = bli_is_col_packed( schema ) ? BLIS_PACKM_NRXK_KER \
+	                                                 : BLIS_PACKM_MRXK_KER; \
+\
+	PASTECH2(ch,packm_cxk,_ker_ft) packm_ker = bli_cntx_get_ukr_dt( dt, ker_id, cntx ); \
+\
+	/* The number of leading columns that have been packed (including any
+	   zero-padding). */ \
+	dim_t j_done = 0; \
+\
+	for ( dim_t j = 0; j < panel_len; ) \
+	{ \
+		/* Find the run of taps [j,j1) in the same filter row whose offsets
+		   (both into X and within the row) have a constant stride. */ \
+		dim_t       j1  = j + 1; \
+		const inc_t lda = ( j1 < panel_len ? koff[ j1 ] - koff[ j ] : 1 ); \
+		const inc_t djw = ( j1 < panel_len ? kiw[ j1 ]  - kiw[ j ]  : 0 ); \
+\
+		while ( j1 < panel_len && kih[ j1 ] == kih[ j ] && \
+		        koff[ j1 ] - koff[ j1 - 1 ] == lda && \
+		        kiw[ j1 ]  - kiw[ j1 - 1 ]  == djw ) \
+			++j1; \
+\
+		const dim_t n_j = j1 - j; \
+\
+		/* Since the anchors of the pixels and the offsets of the taps each
+		   increase monotonically, the run lies within the image for every
+		   pixel if its extreme elements do. */ \
+		const inc_t ih    = pih[ 0 ] + kih[ j ]; \
+		const inc_t iw_lo = piw[ 0 ] + bli_min( kiw[ j ], kiw[ j1 - 1 ] ); \
+		const inc_t iw_hi = piw[ panel_dim - 1 ] + bli_max( kiw[ j ], kiw[ j1 - 1 ] ); \
+\
+		if ( incx != 0 && 0 <= ih && ih < h && 0 <= iw_lo && iw_hi < w ) \
+		{ \
+			/* The last run is also responsible for zero-padding. */ \
+			const dim_t n_max_j = ( j1 == panel_len ? panel_len_max - j : n_j ); \
+\
+			packm_ker \
+			( \
+			  conja, \
+			  schema, \
+			  panel_dim, \
+			  n_j, \
+			  n_max_j, \
+			  kappa, \
+			  x_cast + poff[ 0 ] + koff[ j ], incx, lda, \
+			  p_cast + j * ldp,                 ldp, \
+			  ( cntx_t* )cntx  \
+			); \
+\
+			j_done = j + n_max_j; \
+		} \
+		else \
+		{ \
+			for ( dim_t jj = j; jj < j1; ++jj ) \
+			{ \
+				ctype* restrict p_j = p_cast + jj * ldp; \
+\
+				for ( dim_t i = 0; i < panel_dim; ++i ) \
+				{ \
+					const inc_t ih_i = pih[ i ] + kih[ jj ]; \
+					const inc_t iw_i = piw[ i ] + kiw[ jj ]; \
+\
+					if ( ih_i < 0 || h <= ih_i || iw_i < 0 || w <= iw_i ) \
+					{ \
+						PASTEMAC(ch,set0s)( p_j[ i ] ); \
+					} \
+					else if ( bli_is_conj( conja ) ) \
+					{ \
+						PASTEMAC(ch,scal2js)( *kappa_cast, x_cast[ poff[ i ] + koff[ jj ] ], p_j[ i ] ); \
+					} \
+					else \
+					{ \
+						PASTEMAC(ch,scal2s)( *kappa_cast, x_cast[ poff[ i ] + koff[ jj ] ], p_j[ i ] ); \
+					} \
+				} \
+\
+				for ( dim_t i = panel_dim; i < panel_dim_max; ++i ) \
+					PASTEMAC(ch,set0s)( p_j[ i ] ); \
+			} \
+\
+			j_done = j1; \
+		} \
+\
+		j = j1; \
+	} \
+\
+	/* Zero-pad the far end of the micropanel, if necessary. */ \
+	for ( dim_t j = j_done; j < panel_len_max; ++j ) \
+	{ \
+		ctype* restrict p_j = p_cast + j * ldp; \
+\
+		for ( dim_t i = 0; i < panel_dim_max; ++i ) \
+			PASTEMAC(ch,set0s)( p_j[ i ] ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( conv2d_packm_cxk )
+
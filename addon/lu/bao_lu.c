@@ -0,0 +1,239 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#include "blis.h"
+
+//
+// -- Define the LU blocksize query --------------------------------------------
+//
+
+dim_t bao_lu_nb
+     (
+             num_t   dt,
+       const cntx_t* cntx
+     )
+{
+	const dim_t mr = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx );
+	const dim_t nr = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+	const dim_t kc = bli_cntx_get_blksz_def_dt( dt, BLIS_KC, cntx );
+
+	// Each panel is the k dimension of the trailing update, which performs
+	// best when it is close to KC. Panels must also consist of whole
+	// micropanels of both A and B.
+	const dim_t bf = bli_lcm( mr, nr );
+	const dim_t nb = ( BAO_LU_NB > 0 ? BAO_LU_NB : kc );
+
+	return bli_max( ( nb / bf ) * bf, bf );
+}
+
+//
+// -- Define the LU operation's object API -------------------------------------
+//
+
+dim_t bao_lu
+     (
+       const obj_t*  a,
+             dim_t*  ipiv
+     )
+{
+	return bao_lu_ex
+	(
+	  a,
+	  ipiv,
+	  NULL,
+	  NULL
+	);
+}
+
+dim_t bao_lu_ex
+     (
+       const obj_t*  a,
+             dim_t*  ipiv,
+       const cntx_t* cntx,
+             rntm_t* rntm
+     )
+{
+	bli_init_once();
+
+	// Initialize a local runtime with global settings if necessary. Note
+	// that in the case that a runtime is passed in, we make a local copy.
+	rntm_t rntm_l;
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); rntm = &rntm_l; }
+	else                { rntm_l = *rntm;                       rntm = &rntm_l; }
+
+	// Obtain a valid (native) context from the gks if necessary.
+	// NOTE: This must be done before calling the _check() function, since
+	// that function assumes the context pointer is valid.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bao_lu_check( a, ipiv, cntx );
+
+	// If A has a zero dimension, return early.
+	if ( bli_obj_has_zero_dim( a ) )
+	{
+		return 0;
+	}
+
+	obj_t a_local;
+
+	// Alias A so that any transposition is absorbed into its strides.
+	bli_obj_alias_to( a, &a_local );
+
+	if ( bli_obj_has_trans( &a_local ) )
+	{
+		bli_obj_induce_trans( &a_local );
+		bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, &a_local );
+	}
+
+	// Initialize the state shared by all threads and pass it along with A.
+	lu_state_t state;
+
+	state.nb   = bao_lu_nb( bli_obj_dt( &a_local ), cntx );
+	state.ipiv = ipiv;
+	state.info = 0;
+	state.next = 0;
+
+	bli_obj_set_ker_params( &state, &a_local );
+
+	// Parse and interpret the contents of the rntm_t object to determine
+	// the total number of threads. The threads work as a single team (see
+	// bao_lu_la_var1()), so all of the parallelism is assigned to the
+	// outermost loop, for which the root thrinfo_t nodes are created.
+	const dim_t m = bli_obj_length( &a_local );
+	const dim_t n = bli_obj_width( &a_local );
+
+	bli_rntm_set_ways_for_op
+	(
+	  BLIS_GEMM,
+	  BLIS_LEFT, // ignored for gemm/hemm/symm
+	  m, n, state.nb,
+	  rntm
+	);
+
+	bli_rntm_set_ways_only( bli_rntm_num_threads( rntm ), 1, 1, 1, 1, rntm );
+
+	// Spawn threads (if applicable), where bao_lu_int() is the thread
+	// entry point function for each thread.
+	bli_l3_sup_thread_decorator
+	(
+	  bao_lu_int,
+	  BLIS_GEMM, // operation family id
+	  &BLIS_ONE,
+	  &a_local,
+	  &a_local,
+	  &BLIS_ONE,
+	  &a_local,
+	  cntx,
+	  rntm
+	);
+
+	return state.info;
+}
+
+//
+// -- Define the LU operation's thread entry point -----------------------------
+//
+
+err_t bao_lu_int
+     (
+       const obj_t*     alpha,
+       const obj_t*     a,
+       const obj_t*     b,
+       const obj_t*     beta,
+       const obj_t*     c,
+       const cntx_t*    cntx,
+             rntm_t*    rntm,
+             thrinfo_t* thread
+     )
+{
+	( void )alpha;
+	( void )b;
+	( void )beta;
+	( void )c;
+
+	// There is only one variant: a right-looking blocked algorithm with
+	// lookahead.
+	bao_lu_la_var1
+	(
+	  a,
+	  cntx,
+	  rntm,
+	  thread
+	);
+
+	return BLIS_SUCCESS;
+}
+
+//
+// -- Define the LU operation's typed API --------------------------------------
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+dim_t PASTECH2(bao_,ch,opname) \
+     ( \
+       dim_t   m, \
+       dim_t   n, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       dim_t*  ipiv  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	/* Determine the datatype (e.g. BLIS_FLOAT, BLIS_DOUBLE, etc.) based on
+	   the macro parameter 'ch' (e.g. s, d, etc). */ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	obj_t       ao; \
+\
+	/* Create a bufferless matrix object and attach the provided matrix
+	   pointer to it. */ \
+	bli_obj_create_with_attached_buffer( dt, m, n, a, rs_a, cs_a, &ao ); \
+\
+	/* Call the object interface. */ \
+	return PASTECH(bao_,opname) \
+	( \
+	  &ao, \
+	  ipiv  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC0( lu )
+
@@ -0,0 +1,156 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+//
+// -- LU factorization definitions ---------------------------------------------
+//
+
+// The algorithmic blocksize (the width of each panel) is derived from the
+// context's KC, rounded down to a multiple of both MR and NR so that every
+// panel but the last consists of whole micropanels. A nonzero value
+// overrides the blocksize for all datatypes at compile-time (rounded in the
+// same way).
+#ifndef BAO_LU_NB
+#define BAO_LU_NB          0
+#endif
+
+// Panels are factored recursively, with subpanels this wide or narrower
+// factored by an unblocked algorithm.
+#ifndef BAO_LU_UNB_MAX
+#define BAO_LU_UNB_MAX     8
+#endif
+
+// The maximum width of the blocks of columns into which the trailing
+// update is divided (and which the threads claim dynamically), rounded
+// down to a multiple of NR.
+#ifndef BAO_LU_NW
+#define BAO_LU_NW        256
+#endif
+
+// State shared by all of the threads that cooperate on one factorization.
+// It is passed to the thread entry point along with A.
+typedef struct
+{
+	// The algorithmic blocksize.
+	dim_t  nb;
+
+	// The pivot indices (see bao_lu()).
+	dim_t* ipiv;
+
+	// The (one-based) index of the first exactly zero pivot (or zero if
+	// there is none).
+	dim_t  info;
+
+	// The next unclaimed block of the trailing update in the current
+	// iteration. This counter is incremented atomically.
+	dim_t  next;
+
+} lu_state_t;
+
+//
+// -- Prototype the LU operation's object API ----------------------------------
+//
+
+// Compute the LU factorization with partial pivoting A = P L U of the
+// general m x n matrix A, where P is a permutation matrix, L is unit lower
+// triangular (lower trapezoidal if m > n) and U is upper triangular (upper
+// trapezoidal if m < n). A is overwritten with L and U, without the unit
+// diagonal of L. The permutation is returned in ipiv, which must have room
+// for min(m,n) elements: for i = 0, 1, ..., min(m,n)-1 (in that order),
+// row i was interchanged with row ipiv[i] >= i. (Unlike LAPACK's ?getrf,
+// the pivot indices are zero-based.) The return value is zero on success;
+// otherwise, it is the (one-based) index i of the first diagonal element
+// of U that is exactly zero. As with LAPACK, the factorization is completed
+// in that case, but U is singular.
+
+BLIS_EXPORT_ADDON dim_t bao_lu
+     (
+       const obj_t*  a,
+             dim_t*  ipiv
+     );
+
+BLIS_EXPORT_ADDON dim_t bao_lu_ex
+     (
+       const obj_t*  a,
+             dim_t*  ipiv,
+       const cntx_t* cntx,
+             rntm_t* rntm
+     );
+
+//
+// -- Prototype the LU operation's thread entry point --------------------------
+//
+
+err_t bao_lu_int
+     (
+       const obj_t*     alpha,
+       const obj_t*     a,
+       const obj_t*     b,
+       const obj_t*     beta,
+       const obj_t*     c,
+       const cntx_t*    cntx,
+             rntm_t*    rntm,
+             thrinfo_t* thread
+     );
+
+//
+// -- Prototype the LU blocksize query -----------------------------------------
+//
+
+BLIS_EXPORT_ADDON dim_t bao_lu_nb
+     (
+             num_t   dt,
+       const cntx_t* cntx
+     );
+
+//
+// -- Prototype the LU operation's typed API -----------------------------------
+//
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_ADDON dim_t PASTECH2(bao_,ch,opname) \
+     ( \
+       dim_t   m, \
+       dim_t   n, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       dim_t*  ipiv  \
+     );
+
+INSERT_GENTPROT_BASIC0( lu )
+
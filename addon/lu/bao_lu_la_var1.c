@@ -0,0 +1,518 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#include "blis.h"
+
+#define FUNCPTR_T lu_fp
+
+typedef void (*FUNCPTR_T)
+     (
+             dim_t       m,
+             dim_t       n,
+             void*       a, inc_t rs_a, inc_t cs_a,
+             lu_state_t* state,
+             cntx_t*     cntx,
+             rntm_t*     rntm,
+             thrinfo_t*  thread
+     );
+
+//
+// -- Blocked LU with lookahead (object interface) -----------------------------
+//
+
+// Define a function pointer array named ftypes and initialize its contents with
+// the addresses of the typed functions defined below, bao_?lu_la_var1().
+static FUNCPTR_T GENARRAY_PREF(ftypes,bao_,lu_la_var1);
+
+void bao_lu_la_var1
+     (
+       const obj_t*     a,
+       const cntx_t*    cntx,
+             rntm_t*    rntm,
+             thrinfo_t* thread
+     )
+{
+	const num_t    dt        = bli_obj_dt( a );
+
+	const dim_t    m         = bli_obj_length( a );
+	const dim_t    n         = bli_obj_width( a );
+
+	void* restrict buf_a     = bli_obj_buffer_at_off( a );
+	const inc_t    rs_a      = bli_obj_row_stride( a );
+	const inc_t    cs_a      = bli_obj_col_stride( a );
+
+	// The state shared by all threads is passed in with A.
+	lu_state_t*    state     = bli_obj_ker_params( a );
+
+	// Index into the function pointer array to extract the correct
+	// typed function pointer based on the chosen datatype.
+	FUNCPTR_T f = ftypes[dt];
+
+	// Invoke the function.
+	f
+	(
+	  m,
+	  n,
+	  buf_a, rs_a, cs_a,
+	  state,
+	  ( cntx_t* )cntx,
+	  rntm,
+	  thread
+	);
+}
+
+//
+// -- Trailing update of one block of columns ----------------------------------
+//
+
+// Update the w columns of A starting at a1 (whose row indices are those of
+// A) after the panel with kb pivots starting at row and column j has been
+// factored, given the panel's unit lower triangular block L11 packed in lp
+// and the rows of L21 packed in ap:
+//
+//   1. The panel's row interchanges are applied to the block. Since the
+//      block is narrow, the rows it touches are then still in cache when
+//      the next step packs them.
+//   2. A12 := L11^-1 A12. Each NR-column micropanel of A12 is packed into
+//      the packed format for B, and L11 X = A12 is solved in place within
+//      the packed micropanel with the gemmtrsm microkernel, which also
+//      writes U12 back to A12.
+//   3. A22 := A22 - L21 U12, where the packed micropanels of U12 produced
+//      by the trsm are consumed directly by the gemm microkernel.
+//
+// The packed micropanels of the block (at most NR * kb each) are stored in
+// bp, which is private to the calling thread.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTECH2(bao_,ch,opname) \
+     ( \
+             dim_t    j, \
+             dim_t    kb, \
+             dim_t    m, \
+             dim_t    w, \
+             ctype*   a1, inc_t rs_a, inc_t cs_a, \
+       const dim_t*   ipiv, \
+             ctype*   lp, \
+             ctype*   ap, inc_t ps_a, \
+             ctype*   bp, \
+             cntx_t*  cntx  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	const dim_t MR     = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx ); \
+	const dim_t NR     = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx ); \
+	const dim_t MC     = bli_cntx_get_blksz_def_dt( dt, BLIS_MC, cntx ); \
+	const dim_t PACKMR = bli_cntx_get_blksz_max_dt( dt, BLIS_MR, cntx ); \
+	const dim_t PACKNR = bli_cntx_get_blksz_max_dt( dt, BLIS_NR, cntx ); \
+\
+	PASTECH(ch,gemm_ukr_ft) \
+	            gemm_ukr     = bli_cntx_get_ukr_dt( dt, BLIS_GEMM_UKR, cntx ); \
+	PASTECH(ch,gemmtrsm_ukr_ft) \
+	            gemmtrsm_ukr = bli_cntx_get_ukr_dt( dt, BLIS_GEMMTRSM_L_UKR, cntx ); \
+	PASTECH2(ch,packm_cxk,_ker_ft) \
+	            packm_nr_ker = bli_cntx_get_ukr_dt( dt, BLIS_PACKM_NRXK_KER, cntx ); \
+\
+	ctype* restrict one       = PASTEMAC(ch,1); \
+	ctype* restrict minus_one = PASTEMAC(ch,m1); \
+\
+	/* The last panel's L11 may have been padded (see
+	   bao_?lu_packm_tri()), in which case so is each micropanel of B. */ \
+	const dim_t kb_pad = ( ( kb + MR - 1 ) / MR ) * MR; \
+	const inc_t ps_b   = PACKNR * kb_pad; \
+	const dim_t m2     = m - j - kb; \
+\
+	ctype* restrict a12 = a1 + ( j      ) * rs_a; \
+	ctype* restrict a22 = a1 + ( j + kb ) * rs_a; \
+\
+	auxinfo_t aux; \
+	bli_auxinfo_set_schema_a( BLIS_PACKED_ROW_PANELS, &aux ); \
+	bli_auxinfo_set_schema_b( BLIS_PACKED_COL_PANELS, &aux ); \
+\
+	/* -- Row interchanges ------------------------------------------------- */ \
+\
+	PASTECH2(bao_,ch,lu_swap)( w, a1, rs_a, cs_a, j, j + kb, ipiv ); \
+\
+	/* -- A12 := L11^-1 A12 ------------------------------------------------ */ \
+\
+	for ( dim_t q = 0; q < w; q += NR ) \
+	{ \
+		const dim_t     nr_cur = bli_min( NR, w - q ); \
+		ctype* restrict b1     = bp + ( q / NR ) * ps_b; \
+		ctype* restrict c1     = a12 + q * cs_a; \
+		ctype* restrict l1     = lp; \
+\
+		packm_nr_ker \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  BLIS_PACKED_COL_PANELS, \
+		  nr_cur, \
+		  kb, \
+		  kb_pad, \
+		  one, \
+		  c1, cs_a, rs_a, \
+		  b1,       PACKNR, \
+		  cntx  \
+		); \
+\
+		for ( dim_t i = 0; i < kb_pad; i += MR ) \
+		{ \
+			inc_t is_l = ( i + MR ) * PACKMR; \
+			is_l += ( bli_is_odd( is_l ) ? 1 : 0 ); \
+\
+			bli_auxinfo_set_next_a( i + MR < kb_pad ? l1 + is_l : lp, &aux ); \
+			bli_auxinfo_set_next_b( b1, &aux ); \
+\
+			gemmtrsm_ukr \
+			( \
+			  bli_min( MR, kb - i ), \
+			  nr_cur, \
+			  i, \
+			  one, \
+			  l1, \
+			  l1 + i * PACKMR, \
+			  b1, \
+			  b1 + i * PACKNR, \
+			  c1 + i * rs_a, rs_a, cs_a, \
+			  &aux, \
+			  cntx  \
+			); \
+\
+			l1 += is_l; \
+		} \
+	} \
+\
+	/* -- A22 := A22 - L21 U12 --------------------------------------------- */ \
+\
+	/* Loop over blocks of MC rows, so that the micropanels of A in each
+	   block are reused from the L2 cache across the block of columns. */ \
+	for ( dim_t ic = 0; ic < m2; ic += MC ) \
+	{ \
+		const dim_t ic1 = bli_min( ic + MC, m2 ); \
+\
+		for ( dim_t q = 0; q < w; q += NR ) \
+		{ \
+			const dim_t     nr_cur = bli_min( NR, w - q ); \
+			ctype* restrict b1     = bp + ( q / NR ) * ps_b; \
+\
+			for ( dim_t ir = ic; ir < ic1; ir += MR ) \
+			{ \
+				const dim_t     mr_cur = bli_min( MR, m2 - ir ); \
+				ctype* restrict a1p    = ap + ( ir / MR ) * ps_a; \
+\
+				bli_auxinfo_set_next_a( ir + MR < ic1 ? a1p + ps_a \
+				                                      : ap + ( ic / MR ) * ps_a, &aux ); \
+				bli_auxinfo_set_next_b( ir + MR < ic1 || w <= q + NR ? b1 : b1 + ps_b, &aux ); \
+\
+				gemm_ukr \
+				( \
+				  mr_cur, \
+				  nr_cur, \
+				  kb, \
+				  minus_one, \
+				  a1p, \
+				  b1, \
+				  one, \
+				  a22 + ir * rs_a + q * cs_a, rs_a, cs_a, \
+				  &aux, \
+				  cntx  \
+				); \
+			} \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( lu_upd )
+
+//
+// -- Blocked LU with lookahead (typed interface) ------------------------------
+//
+
+// A right-looking blocked algorithm that overwrites A with L and U. In each
+// iteration, the trailing part of A is partitioned as
+//
+//   [ A11  A12 ]            [ A12 ]   [ B12  C12 ]
+//   [ A21  A22 ]    with    [ A22 ] = [ B22  C22 ]
+//
+// where the panel [ A11; A21 ] is nb wide (and was factored in the previous
+// iteration) and [ B12; B22 ] is the next panel:
+//
+//   1. All threads pack their rows of L21 into the packed format for A.
+//   2. The chief thread updates the next panel (see bao_?lu_upd()) and
+//      factors it (along with packing the resulting L11 for the next
+//      iteration) while the other threads update [ C12; C22 ]. This is the
+//      lookahead: the otherwise serial factorization of the next panel is
+//      overlapped with the bulk of the trailing update. Blocks of columns
+//      are claimed dynamically, so the chief thread joins in once it is
+//      done.
+//
+// There is no separate pass that applies the row interchanges of a panel
+// to the trailing matrix: each block of columns applies them just before
+// packing its rows of A12, so the interchanges are applied in parallel and
+// while the rows are in cache anyway. The interchanges of the later panels
+// are applied to the columns of L (that is, to the left of each panel) in a
+// single pass at the end, which also runs in parallel.
+//
+// Each panel is factored recursively by bao_?lu_rec_var1(). The microtiles
+// of A22 are updated with the same storage as A, since the microkernel
+// supports either (and transposing the update would require U12 to be
+// packed as A rather than B).
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTECH2(bao_,ch,varname) \
+     ( \
+             dim_t       m, \
+             dim_t       n, \
+             void*       a, inc_t rs_a, inc_t cs_a, \
+             lu_state_t* state, \
+             cntx_t*     cntx, \
+             rntm_t*     rntm, \
+             thrinfo_t*  thread  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	/* Query the context for various blocksizes. */ \
+	const dim_t MR     = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx ); \
+	const dim_t NR     = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx ); \
+	const dim_t PACKMR = bli_cntx_get_blksz_max_dt( dt, BLIS_MR, cntx ); \
+	const dim_t PACKNR = bli_cntx_get_blksz_max_dt( dt, BLIS_NR, cntx ); \
+	const dim_t NB     = state->nb; \
+	const dim_t NW     = bli_max( ( BAO_LU_NW / NR ) * NR, NR ); \
+\
+	/* Query the context for the kernel address and cast it to its function
+	   pointer type. */ \
+	PASTECH2(ch,packm_cxk,_ker_ft) \
+	            packm_mr_ker = bli_cntx_get_ukr_dt( dt, BLIS_PACKM_MRXK_KER, cntx ); \
+\
+	ctype* restrict a_cast = a; \
+	dim_t* restrict ipiv   = state->ipiv; \
+	ctype* restrict one    = PASTEMAC(ch,1); \
+\
+	const dim_t     kmin   = bli_min( m, n ); \
+	const dim_t     nt     = bli_thread_n_way( thread ); \
+\
+	/* The panels are factored by one thread, so the calls to BLIS made
+	   along the way must be single-threaded. */ \
+	rntm_t rntm_s = BLIS_RNTM_INITIALIZER; \
+	bli_rntm_set_num_threads( 1, &rntm_s ); \
+\
+	/* Acquire a buffer shared by all threads for the packed panel of A
+	   (L21 as MR x nb micropanels) and two packed triangular blocks L11
+	   (one for the current iteration and one for the next), each aligned
+	   to a page boundary. */ \
+	const dim_t pg   = BLIS_PAGE_SIZE / sizeof( ctype ); \
+	const dim_t n_ap = ( ( m + MR - 1 ) / MR ) * PACKMR * NB; \
+	const dim_t n_lp = bao_lu_packm_tri_size( NB, MR, PACKMR ); \
+	const dim_t o_lp = ( ( n_ap + pg - 1 ) / pg ) * pg; \
+	const dim_t s_lp = ( ( n_lp + pg - 1 ) / pg ) * pg; \
+\
+	mem_t mem = BLIS_MEM_INITIALIZER; \
+	bao_lu_packm_init_mem( ( o_lp + 2 * s_lp ) * sizeof( ctype ), rntm, &mem, thread ); \
+\
+	ctype* restrict ap = ( ctype* )bli_mem_buffer( &mem ); \
+	ctype* restrict lp[ 2 ] = { ap + o_lp, ap + o_lp + s_lp }; \
+\
+	/* Acquire a buffer private to this thread for the packed micropanels
+	   of B (U12 as nb x NR micropanels) of one block of columns, which is
+	   at most max(NW,nb) wide. */ \
+	const dim_t n_bp = ( ( bli_max( NW, NB ) + NR - 1 ) / NR ) * PACKNR * NB; \
+\
+	mem_t mem_b = BLIS_MEM_INITIALIZER; \
+	bli_pba_acquire_m( rntm, n_bp * sizeof( ctype ), BLIS_BUFFER_FOR_GEN_USE, &mem_b ); \
+\
+	ctype* restrict bp = ( ctype* )bli_mem_buffer( &mem_b ); \
+\
+	/* Factor the first panel and pack its L11. */ \
+	if ( bli_thread_am_ochief( thread ) ) \
+	{ \
+		const dim_t b0 = bli_min( NB, n ); \
+		const dim_t k0 = bli_min( b0, m ); \
+\
+		state->info = PASTECH2(bao_,ch,lu_rec_var1)( m, b0, a_cast, rs_a, cs_a, \
+		                                             ipiv, cntx, &rntm_s ); \
+\
+		if ( b0 < n ) \
+			PASTECH2(bao_,ch,lu_packm_tri)( k0, MR, PACKMR, \
+			                                a_cast, rs_a, cs_a, lp[ 0 ] ); \
+	} \
+\
+	bli_thread_barrier( thread ); \
+\
+	for ( dim_t j = 0, it = 0; ; j += NB, ++it ) \
+	{ \
+		const dim_t b  = bli_min( NB, n - j ); \
+		const dim_t kb = bli_min( b, m - j ); \
+		const dim_t m2 = m - j - kb; \
+		const dim_t n2 = n - j - b; \
+\
+		/* Stop once there are no columns right of the panel. */ \
+		if ( n2 == 0 ) break; \
+\
+		ctype* restrict a21 = a_cast + ( j + kb ) * rs_a + j * cs_a; \
+\
+		/* If m2 > 0, then kb == NB, and the trailing update is a gemm with
+		   k == NB. Otherwise, only A12 is updated. */ \
+		const inc_t ps_a = PACKMR * kb; \
+\
+		/* -- Pack L21 ----------------------------------------------------- */ \
+\
+		dim_t r_start, r_end; \
+		bli_thread_range_sub( thread, m2, MR, FALSE, &r_start, &r_end ); \
+\
+		for ( dim_t r = r_start; r < r_end; r += MR ) \
+		{ \
+			const dim_t mr_cur = bli_min( MR, m2 - r ); \
+\
+			packm_mr_ker \
+			( \
+			  BLIS_NO_CONJUGATE, \
+			  BLIS_PACKED_ROW_PANELS, \
+			  mr_cur, \
+			  kb, \
+			  kb, \
+			  one, \
+			  a21 + r * rs_a, rs_a, cs_a, \
+			  ap + ( r / MR ) * ps_a,   PACKMR, \
+			  cntx  \
+			); \
+		} \
+\
+		if ( bli_thread_am_ochief( thread ) ) state->next = 0; \
+\
+		bli_thread_barrier( thread ); \
+\
+		/* -- Trailing update ---------------------------------------------- */ \
+\
+		/* Whether there is a next panel with at least one pivot, which is
+		   then updated and factored as the lookahead. */ \
+		const bool  la = ( j + b < kmin ); \
+		const dim_t b2 = ( la ? bli_min( NB, n2 ) : 0 ); \
+\
+		if ( la && bli_thread_am_ochief( thread ) ) \
+		{ \
+			PASTECH2(bao_,ch,lu_upd) \
+			( \
+			  j, kb, m, b2, \
+			  a_cast + ( j + b ) * cs_a, rs_a, cs_a, \
+			  ipiv, \
+			  lp[ it % 2 ], \
+			  ap, ps_a, \
+			  bp, \
+			  cntx  \
+			); \
+\
+			const dim_t j2   = j + b; \
+			const dim_t k2   = bli_min( b2, m - j2 ); \
+			ctype*      a_2  = a_cast + j2 * rs_a + j2 * cs_a; \
+			const dim_t info = PASTECH2(bao_,ch,lu_rec_var1)( m - j2, b2, a_2, rs_a, cs_a, \
+			                                                  ipiv + j2, cntx, &rntm_s ); \
+\
+			for ( dim_t i = j2; i < j2 + k2; ++i ) \
+				ipiv[ i ] += j2; \
+\
+			if ( state->info == 0 && info != 0 ) \
+				state->info = j2 + info; \
+\
+			if ( b2 < n2 ) \
+				PASTECH2(bao_,ch,lu_packm_tri)( k2, MR, PACKMR, \
+				                                a_2, rs_a, cs_a, lp[ ( it + 1 ) % 2 ] ); \
+		} \
+\
+		/* Update the rest of the columns in blocks of at most NW columns,
+		   but small enough that each thread gets at least one block. */ \
+		const dim_t c0    = j + b + b2; \
+		const dim_t nc    = n - c0; \
+		const dim_t nw    = bli_min( NW, bli_max( ( ( nc + nt - 1 ) / nt + NR - 1 ) / NR * NR, NR ) ); \
+		const dim_t n_blk = ( nc + nw - 1 ) / nw; \
+\
+		while ( TRUE ) \
+		{ \
+			const dim_t t = __atomic_fetch_add( &state->next, 1, __ATOMIC_RELAXED ); \
+\
+			if ( n_blk <= t ) break; \
+\
+			const dim_t c = c0 + t * nw; \
+\
+			PASTECH2(bao_,ch,lu_upd) \
+			( \
+			  j, kb, m, bli_min( nw, n - c ), \
+			  a_cast + c * cs_a, rs_a, cs_a, \
+			  ipiv, \
+			  lp[ it % 2 ], \
+			  ap, ps_a, \
+			  bp, \
+			  cntx  \
+			); \
+		} \
+\
+		bli_thread_barrier( thread ); \
+\
+		if ( !la ) break; \
+	} \
+\
+	/* -- Row interchanges left of each panel ------------------------------ */ \
+\
+	/* The columns of each panel but the last are subject to the row
+	   interchanges of all later panels. Since NB is a multiple of NR, each
+	   block of NR columns lies within one panel. */ \
+	const dim_t nl = ( kmin > 0 ? ( ( kmin - 1 ) / NB ) * NB : 0 ); \
+\
+	dim_t c_start, c_end; \
+	bli_thread_range_sub( thread, nl, NR, FALSE, &c_start, &c_end ); \
+\
+	for ( dim_t c = c_start; c < c_end; c += NR ) \
+	{ \
+		const dim_t j_p = ( c / NB ) * NB; \
+\
+		PASTECH2(bao_,ch,lu_swap)( bli_min( NR, c_end - c ), \
+		                           a_cast + c * cs_a, rs_a, cs_a, \
+		                           j_p + NB, kmin, ipiv ); \
+	} \
+\
+	/* Release the packing buffers. */ \
+	bli_pba_release( rntm, &mem_b ); \
+\
+	bao_lu_packm_finalize_mem( rntm, &mem, thread ); \
+}
+
+INSERT_GENTFUNC_BASIC0( lu_la_var1 )
+
@@ -0,0 +1,216 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#include "blis.h"
+
+void bao_lu_packm_init_mem
+     (
+       siz_t      size_needed,
+       rntm_t*    rntm,
+       mem_t*     mem,
+       thrinfo_t* thread
+     )
+{
+	// Acquire a block from the packed block allocator. The acquisition is
+	// done by the chief thread directly into its own passed-in mem_t, which
+	// is then broadcast to the other threads. Since the block holds entire
+	// panels rather than MC x KC blocks, it is requested for general use.
+	if ( bli_thread_am_ochief( thread ) )
+	{
+		bli_pba_acquire_m
+		(
+		  rntm,
+		  size_needed,
+		  BLIS_BUFFER_FOR_GEN_USE,
+		  mem
+		);
+	}
+
+	// Broadcast the address of the chief thread's passed-in mem_t to all
+	// threads.
+	mem_t* mem_p = bli_thread_broadcast( thread, mem );
+
+	// Non-chief threads: Copy the contents of the chief thread's passed-in
+	// mem_t to the passed-in mem_t for this thread.
+	if ( !bli_thread_am_ochief( thread ) )
+	{
+		*mem = *mem_p;
+	}
+}
+
+void bao_lu_packm_finalize_mem
+     (
+       rntm_t*    rntm,
+       mem_t*     mem,
+       thrinfo_t* thread
+     )
+{
+	// Make sure that no thread is still using the block before the chief
+	// thread releases it.
+	bli_thread_barrier( thread );
+
+	if ( bli_thread_am_ochief( thread ) )
+	{
+		if ( bli_mem_is_alloc( mem ) )
+			bli_pba_release( rntm, mem );
+	}
+}
+
+//
+// The triangular block of a panel is packed in the format expected by the
+// lower gemmtrsm microkernel: micropanel i consists of the first (i+1)*mr
+// columns of rows i*mr through (i+1)*mr-1, so that its last mr x mr block
+// is the diagonal block. The size of each micropanel is rounded up to an
+// even number of elements, as in the trsm macrokernels. If the order of
+// the block is not a multiple of mr, the block is padded to the next
+// multiple with an identity block, as BLIS does when packing for trsm.
+//
+
+dim_t bao_lu_packm_tri_size
+     (
+       dim_t m,
+       dim_t mr,
+       dim_t packmr
+     )
+{
+	dim_t size = 0;
+
+	for ( dim_t i = 0; i < ( m + mr - 1 ) / mr; ++i )
+	{
+		dim_t is_p = ( i + 1 ) * mr * packmr;
+		size += is_p + ( bli_is_odd( is_p ) ? 1 : 0 );
+	}
+
+	return size;
+}
+
+//
+// Pack the unit lower triangular m x m block L whose strictly lower part is
+// stored in a, for solving L X = B with the lower gemmtrsm microkernel. The
+// diagonal is set to one (which is its own inverse, so trsm preinversion
+// does not matter) and the strictly upper part of each diagonal block is
+// zeroed.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+       dim_t   m, \
+       dim_t   mr, \
+       dim_t   packmr, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  p  \
+     ) \
+{ \
+	for ( dim_t i = 0; i < ( m + mr - 1 ) / mr; ++i ) \
+	{ \
+		const dim_t k_i  = ( i + 1 ) * mr; \
+		      dim_t is_p = k_i * packmr; \
+\
+		for ( dim_t l = 0; l < k_i; ++l ) \
+		{ \
+			ctype* restrict p_l = p + l * packmr; \
+\
+			for ( dim_t r = 0; r < mr; ++r ) \
+			{ \
+				const dim_t ir = i * mr + r; \
+\
+				if      ( l == ir ) \
+				{ \
+					PASTEMAC(ch,set1s)( p_l[ r ] ); \
+				} \
+				else if ( l < ir && ir < m ) \
+				{ \
+					PASTEMAC(ch,copys)( a[ ir * rs_a + l * cs_a ], p_l[ r ] ); \
+				} \
+				else \
+				{ \
+					PASTEMAC(ch,set0s)( p_l[ r ] ); \
+				} \
+			} \
+\
+			for ( dim_t r = mr; r < packmr; ++r ) \
+				PASTEMAC(ch,set0s)( p_l[ r ] ); \
+		} \
+\
+		p += is_p + ( bli_is_odd( is_p ) ? 1 : 0 ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( lu_packm_tri )
+
+//
+// Apply the row interchanges i0 through i1-1 recorded in ipiv, in order, to
+// the n columns of a: for i = i0, ..., i1-1, row i is interchanged with row
+// ipiv[i]. (The row indices are relative to a.)
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+             dim_t  n, \
+             ctype* a, inc_t rs_a, inc_t cs_a, \
+             dim_t  i0, \
+             dim_t  i1, \
+       const dim_t* ipiv  \
+     ) \
+{ \
+	for ( dim_t i = i0; i < i1; ++i ) \
+	{ \
+		const dim_t p = ipiv[ i ]; \
+\
+		if ( p == i ) continue; \
+\
+		ctype* restrict a_i = a + i * rs_a; \
+		ctype* restrict a_p = a + p * rs_a; \
+\
+		for ( dim_t j = 0; j < n; ++j ) \
+		{ \
+			ctype t; \
+			PASTEMAC(ch,copys)( a_i[ j * cs_a ], t ); \
+			PASTEMAC(ch,copys)( a_p[ j * cs_a ], a_i[ j * cs_a ] ); \
+			PASTEMAC(ch,copys)( t, a_p[ j * cs_a ] ); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( lu_swap )
+
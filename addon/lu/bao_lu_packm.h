@@ -0,0 +1,101 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+//
+// Prototype the shared packing buffer management functions.
+//
+
+void bao_lu_packm_init_mem
+     (
+       siz_t      size_needed,
+       rntm_t*    rntm,
+       mem_t*     mem,
+       thrinfo_t* thread
+     );
+
+void bao_lu_packm_finalize_mem
+     (
+       rntm_t*    rntm,
+       mem_t*     mem,
+       thrinfo_t* thread
+     );
+
+
+//
+// Prototype the packing function for the triangular (diagonal) blocks.
+//
+
+dim_t bao_lu_packm_tri_size
+     (
+       dim_t m,
+       dim_t mr,
+       dim_t packmr
+     );
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+       dim_t   m, \
+       dim_t   mr, \
+       dim_t   packmr, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  p  \
+     );
+
+INSERT_GENTPROT_BASIC0( lu_packm_tri )
+
+
+//
+// Prototype the row interchange function.
+//
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+             dim_t  n, \
+             ctype* a, inc_t rs_a, inc_t cs_a, \
+             dim_t  i0, \
+             dim_t  i1, \
+       const dim_t* ipiv  \
+     );
+
+INSERT_GENTPROT_BASIC0( lu_swap )
+
@@ -0,0 +1,215 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#include "blis.h"
+
+//
+// -- Recursive LU factorization of a panel ------------------------------------
+//
+
+// The m x n panel A is partitioned as
+//
+//   [ A11  A12 ]
+//   [ A21  A22 ]
+//
+// with A11 n1 x n1, where n1 = min(m,n)/2, and factored according to
+//
+//   [ A11 ]      [ L11 ]
+//   [ A21 ] := P [ L21 ] U11    (recursively)
+//
+//   [ A12 ]        [ A12 ]
+//   [ A22 ] := P^T [ A22 ]
+//
+//   A12 := L11^-1 A12
+//   A22 := P2 L22 U22 = A22 - L21 A12    (recursively)
+//   A21 := P2^T A21
+//
+// where the trsm and gemm are performed by single-threaded calls to BLIS, so
+// that all but the narrowest subpanels are factored with the gemm
+// microkernel (as with LAPACK's ?getrf2). This is only used for the panels
+// of the blocked algorithm, which are factored by one thread while the
+// others update the trailing matrix. The pivot indices written to ipiv are
+// relative to a.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+dim_t PASTECH2(bao_,ch,varname) \
+     ( \
+       dim_t   m, \
+       dim_t   n, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       dim_t*  ipiv, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	if ( n <= BAO_LU_UNB_MAX || m <= 1 ) \
+		return PASTECH2(bao_,ch,lu_unb_var1)( m, n, a, rs_a, cs_a, ipiv ); \
+\
+	const dim_t n1 = bli_min( m, n ) / 2; \
+	const dim_t n2 = n - n1; \
+	const dim_t m2 = m - n1; \
+	const dim_t k2 = bli_min( m2, n2 ); \
+\
+	ctype* a11 = a; \
+	ctype* a12 = a + n1 * cs_a; \
+	ctype* a21 = a + n1 * rs_a; \
+	ctype* a22 = a + n1 * rs_a + n1 * cs_a; \
+\
+	dim_t info = PASTECH2(bao_,ch,varname)( m, n1, a11, rs_a, cs_a, ipiv, cntx, rntm ); \
+\
+	PASTECH2(bao_,ch,lu_swap)( n2, a12, rs_a, cs_a, 0, n1, ipiv ); \
+\
+	obj_t l11, a12o, a21o, a22o; \
+\
+	bli_obj_create_with_attached_buffer( dt, n1, n1, a11, rs_a, cs_a, &l11 ); \
+	bli_obj_create_with_attached_buffer( dt, n1, n2, a12, rs_a, cs_a, &a12o ); \
+	bli_obj_create_with_attached_buffer( dt, m2, n1, a21, rs_a, cs_a, &a21o ); \
+	bli_obj_create_with_attached_buffer( dt, m2, n2, a22, rs_a, cs_a, &a22o ); \
+\
+	bli_obj_set_struc( BLIS_TRIANGULAR, &l11 ); \
+	bli_obj_set_uplo( BLIS_LOWER, &l11 ); \
+	bli_obj_set_diag( BLIS_UNIT_DIAG, &l11 ); \
+\
+	bli_trsm_ex( BLIS_LEFT, &BLIS_ONE, &l11, &a12o, cntx, rntm ); \
+\
+	bli_gemm_ex( &BLIS_MINUS_ONE, &a21o, &a12o, &BLIS_ONE, &a22o, cntx, rntm ); \
+\
+	const dim_t info2 = PASTECH2(bao_,ch,varname)( m2, n2, a22, rs_a, cs_a, \
+	                                               ipiv + n1, cntx, rntm ); \
+\
+	for ( dim_t i = n1; i < n1 + k2; ++i ) \
+		ipiv[ i ] += n1; \
+\
+	PASTECH2(bao_,ch,lu_swap)( n1, a, rs_a, cs_a, n1, n1 + k2, ipiv ); \
+\
+	if ( info == 0 && info2 != 0 ) info = n1 + info2; \
+\
+	return info; \
+}
+
+INSERT_GENTFUNC_BASIC0( lu_rec_var1 )
+
+//
+// -- Unblocked LU factorization -----------------------------------------------
+//
+
+// A right-looking algorithm that overwrites A with L and U, choosing as the
+// pivot of each column the element of largest magnitude on or below the
+// diagonal, where (as with LAPACK) the magnitude of a complex element is
+// the sum of the absolute values of its real and imaginary parts. An
+// exactly zero pivot is skipped, and its (one-based) index is returned if
+// it is the first.
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, varname ) \
+\
+dim_t PASTECH2(bao_,ch,varname) \
+     ( \
+       dim_t   m, \
+       dim_t   n, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       dim_t*  ipiv  \
+     ) \
+{ \
+	const dim_t mn   = bli_min( m, n ); \
+	      dim_t info = 0; \
+\
+	for ( dim_t j = 0; j < mn; ++j ) \
+	{ \
+		/* Find the pivot. */ \
+		dim_t   p     = j; \
+		ctype_r abs_p = -1.0; \
+\
+		for ( dim_t i = j; i < m; ++i ) \
+		{ \
+			ctype_r chi_r; \
+			ctype_r chi_i; \
+\
+			PASTEMAC(ch,gets)( a[ i * rs_a + j * cs_a ], chi_r, chi_i ); \
+\
+			const ctype_r abs_i = bli_fabs( chi_r ) + bli_fabs( chi_i ); \
+\
+			if ( abs_p < abs_i ) { p = i; abs_p = abs_i; } \
+		} \
+\
+		ipiv[ j ] = p; \
+\
+		ctype* alpha11 = a + j * rs_a + j * cs_a; \
+\
+		if ( !PASTEMAC(ch,eq0)( a[ p * rs_a + j * cs_a ] ) ) \
+		{ \
+			PASTECH2(bao_,ch,lu_swap)( n, a, rs_a, cs_a, j, j + 1, ipiv ); \
+\
+			/* a21 := a21 / alpha11 */ \
+			ctype rho; \
+			PASTEMAC(ch,copys)( *alpha11, rho ); \
+			PASTEMAC(ch,inverts)( rho ); \
+\
+			for ( dim_t i = j + 1; i < m; ++i ) \
+			{ \
+				PASTEMAC(ch,scals)( rho, a[ i * rs_a + j * cs_a ] ); \
+			} \
+		} \
+		else if ( info == 0 ) \
+		{ \
+			info = j + 1; \
+		} \
+\
+		/* A22 := A22 - a21 a12 */ \
+		for ( dim_t k = j + 1; k < n; ++k ) \
+		{ \
+			ctype chi; \
+			PASTEMAC(ch,copys)( a[ j * rs_a + k * cs_a ], chi ); \
+			PASTEMAC(ch,scals)( *PASTEMAC(ch,m1), chi ); \
+\
+			for ( dim_t i = j + 1; i < m; ++i ) \
+			{ \
+				PASTEMAC(ch,axpys)( chi, a[ i * rs_a + j * cs_a ], \
+				                         a[ i * rs_a + k * cs_a ] ); \
+			} \
+		} \
+	} \
+\
+	return info; \
+}
+
+INSERT_GENTFUNCR_BASIC0( lu_unb_var1 )
+
@@ -0,0 +1,320 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#include "blis.h"
+
+//
+// -- Define the multiple gemm operation's object API --------------------------
+//
+
+void bao_mgemm
+     (
+             dim_t   nb,
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c
+     )
+{
+	bao_mgemm_ex
+	(
+	  nb,
+	  alpha,
+	  a,
+	  b,
+	  beta,
+	  c,
+	  NULL,
+	  NULL
+	);
+}
+
+void bao_mgemm_ex
+     (
+             dim_t   nb,
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c,
+       const cntx_t* cntx,
+             rntm_t* rntm
+     )
+{
+	bli_init_once();
+
+	// Initialize a local runtime with global settings if necessary. Note
+	// that in the case that a runtime is passed in, we make a local copy.
+	rntm_t rntm_l;
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); rntm = &rntm_l; }
+	else                { rntm_l = *rntm;                       rntm = &rntm_l; }
+
+	// Obtain a valid (native) context from the gks if necessary.
+	// NOTE: This must be done before calling the _check() function, since
+	// that function assumes the context pointer is valid.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bao_mgemm_check( nb, alpha, a, b, beta, c, cntx );
+
+	const num_t dt = bli_obj_dt( a );
+	const dim_t m  = bli_obj_length_after_trans( a );
+	const dim_t k  = bli_obj_width_after_trans( a );
+
+	// If there are no operands, or if the C_i have no rows, return early.
+	if ( nb == 0 || m == 0 )
+	{
+		return;
+	}
+
+	// If A has no columns, scale each C_i by beta_i and return.
+	if ( k == 0 )
+	{
+		for ( dim_t i = 0; i < nb; ++i )
+			bli_scalm( &beta[ i ], &c[ i ] );
+		return;
+	}
+
+	// Make local copies of the operands so that any transpositions may be
+	// induced, and so that the scalars may be cast to the datatype of A.
+	err_t  r_val;
+	obj_t* ops     = bli_malloc_intl( 4 * nb * sizeof( obj_t ), &r_val );
+	obj_t* alpha_l = ops;
+	obj_t* b_l     = ops + nb;
+	obj_t* beta_l  = ops + 2 * nb;
+	obj_t* c_l     = ops + 3 * nb;
+
+	obj_t  a_local;
+
+	bli_obj_alias_to( a, &a_local );
+
+	if ( bli_obj_has_trans( &a_local ) )
+	{
+		bli_obj_induce_trans( &a_local );
+		bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, &a_local );
+	}
+
+	dim_t n_tot = 0;
+
+	for ( dim_t i = 0; i < nb; ++i )
+	{
+		bli_obj_scalar_init_detached_copy_of( dt, BLIS_NO_CONJUGATE, &alpha[ i ], &alpha_l[ i ] );
+		bli_obj_scalar_init_detached_copy_of( dt, BLIS_NO_CONJUGATE, &beta[ i ],  &beta_l[ i ] );
+
+		bli_obj_alias_to( &b[ i ], &b_l[ i ] );
+		bli_obj_alias_to( &c[ i ], &c_l[ i ] );
+
+		if ( bli_obj_has_trans( &b_l[ i ] ) )
+		{
+			bli_obj_induce_trans( &b_l[ i ] );
+			bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, &b_l[ i ] );
+		}
+		if ( bli_obj_has_trans( &c_l[ i ] ) )
+		{
+			bli_obj_induce_trans( &c_l[ i ] );
+			bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, &c_l[ i ] );
+		}
+
+		n_tot += bli_obj_width( &c_l[ i ] );
+	}
+
+	// Parse and interpret the contents of the rntm_t object to determine
+	// the total number of threads. The threads share the work for each
+	// block of A (see bao_mgemm_var1()), so all of the parallelism is
+	// assigned to the outermost loop, for which the root thrinfo_t nodes
+	// are created.
+	bli_rntm_set_ways_for_op
+	(
+	  BLIS_GEMM,
+	  BLIS_LEFT, // ignored for gemm/hemm/symm
+	  m, n_tot, k,
+	  rntm
+	);
+
+	const dim_t nt = bli_rntm_num_threads( rntm );
+
+	bli_rntm_set_ways_only( nt, 1, 1, 1, 1, rntm );
+
+	// Choose the width of the chunks of the B_i: at most NC, but small
+	// enough that (if possible) every thread has a chunk.
+	const dim_t NR = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+	const dim_t NC = bli_cntx_get_blksz_def_dt( dt, BLIS_NC, cntx );
+
+	mgemm_state_t state;
+
+	state.nb    = nb;
+	state.alpha = alpha_l;
+	state.b     = b_l;
+	state.beta  = beta_l;
+	state.c     = c_l;
+	state.ncu   = bli_min( bli_align_dim_to_mult( ( n_tot + nt - 1 ) / nt, NR ),
+	                       bli_max( NC, NR ) );
+
+	// Pass the state along with A.
+	bli_obj_set_ker_params( &state, &a_local );
+
+	// Spawn threads (if applicable), where bao_mgemm_int() is the thread
+	// entry point function for each thread.
+	bli_l3_sup_thread_decorator
+	(
+	  bao_mgemm_int,
+	  BLIS_GEMM, // operation family id
+	  &alpha_l[ 0 ],
+	  &a_local,
+	  &b_l[ 0 ],
+	  &beta_l[ 0 ],
+	  &c_l[ 0 ],
+	  cntx,
+	  rntm
+	);
+
+	bli_free_intl( ops );
+}
+
+//
+// -- Define the multiple gemm operation's thread entry point ------------------
+//
+
+err_t bao_mgemm_int
+     (
+       const obj_t*     alpha,
+       const obj_t*     a,
+       const obj_t*     b,
+       const obj_t*     beta,
+       const obj_t*     c,
+       const cntx_t*    cntx,
+             rntm_t*    rntm,
+             thrinfo_t* thread
+     )
+{
+	// There is only one variant.
+	bao_mgemm_var1
+	(
+	  alpha,
+	  a,
+	  b,
+	  beta,
+	  c,
+	  cntx,
+	  rntm,
+	  thread
+	);
+
+	return BLIS_SUCCESS;
+}
+
+//
+// -- Define the multiple gemm operation's typed API ---------------------------
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+             trans_t transa, \
+             trans_t transb, \
+             dim_t   nb, \
+             dim_t   m, \
+       const dim_t*  n, \
+             dim_t   k, \
+       const ctype*  alpha, \
+             ctype*  a, inc_t rs_a, inc_t cs_a, \
+             ctype** b, const inc_t* rs_b, const inc_t* cs_b, \
+       const ctype*  beta, \
+             ctype** c, const inc_t* rs_c, const inc_t* cs_c  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	/* Determine the datatype (e.g. BLIS_FLOAT, BLIS_DOUBLE, etc.) based on
+	   the macro parameter 'ch' (e.g. s, d, etc). */ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	obj_t       ao; \
+	err_t       r_val; \
+\
+	if ( nb <= 0 ) return; \
+\
+	obj_t* ops    = bli_malloc_intl( 4 * nb * sizeof( obj_t ), &r_val ); \
+	obj_t* alphao = ops; \
+	obj_t* bo     = ops + nb; \
+	obj_t* betao  = ops + 2 * nb; \
+	obj_t* co     = ops + 3 * nb; \
+\
+	dim_t m_a, n_a; \
+	bli_set_dims_with_trans( transa, m, k, &m_a, &n_a ); \
+\
+	/* Create bufferless matrix objects and attach the provided matrix
+	   pointers to them. */ \
+	bli_obj_create_with_attached_buffer( dt, m_a, n_a, a, rs_a, cs_a, &ao ); \
+	bli_obj_set_conjtrans( transa, &ao ); \
+\
+	for ( dim_t i = 0; i < nb; ++i ) \
+	{ \
+		dim_t m_b, n_b; \
+		bli_set_dims_with_trans( transb, k, n[ i ], &m_b, &n_b ); \
+\
+		/* Create bufferless scalar objects and attach the provided scalar
+		   pointers to them. */ \
+		bli_obj_create_1x1_with_attached_buffer( dt, ( ctype* )&alpha[ i ], &alphao[ i ] ); \
+		bli_obj_create_1x1_with_attached_buffer( dt, ( ctype* )&beta[ i ],  &betao[ i ] ); \
+\
+		bli_obj_create_with_attached_buffer( dt, m_b, n_b, b[ i ], rs_b[ i ], cs_b[ i ], &bo[ i ] ); \
+		bli_obj_create_with_attached_buffer( dt, m, n[ i ], c[ i ], rs_c[ i ], cs_c[ i ], &co[ i ] ); \
+\
+		bli_obj_set_conjtrans( transb, &bo[ i ] ); \
+	} \
+\
+	/* Call the object interface. */ \
+	bao_mgemm \
+	( \
+	  nb, \
+	  alphao, \
+	  &ao, \
+	  bo, \
+	  betao, \
+	  co  \
+	); \
+\
+	bli_free_intl( ops ); \
+}
+
+INSERT_GENTFUNC_BASIC0( mgemm )
+
@@ -0,0 +1,150 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+//
+// -- Shared-A multiple gemm definitions ---------------------------------------
+//
+
+// The multiple gemm operation
+//
+//   C_i := beta_i C_i + alpha_i A B_i,  i = 0, ..., nb-1
+//
+// multiplies one matrix A by several matrices B_i (whose widths may
+// differ). Rather than packing A once for each B_i (as separate calls to
+// bli_gemm() would), each block of A (at most KC columns and about NC
+// rows) is packed once, by all of the threads together, and then applied
+// to every B_i before the next block of A is packed. The threads share the
+// work of each block of A over all of the B_i: the columns of each B_i are
+// divided into chunks, each of which is packed by the thread that
+// multiplies it by the block of A. (If there are fewer chunks than threads,
+// the rows of the block of A are divided as well.)
+
+// State shared by all of the threads that cooperate on one operation. It
+// is passed to the thread entry point along with A.
+typedef struct
+{
+	// The number of operands B_i (and C_i).
+	dim_t        nb;
+
+	// The operands, each an array of nb objects. The scalars are copies
+	// whose datatype is that of A.
+	const obj_t* alpha;
+	const obj_t* b;
+	const obj_t* beta;
+	const obj_t* c;
+
+	// The (maximum) number of columns in each chunk of a B_i.
+	dim_t        ncu;
+
+} mgemm_state_t;
+
+//
+// -- Prototype the multiple gemm operation's object API -----------------------
+//
+
+// Compute C_i := beta_i C_i + alpha_i trans(A) trans(B_i) for i = 0, ...,
+// nb-1, where alpha, b, beta, and c are arrays of nb objects. All of the
+// matrices must have the same datatype, and each C_i must have as many rows
+// as trans(A). The C_i must not overlap A, any B_j, or each other.
+
+BLIS_EXPORT_ADDON void bao_mgemm
+     (
+             dim_t   nb,
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c
+     );
+
+BLIS_EXPORT_ADDON void bao_mgemm_ex
+     (
+             dim_t   nb,
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c,
+       const cntx_t* cntx,
+             rntm_t* rntm
+     );
+
+//
+// -- Prototype the multiple gemm operation's thread entry point ---------------
+//
+
+err_t bao_mgemm_int
+     (
+       const obj_t*     alpha,
+       const obj_t*     a,
+       const obj_t*     b,
+       const obj_t*     beta,
+       const obj_t*     c,
+       const cntx_t*    cntx,
+             rntm_t*    rntm,
+             thrinfo_t* thread
+     );
+
+//
+// -- Prototype the multiple gemm operation's typed API ------------------------
+//
+
+// The same as the object API, where C_i is m x n[i], A is m x k (after
+// transa is applied), and B_i is k x n[i] (after transb is applied). The
+// matrices B_i and C_i are given by arrays of pointers and strides, and the
+// scalars alpha_i and beta_i by arrays of values.
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_ADDON void PASTECH2(bao_,ch,opname) \
+     ( \
+             trans_t transa, \
+             trans_t transb, \
+             dim_t   nb, \
+             dim_t   m, \
+       const dim_t*  n, \
+             dim_t   k, \
+       const ctype*  alpha, \
+             ctype*  a, inc_t rs_a, inc_t cs_a, \
+             ctype** b, const inc_t* rs_b, const inc_t* cs_b, \
+       const ctype*  beta, \
+             ctype** c, const inc_t* rs_c, const inc_t* cs_c  \
+     );
+
+INSERT_GENTPROT_BASIC0( mgemm )
+
@@ -0,0 +1,127 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#include "blis.h"
+
+void bao_mgemm_check
+     (
+             dim_t   nb,
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c,
+       const cntx_t* cntx
+     )
+{
+	err_t e_val;
+
+	( void )cntx;
+
+	if ( nb < 0 )
+		bli_check_error_code( BLIS_NEGATIVE_DIMENSION );
+
+	if ( nb > 0 )
+	{
+		e_val = bli_check_null_pointer( alpha );
+		bli_check_error_code( e_val );
+
+		e_val = bli_check_null_pointer( b );
+		bli_check_error_code( e_val );
+
+		e_val = bli_check_null_pointer( beta );
+		bli_check_error_code( e_val );
+
+		e_val = bli_check_null_pointer( c );
+		bli_check_error_code( e_val );
+	}
+
+	// Check the datatype, dimensions, and buffer of A.
+
+	e_val = bli_check_floating_object( a );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_matrix_object( a );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( a );
+	bli_check_error_code( e_val );
+
+	// Check each gemm against A.
+
+	for ( dim_t i = 0; i < nb; ++i )
+	{
+		const obj_t* b_i = &b[ i ];
+		const obj_t* c_i = &c[ i ];
+
+		// Check object datatypes.
+
+		e_val = bli_check_consistent_object_datatypes( a, b_i );
+		bli_check_error_code( e_val );
+
+		e_val = bli_check_consistent_object_datatypes( a, c_i );
+		bli_check_error_code( e_val );
+
+		// Check object dimensions.
+
+		e_val = bli_check_scalar_object( &alpha[ i ] );
+		bli_check_error_code( e_val );
+
+		e_val = bli_check_scalar_object( &beta[ i ] );
+		bli_check_error_code( e_val );
+
+		e_val = bli_check_matrix_object( b_i );
+		bli_check_error_code( e_val );
+
+		e_val = bli_check_matrix_object( c_i );
+		bli_check_error_code( e_val );
+
+		if ( bli_obj_length_after_trans( a )   != bli_obj_length_after_trans( c_i ) ||
+		     bli_obj_width_after_trans( a )    != bli_obj_length_after_trans( b_i ) ||
+		     bli_obj_width_after_trans( b_i )  != bli_obj_width_after_trans( c_i ) )
+			bli_check_error_code( BLIS_NONCONFORMAL_DIMENSIONS );
+
+		// Check object buffers (for non-NULLness).
+
+		e_val = bli_check_object_buffer( b_i );
+		bli_check_error_code( e_val );
+
+		e_val = bli_check_object_buffer( c_i );
+		bli_check_error_code( e_val );
+	}
+}
+
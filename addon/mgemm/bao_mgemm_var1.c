@@ -0,0 +1,420 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#include "blis.h"
+
+#define FUNCPTR_T mgemm_packa_fp
+
+typedef void (*FUNCPTR_T)
+     (
+             conj_t     conja,
+             dim_t      mc,
+             dim_t      kc,
+             void*      a, inc_t rs_a, inc_t cs_a,
+             void*      ap, inc_t ps_a,
+       const cntx_t*    cntx,
+             thrinfo_t* thread
+     );
+
+static FUNCPTR_T GENARRAY_PREF(ftypes_packa,bao_,mgemm_packa_var1);
+
+#undef  FUNCPTR_T
+#define FUNCPTR_T mgemm_ker_fp
+
+typedef void (*FUNCPTR_T)
+     (
+             conj_t  conjb,
+             dim_t   ir0,
+             dim_t   ir1,
+             dim_t   mc,
+             dim_t   nc,
+             dim_t   kc,
+             void*   alpha,
+             void*   ap, inc_t ps_a,
+             void*   b, inc_t rs_b, inc_t cs_b,
+             void*   bp,
+             void*   beta,
+             void*   c, inc_t rs_c, inc_t cs_c,
+       const cntx_t* cntx
+     );
+
+static FUNCPTR_T GENARRAY_PREF(ftypes_ker,bao_,mgemm_ker_var1);
+
+//
+// -- Shared-A multiple gemm (object interface) --------------------------------
+//
+
+// The loops over the KC-deep blocks of A and over its slabs of (at most)
+// MS rows are outermost, where MS is the largest multiple of MC not
+// exceeding NC (so that a packed slab of A occupies no more than a packed
+// block of B in the gemm operation). In each iteration, the slab of A is
+// packed into MR-row micropanels with all threads cooperating, and then the
+// units of work for that slab, which comprise every chunk of (at most) ncu
+// columns of every B_i (and, if there are fewer chunks than threads, a
+// range of micropanels of the slab), are assigned to the threads round-
+// robin. For each unit, the thread packs the KC x ncu chunk of B_i into
+// NR-column micropanels in a buffer of its own and multiplies each MC x KC
+// block of the slab by it, just as the macrokernel of gemm does. Thus each
+// block of A is packed only once and then applied to every B_i. Beta_i is
+// applied only with the first block of k; the remaining blocks accumulate
+// into C_i.
+
+void bao_mgemm_var1
+     (
+       const obj_t*     alpha,
+       const obj_t*     a,
+       const obj_t*     b,
+       const obj_t*     beta,
+       const obj_t*     c,
+       const cntx_t*    cntx,
+             rntm_t*    rntm,
+             thrinfo_t* thread
+     )
+{
+	( void )alpha;
+	( void )b;
+	( void )beta;
+	( void )c;
+
+	const mgemm_state_t* state = bli_obj_ker_params( a );
+
+	const num_t dt      = bli_obj_dt( a );
+	const dim_t dt_size = bli_dt_size( dt );
+
+	const dim_t m       = bli_obj_length( a );
+	const dim_t k       = bli_obj_width( a );
+	const dim_t nb      = state->nb;
+	const dim_t ncu     = state->ncu;
+
+	const dim_t MR      = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx );
+	const dim_t NR      = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+	const dim_t MC      = bli_cntx_get_blksz_def_dt( dt, BLIS_MC, cntx );
+	const dim_t NC      = bli_cntx_get_blksz_def_dt( dt, BLIS_NC, cntx );
+	const dim_t KC      = bli_cntx_get_blksz_def_dt( dt, BLIS_KC, cntx );
+	const dim_t PACKMR  = bli_cntx_get_blksz_max_dt( dt, BLIS_MR, cntx );
+	const dim_t PACKNR  = bli_cntx_get_blksz_max_dt( dt, BLIS_NR, cntx );
+
+	const dim_t nt      = bli_thread_n_way( thread );
+	const dim_t tid     = bli_thread_work_id( thread );
+
+	const conj_t conja  = bli_obj_conj_status( a );
+	const inc_t  rs_a   = bli_obj_row_stride( a );
+	const inc_t  cs_a   = bli_obj_col_stride( a );
+	char*        a_buf  = bli_obj_buffer_at_off( a );
+
+	void*        one    = ( void* )bli_obj_buffer_for_const( dt, &BLIS_ONE );
+
+	// The height of the slabs of A, and the stride between micropanels of a
+	// packed slab, which (as in the packing for gemm) is rounded up to an
+	// even number of elements.
+	const dim_t  MS     = bli_min( bli_max( NC / MC, 1 ) * MC, m );
+	const dim_t  MS_r   = bli_align_dim_to_mult( MS, MR );
+	const dim_t  kc_max = bli_min( KC, k );
+	const inc_t  ps_a   = bli_align_dim_to_mult( PACKMR * kc_max, 2 );
+	const siz_t  size_a = ( MS_r / MR ) * ps_a * dt_size;
+	const siz_t  size_b = ( bli_align_dim_to_mult( ncu, NR ) / NR ) *
+	                      PACKNR * kc_max * dt_size;
+
+	// Acquire the slab of A, which is shared by all threads, and a buffer
+	// for this thread's chunks of B_i.
+	mem_t mem_a = BLIS_MEM_INITIALIZER;
+	mem_t mem_b = BLIS_MEM_INITIALIZER;
+
+	if ( bli_thread_am_ochief( thread ) )
+		bli_pba_acquire_m( rntm, size_a, BLIS_BUFFER_FOR_GEN_USE, &mem_a );
+
+	mem_t* mem_p = bli_thread_broadcast( thread, &mem_a );
+
+	void* ap = bli_mem_buffer( mem_p );
+
+	bli_pba_acquire_m( rntm, size_b, BLIS_BUFFER_FOR_GEN_USE, &mem_b );
+
+	void* bp = bli_mem_buffer( &mem_b );
+
+	for ( dim_t pc = 0; pc < k; pc += KC )
+	{
+		const dim_t kc = bli_min( KC, k - pc );
+
+		for ( dim_t ic = 0; ic < m; ic += MS )
+		{
+			const dim_t mc = bli_min( MS, m - ic );
+			const dim_t mp = ( mc + MR - 1 ) / MR;
+
+			// Make sure that no thread is still using the previous slab of
+			// A, and then pack this one.
+			bli_thread_barrier( thread );
+
+			ftypes_packa[dt]
+			(
+			  conja,
+			  mc,
+			  kc,
+			  a_buf + ( ic * rs_a + pc * cs_a ) * dt_size, rs_a, cs_a,
+			  ap, ps_a,
+			  cntx,
+			  thread
+			);
+
+			bli_thread_barrier( thread );
+
+			// Count the chunks of all the B_i, and determine how many ranges
+			// of micropanels of A each chunk is divided into.
+			dim_t n_chunk = 0;
+			for ( dim_t i = 0; i < nb; ++i )
+				n_chunk += ( bli_obj_width( &state->c[ i ] ) + ncu - 1 ) / ncu;
+
+			const dim_t n_grp = ( n_chunk >= nt ? 1
+			                    : bli_min( ( nt + n_chunk - 1 ) / n_chunk, mp ) );
+
+			dim_t u = 0;
+
+			for ( dim_t i = 0; i < nb; ++i )
+			{
+				const obj_t* b_i   = &state->b[ i ];
+				const obj_t* c_i   = &state->c[ i ];
+				const dim_t  n_i   = bli_obj_width( c_i );
+
+				const inc_t  rs_b  = bli_obj_row_stride( b_i );
+				const inc_t  cs_b  = bli_obj_col_stride( b_i );
+				const inc_t  rs_c  = bli_obj_row_stride( c_i );
+				const inc_t  cs_c  = bli_obj_col_stride( c_i );
+				char*        b_buf = bli_obj_buffer_at_off( b_i );
+				char*        c_buf = bli_obj_buffer_at_off( c_i );
+
+				void*        alpha_i = bli_obj_buffer_for_1x1( dt, &state->alpha[ i ] );
+				void*        beta_i  = ( pc == 0 ? bli_obj_buffer_for_1x1( dt, &state->beta[ i ] )
+				                                 : one );
+
+				for ( dim_t jc = 0; jc < n_i; jc += ncu )
+				for ( dim_t g = 0; g < n_grp; ++g, ++u )
+				{
+					if ( u % nt != tid ) continue;
+
+					const dim_t nc = bli_min( ncu, n_i - jc );
+
+					ftypes_ker[dt]
+					(
+					  bli_obj_conj_status( b_i ),
+					  ( g     ) * mp / n_grp,
+					  ( g + 1 ) * mp / n_grp,
+					  mc,
+					  nc,
+					  kc,
+					  alpha_i,
+					  ap, ps_a,
+					  b_buf + ( pc * rs_b + jc * cs_b ) * dt_size, rs_b, cs_b,
+					  bp,
+					  beta_i,
+					  c_buf + ( ic * rs_c + jc * cs_c ) * dt_size, rs_c, cs_c,
+					  cntx
+					);
+				}
+			}
+		}
+	}
+
+	// Make sure that no thread is still using the slab of A before the
+	// chief thread releases it.
+	bli_thread_barrier( thread );
+
+	if ( bli_thread_am_ochief( thread ) )
+		bli_pba_release( rntm, &mem_a );
+
+	bli_pba_release( rntm, &mem_b );
+}
+
+//
+// -- Shared-A multiple gemm (typed interfaces) --------------------------------
+//
+
+// Pack the mc x kc slab of A into MR-row micropanels, with the micropanels
+// assigned to the threads round-robin.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTECH2(bao_,ch,varname) \
+     ( \
+             conj_t     conja, \
+             dim_t      mc, \
+             dim_t      kc, \
+             void*      a, inc_t rs_a, inc_t cs_a, \
+             void*      ap, inc_t ps_a, \
+       const cntx_t*    cntx, \
+             thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t dt     = PASTEMAC(ch,type); \
+\
+	const dim_t MR     = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx ); \
+	const dim_t PACKMR = bli_cntx_get_blksz_max_dt( dt, BLIS_MR, cntx ); \
+\
+	PASTECH2(ch,packm_cxk,_ker_ft) \
+	            packm_ker = bli_cntx_get_ukr_dt( dt, BLIS_PACKM_MRXK_KER, cntx ); \
+\
+	const dim_t nt     = bli_thread_n_way( thread ); \
+	const dim_t tid    = bli_thread_work_id( thread ); \
+\
+	ctype* restrict a_cast  = a; \
+	ctype* restrict ap_cast = ap; \
+\
+	for ( dim_t ir = tid * MR; ir < mc; ir += nt * MR ) \
+	{ \
+		packm_ker \
+		( \
+		  conja, \
+		  BLIS_PACKED_ROW_PANELS, \
+		  bli_min( MR, mc - ir ), \
+		  kc, \
+		  kc, \
+		  PASTEMAC(ch,1), \
+		  a_cast + ir * rs_a, rs_a, cs_a, \
+		  ap_cast + ( ir / MR ) * ps_a, PACKMR, \
+		  ( cntx_t* )cntx  \
+		); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( mgemm_packa_var1 )
+
+// Pack the kc x nc chunk of B into NR-column micropanels and multiply the
+// micropanels [ir0,ir1) of the packed slab of A by it, in blocks of (at
+// most) MC rows.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTECH2(bao_,ch,varname) \
+     ( \
+             conj_t  conjb, \
+             dim_t   ir0, \
+             dim_t   ir1, \
+             dim_t   mc, \
+             dim_t   nc, \
+             dim_t   kc, \
+             void*   alpha, \
+             void*   ap, inc_t ps_a, \
+             void*   b, inc_t rs_b, inc_t cs_b, \
+             void*   bp, \
+             void*   beta, \
+             void*   c, inc_t rs_c, inc_t cs_c, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	const num_t dt     = PASTEMAC(ch,type); \
+\
+	const dim_t MR     = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx ); \
+	const dim_t NR     = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx ); \
+	const dim_t MC     = bli_cntx_get_blksz_def_dt( dt, BLIS_MC, cntx ); \
+	const dim_t PACKNR = bli_cntx_get_blksz_max_dt( dt, BLIS_NR, cntx ); \
+\
+	/* The number of micropanels in each block of A. */ \
+	const dim_t MCp    = bli_max( MC / MR, 1 ); \
+\
+	PASTECH(ch,gemm_ukr_ft) \
+	            gemm_ukr  = bli_cntx_get_ukr_dt( dt, BLIS_GEMM_UKR, cntx ); \
+	PASTECH2(ch,packm_cxk,_ker_ft) \
+	            packm_ker = bli_cntx_get_ukr_dt( dt, BLIS_PACKM_NRXK_KER, cntx ); \
+\
+	ctype* restrict a_cast  = ap; \
+	ctype* restrict b_cast  = b; \
+	ctype* restrict bp_cast = bp; \
+	ctype* restrict c_cast  = c; \
+\
+	/* The stride between micropanels of the packed chunk of B, which (as
+	   in the packing for gemm) is rounded up to an even number of
+	   elements. */ \
+	const inc_t ps_b = bli_align_dim_to_mult( PACKNR * kc, 2 ); \
+\
+	for ( dim_t jr = 0; jr < nc; jr += NR ) \
+	{ \
+		packm_ker \
+		( \
+		  conjb, \
+		  BLIS_PACKED_COL_PANELS, \
+		  bli_min( NR, nc - jr ), \
+		  kc, \
+		  kc, \
+		  PASTEMAC(ch,1), \
+		  b_cast + jr * cs_b, cs_b, rs_b, \
+		  bp_cast + ( jr / NR ) * ps_b, PACKNR, \
+		  ( cntx_t* )cntx  \
+		); \
+	} \
+\
+	auxinfo_t aux; \
+	bli_auxinfo_set_schema_a( BLIS_PACKED_ROW_PANELS, &aux ); \
+	bli_auxinfo_set_schema_b( BLIS_PACKED_COL_PANELS, &aux ); \
+\
+	/* Loop over the blocks of the slab of A (the third loop around the
+	   microkernel), the micropanels of B (the second loop), and the
+	   micropanels of the block of A (the first loop). */ \
+	for ( dim_t ib = ir0; ib < ir1; ib += MCp ) \
+	{ \
+		const dim_t ie = bli_min( ib + MCp, ir1 ); \
+\
+		for ( dim_t jr = 0; jr < nc; jr += NR ) \
+		{ \
+			ctype* restrict b1 = bp_cast + ( jr / NR ) * ps_b; \
+\
+			for ( dim_t i = ib; i < ie; ++i ) \
+			{ \
+				ctype* restrict a1 = a_cast + i * ps_a; \
+\
+				bli_auxinfo_set_next_a( ( i + 1 < ie ? a1 + ps_a : a_cast + ib * ps_a ), &aux ); \
+				bli_auxinfo_set_next_b( ( i + 1 < ie ? b1 : b1 + ps_b ), &aux ); \
+\
+				gemm_ukr \
+				( \
+				  bli_min( MR, mc - i * MR ), \
+				  bli_min( NR, nc - jr ), \
+				  kc, \
+				  alpha, \
+				  a1, \
+				  b1, \
+				  beta, \
+				  c_cast + i * MR * rs_c + jr * cs_c, rs_c, cs_c, \
+				  &aux, \
+				  ( cntx_t* )cntx  \
+				); \
+			} \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( mgemm_ker_var1 )
+
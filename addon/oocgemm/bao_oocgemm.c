@@ -0,0 +1,388 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#include "blis.h"
+
+//
+// -- Define the out-of-core matrix initialization functions -------------------
+//
+
+void bao_oocmat_init_map
+     (
+       num_t     dt,
+       dim_t     m,
+       dim_t     n,
+       void*     buf, inc_t rs, inc_t cs,
+       oocmat_t* a
+     )
+{
+	a->kind   = BAO_OOC_MAP;
+	a->dt     = dt;
+	a->m      = m;
+	a->n      = n;
+	a->rs     = rs;
+	a->cs     = cs;
+	a->buf    = buf;
+	a->fd     = -1;
+	a->offset = 0;
+}
+
+void bao_oocmat_init_fd
+     (
+       num_t     dt,
+       dim_t     m,
+       dim_t     n,
+       int       fd,
+       int64_t   offset, inc_t rs, inc_t cs,
+       oocmat_t* a
+     )
+{
+	a->kind   = BAO_OOC_FD;
+	a->dt     = dt;
+	a->m      = m;
+	a->n      = n;
+	a->rs     = rs;
+	a->cs     = cs;
+	a->buf    = NULL;
+	a->fd     = fd;
+	a->offset = offset;
+}
+
+//
+// -- Define the out-of-core gemm tile size query ------------------------------
+//
+
+// Round x down to a multiple of b, unless x is smaller than b.
+BLIS_INLINE dim_t bao_oocgemm_round( dim_t x, dim_t b )
+{
+	return ( x >= b ? x - x % b : x );
+}
+
+void bao_oocgemm_tiles
+     (
+             num_t   dt,
+             dim_t   m,
+             dim_t   n,
+             siz_t   mem_max,
+       const cntx_t* cntx,
+             dim_t*  tm,
+             dim_t*  tn
+     )
+{
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+	if ( mem_max == 0 ) mem_max = BAO_OOCGEMM_MEM_DEF;
+
+	const dim_t MC = bli_cntx_get_blksz_def_dt( dt, BLIS_MC, cntx );
+	const dim_t NC = bli_cntx_get_blksz_def_dt( dt, BLIS_NC, cntx );
+
+	// The tiles of C are (about) square, which minimizes the number of
+	// times that A and B are read for a given tile size, and consist of
+	// whole blocks of the blocked variants where possible.
+	const double e = ( double )( mem_max / bli_dt_size( dt ) );
+	const dim_t  t = bli_max( ( dim_t )sqrt( e ), 1 );
+
+	*tm = bli_max( bli_min( bao_oocgemm_round( t, MC ), m ), 1 );
+	*tn = bli_max( bli_min( bao_oocgemm_round( e / *tm, NC ), n ), 1 );
+}
+
+//
+// -- Define the out-of-core gemm operation's object API -----------------------
+//
+
+err_t bao_oocgemm
+     (
+       const obj_t*    alpha,
+       const oocmat_t* a,
+       const oocmat_t* b,
+       const obj_t*    beta,
+       const oocmat_t* c
+     )
+{
+	return bao_oocgemm_ex
+	(
+	  alpha,
+	  a,
+	  b,
+	  beta,
+	  c,
+	  0,
+	  NULL,
+	  NULL
+	);
+}
+
+#ifdef BAO_OOC_POSIX
+
+// Compute C := beta C + alpha A B for one tile of C (in memory) with the
+// blocked variants of gemm, with the blocks of A and panels of B fetched by
+// the packm hooks of a and b. This follows bli_gemm_front(), except that
+// the threads are not partitioned along the jc and ic loops, so that all
+// of them share a single block of A and panel of B at a time.
+static void bao_oocgemm_front
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c,
+             bool    swap,
+       const cntx_t* cntx,
+             rntm_t* rntm
+     )
+{
+	obj_t a_local, b_local, c_local;
+
+	bli_obj_alias_to( a, &a_local );
+	bli_obj_alias_to( b, &b_local );
+	bli_obj_alias_to( c, &c_local );
+
+	// If the micro-kernel dislikes the storage of C, transpose the entire
+	// operation (as bli_gemm_front() does).
+	if ( swap )
+	{
+		bli_obj_swap( &a_local, &b_local );
+
+		bli_obj_induce_trans( &a_local );
+		bli_obj_induce_trans( &b_local );
+		bli_obj_induce_trans( &c_local );
+	}
+
+	bli_l3_set_schemas( &a_local, &b_local, &c_local, cntx );
+
+	bli_obj_scalar_attach( BLIS_NO_CONJUGATE, alpha, &b_local );
+	bli_obj_scalar_attach( BLIS_NO_CONJUGATE, beta,  &c_local );
+
+	bli_rntm_set_ways_for_op
+	(
+	  BLIS_GEMM,
+	  BLIS_LEFT,
+	  bli_obj_length( &c_local ),
+	  bli_obj_width( &c_local ),
+	  bli_obj_width( &a_local ),
+	  rntm
+	);
+
+	// Move the parallelism of the jc, pc, and ic loops to the jr loop. (The
+	// total number of threads is unchanged.)
+	bli_rntm_set_ways_only
+	(
+	  1,
+	  1,
+	  1,
+	  bli_rntm_jc_ways( rntm ) * bli_rntm_pc_ways( rntm ) *
+	  bli_rntm_ic_ways( rntm ) * bli_rntm_jr_ways( rntm ),
+	  bli_rntm_ir_ways( rntm ),
+	  rntm
+	);
+
+	bli_l3_thread_decorator
+	(
+	  bli_l3_int,
+	  BLIS_GEMM,
+	  &BLIS_ONE,
+	  &a_local,
+	  &b_local,
+	  &BLIS_ONE,
+	  &c_local,
+	  cntx,
+	  rntm,
+	  NULL
+	);
+}
+
+#endif
+
+err_t bao_oocgemm_ex
+     (
+       const obj_t*    alpha,
+       const oocmat_t* a,
+       const oocmat_t* b,
+       const obj_t*    beta,
+       const oocmat_t* c,
+             siz_t     mem_max,
+       const cntx_t*   cntx,
+             rntm_t*   rntm
+     )
+{
+	bli_init_once();
+
+	// Obtain a valid (native) context from the gks if necessary.
+	// NOTE: This must be done before calling the _check() function, since
+	// that function assumes the context pointer is valid.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bao_oocgemm_check( alpha, a, b, beta, c, cntx );
+
+#ifndef BAO_OOC_POSIX
+	( void )rntm;
+	( void )mem_max;
+
+	return BLIS_NOT_YET_IMPLEMENTED;
+#else
+	const num_t dt = bao_oocmat_dt( c );
+	const siz_t es = bli_dt_size( dt );
+	const dim_t m  = bao_oocmat_length( c );
+	const dim_t n  = bao_oocmat_width( c );
+	const dim_t k  = bao_oocmat_width( a );
+
+	// If C has a zero dimension, return early.
+	if ( m == 0 || n == 0 )
+	{
+		return BLIS_SUCCESS;
+	}
+
+	// Initialize a local runtime with global settings if necessary. Note
+	// that in the case that a runtime is passed in, we make a local copy.
+	rntm_t rntm_l;
+	if ( rntm == NULL ) bli_rntm_init_from_global( &rntm_l );
+	else                rntm_l = *rntm;
+
+	// A mapped C is updated in place as a single tile; otherwise, C is
+	// read and written a tile (within the budget) at a time.
+	dim_t tm = m, tn = n;
+
+	if ( bao_oocmat_is_fd( c ) )
+		bao_oocgemm_tiles( dt, m, n, mem_max, cntx, &tm, &tn );
+
+	// If beta is zero, the tiles of C need not be read.
+	const bool  beta0  = bli_obj_equals( beta, &BLIS_ZERO );
+	const bool  alpha0 = bli_obj_equals( alpha, &BLIS_ZERO );
+
+	err_t       r_val;
+	void*       buf_c  = ( bao_oocmat_is_fd( c ) ? bli_malloc_intl( tm * tn * es, &r_val )
+	                                             : NULL );
+
+	// The blocked variants transpose the operation if the micro-kernel
+	// dislikes the storage of (the tiles of) C, in which case A is packed
+	// as B would be and vice versa.
+	ooctile_t tc;
+	obj_t     ct;
+
+	bao_ooc_tile_init( c, 0, 0, tm, tn, buf_c, &tc );
+	bli_obj_create_with_attached_buffer( dt, tm, tn, tc.buf, tc.rs, tc.cs, &ct );
+
+	const bool  swap   = bli_cntx_dislikes_storage_of( &ct, BLIS_GEMM_VIR_UKR, cntx );
+
+	const dim_t MC     = bli_cntx_get_blksz_max_dt( dt, BLIS_MC, cntx );
+	const dim_t NC     = bli_cntx_get_blksz_max_dt( dt, BLIS_NC, cntx );
+	const dim_t KC     = bli_cntx_get_blksz_max_dt( dt, BLIS_KC, cntx );
+
+	// Whether the next block of A (or panel of B) is fetched while the
+	// current one is computed with (for comparison, prefetching may be
+	// disabled by setting BAO_OOCGEMM_PREFETCH=0).
+	const bool  prefetch = bli_env_get_var( "BAO_OOCGEMM_PREFETCH", 1 ) != 0;
+
+	// A is packed in place (and B transposed); see bao_ooc_packm().
+	oocstream_t sa, sb;
+	obj_t       ao, bo;
+
+	bao_ooc_stream_init( a, FALSE, !swap, prefetch, &sa );
+	bao_ooc_stream_init( b, TRUE,   swap, prefetch, &sb );
+
+	// The buffer of a matrix accessed through a descriptor is never accessed
+	// (see bao_ooc_packm()), but it must not be NULL, so its stream stands
+	// in for it.
+	bli_obj_create_with_attached_buffer( dt, m, k, bao_oocmat_is_fd( a ) ? ( void* )&sa : a->buf,
+	                                     a->rs, a->cs, &ao );
+	bli_obj_create_with_attached_buffer( dt, k, n, bao_oocmat_is_fd( b ) ? ( void* )&sb : b->buf,
+	                                     b->rs, b->cs, &bo );
+
+	bli_obj_set_pack_fn( bao_ooc_packm, &ao );
+	bli_obj_set_pack_fn( bao_ooc_packm, &bo );
+	bli_obj_set_pack_params( &sa, &ao );
+	bli_obj_set_pack_params( &sb, &bo );
+
+	err_t       err    = BLIS_SUCCESS;
+
+	for ( dim_t jc = 0; jc < n && err == BLIS_SUCCESS; jc += tn )
+	{
+		const dim_t nt = bli_min( tn, n - jc );
+
+		for ( dim_t ic = 0; ic < m && err == BLIS_SUCCESS; ic += tm )
+		{
+			const dim_t mt = bli_min( tm, m - ic );
+
+			bao_ooc_tile_init( c, ic, jc, mt, nt, buf_c, &tc );
+
+			if ( !beta0 || !bao_oocmat_is_fd( c ) )
+				err = bao_ooc_tile_read( c, ic, jc, mt, nt, &tc );
+
+			if ( err != BLIS_SUCCESS ) break;
+
+			bli_obj_create_with_attached_buffer( dt, mt, nt, tc.buf, tc.rs, tc.cs, &ct );
+
+			if ( k == 0 || alpha0 )
+			{
+				bli_scalm( beta, &ct );
+			}
+			else
+			{
+				obj_t a1, b1;
+
+				bli_acquire_mpart_mdim( BLIS_FWD, BLIS_SUBPART1, ic, mt, &ao, &a1 );
+				bli_acquire_mpart_ndim( BLIS_FWD, BLIS_SUBPART1, jc, nt, &bo, &b1 );
+
+				// The rows of A and B^T to be packed for this tile of C, and
+				// their partitioning by the ic (MC) and jc (NC) loops.
+				bao_ooc_stream_set_tile( ic, ic + mt, 0, k, swap ? NC : MC, KC,
+				                         swap ? FALSE : nt > NC, &sa );
+				bao_ooc_stream_set_tile( jc, jc + nt, 0, k, swap ? MC : NC, KC,
+				                         swap ? mt > NC : FALSE, &sb );
+
+				rntm_t rntm_use = rntm_l;
+
+				bao_oocgemm_front( alpha, &a1, &b1, beta, &ct, swap, cntx, &rntm_use );
+
+				err = ( sa.err != BLIS_SUCCESS ? sa.err : sb.err );
+			}
+
+			if ( err != BLIS_SUCCESS ) break;
+
+			err = bao_ooc_tile_write( c, ic, jc, mt, nt, &tc );
+		}
+	}
+
+	bao_ooc_stream_free( &sa );
+	bao_ooc_stream_free( &sb );
+
+	bli_free_intl( buf_c );
+
+	return err;
+#endif
+}
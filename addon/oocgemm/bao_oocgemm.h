@@ -0,0 +1,198 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+//
+// -- Out-of-core gemm definitions ---------------------------------------------
+//
+
+// The out-of-core gemm operation computes C := beta C + alpha A B, where
+// any of the matrices may reside in a file rather than in memory, either
+// mapped into memory by the caller (e.g. with mmap()) or accessed through a
+// file descriptor. The blocked variants of gemm (the jc, pc, and ic loops)
+// are used as they are, except that A and B are packed by a packm hook
+// (bao_ooc_packm()) that fetches each block of A (MC x KC) and panel of B
+// (KC x NC) as it is packed, so that only these (and the packed copies) are
+// resident. All threads share each block and panel; the parallelism of the
+// jc and ic loops is moved to the jr loop.
+//
+// While one block of A (or panel of B) is packed and computed with, the
+// next one in the order of the loops is fetched: blocks of operands accessed
+// through a descriptor are read (by a separate thread) into the second of
+// two buffers for each operand, and the pages of blocks of mapped operands
+// are requested from the kernel with posix_madvise( POSIX_MADV_WILLNEED ).
+//
+// A mapped C is updated in place. A C accessed through a descriptor is
+// instead read and written a tile at a time, each of which is within a given
+// budget, and the blocked variants are applied to each tile of C in turn.
+//
+// Only POSIX systems are supported; elsewhere, bao_oocgemm() returns
+// BLIS_NOT_YET_IMPLEMENTED.
+
+// The default budget (in bytes) for the tiles of C, which may be overridden
+// at compile-time or for each call.
+#ifndef BAO_OOCGEMM_MEM_DEF
+#define BAO_OOCGEMM_MEM_DEF  ( ( siz_t )1 << 30 )
+#endif
+
+typedef enum
+{
+	// The matrix is mapped into memory by the caller.
+	BAO_OOC_MAP = 0,
+
+	// The matrix is accessed with pread() and pwrite().
+	BAO_OOC_FD
+
+} oocmat_kind_t;
+
+// A matrix that may reside in a file. Its elements are stored with row and
+// column strides rs and cs (in units of elements); for a matrix accessed
+// through a file descriptor, one of them must be unit.
+typedef struct
+{
+	oocmat_kind_t kind;
+
+	num_t         dt;
+	dim_t         m;
+	dim_t         n;
+	inc_t         rs;
+	inc_t         cs;
+
+	// BAO_OOC_MAP: the address of element (0,0).
+	void*         buf;
+
+	// BAO_OOC_FD: the file descriptor and the offset (in bytes) of element
+	// (0,0) within the file.
+	int           fd;
+	int64_t       offset;
+
+} oocmat_t;
+
+BLIS_INLINE num_t bao_oocmat_dt( const oocmat_t* a )
+{
+	return a->dt;
+}
+
+BLIS_INLINE dim_t bao_oocmat_length( const oocmat_t* a )
+{
+	return a->m;
+}
+
+BLIS_INLINE dim_t bao_oocmat_width( const oocmat_t* a )
+{
+	return a->n;
+}
+
+BLIS_INLINE bool bao_oocmat_is_fd( const oocmat_t* a )
+{
+	return a->kind == BAO_OOC_FD;
+}
+
+//
+// -- Prototype the out-of-core matrix initialization functions ----------------
+//
+
+// Describe an m x n matrix mapped into memory at buf.
+BLIS_EXPORT_ADDON void bao_oocmat_init_map
+     (
+       num_t     dt,
+       dim_t     m,
+       dim_t     n,
+       void*     buf, inc_t rs, inc_t cs,
+       oocmat_t* a
+     );
+
+// Describe an m x n matrix stored at the given offset (in bytes) of the
+// file open as fd. If the matrix is to be written (as C), the file must be
+// open for both reading and writing.
+BLIS_EXPORT_ADDON void bao_oocmat_init_fd
+     (
+       num_t     dt,
+       dim_t     m,
+       dim_t     n,
+       int       fd,
+       int64_t   offset, inc_t rs, inc_t cs,
+       oocmat_t* a
+     );
+
+//
+// -- Prototype the out-of-core gemm operation's object API --------------------
+//
+
+// Compute C := beta C + alpha A B. The budget mem_max (in bytes) bounds the
+// size of the buffer for the tiles of C (zero selects BAO_OOCGEMM_MEM_DEF);
+// in addition, two blocks of A and two panels of B are allocated for each
+// of these operands that is accessed through a descriptor. The return value
+// is BLIS_SUCCESS, or BLIS_FAILURE if a read or write of a file failed (in
+// which case C may have been partially updated).
+
+BLIS_EXPORT_ADDON err_t bao_oocgemm
+     (
+       const obj_t*    alpha,
+       const oocmat_t* a,
+       const oocmat_t* b,
+       const obj_t*    beta,
+       const oocmat_t* c
+     );
+
+BLIS_EXPORT_ADDON err_t bao_oocgemm_ex
+     (
+       const obj_t*    alpha,
+       const oocmat_t* a,
+       const oocmat_t* b,
+       const obj_t*    beta,
+       const oocmat_t* c,
+             siz_t     mem_max,
+       const cntx_t*   cntx,
+             rntm_t*   rntm
+     );
+
+//
+// -- Prototype the out-of-core gemm tile size query ---------------------------
+//
+
+// Compute the dimensions of the tiles of C (tm x tn) for a problem of the
+// given size and budget.
+BLIS_EXPORT_ADDON void bao_oocgemm_tiles
+     (
+             num_t   dt,
+             dim_t   m,
+             dim_t   n,
+             siz_t   mem_max,
+       const cntx_t* cntx,
+             dim_t*  tm,
+             dim_t*  tn
+     );
@@ -0,0 +1,114 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#include "blis.h"
+
+static void bao_oocmat_check
+     (
+       const oocmat_t* a
+     )
+{
+	err_t e_val;
+
+	e_val = bli_check_floating_datatype( bao_oocmat_dt( a ) );
+	bli_check_error_code( e_val );
+
+	if ( a->m < 0 || a->n < 0 )
+		bli_check_error_code( BLIS_NEGATIVE_DIMENSION );
+
+	e_val = bli_check_matrix_strides( a->m, a->n, a->rs, a->cs, 1 );
+	bli_check_error_code( e_val );
+
+	if ( a->m == 0 || a->n == 0 ) return;
+
+	if ( bao_oocmat_is_fd( a ) )
+	{
+		// Tiles are read and written a row or a column at a time, so one of
+		// the strides must be unit.
+		if ( a->rs != 1 && a->cs != 1 )
+			bli_check_error_code( BLIS_INVALID_DIM_STRIDE_COMBINATION );
+
+		if ( a->fd < 0 || a->offset < 0 )
+			bli_check_error_code( BLIS_NULL_POINTER );
+	}
+	else
+	{
+		e_val = bli_check_null_pointer( a->buf );
+		bli_check_error_code( e_val );
+	}
+}
+
+void bao_oocgemm_check
+     (
+       const obj_t*    alpha,
+       const oocmat_t* a,
+       const oocmat_t* b,
+       const obj_t*    beta,
+       const oocmat_t* c,
+       const cntx_t*   cntx
+     )
+{
+	err_t e_val;
+
+	( void )cntx;
+
+	// Check the matrices.
+
+	bao_oocmat_check( a );
+	bao_oocmat_check( b );
+	bao_oocmat_check( c );
+
+	e_val = bli_check_consistent_datatypes( bao_oocmat_dt( c ), bao_oocmat_dt( a ) );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_consistent_datatypes( bao_oocmat_dt( c ), bao_oocmat_dt( b ) );
+	bli_check_error_code( e_val );
+
+	// Check object dimensions.
+
+	e_val = bli_check_scalar_object( alpha );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_scalar_object( beta );
+	bli_check_error_code( e_val );
+
+	if ( bao_oocmat_length( a ) != bao_oocmat_length( c ) ||
+	     bao_oocmat_width( a )  != bao_oocmat_length( b ) ||
+	     bao_oocmat_width( b )  != bao_oocmat_width( c ) )
+		bli_check_error_code( BLIS_NONCONFORMAL_DIMENSIONS );
+}
+
@@ -0,0 +1,495 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+// pread() and pwrite() are XSI extensions of the POSIX version (200112L)
+// requested by the build system.
+#ifndef _XOPEN_SOURCE
+#define _XOPEN_SOURCE 600
+#endif
+
+#include "blis.h"
+
+#ifdef BAO_OOC_POSIX
+#include <errno.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+//
+// -- Tiles --------------------------------------------------------------------
+//
+
+void bao_ooc_tile_init
+     (
+       const oocmat_t*  x,
+             dim_t      i0,
+             dim_t      j0,
+             dim_t      mt,
+             dim_t      nt,
+             void*      buf,
+             ooctile_t* t
+     )
+{
+	const siz_t es = bli_dt_size( bao_oocmat_dt( x ) );
+
+	if ( bao_oocmat_is_fd( x ) )
+	{
+		// Store the tile in the buffer as the matrix is stored in the file.
+		t->buf = buf;
+		t->rs  = ( x->cs == 1 && x->rs != 1 ? nt : 1  );
+		t->cs  = ( x->cs == 1 && x->rs != 1 ? 1  : mt );
+	}
+	else
+	{
+		t->buf = ( char* )x->buf + ( i0 * x->rs + j0 * x->cs ) * es;
+		t->rs  = x->rs;
+		t->cs  = x->cs;
+	}
+}
+
+#ifdef BAO_OOC_POSIX
+
+// Transfer len bytes between buf and the file at offset off, retrying
+// after partial transfers and interruptions.
+static err_t bao_ooc_xfer
+     (
+       bool    write,
+       int     fd,
+       char*   buf,
+       siz_t   len,
+       int64_t off
+     )
+{
+	while ( len > 0 )
+	{
+		const ssize_t r = ( write ? pwrite( fd, buf, len, ( off_t )off )
+		                          : pread(  fd, buf, len, ( off_t )off ) );
+
+		if ( r < 0 && errno == EINTR ) continue;
+		if ( r <= 0 ) return BLIS_FAILURE;
+
+		buf += r;
+		len -= r;
+		off += r;
+	}
+
+	return BLIS_SUCCESS;
+}
+
+// Transfer the mt x nt tile of x at (i0,j0) between the file and t, one
+// row or column at a time (or all at once, if the tile is contiguous in
+// the file).
+static err_t bao_ooc_tile_xfer
+     (
+             bool       write,
+       const oocmat_t*  x,
+             dim_t      i0,
+             dim_t      j0,
+             dim_t      mt,
+             dim_t      nt,
+       const ooctile_t* t
+     )
+{
+	const siz_t es    = bli_dt_size( bao_oocmat_dt( x ) );
+	const bool  byrow = ( x->cs == 1 && x->rs != 1 );
+
+	// The number of vectors (rows or columns) of the tile, their length,
+	// and the stride between them in the file.
+	const dim_t n_vec = ( byrow ? mt : nt );
+	const dim_t len   = ( byrow ? nt : mt );
+	const inc_t ld    = ( byrow ? x->rs : x->cs );
+
+	int64_t     off   = x->offset + ( int64_t )( i0 * x->rs + j0 * x->cs ) * es;
+	char*       p     = t->buf;
+
+	if ( ld == len || n_vec == 1 )
+		return bao_ooc_xfer( write, x->fd, p, n_vec * len * es, off );
+
+	for ( dim_t v = 0; v < n_vec; ++v )
+	{
+		if ( bao_ooc_xfer( write, x->fd, p, len * es, off ) != BLIS_SUCCESS )
+			return BLIS_FAILURE;
+
+		p   += len * es;
+		off += ld * es;
+	}
+
+	return BLIS_SUCCESS;
+}
+
+// Ask the kernel to fetch the pages spanned by the mt x nt tile of the
+// mapped matrix x at (i0,j0).
+static void bao_ooc_tile_willneed
+     (
+       const oocmat_t*  x,
+             dim_t      i0,
+             dim_t      j0,
+             dim_t      mt,
+             dim_t      nt
+     )
+{
+	const siz_t     es   = bli_dt_size( bao_oocmat_dt( x ) );
+	const uintptr_t page = ( uintptr_t )sysconf( _SC_PAGESIZE );
+
+	const uintptr_t lo   = ( uintptr_t )x->buf + ( i0 * x->rs + j0 * x->cs ) * es;
+	const uintptr_t hi   = ( uintptr_t )x->buf + ( ( i0 + mt - 1 ) * x->rs +
+	                                               ( j0 + nt - 1 ) * x->cs + 1 ) * es;
+	const uintptr_t lo_p = lo & ~( page - 1 );
+
+	// This is only a hint, so any error is ignored.
+	( void )posix_madvise( ( void* )lo_p, hi - lo_p, POSIX_MADV_WILLNEED );
+}
+
+#endif
+
+err_t bao_ooc_tile_read
+     (
+       const oocmat_t*  x,
+             dim_t      i0,
+             dim_t      j0,
+             dim_t      mt,
+             dim_t      nt,
+       const ooctile_t* t
+     )
+{
+#ifdef BAO_OOC_POSIX
+	if ( mt == 0 || nt == 0 ) return BLIS_SUCCESS;
+
+	if ( bao_oocmat_is_fd( x ) )
+		return bao_ooc_tile_xfer( FALSE, x, i0, j0, mt, nt, t );
+
+	bao_ooc_tile_willneed( x, i0, j0, mt, nt );
+
+	return BLIS_SUCCESS;
+#else
+	( void )x; ( void )i0; ( void )j0; ( void )mt; ( void )nt; ( void )t;
+
+	return BLIS_FAILURE;
+#endif
+}
+
+err_t bao_ooc_tile_write
+     (
+       const oocmat_t*  x,
+             dim_t      i0,
+             dim_t      j0,
+             dim_t      mt,
+             dim_t      nt,
+       const ooctile_t* t
+     )
+{
+#ifdef BAO_OOC_POSIX
+	if ( mt == 0 || nt == 0 || !bao_oocmat_is_fd( x ) ) return BLIS_SUCCESS;
+
+	return bao_ooc_tile_xfer( TRUE, x, i0, j0, mt, nt, t );
+#else
+	( void )x; ( void )i0; ( void )j0; ( void )mt; ( void )nt; ( void )t;
+
+	return BLIS_FAILURE;
+#endif
+}
+
+//
+// -- Streaming packm hook -----------------------------------------------------
+//
+
+void bao_ooc_stream_init
+     (
+       const oocmat_t*    x,
+             bool         trans,
+             bool         inner,
+             bool         prefetch,
+             oocstream_t* s
+     )
+{
+	memset( s, 0, sizeof( oocstream_t ) );
+
+	s->x        = x;
+	s->trans    = trans;
+	s->inner    = inner;
+	s->prefetch = prefetch;
+	s->err      = BLIS_SUCCESS;
+}
+
+void bao_ooc_stream_set_tile
+     (
+       dim_t        r_lo,
+       dim_t        r_hi,
+       dim_t        c_lo,
+       dim_t        c_hi,
+       dim_t        mn_max,
+       dim_t        k_max,
+       bool         wrap,
+       oocstream_t* s
+     )
+{
+	s->r_lo   = r_lo;
+	s->r_hi   = r_hi;
+	s->c_lo   = c_lo;
+	s->c_hi   = c_hi;
+	s->mn_max = mn_max;
+	s->k_max  = k_max;
+	s->wrap   = wrap;
+}
+
+#ifdef BAO_OOC_POSIX
+
+// Fetch the region of slot (or, for a mapped matrix, ask the kernel to).
+static err_t bao_ooc_slot_fetch
+     (
+       const oocstream_t* s,
+             oocslot_t*   slot
+     )
+{
+	const dim_t i0 = ( s->trans ? slot->c0  : slot->r0  );
+	const dim_t j0 = ( s->trans ? slot->r0  : slot->c0  );
+	const dim_t mt = ( s->trans ? slot->w   : slot->len );
+	const dim_t nt = ( s->trans ? slot->len : slot->w   );
+
+	bao_ooc_tile_init( s->x, i0, j0, mt, nt, slot->buf, &slot->t );
+
+	return bao_ooc_tile_read( s->x, i0, j0, mt, nt, &slot->t );
+}
+
+static void* bao_ooc_stream_thread( void* arg )
+{
+	oocstream_t* s    = arg;
+	oocslot_t*   slot = &s->slot[ 1 - s->cur ];
+
+	slot->err = bao_ooc_slot_fetch( s, slot );
+
+	return NULL;
+}
+
+// Set the region of slot to the given block, enlarging its buffer if it is
+// too small.
+static void bao_ooc_slot_set
+     (
+       const oocstream_t* s,
+             dim_t        r0,
+             dim_t        len,
+             dim_t        c0,
+             dim_t        w,
+             oocslot_t*   slot
+     )
+{
+	const siz_t size = len * w * bli_dt_size( bao_oocmat_dt( s->x ) );
+
+	if ( bao_oocmat_is_fd( s->x ) && size > slot->size )
+	{
+		err_t r_val;
+
+		bli_free_intl( slot->buf );
+		slot->buf  = bli_malloc_intl( size, &r_val );
+		slot->size = size;
+	}
+
+	slot->r0    = r0;
+	slot->len   = len;
+	slot->c0    = c0;
+	slot->w     = w;
+	slot->valid = TRUE;
+	slot->err   = BLIS_SUCCESS;
+}
+
+// Determine the block packed after the one at (r0,c0), in the order of the
+// loops of the blocked variants. The return value is FALSE if there is none
+// for the current tile of C.
+static bool bao_ooc_stream_next
+     (
+       const oocstream_t* s,
+             dim_t        r0,
+             dim_t        len,
+             dim_t        c0,
+             dim_t        w,
+             dim_t*       r1,
+             dim_t*       c1
+     )
+{
+	if ( s->inner )
+	{
+		if      ( r0 + len < s->r_hi ) { *r1 = r0 + len; *c1 = c0;     }
+		else if ( c0 + w   < s->c_hi ) { *r1 = s->r_lo;  *c1 = c0 + w; }
+		else if ( s->wrap )            { *r1 = s->r_lo;  *c1 = s->c_lo; }
+		else return FALSE;
+	}
+	else
+	{
+		if      ( c0 + w   < s->c_hi ) { *r1 = r0;       *c1 = c0 + w;  }
+		else if ( r0 + len < s->r_hi ) { *r1 = r0 + len; *c1 = s->c_lo; }
+		else return FALSE;
+	}
+
+	return TRUE;
+}
+
+// Obtain the slot that holds the block at (r0,c0), fetching it if it was not
+// prefetched, and start fetching the block expected next. Only the chief
+// thread calls this function.
+static oocslot_t* bao_ooc_stream_get
+     (
+       oocstream_t* s,
+       dim_t        r0,
+       dim_t        len,
+       dim_t        c0,
+       dim_t        w
+     )
+{
+	// The block of the previous call has been packed, so its slot is free
+	// once any fetch in progress (into the other slot) completes.
+	if ( s->fetching )
+	{
+		bli_pthread_join( s->thread, NULL );
+		s->fetching = FALSE;
+	}
+
+	oocslot_t* slot = &s->slot[ 1 - s->cur ];
+
+	const bool hit = slot->valid && slot->err == BLIS_SUCCESS &&
+	                 slot->r0 <= r0 && r0 + len <= slot->r0 + slot->len &&
+	                 slot->c0 <= c0 && c0 + w   <= slot->c0 + slot->w;
+
+	if ( !hit )
+	{
+		bao_ooc_slot_set( s, r0, len, c0, w, slot );
+		slot->err = bao_ooc_slot_fetch( s, slot );
+	}
+
+	if ( slot->err != BLIS_SUCCESS && s->err == BLIS_SUCCESS )
+		s->err = slot->err;
+
+	s->cur = slot - s->slot;
+
+	// Fetch the next block into the other slot while this one is packed and
+	// computed with. Since the last block of each loop may be enlarged (up
+	// to the maximum blocksize), the largest possible block is fetched.
+	dim_t r1, c1;
+
+	if ( s->prefetch && bao_ooc_stream_next( s, r0, len, c0, w, &r1, &c1 ) )
+	{
+		oocslot_t* next = &s->slot[ 1 - s->cur ];
+
+		bao_ooc_slot_set( s, r1, bli_min( s->mn_max, s->r_hi - r1 ),
+		                     c1, bli_min( s->k_max,  s->c_hi - c1 ), next );
+
+		if ( bao_oocmat_is_fd( s->x ) )
+		{
+			bli_pthread_create( &s->thread, NULL, bao_ooc_stream_thread, s );
+			s->fetching = TRUE;
+		}
+		else
+		{
+			next->err = bao_ooc_slot_fetch( s, next );
+		}
+	}
+	else
+	{
+		s->slot[ 1 - s->cur ].valid = FALSE;
+	}
+
+	return slot;
+}
+
+#endif
+
+void bao_ooc_stream_free
+     (
+       oocstream_t* s
+     )
+{
+	if ( s->fetching )
+	{
+		bli_pthread_join( s->thread, NULL );
+		s->fetching = FALSE;
+	}
+
+	for ( dim_t i = 0; i < 2; ++i )
+	{
+		bli_free_intl( s->slot[ i ].buf );
+		s->slot[ i ].buf  = NULL;
+		s->slot[ i ].size = 0;
+	}
+}
+
+void bao_ooc_packm
+     (
+       const obj_t*     a,
+             obj_t*     p,
+       const cntx_t*    cntx,
+             rntm_t*    rntm,
+             cntl_t*    cntl,
+       const thrinfo_t* thread
+     )
+{
+	oocstream_t* s = bli_obj_pack_params( a );
+
+	const dim_t  r0  = bli_obj_row_off( a );
+	const dim_t  c0  = bli_obj_col_off( a );
+	const dim_t  len = bli_obj_length( a );
+	const dim_t  w   = bli_obj_width( a );
+
+	oocslot_t*   slot = NULL;
+
+#ifdef BAO_OOC_POSIX
+	if ( bli_thread_am_ochief( thread ) )
+		slot = bao_ooc_stream_get( s, r0, len, c0, w );
+#endif
+
+	slot = bli_thread_broadcast( thread, slot );
+
+	// Pack the block as an ordinary matrix: a mapped matrix in place, and
+	// a matrix accessed through a file descriptor from the staged tile.
+	obj_t a_use;
+
+	bli_obj_alias_to( a, &a_use );
+	bli_obj_set_pack_params( NULL, &a_use );
+
+	if ( bao_oocmat_is_fd( s->x ) )
+	{
+		const inc_t rs = ( s->trans ? slot->t.cs : slot->t.rs );
+		const inc_t cs = ( s->trans ? slot->t.rs : slot->t.cs );
+		const siz_t es = bli_obj_elem_size( a );
+
+		bli_obj_set_buffer( ( char* )slot->t.buf +
+		                    ( ( r0 - slot->r0 ) * rs + ( c0 - slot->c0 ) * cs ) * es,
+		                    &a_use );
+		bli_obj_set_strides( rs, cs, &a_use );
+		bli_obj_set_offs( 0, 0, &a_use );
+	}
+
+	bli_packm_blk_var1( &a_use, p, cntx, rntm, cntl, thread );
+}
@@ -0,0 +1,196 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+// The operation depends on pread(), pwrite(), posix_madvise(), and POSIX
+// threads.
+#if defined(BLIS_ENABLE_SYSTEM) && !defined(BLIS_OS_WINDOWS)
+#define BAO_OOC_POSIX
+#endif
+
+// A tile of an out-of-core matrix as it resides in memory: the address of
+// its element (0,0) and its strides. A tile of a mapped matrix is a view of
+// the mapping; a tile of a matrix accessed through a file descriptor is
+// read into (and written from) a buffer, in which it is stored by rows or
+// by columns as the matrix is in the file.
+typedef struct
+{
+	void* buf;
+	inc_t rs;
+	inc_t cs;
+
+} ooctile_t;
+
+//
+// -- Prototype the tile functions ---------------------------------------------
+//
+
+// Set t to the mt x nt tile of x at (i0,j0), using buf (which must hold mt
+// x nt elements) if x is accessed through a file descriptor.
+void bao_ooc_tile_init
+     (
+       const oocmat_t*  x,
+             dim_t      i0,
+             dim_t      j0,
+             dim_t      mt,
+             dim_t      nt,
+             void*      buf,
+             ooctile_t* t
+     );
+
+// Read (or write) the mt x nt tile t of x at (i0,j0) from (or to) the file,
+// if x is accessed through a file descriptor. For a mapped matrix, reading
+// asks the kernel to fetch the pages of the tile, and writing does nothing.
+// The return value is BLIS_SUCCESS or BLIS_FAILURE.
+err_t bao_ooc_tile_read
+     (
+       const oocmat_t*  x,
+             dim_t      i0,
+             dim_t      j0,
+             dim_t      mt,
+             dim_t      nt,
+       const ooctile_t* t
+     );
+
+err_t bao_ooc_tile_write
+     (
+       const oocmat_t*  x,
+             dim_t      i0,
+             dim_t      j0,
+             dim_t      mt,
+             dim_t      nt,
+       const ooctile_t* t
+     );
+
+//
+// -- Prototype the streaming packm hook ---------------------------------------
+//
+
+// A region of an out-of-core matrix staged in memory for packing: the
+// region in the coordinates of the object being packed (rows r0 to r0+len
+// and columns c0 to c0+w) and the tile that holds it.
+typedef struct
+{
+	void*     buf;
+	siz_t     size;
+
+	dim_t     r0, len;
+	dim_t     c0, w;
+	bool      valid;
+	err_t     err;
+
+	ooctile_t t;
+
+} oocslot_t;
+
+// The state of an operand of the out-of-core gemm whose blocks (or panels)
+// are fetched as they are packed by the blocked variants. The object being
+// packed is the matrix itself (or its transpose, if trans), and its rows
+// are partitioned by blocks of at most mn_max rows, and its columns (along
+// the k dimension) by blocks of at most k_max columns. If inner, the blocks
+// are packed in the order of the ic loop within the pc loop (as for A);
+// otherwise, in the order of the pc loop within the jc loop (as for B).
+typedef struct
+{
+	const oocmat_t* x;
+
+	bool            trans;
+	bool            inner;
+	bool            prefetch;
+
+	// The rows (r_lo to r_hi) and columns (c_lo to c_hi) of the object to
+	// be packed for the current tile of C, and whether the ic loop has more
+	// than one iteration (so that the blocks are packed again after the
+	// last one).
+	dim_t           r_lo, r_hi;
+	dim_t           c_lo, c_hi;
+	dim_t           mn_max;
+	dim_t           k_max;
+	bool            wrap;
+
+	// For an operand accessed through a file descriptor: two slots, the
+	// one being packed and the one being fetched (by a separate thread),
+	// and the first error (if any).
+	oocslot_t       slot[ 2 ];
+	dim_t           cur;
+	bool            fetching;
+	bli_pthread_t   thread;
+	err_t           err;
+
+} oocstream_t;
+
+void bao_ooc_stream_init
+     (
+       const oocmat_t*    x,
+             bool         trans,
+             bool         inner,
+             bool         prefetch,
+             oocstream_t* s
+     );
+
+// Set the rows and columns of the object to be packed for the next tile of
+// C, and how they are partitioned.
+void bao_ooc_stream_set_tile
+     (
+       dim_t        r_lo,
+       dim_t        r_hi,
+       dim_t        c_lo,
+       dim_t        c_hi,
+       dim_t        mn_max,
+       dim_t        k_max,
+       bool         wrap,
+       oocstream_t* s
+     );
+
+// Wait for any fetch in progress and free the buffers.
+void bao_ooc_stream_free
+     (
+       oocstream_t* s
+     );
+
+// The packm hook (an obj_pack_fn_t) of an object whose pack params point
+// to its oocstream_t. The chief thread fetches the block being packed (or
+// finds it already fetched) and starts fetching the block expected next;
+// all threads then pack the block with bli_packm_blk_var1().
+void bao_ooc_packm
+     (
+       const obj_t*     a,
+             obj_t*     p,
+       const cntx_t*    cntx,
+             rntm_t*    rntm,
+             cntl_t*    cntl,
+       const thrinfo_t* thread
+     );
@@ -0,0 +1,308 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#include "blis.h"
+
+//
+// -- Define the sparse matrix initialization functions ------------------------
+//
+
+void bao_spmat_init_csr
+     (
+             num_t    dt,
+             dim_t    m,
+             dim_t    n,
+       const dim_t*   row_ptr,
+       const dim_t*   col_ind,
+       const void*    val,
+             spmat_t* a
+     )
+{
+	bao_spmat_init_bsr( dt, m, n, 1, 1, row_ptr, col_ind, val, a );
+}
+
+void bao_spmat_init_bsr
+     (
+             num_t    dt,
+             dim_t    m,
+             dim_t    n,
+             dim_t    bm,
+             dim_t    bn,
+       const dim_t*   row_ptr,
+       const dim_t*   col_ind,
+       const void*    val,
+             spmat_t* a
+     )
+{
+	a->dt      = dt;
+	a->m       = m;
+	a->n       = n;
+	a->bm      = bm;
+	a->bn      = bn;
+	a->row_ptr = row_ptr;
+	a->col_ind = col_ind;
+	a->val     = val;
+}
+
+//
+// -- Define the SpMM operation's object API -----------------------------------
+//
+
+void bao_spmm
+     (
+       const obj_t*   alpha,
+       const spmat_t* a,
+       const obj_t*   b,
+       const obj_t*   beta,
+       const obj_t*   c
+     )
+{
+	bao_spmm_ex
+	(
+	  alpha,
+	  a,
+	  b,
+	  beta,
+	  c,
+	  NULL,
+	  NULL
+	);
+}
+
+void bao_spmm_ex
+     (
+       const obj_t*   alpha,
+       const spmat_t* a,
+       const obj_t*   b,
+       const obj_t*   beta,
+       const obj_t*   c,
+       const cntx_t*  cntx,
+             rntm_t*  rntm
+     )
+{
+	bli_init_once();
+
+	// Initialize a local runtime with global settings if necessary. Note
+	// that in the case that a runtime is passed in, we make a local copy.
+	rntm_t rntm_l;
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); rntm = &rntm_l; }
+	else                { rntm_l = *rntm;                       rntm = &rntm_l; }
+
+	// Obtain a valid (native) context from the gks if necessary.
+	// NOTE: This must be done before calling the _check() function, since
+	// that function assumes the context pointer is valid.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bao_spmm_check( alpha, a, b, beta, c, cntx );
+
+	// If C has a zero dimension, return early.
+	if ( bli_obj_has_zero_dim( c ) )
+	{
+		return;
+	}
+
+	// If alpha is zero or A has no columns, scale by beta and return.
+	if ( bli_obj_equals( alpha, &BLIS_ZERO ) || bao_spmat_width( a ) == 0 )
+	{
+		bli_scalm( beta, c );
+		return;
+	}
+
+	// Wrap A in a bufferless object so that it may be passed through the
+	// sup thread decorator. Only its dimensions and datatype are set; the
+	// sparse matrix itself is passed along with it.
+	obj_t a_local;
+
+	bli_obj_create_without_buffer( bli_obj_dt( c ),
+	                               bao_spmat_length( a ), bao_spmat_width( a ),
+	                               &a_local );
+	bli_obj_set_ker_params( ( void* )a, &a_local );
+
+	// Parse and interpret the contents of the rntm_t object to determine
+	// the total number of threads. The threads partition the block rows of
+	// A (and C) among themselves (see bao_spmm_var1()), so all of the
+	// parallelism is assigned to the outermost loop, for which the root
+	// thrinfo_t nodes are created.
+	bli_rntm_set_ways_for_op
+	(
+	  BLIS_GEMM,
+	  BLIS_LEFT, // ignored for gemm/hemm/symm
+	  bli_obj_length( c ), bli_obj_width( c ), bao_spmat_width( a ),
+	  rntm
+	);
+
+	bli_rntm_set_ways_only( bli_rntm_num_threads( rntm ), 1, 1, 1, 1, rntm );
+
+	// Spawn threads (if applicable), where bao_spmm_int() is the thread
+	// entry point function for each thread.
+	bli_l3_sup_thread_decorator
+	(
+	  bao_spmm_int,
+	  BLIS_GEMM, // operation family id
+	  alpha,
+	  &a_local,
+	  b,
+	  beta,
+	  c,
+	  cntx,
+	  rntm
+	);
+}
+
+//
+// -- Define the SpMM operation's thread entry point ---------------------------
+//
+
+err_t bao_spmm_int
+     (
+       const obj_t*     alpha,
+       const obj_t*     a,
+       const obj_t*     b,
+       const obj_t*     beta,
+       const obj_t*     c,
+       const cntx_t*    cntx,
+             rntm_t*    rntm,
+             thrinfo_t* thread
+     )
+{
+	// There is only one variant, which handles both CSR and BSR.
+	bao_spmm_var1
+	(
+	  alpha,
+	  a,
+	  b,
+	  beta,
+	  c,
+	  cntx,
+	  rntm,
+	  thread
+	);
+
+	return BLIS_SUCCESS;
+}
+
+//
+// -- Define the SpMM operation's typed API ------------------------------------
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+             dim_t   m, \
+             dim_t   n, \
+             dim_t   k, \
+             dim_t   bm, \
+             dim_t   bn, \
+             ctype*  alpha, \
+       const dim_t*  row_ptr, \
+       const dim_t*  col_ind, \
+       const ctype*  val, \
+             ctype*  b, inc_t rs_b, inc_t cs_b, \
+             ctype*  beta, \
+             ctype*  c, inc_t rs_c, inc_t cs_c  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	/* Determine the datatype (e.g. BLIS_FLOAT, BLIS_DOUBLE, etc.) based on
+	   the macro parameter 'ch' (e.g. s, d, etc). */ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	obj_t       alphao, bo, betao, co; \
+	spmat_t     a; \
+\
+	/* Initialize the sparse matrix. */ \
+	bao_spmat_init_bsr( dt, m, k, bm, bn, row_ptr, col_ind, val, &a ); \
+\
+	/* Create bufferless scalar objects and attach the provided scalar
+	   pointers to them. */ \
+	bli_obj_create_1x1_with_attached_buffer( dt, alpha, &alphao ); \
+	bli_obj_create_1x1_with_attached_buffer( dt, beta,  &betao ); \
+\
+	/* Create bufferless matrix objects and attach the provided matrix
+	   pointers to them. */ \
+	bli_obj_create_with_attached_buffer( dt, k, n, b, rs_b, cs_b, &bo ); \
+	bli_obj_create_with_attached_buffer( dt, m, n, c, rs_c, cs_c, &co ); \
+\
+	/* Call the object interface. */ \
+	bao_spmm \
+	( \
+	  &alphao, \
+	  &a, \
+	  &bo, \
+	  &betao, \
+	  &co  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC0( bsrmm )
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+             dim_t   m, \
+             dim_t   n, \
+             dim_t   k, \
+             ctype*  alpha, \
+       const dim_t*  row_ptr, \
+       const dim_t*  col_ind, \
+       const ctype*  val, \
+             ctype*  b, inc_t rs_b, inc_t cs_b, \
+             ctype*  beta, \
+             ctype*  c, inc_t rs_c, inc_t cs_c  \
+     ) \
+{ \
+	PASTECH2(bao_,ch,bsrmm) \
+	( \
+	  m, n, k, \
+	  1, 1, \
+	  alpha, \
+	  row_ptr, col_ind, val, \
+	  b, rs_b, cs_b, \
+	  beta, \
+	  c, rs_c, cs_c  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC0( csrmm )
+
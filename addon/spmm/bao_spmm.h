@@ -0,0 +1,199 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+//
+// -- Sparse matrix definitions ------------------------------------------------
+//
+
+// An m x n sparse matrix in block compressed sparse row (BSR) format with
+// bm x bn blocks, where bm divides m and bn divides n. Block row i (rows
+// i*bm through (i+1)*bm-1) consists of the blocks p = row_ptr[i], ...,
+// row_ptr[i+1]-1, where block p is in block column col_ind[p] and its
+// elements are stored contiguously (by rows) starting at val + p*bm*bn.
+// The compressed sparse row (CSR) format is the special case of 1 x 1
+// blocks. All indices are zero-based, and the arrays are only referenced.
+typedef struct
+{
+	num_t        dt;
+
+	dim_t        m;
+	dim_t        n;
+
+	dim_t        bm;
+	dim_t        bn;
+
+	const dim_t* row_ptr;
+	const dim_t* col_ind;
+	const void*  val;
+
+} spmat_t;
+
+BLIS_INLINE num_t bao_spmat_dt( const spmat_t* a )
+{
+	return a->dt;
+}
+
+BLIS_INLINE dim_t bao_spmat_length( const spmat_t* a )
+{
+	return a->m;
+}
+
+BLIS_INLINE dim_t bao_spmat_width( const spmat_t* a )
+{
+	return a->n;
+}
+
+BLIS_INLINE bool bao_spmat_is_csr( const spmat_t* a )
+{
+	return a->bm == 1 && a->bn == 1;
+}
+
+// Initialize a to refer to an existing matrix in CSR or BSR format.
+
+BLIS_EXPORT_ADDON void bao_spmat_init_csr
+     (
+             num_t    dt,
+             dim_t    m,
+             dim_t    n,
+       const dim_t*   row_ptr,
+       const dim_t*   col_ind,
+       const void*    val,
+             spmat_t* a
+     );
+
+BLIS_EXPORT_ADDON void bao_spmat_init_bsr
+     (
+             num_t    dt,
+             dim_t    m,
+             dim_t    n,
+             dim_t    bm,
+             dim_t    bn,
+       const dim_t*   row_ptr,
+       const dim_t*   col_ind,
+       const void*    val,
+             spmat_t* a
+     );
+
+//
+// -- Prototype the SpMM operation's object API --------------------------------
+//
+
+// Compute C := beta * C + alpha * A * B, where A is a sparse m x k matrix and
+// B and C are dense k x n and m x n matrices, respectively. (Transposition
+// and conjugation of B are honored; those of C are ignored.) As with gemm,
+// C is not read if beta is zero.
+
+BLIS_EXPORT_ADDON void bao_spmm
+     (
+       const obj_t*   alpha,
+       const spmat_t* a,
+       const obj_t*   b,
+       const obj_t*   beta,
+       const obj_t*   c
+     );
+
+BLIS_EXPORT_ADDON void bao_spmm_ex
+     (
+       const obj_t*   alpha,
+       const spmat_t* a,
+       const obj_t*   b,
+       const obj_t*   beta,
+       const obj_t*   c,
+       const cntx_t*  cntx,
+             rntm_t*  rntm
+     );
+
+//
+// -- Prototype the SpMM operation's thread entry point ------------------------
+//
+
+err_t bao_spmm_int
+     (
+       const obj_t*     alpha,
+       const obj_t*     a,
+       const obj_t*     b,
+       const obj_t*     beta,
+       const obj_t*     c,
+       const cntx_t*    cntx,
+             rntm_t*    rntm,
+             thrinfo_t* thread
+     );
+
+//
+// -- Prototype the SpMM operation's typed API ---------------------------------
+//
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_ADDON void PASTECH2(bao_,ch,opname) \
+     ( \
+             dim_t   m, \
+             dim_t   n, \
+             dim_t   k, \
+             ctype*  alpha, \
+       const dim_t*  row_ptr, \
+       const dim_t*  col_ind, \
+       const ctype*  val, \
+             ctype*  b, inc_t rs_b, inc_t cs_b, \
+             ctype*  beta, \
+             ctype*  c, inc_t rs_c, inc_t cs_c  \
+     );
+
+INSERT_GENTPROT_BASIC0( csrmm )
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_ADDON void PASTECH2(bao_,ch,opname) \
+     ( \
+             dim_t   m, \
+             dim_t   n, \
+             dim_t   k, \
+             dim_t   bm, \
+             dim_t   bn, \
+             ctype*  alpha, \
+       const dim_t*  row_ptr, \
+       const dim_t*  col_ind, \
+       const ctype*  val, \
+             ctype*  b, inc_t rs_b, inc_t cs_b, \
+             ctype*  beta, \
+             ctype*  c, inc_t rs_c, inc_t cs_c  \
+     );
+
+INSERT_GENTPROT_BASIC0( bsrmm )
+
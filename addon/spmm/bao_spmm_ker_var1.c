@@ -0,0 +1,291 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#include "blis.h"
+
+//
+// -- CSR macrokernel ----------------------------------------------------------
+//
+
+// Update rows [i0,i1) of the m x nc matrix C according to
+//
+//   C := beta * C + alpha * A * B
+//
+// where A is in CSR format and B is packed as k x NR micropanels (with
+// panel stride ps_b). For each micropanel of B (which thus remains in cache
+// while the rows are processed) and each row of C, the NR elements of the
+// row are accumulated in a temporary vector from the rows of the micropanel
+// selected by the nonzeros of the row of A, and then written to C. Since
+// each row of a micropanel is contiguous, the accumulation vectorizes along
+// the micropanel width.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTECH2(bao_,ch,varname) \
+     ( \
+             dim_t   i0, \
+             dim_t   i1, \
+             dim_t   nc, \
+       const dim_t*  row_ptr, \
+       const dim_t*  col_ind, \
+       const void*   val, \
+             void*   alpha, \
+             void*   bp, inc_t ps_b, \
+             void*   beta, \
+             void*   c, inc_t rs_c, inc_t cs_c, \
+             cntx_t* cntx  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	const dim_t NR     = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx ); \
+	const dim_t PACKNR = bli_cntx_get_blksz_max_dt( dt, BLIS_NR, cntx ); \
+\
+	const ctype* restrict val_cast   = val; \
+	      ctype* restrict alpha_cast = alpha; \
+	      ctype* restrict bp_cast    = bp; \
+	      ctype* restrict beta_cast  = beta; \
+	      ctype* restrict c_cast     = c; \
+\
+	const bool  beta0 = PASTEMAC(ch,eq0)( *beta_cast ); \
+\
+	ctype       acc[ BLIS_STACK_BUF_MAX_SIZE / sizeof( ctype ) ] \
+	                 __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+\
+	for ( dim_t q = 0; q < nc; q += NR ) \
+	{ \
+		const dim_t           nr_cur = bli_min( NR, nc - q ); \
+		const ctype* restrict b1     = bp_cast + ( q / NR ) * ps_b; \
+\
+		for ( dim_t i = i0; i < i1; ++i ) \
+		{ \
+			const dim_t           p0 = row_ptr[ i ]; \
+			const dim_t           p1 = row_ptr[ i + 1 ]; \
+			      ctype* restrict c1 = c_cast + i * rs_c + q * cs_c; \
+\
+			for ( dim_t jj = 0; jj < NR; ++jj ) \
+				PASTEMAC(ch,set0s)( acc[ jj ] ); \
+\
+			for ( dim_t p = p0; p < p1; ++p ) \
+			{ \
+				const ctype           alpha1 = val_cast[ p ]; \
+				const ctype* restrict b1p    = b1 + col_ind[ p ] * PACKNR; \
+\
+				for ( dim_t jj = 0; jj < NR; ++jj ) \
+				{ \
+					PASTEMAC(ch,axpys)( alpha1, b1p[ jj ], acc[ jj ] ); \
+				} \
+			} \
+\
+			if ( beta0 ) \
+			{ \
+				for ( dim_t jj = 0; jj < nr_cur; ++jj ) \
+				{ \
+					PASTEMAC(ch,scal2s)( *alpha_cast, acc[ jj ], c1[ jj * cs_c ] ); \
+				} \
+			} \
+			else \
+			{ \
+				for ( dim_t jj = 0; jj < nr_cur; ++jj ) \
+				{ \
+					PASTEMAC(ch,axpbys)( *alpha_cast, acc[ jj ], *beta_cast, c1[ jj * cs_c ] ); \
+				} \
+			} \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( spmm_csr_ker_var1 )
+
+//
+// -- BSR macrokernel ----------------------------------------------------------
+//
+
+// Update block rows [i0,i1) of the m x nc matrix C according to
+//
+//   C := beta * C + alpha * A * B
+//
+// where A is in BSR format with bm x bn blocks and B is packed as k x NR
+// micropanels (with panel stride ps_b). The blocks of each block row of A
+// are packed into MR x bn micropanels, a chunk of at most KC columns at a
+// time, in the buffer ap. For each micropanel of B, the gemm microkernel
+// then multiplies each packed block by the bn rows of the micropanel that
+// correspond to its block column, accumulating into the same bm x NR
+// microtiles of C (which thus remain in cache).
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTECH2(bao_,ch,varname) \
+     ( \
+             dim_t   i0, \
+             dim_t   i1, \
+             dim_t   bm, \
+             dim_t   bn, \
+             dim_t   nc, \
+       const dim_t*  row_ptr, \
+       const dim_t*  col_ind, \
+       const void*   val, \
+             void*   alpha, \
+             void*   bp, inc_t ps_b, \
+             void*   beta, \
+             void*   c, inc_t rs_c, inc_t cs_c, \
+             void*   ap, \
+             cntx_t* cntx  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	const dim_t MR     = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx ); \
+	const dim_t NR     = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx ); \
+	const dim_t KC     = bli_cntx_get_blksz_def_dt( dt, BLIS_KC, cntx ); \
+	const dim_t PACKMR = bli_cntx_get_blksz_max_dt( dt, BLIS_MR, cntx ); \
+	const dim_t PACKNR = bli_cntx_get_blksz_max_dt( dt, BLIS_NR, cntx ); \
+\
+	PASTECH(ch,gemm_ukr_ft) \
+	            gemm_ukr     = bli_cntx_get_ukr_dt( dt, BLIS_GEMM_UKR, cntx ); \
+	PASTECH2(ch,packm_cxk,_ker_ft) \
+	            packm_mr_ker = bli_cntx_get_ukr_dt( dt, BLIS_PACKM_MRXK_KER, cntx ); \
+\
+	const ctype* restrict val_cast   = val; \
+	      ctype* restrict alpha_cast = alpha; \
+	      ctype* restrict bp_cast    = bp; \
+	      ctype* restrict beta_cast  = beta; \
+	      ctype* restrict c_cast     = c; \
+	      ctype* restrict ap_cast    = ap; \
+	      ctype* restrict one        = PASTEMAC(ch,1); \
+\
+	/* The number of micropanels of each packed block, their stride, and
+	   the maximum number of blocks per chunk. */ \
+	const dim_t mp    = ( bm + MR - 1 ) / MR; \
+	      inc_t ps_a  = PACKMR * bn; \
+	ps_a += ( bli_is_odd( ps_a ) ? 1 : 0 ); \
+	const dim_t n_blk = bli_max( KC / bn, 1 ); \
+\
+	auxinfo_t aux; \
+	bli_auxinfo_set_schema_a( BLIS_PACKED_ROW_PANELS, &aux ); \
+	bli_auxinfo_set_schema_b( BLIS_PACKED_COL_PANELS, &aux ); \
+\
+	for ( dim_t i = i0; i < i1; ++i ) \
+	{ \
+		ctype* restrict c1 = c_cast + i * bm * rs_c; \
+\
+		/* Scale an empty block row of C by beta. */ \
+		if ( row_ptr[ i ] == row_ptr[ i + 1 ] ) \
+		{ \
+			for ( dim_t jj = 0; jj < nc; ++jj ) \
+			for ( dim_t ii = 0; ii < bm; ++ii ) \
+			{ \
+				ctype* restrict gamma = c1 + ii * rs_c + jj * cs_c; \
+\
+				if ( PASTEMAC(ch,eq0)( *beta_cast ) ) \
+				{ \
+					PASTEMAC(ch,set0s)( *gamma ); \
+				} \
+				else \
+				{ \
+					PASTEMAC(ch,scals)( *beta_cast, *gamma ); \
+				} \
+			} \
+\
+			continue; \
+		} \
+\
+		for ( dim_t p0 = row_ptr[ i ]; p0 < row_ptr[ i + 1 ]; p0 += n_blk ) \
+		{ \
+			const dim_t p1 = bli_min( p0 + n_blk, row_ptr[ i + 1 ] ); \
+\
+			/* Pack the blocks of the chunk. */ \
+			for ( dim_t p = p0; p < p1; ++p ) \
+			for ( dim_t ii = 0; ii < mp; ++ii ) \
+			{ \
+				packm_mr_ker \
+				( \
+				  BLIS_NO_CONJUGATE, \
+				  BLIS_PACKED_ROW_PANELS, \
+				  bli_min( MR, bm - ii * MR ), \
+				  bn, \
+				  bn, \
+				  one, \
+				  ( ctype* )val_cast + ( p * bm + ii * MR ) * bn, bn, 1, \
+				  ap_cast + ( ( p - p0 ) * mp + ii ) * ps_a,   PACKMR, \
+				  cntx  \
+				); \
+			} \
+\
+			/* Only the first chunk of the block row scales C by beta. */ \
+			ctype* restrict beta_use = ( p0 == row_ptr[ i ] ? beta_cast : one ); \
+\
+			for ( dim_t q = 0; q < nc; q += NR ) \
+			{ \
+				const dim_t     nr_cur = bli_min( NR, nc - q ); \
+				ctype* restrict b1     = bp_cast + ( q / NR ) * ps_b; \
+\
+				for ( dim_t p = p0; p < p1; ++p ) \
+				{ \
+					ctype* restrict b1p = b1 + col_ind[ p ] * bn * PACKNR; \
+\
+					for ( dim_t ii = 0; ii < mp; ++ii ) \
+					{ \
+						ctype* restrict a1 = ap_cast + ( ( p - p0 ) * mp + ii ) * ps_a; \
+\
+						bli_auxinfo_set_next_a( a1, &aux ); \
+						bli_auxinfo_set_next_b( b1p, &aux ); \
+\
+						gemm_ukr \
+						( \
+						  bli_min( MR, bm - ii * MR ), \
+						  nr_cur, \
+						  bn, \
+						  alpha_cast, \
+						  a1, \
+						  b1p, \
+						  ( p == p0 ? beta_use : one ), \
+						  c1 + ii * MR * rs_c + q * cs_c, rs_c, cs_c, \
+						  &aux, \
+						  cntx  \
+						); \
+					} \
+				} \
+			} \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( spmm_bsr_ker_var1 )
+
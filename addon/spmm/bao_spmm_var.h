@@ -0,0 +1,113 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+//
+// Prototype the object-based variant interfaces.
+//
+
+void bao_spmm_var1
+     (
+       const obj_t*     alpha,
+       const obj_t*     a,
+       const obj_t*     b,
+       const obj_t*     beta,
+       const obj_t*     c,
+       const cntx_t*    cntx,
+             rntm_t*    rntm,
+             thrinfo_t* thread
+     );
+
+//
+// Prototype the nnz-weighted partitioning of block rows.
+//
+
+void bao_spmm_thread_range_nnz
+     (
+       const thrinfo_t* thread,
+             dim_t      mb,
+       const dim_t*     row_ptr,
+             dim_t*     start,
+             dim_t*     end
+     );
+
+//
+// Prototype the typed macrokernels.
+//
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, varname ) \
+\
+void PASTECH2(bao_,ch,varname) \
+     ( \
+             dim_t   i0, \
+             dim_t   i1, \
+             dim_t   nc, \
+       const dim_t*  row_ptr, \
+       const dim_t*  col_ind, \
+       const void*   val, \
+             void*   alpha, \
+             void*   bp, inc_t ps_b, \
+             void*   beta, \
+             void*   c, inc_t rs_c, inc_t cs_c, \
+             cntx_t* cntx  \
+     );
+
+INSERT_GENTPROT_BASIC0( spmm_csr_ker_var1 )
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, varname ) \
+\
+void PASTECH2(bao_,ch,varname) \
+     ( \
+             dim_t   i0, \
+             dim_t   i1, \
+             dim_t   bm, \
+             dim_t   bn, \
+             dim_t   nc, \
+       const dim_t*  row_ptr, \
+       const dim_t*  col_ind, \
+       const void*   val, \
+             void*   alpha, \
+             void*   bp, inc_t ps_b, \
+             void*   beta, \
+             void*   c, inc_t rs_c, inc_t cs_c, \
+             void*   ap, \
+             cntx_t* cntx  \
+     );
+
+INSERT_GENTPROT_BASIC0( spmm_bsr_ker_var1 )
+
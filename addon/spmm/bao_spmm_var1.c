@@ -0,0 +1,323 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#include "blis.h"
+
+#define FUNCPTR_T spmm_fp
+
+typedef void (*FUNCPTR_T)
+     (
+             dim_t   i0,
+             dim_t   i1,
+             dim_t   bm,
+             dim_t   bn,
+             dim_t   nc,
+       const dim_t*  row_ptr,
+       const dim_t*  col_ind,
+       const void*   val,
+             void*   alpha,
+             void*   bp, inc_t ps_b,
+             void*   beta,
+             void*   c, inc_t rs_c, inc_t cs_c,
+             void*   ap,
+             cntx_t* cntx
+     );
+
+//
+// -- nnz-weighted partitioning ------------------------------------------------
+//
+
+// Partition the mb block rows of a sparse matrix among the threads of a
+// thrinfo_t node so that each receives (about) the same weight, where the
+// weight of a block row is its number of blocks plus one (for the update of
+// the corresponding rows of C, which is needed even if the row is empty).
+// The range assigned to the calling thread is returned in [start,end).
+
+static dim_t bao_spmm_find_weight
+     (
+             dim_t  mb,
+       const dim_t* row_ptr,
+             dim_t  w
+     )
+{
+	// Return the smallest r in [0,mb] whose leading block rows [0,r) weigh
+	// at least w.
+	dim_t lo = 0;
+	dim_t hi = mb;
+
+	while ( lo < hi )
+	{
+		const dim_t mid = lo + ( hi - lo ) / 2;
+
+		if ( ( row_ptr[ mid ] - row_ptr[ 0 ] ) + mid < w ) lo = mid + 1;
+		else                                               hi = mid;
+	}
+
+	return lo;
+}
+
+void bao_spmm_thread_range_nnz
+     (
+       const thrinfo_t* thread,
+             dim_t      mb,
+       const dim_t*     row_ptr,
+             dim_t*     start,
+             dim_t*     end
+     )
+{
+	const dim_t nt  = bli_thread_n_way( thread );
+	const dim_t tid = bli_thread_work_id( thread );
+
+	const double w  = ( double )( row_ptr[ mb ] - row_ptr[ 0 ] + mb );
+
+	*start = bao_spmm_find_weight( mb, row_ptr, ( dim_t )( w * ( tid     ) / nt ) );
+	*end   = ( tid == nt - 1 ? mb
+	         : bao_spmm_find_weight( mb, row_ptr, ( dim_t )( w * ( tid + 1 ) / nt ) ) );
+}
+
+//
+// -- SpMM (object interface) --------------------------------------------------
+//
+
+// Adapt the CSR macrokernel to the signature of the BSR macrokernel so that
+// both can be stored in the same function pointer array.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTECH2(bao_,ch,opname) \
+     ( \
+             dim_t   i0, \
+             dim_t   i1, \
+             dim_t   bm, \
+             dim_t   bn, \
+             dim_t   nc, \
+       const dim_t*  row_ptr, \
+       const dim_t*  col_ind, \
+       const void*   val, \
+             void*   alpha, \
+             void*   bp, inc_t ps_b, \
+             void*   beta, \
+             void*   c, inc_t rs_c, inc_t cs_c, \
+             void*   ap, \
+             cntx_t* cntx  \
+     ) \
+{ \
+	( void )bm; \
+	( void )bn; \
+	( void )ap; \
+\
+	PASTECH2(bao_,ch,spmm_csr_ker_var1) \
+	( \
+	  i0, i1, nc, \
+	  row_ptr, col_ind, val, \
+	  alpha, \
+	  bp, ps_b, \
+	  beta, \
+	  c, rs_c, cs_c, \
+	  cntx  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC0( spmm_csr_ker )
+
+static FUNCPTR_T GENARRAY_PREF(ftypes_csr,bao_,spmm_csr_ker);
+static FUNCPTR_T GENARRAY_PREF(ftypes_bsr,bao_,spmm_bsr_ker_var1);
+
+// In each iteration of the outermost loop, a block of at most NC columns of
+// B is packed into NR-column micropanels by the same
+// packing variant as the gemm operation, bli_packm_blk_var1(), with all
+// threads cooperating. Since each row of A refers to arbitrary rows of B,
+// the block spans all rows of B (rather than KC of them). Each thread then
+// updates its block rows of C, which are assigned according to the number
+// of blocks (nonzeros) of A in each, so that the threads are balanced even
+// when the numbers of nonzeros of the rows vary widely.
+//
+// For a matrix in CSR format, each element of a row of C is accumulated
+// from the corresponding rows of the packed micropanels of B. For a matrix
+// in BSR format, the blocks of each block row of A are packed into MR x bn
+// micropanels (in chunks of at most KC columns), which are reused for all
+// micropanels of B, and each block is multiplied by the gemm microkernel.
+
+void bao_spmm_var1
+     (
+       const obj_t*     alpha,
+       const obj_t*     a,
+       const obj_t*     b,
+       const obj_t*     beta,
+       const obj_t*     c,
+       const cntx_t*    cntx,
+             rntm_t*    rntm,
+             thrinfo_t* thread
+     )
+{
+	const spmat_t* a_sp   = bli_obj_ker_params( a );
+
+	const num_t    dt      = bli_obj_dt( c );
+	const dim_t    dt_size = bli_dt_size( dt );
+
+	const dim_t    k      = bao_spmat_width( a_sp );
+	const dim_t    n      = bli_obj_width( c );
+	const dim_t    bm     = a_sp->bm;
+	const dim_t    bn     = a_sp->bn;
+	const dim_t    mb     = bao_spmat_length( a_sp ) / bm;
+
+	const dim_t    MR     = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx );
+	const dim_t    NC     = bli_cntx_get_blksz_def_dt( dt, BLIS_NC, cntx );
+	const dim_t    KC     = bli_cntx_get_blksz_def_dt( dt, BLIS_KC, cntx );
+	const dim_t    PACKMR = bli_cntx_get_blksz_max_dt( dt, BLIS_MR, cntx );
+
+	char*          c_cast = bli_obj_buffer_at_off( c );
+	const inc_t    rs_c   = bli_obj_row_stride( c );
+	const inc_t    cs_c   = bli_obj_col_stride( c );
+	void*          buf_alpha = bli_obj_buffer_for_1x1( dt, alpha );
+	void*          buf_beta  = bli_obj_buffer_for_1x1( dt, beta );
+
+	const bool     is_csr = bao_spmat_is_csr( a_sp );
+	FUNCPTR_T      f      = ( is_csr ? ftypes_csr[dt] : ftypes_bsr[dt] );
+
+	// Create a control tree node for packing B, which is private to this
+	// thread but whose packing buffer (cached in the node) is shared.
+	cntl_t* cntl = bli_packm_cntl_create_node
+	(
+	  rntm,
+	  NULL,    // the variant is called directly (see below)
+	  BLIS_NR,
+	  BLIS_KR,
+	  FALSE,   // do NOT invert diagonal
+	  FALSE,   // reverse iteration if upper?
+	  FALSE,   // reverse iteration if lower?
+	  BLIS_PACKED_COL_PANELS,
+	  BLIS_BUFFER_FOR_B_PANEL,
+	  NULL
+	);
+
+	// Determine this thread's block rows.
+	dim_t i0, i1;
+	bao_spmm_thread_range_nnz( thread, mb, a_sp->row_ptr, &i0, &i1 );
+
+	// For BSR, acquire a buffer private to this thread for the packed
+	// blocks of (a chunk of) one block row of A.
+	mem_t mem_a = BLIS_MEM_INITIALIZER;
+	void* ap    = NULL;
+
+	if ( !is_csr )
+	{
+		const dim_t n_blk = bli_max( KC / bn, 1 );
+		      inc_t ps_a  = PACKMR * bn;
+		ps_a += ( bli_is_odd( ps_a ) ? 1 : 0 );
+
+		bli_pba_acquire_m
+		(
+		  rntm,
+		  n_blk * ( ( bm + MR - 1 ) / MR ) * ps_a * dt_size,
+		  BLIS_BUFFER_FOR_GEN_USE,
+		  &mem_a
+		);
+
+		ap = bli_mem_buffer( &mem_a );
+	}
+
+	obj_t b_local;
+
+	// Alias B so that any transposition is absorbed into its strides.
+	bli_obj_alias_to( b, &b_local );
+
+	if ( bli_obj_has_trans( &b_local ) )
+	{
+		bli_obj_induce_trans( &b_local );
+		bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, &b_local );
+	}
+
+	for ( dim_t jc = 0; jc < n; jc += NC )
+	{
+		const dim_t nc = bli_min( NC, n - jc );
+
+		obj_t b1, bt1, bt1_pack;
+
+		// Pack B1 as k x NR micropanels, which (as in bli_l3_packb()) is
+		// done by packing B1^T. (As for gemm, alpha is applied by the
+		// macrokernels rather than during packing.)
+		bli_acquire_mpart( 0, jc, k, nc, &b_local, &b1 );
+		bli_obj_alias_to( &b1, &bt1 );
+		bli_obj_induce_trans( &bt1 );
+
+		// Wait until all threads are done with the previous block of B.
+		bli_thread_barrier( thread );
+
+		bli_packm_blk_var1
+		(
+		  &bt1,
+		  &bt1_pack,
+		  cntx,
+		  rntm,
+		  cntl,
+		  thread
+		);
+
+		bli_thread_barrier( thread );
+
+		void* bp   = bli_obj_buffer( &bt1_pack );
+		inc_t ps_b = bli_obj_panel_stride( &bt1_pack );
+
+		f
+		(
+		  i0, i1,
+		  bm, bn,
+		  nc,
+		  a_sp->row_ptr,
+		  a_sp->col_ind,
+		  a_sp->val,
+		  buf_alpha,
+		  bp, ps_b,
+		  buf_beta,
+		  c_cast + jc * cs_c * dt_size, rs_c, cs_c,
+		  ap,
+		  ( cntx_t* )cntx
+		);
+	}
+
+	// Release the buffers. The packing buffer for B is released by the
+	// chief thread once all threads are done with it.
+	if ( !is_csr )
+		bli_pba_release( rntm, &mem_a );
+
+	bli_thread_barrier( thread );
+
+	bli_cntl_free( rntm, cntl, thread );
+}
+
@@ -0,0 +1,519 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+//
+// -- One level of Strassen ----------------------------------------------------
+//
+
+// The seven products of one level of Strassen, expressed in terms of the
+// 2x2 partitionings of A, B, and C:
+//
+//   M1 = ( A00 + A11 )( B00 + B11 );  C00 += M1;  C11 += M1;
+//   M2 = ( A10 + A11 )  B00;          C10 += M2;  C11 -= M2;
+//   M3 =   A00        ( B01 - B11 );  C01 += M3;  C11 += M3;
+//   M4 =   A11        ( B10 - B00 );  C00 += M4;  C10 += M4;
+//   M5 = ( A00 + A01 )  B11;          C00 -= M5;  C01 += M5;
+//   M6 = ( A10 - A00 )( B00 + B01 );  C11 += M6;
+//   M7 = ( A01 - A11 )( B10 + B11 );  C00 += M7;
+
+static const strassen_prod_t bao_strassen_one_level[ 7 ] =
+{
+	{ 2, 2, 2, { { 0, 0,  1.0 }, { 1, 1,  1.0 } },
+	           { { 0, 0,  1.0 }, { 1, 1,  1.0 } },
+	           { { 0, 0,  1.0 }, { 1, 1,  1.0 } } },
+	{ 2, 1, 2, { { 1, 0,  1.0 }, { 1, 1,  1.0 } },
+	           { { 0, 0,  1.0 } },
+	           { { 1, 0,  1.0 }, { 1, 1, -1.0 } } },
+	{ 1, 2, 2, { { 0, 0,  1.0 } },
+	           { { 0, 1,  1.0 }, { 1, 1, -1.0 } },
+	           { { 0, 1,  1.0 }, { 1, 1,  1.0 } } },
+	{ 1, 2, 2, { { 1, 1,  1.0 } },
+	           { { 1, 0,  1.0 }, { 0, 0, -1.0 } },
+	           { { 0, 0,  1.0 }, { 1, 0,  1.0 } } },
+	{ 2, 1, 2, { { 0, 0,  1.0 }, { 0, 1,  1.0 } },
+	           { { 1, 1,  1.0 } },
+	           { { 0, 0, -1.0 }, { 0, 1,  1.0 } } },
+	{ 2, 2, 1, { { 1, 0,  1.0 }, { 0, 0, -1.0 } },
+	           { { 0, 0,  1.0 }, { 0, 1,  1.0 } },
+	           { { 1, 1,  1.0 } } },
+	{ 2, 2, 1, { { 0, 1,  1.0 }, { 1, 1, -1.0 } },
+	           { { 1, 0,  1.0 }, { 1, 1,  1.0 } },
+	           { { 0, 0,  1.0 } } },
+};
+
+// Refine the terms in x (which refer to blocks of a 2^l x 2^l partitioning)
+// by the terms in y (which refer to blocks of a 2x2 partitioning), storing
+// the Kronecker product of the two term lists, which refer to blocks of a
+// 2^(l+1) x 2^(l+1) partitioning, to z.
+static dim_t bao_strassen_refine_terms
+     (
+             dim_t            n_x,
+       const strassen_term_t* x,
+             dim_t            n_y,
+       const strassen_term_t* y,
+             strassen_term_t* z
+     )
+{
+	dim_t n_z = 0;
+
+	for ( dim_t ix = 0; ix < n_x; ++ix )
+	for ( dim_t iy = 0; iy < n_y; ++iy )
+	{
+		z[ n_z ].i    = 2 * x[ ix ].i + y[ iy ].i;
+		z[ n_z ].j    = 2 * x[ ix ].j + y[ iy ].j;
+		z[ n_z ].coef = x[ ix ].coef * y[ iy ].coef;
+		++n_z;
+	}
+
+	return n_z;
+}
+
+void bao_strassen_plan_init
+     (
+       dim_t            levels,
+       strassen_plan_t* plan
+     )
+{
+	// Begin with a single product of the unpartitioned operands, which is
+	// equivalent to zero levels of Strassen.
+	strassen_prod_t* prod0 = &plan->prod[ 0 ];
+
+	prod0->n_a = prod0->n_b = prod0->n_c = 1;
+	prod0->a[ 0 ] = prod0->b[ 0 ] = prod0->c[ 0 ] = ( strassen_term_t ){ 0, 0, 1.0 };
+
+	plan->levels = 0;
+	plan->n_prod = 1;
+
+	// Each additional level replaces every product in the plan with the
+	// seven products of one level of Strassen applied to its operands.
+	// Iterating backwards allows the plan to be refined in place, since the
+	// seven products that replace product p are stored at 7p through 7p+6.
+	for ( dim_t l = 0; l < levels; ++l )
+	{
+		for ( dim_t p = plan->n_prod - 1; 0 <= p; --p )
+		{
+			const strassen_prod_t prod = plan->prod[ p ];
+
+			for ( dim_t s = 0; s < 7; ++s )
+			{
+				const strassen_prod_t* sprod = &bao_strassen_one_level[ s ];
+				      strassen_prod_t* rprod = &plan->prod[ 7 * p + s ];
+
+				rprod->n_a = bao_strassen_refine_terms( prod.n_a, prod.a,
+				                                        sprod->n_a, sprod->a, rprod->a );
+				rprod->n_b = bao_strassen_refine_terms( prod.n_b, prod.b,
+				                                        sprod->n_b, sprod->b, rprod->b );
+				rprod->n_c = bao_strassen_refine_terms( prod.n_c, prod.c,
+				                                        sprod->n_c, sprod->c, rprod->c );
+			}
+		}
+
+		plan->levels += 1;
+		plan->n_prod *= 7;
+	}
+}
+
+dim_t bao_strassen_auto_levels
+     (
+       num_t dt,
+       dim_t m,
+       dim_t n,
+       dim_t k
+     )
+{
+	dim_t crossover;
+
+	if      ( dt == BLIS_FLOAT    ) crossover = BAO_STRASSEN_CROSSOVER_S;
+	else if ( dt == BLIS_DOUBLE   ) crossover = BAO_STRASSEN_CROSSOVER_D;
+	else if ( dt == BLIS_SCOMPLEX ) crossover = BAO_STRASSEN_CROSSOVER_C;
+	else                            crossover = BAO_STRASSEN_CROSSOVER_Z;
+
+	const dim_t mnk_min = bli_min( m, bli_min( n, k ) );
+
+	// Apply another level only if the resulting submatrix products are
+	// still at least as large as the crossover point in every dimension.
+	dim_t levels = 0;
+
+	while ( levels < BAO_STRASSEN_MAX_LEVELS &&
+	        ( mnk_min >> ( levels + 1 ) ) >= crossover )
+		++levels;
+
+	return levels;
+}
+
+//
+// -- Define the Strassen operation's object API -------------------------------
+//
+
+void bao_strassen
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c
+     )
+{
+	bao_strassen_ex
+	(
+	  alpha,
+	  a,
+	  b,
+	  beta,
+	  c,
+	  BAO_STRASSEN_AUTO,
+	  NULL,
+	  NULL
+	);
+}
+
+void bao_strassen_ex
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c,
+             dim_t   levels,
+       const cntx_t* cntx,
+             rntm_t* rntm
+     )
+{
+	bli_init_once();
+
+	// Initialize a local runtime with global settings if necessary. Note
+	// that in the case that a runtime is passed in, we make a local copy.
+	rntm_t rntm_l;
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); rntm = &rntm_l; }
+	else                { rntm_l = *rntm;                       rntm = &rntm_l; }
+
+	// Obtain a valid (native) context from the gks if necessary.
+	// NOTE: This must be done before calling the _check() function, since
+	// that function assumes the context pointer is valid.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bao_strassen_check( alpha, a, b, beta, c, levels, cntx );
+
+	// Choose the number of levels, if requested.
+	if ( levels == BAO_STRASSEN_AUTO )
+		levels = bao_strassen_auto_levels( bli_obj_dt( c ),
+		                                   bli_obj_length( c ),
+		                                   bli_obj_width( c ),
+		                                   bli_obj_width_after_trans( a ) );
+
+	// If no levels of Strassen are to be applied, this is simply gemm.
+	if ( levels == 0 )
+	{
+		bli_gemm_ex( alpha, a, b, beta, c, cntx, rntm );
+		return;
+	}
+
+	// -- bao_strassen_front() -------------------------------------------------
+
+	obj_t a_local;
+	obj_t b_local;
+	obj_t c_local;
+
+	// If C has a zero dimension, return early.
+	if ( bli_obj_has_zero_dim( c ) )
+	{
+		return;
+	}
+
+	// If alpha is zero, or if A or B has a zero dimension, scale C by beta
+	// and return early.
+	if ( bli_obj_equals( alpha, &BLIS_ZERO ) ||
+	     bli_obj_has_zero_dim( a ) ||
+	     bli_obj_has_zero_dim( b ) )
+	{
+		bli_scalm( beta, c );
+		return;
+	}
+
+	// Alias A, B, and C in case we need to apply transformations.
+	bli_obj_alias_to( a, &a_local );
+	bli_obj_alias_to( b, &b_local );
+	bli_obj_alias_to( c, &c_local );
+
+	// Induce a transposition of A if it has its transposition property set.
+	// Then clear the transposition bit in the object.
+	if ( bli_obj_has_trans( &a_local ) )
+	{
+		bli_obj_induce_trans( &a_local );
+		bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, &a_local );
+	}
+
+	// Induce a transposition of B if it has its transposition property set.
+	// Then clear the transposition bit in the object.
+	if ( bli_obj_has_trans( &b_local ) )
+	{
+		bli_obj_induce_trans( &b_local );
+		bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, &b_local );
+	}
+
+	// An optimization: If C is stored by rows and the micro-kernel prefers
+	// contiguous columns, or if C is stored by columns and the micro-kernel
+	// prefers contiguous rows, transpose the entire operation to allow the
+	// micro-kernel to access elements of C in its preferred manner.
+	if ( bli_cntx_dislikes_storage_of( &c_local, BLIS_GEMM_VIR_UKR, cntx ) )
+	{
+		bli_obj_swap( &a_local, &b_local );
+
+		bli_obj_induce_trans( &a_local );
+		bli_obj_induce_trans( &b_local );
+		bli_obj_induce_trans( &c_local );
+	}
+
+	const dim_t m = bli_obj_length( &c_local );
+	const dim_t n = bli_obj_width( &c_local );
+	const dim_t k = bli_obj_width( &a_local );
+
+	// Strassen is applied to the leading m_s x n_s x k_s subproblem, whose
+	// dimensions are multiples of 2^levels. The remaining rows, columns, and
+	// rank-k update (each fewer than 2^levels wide) are computed with gemm.
+	const dim_t m_s = ( m >> levels ) << levels;
+	const dim_t n_s = ( n >> levels ) << levels;
+	const dim_t k_s = ( k >> levels ) << levels;
+
+	// Save a copy of the rntm_t for the gemm calls below, since the copy
+	// used for the Strassen subproblem is modified.
+	rntm_t rntm_g = *rntm;
+
+	if ( m_s > 0 && n_s > 0 && k_s > 0 )
+	{
+		obj_t a_s, b_s, c_s;
+
+		bli_acquire_mpart( 0, 0, m_s, k_s, &a_local, &a_s );
+		bli_acquire_mpart( 0, 0, k_s, n_s, &b_local, &b_s );
+		bli_acquire_mpart( 0, 0, m_s, n_s, &c_local, &c_s );
+
+		// Each block of C is updated by several products, so beta is applied
+		// once, up front: either along with the remainder of the k dimension
+		// (if any), or by scaling. (This must precede attaching the plan to
+		// C below.)
+		if ( k_s < k )
+		{
+			obj_t a_k, b_k;
+
+			bli_acquire_mpart( 0,   k_s, m_s, k - k_s, &a_local, &a_k );
+			bli_acquire_mpart( k_s, 0,   k - k_s, n_s, &b_local, &b_k );
+
+			bli_gemm_ex( alpha, &a_k, &b_k, beta, &c_s, cntx, &rntm_g );
+		}
+		else if ( !bli_obj_equals( beta, &BLIS_ONE ) )
+		{
+			bli_scalm( beta, &c_s );
+		}
+
+		// Build the plan and pass it along with C.
+		strassen_plan_t plan;
+		bao_strassen_plan_init( levels, &plan );
+		bli_obj_set_ker_params( &plan, &c_s );
+
+		// Parse and interpret the contents of the rntm_t object to properly
+		// set the ways of parallelism for each loop, and then make any
+		// additional modifications necessary for the current operation.
+		// Each thread computes the same portion of every product, so the
+		// ways are chosen based on the dimensions of the products.
+		bli_rntm_set_ways_for_op
+		(
+		  BLIS_GEMM,
+		  BLIS_LEFT, // ignored for gemm/hemm/symm
+		  m_s >> levels,
+		  n_s >> levels,
+		  k_s >> levels,
+		  rntm
+		);
+
+		// Both A and B are always packed. Note that the sup thrinfo_t tree
+		// only creates the communicators needed to share packed blocks among
+		// threads when these fields are set.
+		bli_rntm_set_pack_a( TRUE, rntm );
+		bli_rntm_set_pack_b( TRUE, rntm );
+
+		// Spawn threads (if applicable), where bao_strassen_int() is the
+		// thread entry point function for each thread. This also begins the
+		// process of creating the thrinfo_t tree, which contains thread
+		// communicators.
+		bli_l3_sup_thread_decorator
+		(
+		  bao_strassen_int,
+		  BLIS_GEMM, // operation family id
+		  alpha,
+		  &a_s,
+		  &b_s,
+		  &BLIS_ONE,
+		  &c_s,
+		  cntx,
+		  rntm
+		);
+	}
+	else
+	{
+		// The subproblem is empty (some dimension is smaller than
+		// 2^levels), so the entire operation is simply gemm.
+		bli_gemm_ex( alpha, a, b, beta, c, cntx, &rntm_g );
+		return;
+	}
+
+	// Compute the remaining rows of C.
+	if ( m_s < m )
+	{
+		obj_t a_m, c_m;
+
+		bli_acquire_mpart( m_s, 0, m - m_s, k, &a_local, &a_m );
+		bli_acquire_mpart( m_s, 0, m - m_s, n, &c_local, &c_m );
+
+		bli_gemm_ex( alpha, &a_m, &b_local, beta, &c_m, cntx, &rntm_g );
+	}
+
+	// Compute the remaining columns of C (excluding the rows above).
+	if ( n_s < n )
+	{
+		obj_t a_n, b_n, c_n;
+
+		bli_acquire_mpart( 0, 0,   m_s, k,       &a_local, &a_n );
+		bli_acquire_mpart( 0, n_s, k,   n - n_s, &b_local, &b_n );
+		bli_acquire_mpart( 0, n_s, m_s, n - n_s, &c_local, &c_n );
+
+		bli_gemm_ex( alpha, &a_n, &b_n, beta, &c_n, cntx, &rntm_g );
+	}
+}
+
+//
+// -- Define the Strassen operation's thread entry point -----------------------
+//
+
+err_t bao_strassen_int
+     (
+       const obj_t*     alpha,
+       const obj_t*     a,
+       const obj_t*     b,
+       const obj_t*     beta,
+       const obj_t*     c,
+       const cntx_t*    cntx,
+             rntm_t*    rntm,
+             thrinfo_t* thread
+     )
+{
+	// In this function, we choose the Strassen implementation that is
+	// executed on each thread.
+
+	// Call the block-panel algorithm.
+	bao_strassen_bp_var1
+	(
+	  alpha,
+	  a,
+	  b,
+	  beta,
+	  c,
+	  cntx,
+	  rntm,
+	  thread
+	);
+
+	return BLIS_SUCCESS;
+}
+
+//
+// -- Define the Strassen operation's typed API --------------------------------
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  b, inc_t rs_b, inc_t cs_b, \
+       ctype*  beta, \
+       ctype*  c, inc_t rs_c, inc_t cs_c  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	/* Determine the datatype (e.g. BLIS_FLOAT, BLIS_DOUBLE, etc.) based on
+	   the macro parameter 'ch' (e.g. s, d, etc). */ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	obj_t       alphao, ao, bo, betao, co; \
+\
+	dim_t       m_a, n_a; \
+	dim_t       m_b, n_b; \
+\
+	/* Adjust the dimensions of matrices A and B according to the transa and
+	   transb parameters. */ \
+	bli_set_dims_with_trans( transa, m, k, &m_a, &n_a ); \
+	bli_set_dims_with_trans( transb, k, n, &m_b, &n_b ); \
+\
+	/* Create bufferless scalar objects and attach the provided scalar pointers
+	   to those scalar objects. */ \
+	bli_obj_create_1x1_with_attached_buffer( dt, alpha, &alphao ); \
+	bli_obj_create_1x1_with_attached_buffer( dt, beta,  &betao  ); \
+\
+	/* Create bufferless matrix objects and attach the provided matrix pointers
+	   to those matrix objects. */ \
+	bli_obj_create_with_attached_buffer( dt, m_a, n_a, a, rs_a, cs_a, &ao ); \
+	bli_obj_create_with_attached_buffer( dt, m_b, n_b, b, rs_b, cs_b, &bo ); \
+	bli_obj_create_with_attached_buffer( dt, m,   n,   c, rs_c, cs_c, &co ); \
+\
+	/* Set the transposition/conjugation properties of the objects for matrices
+	   A and B. */ \
+	bli_obj_set_conjtrans( transa, &ao ); \
+	bli_obj_set_conjtrans( transb, &bo ); \
+\
+	/* Call the object interface. */ \
+	PASTECH(bao_,opname) \
+	( \
+	  &alphao, \
+	  &ao, \
+	  &bo, \
+	  &betao, \
+	  &co  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC0( strassen )
+
@@ -0,0 +1,180 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+//
+// -- Strassen plan definitions ------------------------------------------------
+//
+
+// The maximum number of levels of Strassen that may be applied. Each level
+// partitions every operand into 2x2 blocks and replaces eight block products
+// with seven, so that a plan with L levels consists of 7^L products, each of
+// which sums up to 2^L submatrices of A, up to 2^L submatrices of B, and
+// updates up to 2^L submatrices of C.
+#define BAO_STRASSEN_MAX_LEVELS  2
+#define BAO_STRASSEN_MAX_TERMS   4
+#define BAO_STRASSEN_MAX_PRODS  49
+
+// When passed in as the number of levels, the number of levels is chosen
+// automatically based on the problem size (see bao_strassen_auto_levels()).
+#define BAO_STRASSEN_AUTO       -1
+
+// The smallest submatrix dimension (after partitioning) for which the
+// automatic crossover applies another level of Strassen. Below this size,
+// the additional packing and C update traffic of ABC Strassen outweighs the
+// savings in flops. These may be overridden at compile-time.
+#ifndef BAO_STRASSEN_CROSSOVER_S
+#define BAO_STRASSEN_CROSSOVER_S  3072
+#endif
+#ifndef BAO_STRASSEN_CROSSOVER_D
+#define BAO_STRASSEN_CROSSOVER_D  2048
+#endif
+#ifndef BAO_STRASSEN_CROSSOVER_C
+#define BAO_STRASSEN_CROSSOVER_C  2048
+#endif
+#ifndef BAO_STRASSEN_CROSSOVER_Z
+#define BAO_STRASSEN_CROSSOVER_Z  1536
+#endif
+
+// One term of a Strassen product: the submatrix in block row i and block
+// column j (of the 2^L x 2^L partitioning) scaled by coef, which is +1 or -1.
+typedef struct
+{
+	dim_t  i;
+	dim_t  j;
+	double coef;
+} strassen_term_t;
+
+// One Strassen product: M = ( sum of A terms )( sum of B terms ), which is
+// then added to each of the C terms.
+typedef struct
+{
+	dim_t           n_a;
+	dim_t           n_b;
+	dim_t           n_c;
+	strassen_term_t a[ BAO_STRASSEN_MAX_TERMS ];
+	strassen_term_t b[ BAO_STRASSEN_MAX_TERMS ];
+	strassen_term_t c[ BAO_STRASSEN_MAX_TERMS ];
+} strassen_prod_t;
+
+// A complete plan for some number of levels of Strassen.
+typedef struct
+{
+	dim_t           levels;
+	dim_t           n_prod;
+	strassen_prod_t prod[ BAO_STRASSEN_MAX_PRODS ];
+} strassen_plan_t;
+
+//
+// -- Prototype the Strassen operation's object API ----------------------------
+//
+
+BLIS_EXPORT_ADDON void bao_strassen
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c
+     );
+
+BLIS_EXPORT_ADDON void bao_strassen_ex
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c,
+             dim_t   levels,
+       const cntx_t* cntx,
+             rntm_t* rntm
+     );
+
+//
+// -- Prototype the Strassen operation's thread entry point --------------------
+//
+
+err_t bao_strassen_int
+     (
+       const obj_t*     alpha,
+       const obj_t*     a,
+       const obj_t*     b,
+       const obj_t*     beta,
+       const obj_t*     c,
+       const cntx_t*    cntx,
+             rntm_t*    rntm,
+             thrinfo_t* thread
+     );
+
+//
+// -- Prototype the Strassen plan and crossover functions ----------------------
+//
+
+BLIS_EXPORT_ADDON dim_t bao_strassen_auto_levels
+     (
+       num_t dt,
+       dim_t m,
+       dim_t n,
+       dim_t k
+     );
+
+void bao_strassen_plan_init
+     (
+       dim_t            levels,
+       strassen_plan_t* plan
+     );
+
+//
+// -- Prototype the Strassen operation's typed API -----------------------------
+//
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_ADDON void PASTECH2(bao_,ch,opname) \
+     ( \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  b, inc_t rs_b, inc_t cs_b, \
+       ctype*  beta, \
+       ctype*  c, inc_t rs_c, inc_t cs_c  \
+     );
+
+INSERT_GENTPROT_BASIC0( strassen )
+
@@ -0,0 +1,595 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#define FUNCPTR_T strassen_fp
+
+typedef void (*FUNCPTR_T)
+     (
+             conj_t           conja,
+             conj_t           conjb,
+             dim_t            m,
+             dim_t            n,
+             dim_t            k,
+             void*   restrict alpha,
+             void*   restrict a, inc_t rs_a, inc_t cs_a,
+             void*   restrict b, inc_t rs_b, inc_t cs_b,
+             void*   restrict c, inc_t rs_c, inc_t cs_c,
+       const strassen_plan_t* plan,
+             cntx_t* restrict cntx,
+             rntm_t* restrict rntm,
+             thrinfo_t* restrict thread
+     );
+
+//
+// -- Strassen block-panel algorithm (object interface) ------------------------
+//
+
+// Define a function pointer array named ftypes and initialize its contents with
+// the addresses of the typed functions defined below, bao_?strassen_bp_var1().
+static FUNCPTR_T GENARRAY_PREF(ftypes,bao_,strassen_bp_var1);
+
+void bao_strassen_bp_var1
+     (
+       const obj_t*     alpha,
+       const obj_t*     a,
+       const obj_t*     b,
+       const obj_t*     beta,
+       const obj_t*     c,
+       const cntx_t*    cntx,
+             rntm_t*    rntm,
+             thrinfo_t* thread
+     )
+{
+	const num_t    dt        = bli_obj_dt( c );
+
+	const conj_t   conja     = bli_obj_conj_status( a );
+	const conj_t   conjb     = bli_obj_conj_status( b );
+
+	const dim_t    m         = bli_obj_length( c );
+	const dim_t    n         = bli_obj_width( c );
+	const dim_t    k         = bli_obj_width( a );
+
+	void* restrict buf_a     = bli_obj_buffer_at_off( a );
+	const inc_t    rs_a      = bli_obj_row_stride( a );
+	const inc_t    cs_a      = bli_obj_col_stride( a );
+
+	void* restrict buf_b     = bli_obj_buffer_at_off( b );
+	const inc_t    rs_b      = bli_obj_row_stride( b );
+	const inc_t    cs_b      = bli_obj_col_stride( b );
+
+	void* restrict buf_c     = bli_obj_buffer_at_off( c );
+	const inc_t    rs_c      = bli_obj_row_stride( c );
+	const inc_t    cs_c      = bli_obj_col_stride( c );
+
+	void* restrict buf_alpha = bli_obj_buffer_for_1x1( dt, alpha );
+
+	// The Strassen plan is passed in with C. Beta is ignored since it was
+	// already applied to C.
+	const strassen_plan_t* plan = bli_obj_ker_params( c );
+
+	( void )beta;
+
+	// Index into the function pointer array to extract the correct
+	// typed function pointer based on the chosen datatype.
+	FUNCPTR_T f = ftypes[dt];
+
+	// Invoke the function.
+	f
+	(
+	  conja,
+	  conjb,
+	  m,
+	  n,
+	  k,
+	  buf_alpha,
+	  buf_a, rs_a, cs_a,
+	  buf_b, rs_b, cs_b,
+	  buf_c, rs_c, cs_c,
+	  plan,
+	  ( cntx_t* )cntx,
+	  rntm,
+	  thread
+	);
+}
+
+//
+// -- Strassen block-panel algorithm (typed interface) -------------------------
+//
+
+// Each product of the plan is computed with a gemm-like block-panel
+// algorithm in which the submatrix additions are folded into the packing of
+// A and B, and in which the microtile computed by the microkernel is added
+// to every submatrix of C that the product updates (ABC Strassen). Since each
+// thread computes the same portion of every product, threads never update
+// the same microtile of C concurrently.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTECH2(bao_,ch,varname) \
+     ( \
+             conj_t           conja, \
+             conj_t           conjb, \
+             dim_t            m, \
+             dim_t            n, \
+             dim_t            k, \
+             void*   restrict alpha, \
+             void*   restrict a, inc_t rs_a, inc_t cs_a, \
+             void*   restrict b, inc_t rs_b, inc_t cs_b, \
+             void*   restrict c, inc_t rs_c, inc_t cs_c, \
+       const strassen_plan_t* plan, \
+             cntx_t* restrict cntx, \
+             rntm_t* restrict rntm, \
+             thrinfo_t* restrict thread  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	/* Query the context for various blocksizes. */ \
+	const dim_t NR  = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx ); \
+	const dim_t MR  = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx ); \
+	const dim_t NC  = bli_cntx_get_blksz_def_dt( dt, BLIS_NC, cntx ); \
+	const dim_t MC  = bli_cntx_get_blksz_def_dt( dt, BLIS_MC, cntx ); \
+	const dim_t KC  = bli_cntx_get_blksz_def_dt( dt, BLIS_KC, cntx ); \
+\
+	/* Query the context for the microkernel address and cast it to its
+	   function pointer type. */ \
+	PASTECH(ch,gemm_ukr_ft) \
+               gemm_ukr = bli_cntx_get_ukr_dt( dt, BLIS_GEMM_UKR, cntx ); \
+\
+	/* Temporary microtile for products that update more than one submatrix
+	   of C, stored according to the microkernel's preference. */ \
+	ctype       ct[ BLIS_STACK_BUF_MAX_SIZE / sizeof( ctype ) ] \
+	                __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+	const bool  col_pref = bli_cntx_ukr_prefers_cols_dt( dt, BLIS_GEMM_UKR, cntx ); \
+	const inc_t rs_ct    = ( col_pref ? 1 : NR ); \
+	const inc_t cs_ct    = ( col_pref ? MR : 1 ); \
+\
+	/* Compute the dimensions of the submatrices of the 2^L x 2^L
+	   partitionings of A, B, and C. */ \
+	const dim_t levels = plan->levels; \
+	const dim_t m_sub  = m >> levels; \
+	const dim_t n_sub  = n >> levels; \
+	const dim_t k_sub  = k >> levels; \
+\
+	/* Compute partitioning step values for each matrix of each loop. */ \
+	const inc_t jcstep_c = cs_c; \
+	const inc_t jcstep_b = cs_b; \
+\
+	const inc_t pcstep_a = cs_a; \
+	const inc_t pcstep_b = rs_b; \
+\
+	const inc_t icstep_c = rs_c; \
+	const inc_t icstep_a = rs_a; \
+\
+	const inc_t jrstep_c = cs_c * NR; \
+\
+	const inc_t irstep_c = rs_c * MR; \
+\
+	ctype* restrict a_00       = a; \
+	ctype* restrict b_00       = b; \
+	ctype* restrict c_00       = c; \
+	ctype* restrict alpha_cast = alpha; \
+\
+	/* Make local copies of the scalars to prevent any unnecessary sharing of
+	   cache lines between the cores' caches. */ \
+	ctype           alpha_local = *alpha_cast; \
+	ctype           one_local   = *PASTEMAC(ch,1); \
+	ctype           zero_local  = *PASTEMAC(ch,0); \
+\
+	auxinfo_t       aux; \
+\
+	/* Initialize a mem_t entry for A and B. These are reused across all of
+	   the products in the plan. */ \
+	mem_t mem_a = BLIS_MEM_INITIALIZER; \
+	mem_t mem_b = BLIS_MEM_INITIALIZER; \
+\
+	/* Acquire a private workspace large enough to hold one packed
+	   micropanel of A or B. The packing routines pack all but the first
+	   term of a sum here before accumulating it into the packed block. */ \
+	mem_t mem_w = BLIS_MEM_INITIALIZER; \
+	bli_pba_acquire_m \
+	( \
+	  rntm, \
+	  bli_max( MR, NR ) * KC * sizeof( ctype ), \
+	  BLIS_BUFFER_FOR_GEN_USE, \
+	  &mem_w  \
+	); \
+	ctype* restrict w = bli_mem_buffer( &mem_w ); \
+\
+	/* Define an array of bszid_t ids, which will act as our substitute for
+	   the cntl_t tree. */ \
+	bszid_t bszids[8] = { BLIS_NC,      /* 5th loop */ \
+	                      BLIS_KC,      /* 4th loop */ \
+	                      BLIS_NO_PART, /* pack B */ \
+	                      BLIS_MC,      /* 3rd loop */ \
+	                      BLIS_NO_PART, /* pack A */ \
+	                      BLIS_NR,      /* 2nd loop */ \
+	                      BLIS_MR,      /* 1st loop */ \
+	                      BLIS_KR };    /* microkernel loop */  \
+\
+	bszid_t* restrict bszids_jc = &bszids[0]; \
+	bszid_t* restrict bszids_pc = &bszids[1]; \
+	bszid_t* restrict bszids_ic = &bszids[3]; \
+	bszid_t* restrict bszids_jr = &bszids[5]; \
+\
+	thrinfo_t* restrict thread_jc = NULL; \
+	thrinfo_t* restrict thread_pc = NULL; \
+	thrinfo_t* restrict thread_pb = NULL; \
+	thrinfo_t* restrict thread_ic = NULL; \
+	thrinfo_t* restrict thread_pa = NULL; \
+	thrinfo_t* restrict thread_jr = NULL; \
+	thrinfo_t* restrict thread_ir = NULL; \
+\
+	/* Identify the current thrinfo_t node and then grow the tree. */ \
+	thread_jc = thread; \
+	bli_thrinfo_sup_grow( rntm, bszids_jc, thread_jc ); \
+\
+	/* Compute the JC loop thread range for the current thread. */ \
+	dim_t jc_start, jc_end; \
+	bli_thread_range_sub( thread_jc, n_sub, NR, FALSE, &jc_start, &jc_end ); \
+	const dim_t n_local = jc_end - jc_start; \
+\
+	/* Compute number of primary and leftover components of the JC loop. */ \
+	const dim_t jc_left =   n_local % NC; \
+\
+	/* Loop over the products of the plan. */ \
+	for ( dim_t ip = 0; ip < plan->n_prod; ++ip ) \
+	{ \
+		const strassen_prod_t* prod = &plan->prod[ ip ]; \
+\
+		const dim_t n_a = prod->n_a; \
+		const dim_t n_b = prod->n_b; \
+		const dim_t n_c = prod->n_c; \
+\
+		/* Locate the submatrices of A, B, and C referenced by the current
+		   product and convert their coefficients to the current datatype. */ \
+		ctype* a_t[ BAO_STRASSEN_MAX_TERMS ]; \
+		ctype* b_t[ BAO_STRASSEN_MAX_TERMS ]; \
+		ctype* c_t[ BAO_STRASSEN_MAX_TERMS ]; \
+		ctype  kappa_a[ BAO_STRASSEN_MAX_TERMS ]; \
+		ctype  kappa_b[ BAO_STRASSEN_MAX_TERMS ]; \
+		ctype  gamma_c[ BAO_STRASSEN_MAX_TERMS ]; \
+\
+		for ( dim_t t = 0; t < n_a; ++t ) \
+		{ \
+			a_t[ t ] = a_00 + prod->a[ t ].i * m_sub * rs_a \
+			                + prod->a[ t ].j * k_sub * cs_a; \
+			PASTEMAC(ch,sets)( prod->a[ t ].coef, 0.0, kappa_a[ t ] ); \
+		} \
+		for ( dim_t t = 0; t < n_b; ++t ) \
+		{ \
+			b_t[ t ] = b_00 + prod->b[ t ].i * k_sub * rs_b \
+			                + prod->b[ t ].j * n_sub * cs_b; \
+			PASTEMAC(ch,sets)( prod->b[ t ].coef, 0.0, kappa_b[ t ] ); \
+		} \
+		for ( dim_t t = 0; t < n_c; ++t ) \
+		{ \
+			c_t[ t ] = c_00 + prod->c[ t ].i * m_sub * rs_c \
+			                + prod->c[ t ].j * n_sub * cs_c; \
+			PASTEMAC(ch,sets)( prod->c[ t ].coef, 0.0, gamma_c[ t ] ); \
+		} \
+\
+		/* When only one submatrix of C is updated, the microkernel updates
+		   it directly, with its coefficient folded into alpha. */ \
+		ctype alpha_c0; \
+		PASTEMAC(ch,scal2s)( gamma_c[ 0 ], alpha_local, alpha_c0 ); \
+\
+		/* Loop over the n dimension (NC rows/columns at a time). */ \
+		for ( dim_t jj = jc_start; jj < jc_end; jj += NC ) \
+		{ \
+			/* Calculate the thread's current JC block dimension. */ \
+			const dim_t nc_cur = ( NC <= jc_end - jj ? NC : jc_left ); \
+\
+			/* Identify the current thrinfo_t node and then grow the tree. */ \
+			thread_pc = bli_thrinfo_sub_node( thread_jc ); \
+			bli_thrinfo_sup_grow( rntm, bszids_pc, thread_pc ); \
+\
+			/* Compute number of primary and leftover components of the PC loop. */ \
+			const dim_t pc_left =   k_sub % KC; \
+\
+			/* Loop over the k dimension (KC rows/columns at a time). */ \
+			for ( dim_t pp = 0; pp < k_sub; pp += KC ) \
+			{ \
+				/* Calculate the thread's current PC block dimension. */ \
+				const dim_t kc_cur = ( KC <= k_sub - pp ? KC : pc_left ); \
+\
+				ctype* b_pc[ BAO_STRASSEN_MAX_TERMS ]; \
+				for ( dim_t t = 0; t < n_b; ++t ) \
+					b_pc[ t ] = b_t[ t ] + jj * jcstep_b + pp * pcstep_b; \
+\
+				ctype* b_use; \
+				inc_t  ps_b_use; \
+\
+				/* Identify the current thrinfo_t node. Note that the thrinfo_t
+				   node will have already been created by a previous call to
+				   bli_thrinfo_sup_grow() since bszid_t values of BLIS_NO_PART
+				   cause the tree to grow by two (e.g. to the next bszid that is
+				   a normal bszid_t value). */ \
+				thread_pb = bli_thrinfo_sub_node( thread_pc ); \
+\
+				/* Pack the sum of the B terms to row-stored kc x NR
+				   micropanels by packing the sum of their transposes. */ \
+				PASTECH2(bao_,ch,strassen_packm) \
+				( \
+				  conjb, \
+				  BLIS_BUFFER_FOR_B_PANEL, \
+				  BLIS_PACKM_NRXK_KER, \
+				  NC,     KC, \
+				  nc_cur, kc_cur, NR, \
+				  n_b, kappa_b, \
+				  b_pc,   cs_b, rs_b, \
+				  &b_use, &ps_b_use, \
+				  w, \
+				  cntx, \
+				  rntm, \
+				  &mem_b, \
+				  thread_pb  \
+				); \
+\
+				/* Alias b_use so that it's clear this is our current block of
+				   matrix B. */ \
+				ctype* restrict b_pc_use = b_use; \
+\
+				/* Identify the current thrinfo_t node and then grow the tree. */ \
+				thread_ic = bli_thrinfo_sub_node( thread_pb ); \
+				bli_thrinfo_sup_grow( rntm, bszids_ic, thread_ic ); \
+\
+				/* Compute the IC loop thread range for the current thread. */ \
+				dim_t ic_start, ic_end; \
+				bli_thread_range_sub( thread_ic, m_sub, MR, FALSE, &ic_start, &ic_end ); \
+				const dim_t m_local = ic_end - ic_start; \
+\
+				/* Compute number of primary and leftover components of the IC loop. */ \
+				const dim_t ic_left =   m_local % MC; \
+\
+				/* Loop over the m dimension (MC rows at a time). */ \
+				for ( dim_t ii = ic_start; ii < ic_end; ii += MC ) \
+				{ \
+					/* Calculate the thread's current IC block dimension. */ \
+					const dim_t mc_cur = ( MC <= ic_end - ii ? MC : ic_left ); \
+\
+					ctype* a_ic[ BAO_STRASSEN_MAX_TERMS ]; \
+					for ( dim_t t = 0; t < n_a; ++t ) \
+						a_ic[ t ] = a_t[ t ] + ii * icstep_a + pp * pcstep_a; \
+\
+					ctype* a_use; \
+					inc_t  ps_a_use; \
+\
+					/* Identify the current thrinfo_t node. */ \
+					thread_pa = bli_thrinfo_sub_node( thread_ic ); \
+\
+					/* Pack the sum of the A terms to column-stored MR x kc
+					   micropanels. */ \
+					PASTECH2(bao_,ch,strassen_packm) \
+					( \
+					  conja, \
+					  BLIS_BUFFER_FOR_A_BLOCK, \
+					  BLIS_PACKM_MRXK_KER, \
+					  MC,     KC, \
+					  mc_cur, kc_cur, MR, \
+					  n_a, kappa_a, \
+					  a_ic,   rs_a, cs_a, \
+					  &a_use, &ps_a_use, \
+					  w, \
+					  cntx, \
+					  rntm, \
+					  &mem_a, \
+					  thread_pa  \
+					); \
+\
+					/* Alias a_use so that it's clear this is our current block of
+					   matrix A. */ \
+					ctype* restrict a_ic_use = a_use; \
+\
+					/* The offset of the current block within each submatrix
+					   of C. */ \
+					const inc_t off_c_ic = jj * jcstep_c + ii * icstep_c; \
+\
+					/* Identify the current thrinfo_t node and then grow the tree. */ \
+					thread_jr = bli_thrinfo_sub_node( thread_pa ); \
+					bli_thrinfo_sup_grow( rntm, bszids_jr, thread_jr ); \
+\
+					/* Query the number of threads and thread ids for the JR loop.
+					   NOTE: These values are only needed when computing the next
+					   micropanel of B. */ \
+					const dim_t jr_nt  = bli_thread_n_way( thread_jr ); \
+					const dim_t jr_tid = bli_thread_work_id( thread_jr ); \
+\
+					/* Compute number of primary and leftover components of the JR loop. */ \
+					dim_t jr_iter = ( nc_cur + NR - 1 ) / NR; \
+					dim_t jr_left =   nc_cur % NR; \
+\
+					/* Compute the JR loop thread range for the current thread. */ \
+					dim_t jr_start, jr_end; \
+					bli_thread_range_sub( thread_jr, jr_iter, 1, FALSE, &jr_start, &jr_end ); \
+\
+					/* Loop over the n dimension (NR columns at a time). */ \
+					for ( dim_t j = jr_start; j < jr_end; j += 1 ) \
+					{ \
+						const dim_t nr_cur \
+						= ( bli_is_not_edge_f( j, jr_iter, jr_left ) ? NR : jr_left ); \
+\
+						ctype* restrict b_jr = b_pc_use + j * ps_b_use; \
+\
+						/* Assume for now that our next panel of B to be the current panel
+						   of B. */ \
+						ctype* restrict b2 = b_jr; \
+\
+						/* Identify the current thrinfo_t node. */ \
+						thread_ir = bli_thrinfo_sub_node( thread_jr ); \
+\
+						/* Query the number of threads and thread ids for the IR loop.
+						   NOTE: These values are only needed when computing the next
+						   micropanel of A. */ \
+						const dim_t ir_nt  = bli_thread_n_way( thread_ir ); \
+						const dim_t ir_tid = bli_thread_work_id( thread_ir ); \
+\
+						/* Compute number of primary and leftover components of the IR loop. */ \
+						dim_t ir_iter = ( mc_cur + MR - 1 ) / MR; \
+						dim_t ir_left =   mc_cur % MR; \
+\
+						/* Compute the IR loop thread range for the current thread. */ \
+						dim_t ir_start, ir_end; \
+						bli_thread_range_sub( thread_ir, ir_iter, 1, FALSE, &ir_start, &ir_end ); \
+\
+						/* Loop over the m dimension (MR rows at a time). */ \
+						for ( dim_t i = ir_start; i < ir_end; i += 1 ) \
+						{ \
+							const dim_t mr_cur \
+							= ( bli_is_not_edge_f( i, ir_iter, ir_left ) ? MR : ir_left ); \
+\
+							ctype* restrict a_ir = a_ic_use + i * ps_a_use; \
+\
+							const inc_t off_c = off_c_ic + j * jrstep_c + i * irstep_c; \
+\
+							ctype* restrict a2; \
+\
+							/* Compute the addresses of the next micropanels of A and B. */ \
+							a2 = bli_gemm_get_next_a_upanel( a_ir, ps_a_use, 1 ); \
+							if ( bli_is_last_iter( i, ir_end, ir_tid, ir_nt ) ) \
+							{ \
+								a2 = a_ic_use; \
+								b2 = bli_gemm_get_next_b_upanel( b_jr, ps_b_use, 1 ); \
+								if ( bli_is_last_iter( j, jr_end, jr_tid, jr_nt ) ) \
+									b2 = b_pc_use; \
+							} \
+\
+							/* Save the addresses of next micropanels of A and B to the
+							   auxinfo_t object. */ \
+							bli_auxinfo_set_next_a( a2, &aux ); \
+							bli_auxinfo_set_next_b( b2, &aux ); \
+\
+							if ( n_c == 1 ) \
+							{ \
+								/* Invoke the gemm microkernel, updating the only
+								   submatrix of C directly. */ \
+								gemm_ukr \
+								( \
+								  mr_cur, \
+								  nr_cur, \
+								  kc_cur, \
+								  &alpha_c0, \
+								  a_ir, \
+								  b_jr, \
+								  &one_local, \
+								  c_t[ 0 ] + off_c, rs_c, cs_c, \
+								  &aux, \
+								  cntx  \
+								); \
+							} \
+							else \
+							{ \
+								/* Invoke the gemm microkernel to compute the
+								   microtile into ct, and then add it to each of
+								   the submatrices of C. */ \
+								gemm_ukr \
+								( \
+								  mr_cur, \
+								  nr_cur, \
+								  kc_cur, \
+								  &alpha_local, \
+								  a_ir, \
+								  b_jr, \
+								  &zero_local, \
+								  ct, rs_ct, cs_ct, \
+								  &aux, \
+								  cntx  \
+								); \
+\
+								for ( dim_t t = 0; t < n_c; ++t ) \
+								{ \
+									ctype* restrict c_ir = c_t[ t ] + off_c; \
+\
+									/* Handle unit-stride storage of C separately so
+									   that the compiler can vectorize the update. */ \
+									if      ( !col_pref && cs_c == 1 ) \
+									{ \
+										for ( dim_t it = 0; it < mr_cur; ++it ) \
+										for ( dim_t jt = 0; jt < nr_cur; ++jt ) \
+											PASTEMAC(ch,axpys)( gamma_c[ t ], \
+											                    ct[ it*rs_ct + jt ], \
+											                    c_ir[ it*rs_c + jt ] ); \
+									} \
+									else if ( col_pref && rs_c == 1 ) \
+									{ \
+										for ( dim_t jt = 0; jt < nr_cur; ++jt ) \
+										for ( dim_t it = 0; it < mr_cur; ++it ) \
+											PASTEMAC(ch,axpys)( gamma_c[ t ], \
+											                    ct[ it + jt*cs_ct ], \
+											                    c_ir[ it + jt*cs_c ] ); \
+									} \
+									else \
+									{ \
+										for ( dim_t jt = 0; jt < nr_cur; ++jt ) \
+										for ( dim_t it = 0; it < mr_cur; ++it ) \
+											PASTEMAC(ch,axpys)( gamma_c[ t ], \
+											                    ct[ it*rs_ct + jt*cs_ct ], \
+											                    c_ir[ it*rs_c + jt*cs_c ] ); \
+									} \
+								} \
+							} \
+						} \
+					} \
+				} \
+\
+				/* This barrier is needed to prevent threads from starting to pack
+				   the next row panel of B before the current row panel is fully
+				   computed upon. */ \
+				bli_thread_barrier( thread_pb ); \
+			} \
+		} \
+	} \
+\
+	/* Release any memory that was acquired for packing matrices A and B. */ \
+	PASTECH2(bao_,ch,strassen_packm_finalize_mem) \
+	( \
+	  rntm, \
+	  &mem_a, \
+	  thread_pa  \
+	); \
+	PASTECH2(bao_,ch,strassen_packm_finalize_mem) \
+	( \
+	  rntm, \
+	  &mem_b, \
+	  thread_pb  \
+	); \
+	bli_pba_release( rntm, &mem_w ); \
+}
+
+INSERT_GENTFUNC_BASIC0( strassen_bp_var1 )
+
@@ -0,0 +1,307 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+       packbuf_t        pack_buf_type, \
+       dim_t            m, \
+       dim_t            k, \
+       dim_t            mr, \
+       rntm_t* restrict rntm, \
+       mem_t*  restrict mem, \
+       thrinfo_t* restrict thread  \
+     ) \
+{ \
+	/* NOTE: This "rounding up" of the last upanel is absolutely necessary since
+	   we NEED that last micropanel to have the same ldim as the other
+	   micropanels. */ \
+	const dim_t m_pack = ( m / mr + ( m % mr ? 1 : 0 ) ) * mr; \
+	const dim_t k_pack = k; \
+\
+	/* Barrier to make sure all threads are caught up and ready to begin the
+	   packm stage. */ \
+	bli_thread_barrier( thread ); \
+\
+	/* Compute the size of the memory block needed. */ \
+	siz_t size_needed = sizeof( ctype ) * m_pack * k_pack; \
+\
+	/* Acquire a block from the packed block allocator if the mem_t entry
+	   provided by the caller is unallocated or too small. The acquisition is
+	   done by the chief thread directly into its own passed-in mem_t, which
+	   is then broadcast to the other threads. */ \
+	if ( bli_mem_is_unalloc( mem ) || bli_mem_size( mem ) < size_needed ) \
+	{ \
+		if ( bli_thread_am_ochief( thread ) ) \
+		{ \
+			if ( bli_mem_is_alloc( mem ) ) \
+				bli_pba_release( rntm, mem ); \
+\
+			bli_pba_acquire_m \
+			( \
+			  rntm, \
+			  size_needed, \
+			  pack_buf_type, \
+			  mem  \
+			); \
+		} \
+\
+		/* Broadcast the address of the chief thread's passed-in mem_t to all
+		   threads. */ \
+		mem_t* mem_p = bli_thread_broadcast( thread, mem ); \
+\
+		/* Non-chief threads: Copy the contents of the chief thread's
+		   passed-in mem_t to the passed-in mem_t for this thread. */ \
+		if ( !bli_thread_am_ochief( thread ) ) \
+		{ \
+			*mem = *mem_p; \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( strassen_packm_init_mem )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+       rntm_t* restrict rntm, \
+       mem_t*  restrict mem, \
+       thrinfo_t* restrict thread  \
+     ) \
+{ \
+	if ( thread != NULL ) \
+	if ( bli_thread_am_ochief( thread ) ) \
+	{ \
+		/* Check the mem_t entry provided by the caller. Only proceed if it
+		   is allocated, which it should be. */ \
+		if ( bli_mem_is_alloc( mem ) ) \
+		{ \
+			bli_pba_release \
+			( \
+			  rntm, \
+			  mem \
+			); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( strassen_packm_finalize_mem )
+
+
+//
+// Pack the sum of n_terms m x k submatrices c[t], each scaled by kappa[t],
+// to column-stored mr x k micropanels. (A k x n block of B is packed to
+// row-stored k x nr micropanels by passing in the transposed view.) The
+// packm kernel identified by ker_id must be the one whose register
+// blocksize is mr.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+       conj_t           conj, \
+       packbuf_t        pack_buf_type, \
+       ukr_t            ker_id, \
+       dim_t            m_alloc, \
+       dim_t            k_alloc, \
+       dim_t            m, \
+       dim_t            k, \
+       dim_t            mr, \
+       dim_t            n_terms, \
+       ctype*  restrict kappa, \
+       ctype** restrict c, inc_t rs_c, inc_t cs_c, \
+       ctype** restrict p, inc_t* restrict ps_p, \
+       ctype*  restrict w, \
+       cntx_t* restrict cntx, \
+       rntm_t* restrict rntm, \
+       mem_t*  restrict mem, \
+       thrinfo_t* restrict thread  \
+     ) \
+{ \
+	/* Prepare the packing destination buffer. */ \
+	PASTECH2(bao_,ch,strassen_packm_init_mem) \
+	( \
+	  pack_buf_type, \
+	  m_alloc, k_alloc, mr, \
+	  rntm, \
+	  mem, \
+	  thread  \
+	); \
+\
+	*p    = bli_mem_buffer( mem ); \
+	*ps_p = mr * k; \
+\
+	const pack_t schema = ( ker_id == BLIS_PACKM_NRXK_KER ? BLIS_PACKED_COL_PANELS \
+	                                                      : BLIS_PACKED_ROW_PANELS ); \
+\
+	/* Query the context for the packm and axpyv kernels. */ \
+	PASTECH2(ch,packm_cxk,_ker_ft) packm_ker = bli_cntx_get_ukr_dt( PASTEMAC(ch,type), ker_id, cntx ); \
+	PASTECH2(ch,axpyv,_ker_ft)     axpyv_ker = bli_cntx_get_ukr_dt( PASTEMAC(ch,type), BLIS_AXPYV_KER, cntx ); \
+\
+	/* Compute the total number of micropanels. */ \
+	const dim_t n_iter = m / mr + ( m % mr ? 1 : 0 ); \
+\
+	/* Query the number of threads and thread ids from the current thread's
+	   packm thrinfo_t node. */ \
+	const dim_t nt  = bli_thread_n_way( thread ); \
+	const dim_t tid = bli_thread_work_id( thread ); \
+\
+	/* Suppress warnings in case tid isn't used (ie: as in slab partitioning). */ \
+	( void )nt; \
+	( void )tid; \
+\
+	dim_t it_start, it_end, it_inc; \
+\
+	/* Determine the thread range and increment using the current thread's
+	   packm thrinfo_t node. */ \
+	bli_thread_range_jrir( thread, n_iter, 1, FALSE, &it_start, &it_end, &it_inc ); \
+\
+	ctype* restrict p_use = *p; \
+\
+	/* Iterate over every logical micropanel in the source matrices. */ \
+	for ( dim_t ic = 0, it = 0; it < n_iter; ic += mr, it += 1 ) \
+	{ \
+		const dim_t panel_dim = bli_min( mr, m - ic ); \
+\
+		if ( bli_packm_my_iter( it, it_start, it_end, tid, nt ) ) \
+		{ \
+			PASTECH2(bao_,ch,strassen_packm_cxk) \
+			( \
+			  conj, \
+			  schema, \
+			  panel_dim, \
+			  mr, \
+			  k, \
+			  n_terms, \
+			  kappa, \
+			  c, ic * rs_c, rs_c, cs_c, \
+			  p_use,                  mr, \
+			  w, \
+			  packm_ker, \
+			  axpyv_ker, \
+			  cntx  \
+			); \
+		} \
+\
+		p_use += *ps_p; \
+	} \
+\
+	/* Barrier so that packing is done before computation. */ \
+	bli_thread_barrier( thread ); \
+}
+
+INSERT_GENTFUNC_BASIC0( strassen_packm )
+
+
+//
+// Pack one micropanel. The first term is packed (and scaled) directly into
+// the micropanel by the context's packm kernel, while each remaining term is
+// packed into the workspace w (which must hold one micropanel) and then
+// added to the micropanel with the context's axpyv kernel, since a packed
+// micropanel is contiguous. This lets the summation use optimized kernels
+// for any storage of the source submatrices.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+       conj_t           conj, \
+       pack_t           schema, \
+       dim_t            panel_dim, \
+       dim_t            panel_dim_max, \
+       dim_t            panel_len, \
+       dim_t            n_terms, \
+       ctype*  restrict kappa, \
+       ctype** restrict c, dim_t off_c, inc_t incc, inc_t ldc, \
+       ctype*  restrict p,                          inc_t ldp, \
+       ctype*  restrict w, \
+       PASTECH2(ch,packm_cxk,_ker_ft) packm_ker, \
+       PASTECH2(ch,axpyv,_ker_ft)     axpyv_ker, \
+       cntx_t* restrict cntx  \
+     ) \
+{ \
+	packm_ker \
+	( \
+	  conj, \
+	  schema, \
+	  panel_dim, \
+	  panel_len, \
+	  panel_len, \
+	  &kappa[ 0 ], \
+	  c[ 0 ] + off_c, incc, ldc, \
+	  p,                    ldp, \
+	  cntx  \
+	); \
+\
+	for ( dim_t t = 1; t < n_terms; ++t ) \
+	{ \
+		packm_ker \
+		( \
+		  conj, \
+		  schema, \
+		  panel_dim, \
+		  panel_len, \
+		  panel_len, \
+		  &kappa[ t ], \
+		  c[ t ] + off_c, incc, ldc, \
+		  w,                    ldp, \
+		  cntx  \
+		); \
+\
+		axpyv_ker \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  panel_dim_max * panel_len, \
+		  PASTEMAC(ch,1), \
+		  w, 1, \
+		  p, 1, \
+		  cntx  \
+		); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( strassen_packm_cxk )
+
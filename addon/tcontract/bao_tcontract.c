@@ -0,0 +1,434 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+#include "blis.h"
+
+// Copy the indices of a group shared by two tensors into tcontract_group_t
+// structs, dropping any indices of unit length. The indices are sorted in
+// order of increasing stride of the first tensor if it has a unit stride in
+// the group, and of the second tensor otherwise, and then any adjacent
+// indices that are contiguous in both tensors are folded into one.
+static void bao_tcontract_init_groups
+     (
+             gint_t             ndim,
+       const dim_t*             len,
+       const inc_t*             stride0,
+       const inc_t*             stride1,
+             tcontract_group_t* group0,
+             tcontract_group_t* group1
+     )
+{
+	gint_t nd = 0;
+
+	for ( gint_t i = 0; i < ndim; ++i )
+	{
+		if ( len[ i ] == 1 ) continue;
+
+		group0->len[ nd ]    = len[ i ];
+		group0->stride[ nd ] = stride0[ i ];
+		group1->len[ nd ]    = len[ i ];
+		group1->stride[ nd ] = stride1[ i ];
+		nd += 1;
+	}
+
+	// An empty group has a single index of unit length.
+	if ( nd == 0 )
+	{
+		group0->len[ 0 ]    = 1;
+		group0->stride[ 0 ] = 1;
+		group1->len[ 0 ]    = 1;
+		group1->stride[ 0 ] = 1;
+		nd = 1;
+	}
+
+	bool has_unit0 = FALSE;
+	for ( gint_t i = 0; i < nd; ++i )
+		if ( bli_abs( group0->stride[ i ] ) == 1 ) has_unit0 = TRUE;
+
+	const inc_t* key = ( has_unit0 ? group0->stride : group1->stride );
+
+	// Sort the indices with an insertion sort, permuting both groups.
+	for ( gint_t i = 1; i < nd; ++i )
+	{
+		for ( gint_t j = i; j > 0 && bli_abs( key[ j - 1 ] ) > bli_abs( key[ j ] ); --j )
+		{
+			dim_t len_t = group0->len[ j ];
+			inc_t s0_t  = group0->stride[ j ];
+			inc_t s1_t  = group1->stride[ j ];
+
+			group0->len[ j ]        = group0->len[ j - 1 ];
+			group0->stride[ j ]     = group0->stride[ j - 1 ];
+			group1->len[ j ]        = group1->len[ j - 1 ];
+			group1->stride[ j ]     = group1->stride[ j - 1 ];
+
+			group0->len[ j - 1 ]    = len_t;
+			group0->stride[ j - 1 ] = s0_t;
+			group1->len[ j - 1 ]    = len_t;
+			group1->stride[ j - 1 ] = s1_t;
+		}
+	}
+
+	// Fold adjacent indices that are contiguous in both tensors.
+	gint_t nf = 0;
+
+	for ( gint_t i = 1; i < nd; ++i )
+	{
+		if ( group0->stride[ i ] == group0->stride[ nf ] * group0->len[ nf ] &&
+		     group1->stride[ i ] == group1->stride[ nf ] * group1->len[ nf ] )
+		{
+			group0->len[ nf ] *= group0->len[ i ];
+			group1->len[ nf ] *= group1->len[ i ];
+		}
+		else
+		{
+			nf += 1;
+			group0->len[ nf ]    = group0->len[ i ];
+			group0->stride[ nf ] = group0->stride[ i ];
+			group1->len[ nf ]    = group1->len[ i ];
+			group1->stride[ nf ] = group1->stride[ i ];
+		}
+	}
+
+	group0->ndim = nf + 1;
+	group1->ndim = nf + 1;
+}
+
+typedef void (*scal_fp)
+     (
+             dim_t  m,
+             dim_t  n,
+             void*  beta,
+             void*  c, const inc_t* rscat_c, const inc_t* cscat_c
+     );
+
+// Define a function pointer array named ftypes_scal and initialize its
+// contents with the addresses of the typed functions bao_?tcontract_scal().
+static scal_fp GENARRAY_PREF(ftypes_scal,bao_,tcontract_scal);
+
+//
+// -- Define the tensor contraction operation's API ----------------------------
+//
+
+void bao_tcontract
+     (
+             num_t  dt,
+             gint_t ndim_m, const dim_t* len_m,
+             gint_t ndim_n, const dim_t* len_n,
+             gint_t ndim_k, const dim_t* len_k,
+       const void*  alpha,
+       const void*  a, const inc_t* stride_a_m, const inc_t* stride_a_k,
+       const void*  b, const inc_t* stride_b_k, const inc_t* stride_b_n,
+       const void*  beta,
+             void*  c, const inc_t* stride_c_m, const inc_t* stride_c_n
+     )
+{
+	bao_tcontract_ex
+	(
+	  dt,
+	  ndim_m, len_m,
+	  ndim_n, len_n,
+	  ndim_k, len_k,
+	  alpha,
+	  a, stride_a_m, stride_a_k,
+	  b, stride_b_k, stride_b_n,
+	  beta,
+	  c, stride_c_m, stride_c_n,
+	  NULL,
+	  NULL
+	);
+}
+
+void bao_tcontract_ex
+     (
+             num_t   dt,
+             gint_t  ndim_m, const dim_t* len_m,
+             gint_t  ndim_n, const dim_t* len_n,
+             gint_t  ndim_k, const dim_t* len_k,
+       const void*   alpha,
+       const void*   a, const inc_t* stride_a_m, const inc_t* stride_a_k,
+       const void*   b, const inc_t* stride_b_k, const inc_t* stride_b_n,
+       const void*   beta,
+             void*   c, const inc_t* stride_c_m, const inc_t* stride_c_n,
+       const cntx_t* cntx,
+             rntm_t* rntm
+     )
+{
+	bli_init_once();
+
+	// Initialize a local runtime with global settings if necessary. Note
+	// that in the case that a runtime is passed in, we make a local copy.
+	rntm_t rntm_l;
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); rntm = &rntm_l; }
+	else                { rntm_l = *rntm;                       rntm = &rntm_l; }
+
+	// Obtain a valid (native) context from the gks if necessary. Induced
+	// methods are not supported since the packing is done here.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bao_tcontract_check( dt,
+		                     ndim_m, len_m, ndim_n, len_n, ndim_k, len_k,
+		                     alpha, a, stride_a_m, stride_a_k,
+		                            b, stride_b_k, stride_b_n,
+		                     beta,  c, stride_c_m, stride_c_n );
+
+	// Set up the index groups of each tensor. The m and n indices are
+	// ordered for the benefit of C, since it is both read and written, and
+	// the k indices are ordered for the benefit of A.
+	tcontract_params_t params_a;
+	tcontract_params_t params_b;
+	tcontract_params_t params_c;
+
+	bao_tcontract_init_groups( ndim_m, len_m, stride_c_m, stride_a_m,
+	                           &params_c.rows, &params_a.rows );
+	bao_tcontract_init_groups( ndim_n, len_n, stride_c_n, stride_b_n,
+	                           &params_c.cols, &params_b.rows );
+	bao_tcontract_init_groups( ndim_k, len_k, stride_a_k, stride_b_k,
+	                           &params_a.cols, &params_b.cols );
+
+	const dim_t m = bao_tcontract_group_len( &params_c.rows );
+	const dim_t n = bao_tcontract_group_len( &params_c.cols );
+	const dim_t k = bao_tcontract_group_len( &params_a.cols );
+
+	// If C has a zero dimension, return early.
+	if ( m == 0 || n == 0 ) return;
+
+	obj_t alpha_o, beta_o;
+	bli_obj_create_1x1_with_attached_buffer( dt, ( void* )alpha, &alpha_o );
+	bli_obj_create_1x1_with_attached_buffer( dt, ( void* )beta,  &beta_o );
+
+	// If alpha is zero, or if the k dimension is empty, scale C by beta and
+	// return early. This can't be left to bli_gemm_ex() since it would treat
+	// C as a matrix.
+	if ( k == 0 || bli_obj_equals( &alpha_o, &BLIS_ZERO ) )
+	{
+		if ( bli_obj_equals( &beta_o, &BLIS_ONE ) ) return;
+
+		err_t  r_val;
+		inc_t* rscat_c = bli_malloc_intl( ( m + n ) * sizeof( inc_t ), &r_val );
+		inc_t* cscat_c = rscat_c + m;
+
+		bao_tcontract_fill_scatter( &params_c.rows, 1, 0, m, rscat_c, NULL );
+		bao_tcontract_fill_scatter( &params_c.cols, 1, 0, n, cscat_c, NULL );
+
+		ftypes_scal[ dt ]( m, n, ( void* )beta, c, rscat_c, cscat_c );
+
+		bli_free_intl( rscat_c );
+		return;
+	}
+
+	// If the microkernel would prefer to access C along its n indices (as
+	// determined by the fastest-varying index of each group), then compute
+	// the transposed contraction, C^T := B^T A^T, instead.
+	const void*         buf_a   = a;
+	const void*         buf_b   = b;
+	tcontract_params_t* par_a   = &params_a;
+	tcontract_params_t* par_b   = &params_b;
+	dim_t               m_use   = m;
+	dim_t               n_use   = n;
+
+	const bool          row_c   = bli_abs( params_c.cols.stride[ 0 ] ) <
+	                              bli_abs( params_c.rows.stride[ 0 ] );
+	const bool          col_pref = bli_cntx_ukr_prefers_cols_dt( dt, BLIS_GEMM_VIR_UKR, cntx );
+
+	if ( row_c == col_pref )
+	{
+		tcontract_group_t t = params_c.rows;
+		params_c.rows = params_c.cols;
+		params_c.cols = t;
+
+		buf_a = b; par_a = &params_b;
+		buf_b = a; par_b = &params_a;
+		m_use = n;
+		n_use = m;
+	}
+
+	// Wrap the tensors in objects so that they may be passed to bli_gemm_ex().
+	// The objects are merely containers for the buffers and the index groups:
+	// their strides describe dense matrices (with C stored the way the
+	// microkernel prefers) and are never used to access elements. Instead,
+	// the custom packing function and macrokernel attached below use the
+	// index groups attached as params.
+	obj_t a_o, b_o, c_o;
+
+	bli_obj_create_without_buffer( dt, m_use, k, &a_o );
+	bli_obj_create_without_buffer( dt, k, n_use, &b_o );
+	bli_obj_create_without_buffer( dt, m_use, n_use, &c_o );
+
+	bli_obj_set_buffer( ( void* )buf_a, &a_o );
+	bli_obj_set_buffer( ( void* )buf_b, &b_o );
+	bli_obj_set_buffer(          c,     &c_o );
+
+	bli_obj_set_strides( 1, m_use, &a_o );
+	bli_obj_set_strides( 1, k,     &b_o );
+
+	if ( col_pref ) bli_obj_set_strides( 1, m_use, &c_o );
+	else            bli_obj_set_strides( n_use, 1, &c_o );
+
+	bli_obj_set_pack_fn( bao_tcontract_packm, &a_o );
+	bli_obj_set_pack_fn( bao_tcontract_packm, &b_o );
+	bli_obj_set_ker_fn( bao_tcontract_gemm_ker, &c_o );
+
+	bli_obj_set_pack_params( par_a, &a_o );
+	bli_obj_set_pack_params( par_b, &b_o );
+	bli_obj_set_ker_params( &params_c, &c_o );
+
+	// The sup code path does not use the packing function or macrokernel
+	// attached to the objects, so it must be disabled.
+	bli_rntm_disable_l3_sup( rntm );
+
+	bli_gemm_ex( &alpha_o, &a_o, &b_o, &beta_o, &c_o, cntx, rntm );
+}
+
+//
+// -- Define the scatter vector utilities --------------------------------------
+//
+
+dim_t bao_tcontract_group_len
+     (
+       const tcontract_group_t* group
+     )
+{
+	dim_t len = 1;
+
+	for ( gint_t i = 0; i < group->ndim; ++i )
+		len *= group->len[ i ];
+
+	return len;
+}
+
+// Compute the offsets of elements off through off+size-1 of an index group
+// (in which the first index varies fastest) into the scatter vector scat.
+// If bscat is non-NULL, then for each block of bs consecutive elements
+// (starting with element off), the block-scatter vector bscat records (in
+// the entry corresponding to the first element of the block) the stride
+// between consecutive elements of the block if it is constant, and zero
+// otherwise.
+void bao_tcontract_fill_scatter
+     (
+       const tcontract_group_t* group,
+             dim_t              bs,
+             dim_t              off,
+             dim_t              size,
+             inc_t*             scat,
+             inc_t*             bscat
+     )
+{
+	const gint_t ndim   = group->ndim;
+	const dim_t* len    = group->len;
+	const inc_t* stride = group->stride;
+
+	if ( size == 0 ) return;
+
+	// Decompose off into a multi-index and compute its offset.
+	dim_t idx[ BAO_TCONTRACT_MAX_NDIM ];
+	dim_t rem = off;
+	inc_t pos = 0;
+
+	for ( gint_t d = 0; d < ndim; ++d )
+	{
+		idx[ d ] = rem % len[ d ];
+		rem      = rem / len[ d ];
+		pos     += idx[ d ] * stride[ d ];
+	}
+
+	for ( dim_t i = 0; i < size; ++i )
+	{
+		scat[ i ] = pos;
+
+		// Advance the multi-index, carrying into the slower indices.
+		for ( gint_t d = 0; d < ndim; ++d )
+		{
+			pos += stride[ d ];
+			if ( ++idx[ d ] < len[ d ] ) break;
+
+			pos -= len[ d ] * stride[ d ];
+			idx[ d ] = 0;
+		}
+	}
+
+	if ( bscat == NULL ) return;
+
+	for ( dim_t i = 0; i < size; i += bs )
+	{
+		const dim_t bs_i = bli_min( bs, size - i );
+
+		inc_t s = ( bs_i > 1 ? scat[ i + 1 ] - scat[ i ] : stride[ 0 ] );
+
+		for ( dim_t j = i + 2; j < i + bs_i; ++j )
+		{
+			if ( scat[ j ] - scat[ j - 1 ] != s ) { s = 0; break; }
+		}
+
+		bscat[ i ] = s;
+	}
+}
+
+//
+// -- Define the typed scaling of a tensor by beta -----------------------------
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+             dim_t  m, \
+             dim_t  n, \
+             void*  beta, \
+             void*  c, const inc_t* rscat_c, const inc_t* cscat_c  \
+     ) \
+{ \
+	ctype* restrict beta_cast = beta; \
+	ctype* restrict c_cast    = c; \
+\
+	if ( PASTEMAC(ch,eq0)( *beta_cast ) ) \
+	{ \
+		for ( dim_t j = 0; j < n; ++j ) \
+		for ( dim_t i = 0; i < m; ++i ) \
+			PASTEMAC(ch,set0s)( c_cast[ rscat_c[ i ] + cscat_c[ j ] ] ); \
+	} \
+	else \
+	{ \
+		for ( dim_t j = 0; j < n; ++j ) \
+		for ( dim_t i = 0; i < m; ++i ) \
+			PASTEMAC(ch,scals)( *beta_cast, c_cast[ rscat_c[ i ] + cscat_c[ j ] ] ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( tcontract_scal )
+
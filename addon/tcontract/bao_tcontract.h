@@ -0,0 +1,146 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+//
+// -- Tensor contraction definitions -------------------------------------------
+//
+
+// A tensor contraction
+//
+//   C[m_0..m_p, n_0..n_q] := beta * C + alpha * sum over k_0..k_r of
+//                            A[m_0..m_p, k_0..k_r] * B[k_0..k_r, n_0..n_q]
+//
+// is computed as a gemm in which the m, n, and k indices of the operands
+// are each grouped into a single matrix dimension. Each tensor is described
+// by the lengths of the indices in each of its two index groups and by its
+// strides along those indices; the tensors are never transposed or copied
+// into matrices. Instead, a scatter vector of element offsets (along with a
+// block-scatter vector that records where runs of elements have a constant
+// stride) is computed for each index group, and these are used to pack A
+// and B and to write out C.
+
+// The maximum number of indices in each of the m, n, and k index groups.
+#define BAO_TCONTRACT_MAX_NDIM  8
+
+// The number of columns of A (or rows of B) that share one block-scatter
+// entry while packing.
+#define BAO_TCONTRACT_BS_K      8
+
+// One group of indices as seen by a single tensor: the lengths of the
+// indices and the tensor's strides along each of them.
+typedef struct
+{
+	gint_t ndim;
+	dim_t  len[ BAO_TCONTRACT_MAX_NDIM ];
+	inc_t  stride[ BAO_TCONTRACT_MAX_NDIM ];
+} tcontract_group_t;
+
+// The index groups spanning the rows and columns of a tensor viewed as a
+// matrix. These are attached to the obj_t's of A and B as packm params and
+// to the obj_t of C as kernel params.
+typedef struct
+{
+	tcontract_group_t rows;
+	tcontract_group_t cols;
+} tcontract_params_t;
+
+//
+// -- Prototype the tensor contraction operation's API -------------------------
+//
+
+BLIS_EXPORT_ADDON void bao_tcontract
+     (
+             num_t  dt,
+             gint_t ndim_m, const dim_t* len_m,
+             gint_t ndim_n, const dim_t* len_n,
+             gint_t ndim_k, const dim_t* len_k,
+       const void*  alpha,
+       const void*  a, const inc_t* stride_a_m, const inc_t* stride_a_k,
+       const void*  b, const inc_t* stride_b_k, const inc_t* stride_b_n,
+       const void*  beta,
+             void*  c, const inc_t* stride_c_m, const inc_t* stride_c_n
+     );
+
+BLIS_EXPORT_ADDON void bao_tcontract_ex
+     (
+             num_t   dt,
+             gint_t  ndim_m, const dim_t* len_m,
+             gint_t  ndim_n, const dim_t* len_n,
+             gint_t  ndim_k, const dim_t* len_k,
+       const void*   alpha,
+       const void*   a, const inc_t* stride_a_m, const inc_t* stride_a_k,
+       const void*   b, const inc_t* stride_b_k, const inc_t* stride_b_n,
+       const void*   beta,
+             void*   c, const inc_t* stride_c_m, const inc_t* stride_c_n,
+       const cntx_t* cntx,
+             rntm_t* rntm
+     );
+
+//
+// -- Prototype the scatter vector utilities -----------------------------------
+//
+
+dim_t bao_tcontract_group_len
+     (
+       const tcontract_group_t* group
+     );
+
+void bao_tcontract_fill_scatter
+     (
+       const tcontract_group_t* group,
+             dim_t              bs,
+             dim_t              off,
+             dim_t              size,
+             inc_t*             scat,
+             inc_t*             bscat
+     );
+
+//
+// -- Prototype the typed scaling of a tensor by beta --------------------------
+//
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+             dim_t  m, \
+             dim_t  n, \
+             void*  beta, \
+             void*  c, const inc_t* rscat_c, const inc_t* cscat_c  \
+     );
+
+INSERT_GENTPROT_BASIC0( tcontract_scal )
+
@@ -0,0 +1,119 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+#include "blis.h"
+
+static void bao_tcontract_check_group
+     (
+             gint_t ndim,
+       const dim_t* len,
+       const inc_t* stride0,
+       const inc_t* stride1
+     )
+{
+	err_t e_val;
+
+	// Check the number of indices in the group.
+
+	if ( ndim < 0 || BAO_TCONTRACT_MAX_NDIM < ndim )
+		bli_check_error_code( BLIS_NOT_YET_IMPLEMENTED );
+
+	if ( ndim == 0 ) return;
+
+	// Check the lengths and strides (for non-NULLness), and then check that
+	// none of the lengths are negative.
+
+	e_val = bli_check_null_pointer( len );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_null_pointer( stride0 );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_null_pointer( stride1 );
+	bli_check_error_code( e_val );
+
+	for ( gint_t i = 0; i < ndim; ++i )
+	{
+		if ( len[ i ] < 0 )
+			bli_check_error_code( BLIS_NEGATIVE_DIMENSION );
+	}
+}
+
+void bao_tcontract_check
+     (
+             num_t  dt,
+             gint_t ndim_m, const dim_t* len_m,
+             gint_t ndim_n, const dim_t* len_n,
+             gint_t ndim_k, const dim_t* len_k,
+       const void*  alpha,
+       const void*  a, const inc_t* stride_a_m, const inc_t* stride_a_k,
+       const void*  b, const inc_t* stride_b_k, const inc_t* stride_b_n,
+       const void*  beta,
+       const void*  c, const inc_t* stride_c_m, const inc_t* stride_c_n
+     )
+{
+	err_t e_val;
+
+	// Check the datatype.
+
+	e_val = bli_check_floating_datatype( dt );
+	bli_check_error_code( e_val );
+
+	// Check the scalars and tensor buffers (for non-NULLness).
+
+	e_val = bli_check_null_pointer( alpha );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_null_pointer( beta );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_null_pointer( a );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_null_pointer( b );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_null_pointer( c );
+	bli_check_error_code( e_val );
+
+	// Check each index group along with the strides of the two tensors that
+	// share it.
+
+	bao_tcontract_check_group( ndim_m, len_m, stride_a_m, stride_c_m );
+	bao_tcontract_check_group( ndim_n, len_n, stride_b_n, stride_c_n );
+	bao_tcontract_check_group( ndim_k, len_k, stride_a_k, stride_b_k );
+}
+
@@ -0,0 +1,300 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+#include "blis.h"
+
+typedef void (*scatter_mxn_fp)
+     (
+             dim_t  m,
+             dim_t  n,
+             void*  x, inc_t rs_x, inc_t cs_x,
+             void*  beta,
+             void*  y, const inc_t* rscat_y, const inc_t* cscat_y
+     );
+
+// Define a function pointer array named ftypes and initialize its contents
+// with the addresses of the typed functions bao_?tcontract_scatter_mxn().
+static scatter_mxn_fp GENARRAY_PREF(ftypes,bao_,tcontract_scatter_mxn);
+
+void bao_tcontract_gemm_ker
+     (
+       const obj_t*     a,
+       const obj_t*     b,
+       const obj_t*     c,
+       const cntx_t*    cntx,
+             rntm_t*    rntm,
+             cntl_t*    cntl,
+       const thrinfo_t* thread
+     )
+{
+	      num_t  dt        = bli_obj_dt( c );
+	      siz_t  dt_size   = bli_dt_size( dt );
+
+	      dim_t  m         = bli_obj_length( c );
+	      dim_t  n         = bli_obj_width( c );
+	      dim_t  k         = bli_obj_width( a );
+
+	const char*  a_cast    = bli_obj_buffer_at_off( a );
+	      dim_t  pd_a      = bli_obj_panel_dim( a );
+	      inc_t  ps_a      = bli_obj_panel_stride( a );
+
+	const char*  b_cast    = bli_obj_buffer_at_off( b );
+	      dim_t  pd_b      = bli_obj_panel_dim( b );
+	      inc_t  ps_b      = bli_obj_panel_stride( b );
+
+	// The offsets into the tensor are computed entirely by the scatter
+	// vectors, so we use the buffer at the origin of the tensor.
+	      char*  c_cast    = bli_obj_buffer( c );
+	      dim_t  off_m     = bli_obj_row_off( c );
+	      dim_t  off_n     = bli_obj_col_off( c );
+
+	const tcontract_params_t* params = bli_obj_ker_params( c );
+
+	// If any dimension is zero, return immediately.
+	if ( bli_zero_dim3( m, n, k ) ) return;
+
+	// Detach and multiply the scalars attached to A and B.
+	obj_t scalar_a;
+	obj_t scalar_b;
+	bli_obj_scalar_detach( a, &scalar_a );
+	bli_obj_scalar_detach( b, &scalar_b );
+	bli_mulsc( &scalar_a, &scalar_b );
+
+	// Grab the addresses of the internal scalar buffers for the scalar
+	// merged above and the scalar attached to C.
+	const char* alpha_cast = bli_obj_internal_scalar_buffer( &scalar_b );
+	const char* beta_cast  = bli_obj_internal_scalar_buffer( c );
+
+	// Alias some constants to simpler names.
+	const dim_t MR = pd_a;
+	const dim_t NR = pd_b;
+
+	// Query the context for the micro-kernel address and cast it to its
+	// function pointer type.
+	gemm_ukr_vft gemm_ukr = bli_cntx_get_l3_vir_ukr_dt( dt, BLIS_GEMM_UKR, cntx );
+
+	// Temporary C buffer for microtiles that can't be written to C with
+	// constant row and column strides.
+	char        ct[ BLIS_STACK_BUF_MAX_SIZE ]
+	                __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE)));
+	const bool  col_pref    = bli_cntx_ukr_prefers_cols_dt( dt, BLIS_GEMM_VIR_UKR, cntx );
+	const inc_t rs_ct       = ( col_pref ? 1 : NR );
+	const inc_t cs_ct       = ( col_pref ? MR : 1 );
+	const char* zero        = bli_obj_buffer_for_const( dt, &BLIS_ZERO );
+
+	// Acquire space for the scatter and block-scatter vectors for the rows
+	// and columns of the current block of C, and fill them in. This is done
+	// by the chief thread only.
+	siz_t  scat_size = 2 * ( m + n ) * sizeof( inc_t );
+	inc_t* rscat_c   = bli_packm_alloc_ex( scat_size, BLIS_BUFFER_FOR_GEN_USE,
+	                                       rntm, cntl, thread );
+	inc_t* rbs_c     = rscat_c + m;
+	inc_t* cscat_c   = rbs_c   + m;
+	inc_t* cbs_c     = cscat_c + n;
+
+	if ( bli_thread_am_ochief( thread ) )
+	{
+		bao_tcontract_fill_scatter( &params->rows, MR, off_m, m, rscat_c, rbs_c );
+		bao_tcontract_fill_scatter( &params->cols, NR, off_n, n, cscat_c, cbs_c );
+	}
+
+	// Wait for the scatter vectors to be filled in.
+	bli_thread_barrier( thread );
+
+	// Compute number of primary and leftover components of the m and n
+	// dimensions.
+	dim_t n_iter = n / NR;
+	dim_t n_left = n % NR;
+
+	dim_t m_iter = m / MR;
+	dim_t m_left = m % MR;
+
+	if ( n_left ) ++n_iter;
+	if ( m_left ) ++m_iter;
+
+	// Determine some increments used to step through A and B.
+	inc_t rstep_a = ps_a * dt_size;
+	inc_t cstep_b = ps_b * dt_size;
+
+	auxinfo_t aux;
+
+	// Save the pack schemas of A and B to the auxinfo_t object.
+	bli_auxinfo_set_schema_a( bli_obj_pack_schema( a ), &aux );
+	bli_auxinfo_set_schema_b( bli_obj_pack_schema( b ), &aux );
+
+	// Save the virtual microkernel address.
+	bli_auxinfo_set_ukr( gemm_ukr, &aux );
+	bli_auxinfo_set_params( NULL, &aux );
+
+	// The 'thread' argument points to the thrinfo_t node for the 2nd (jr)
+	// loop around the microkernel. Here we query the thrinfo_t node for the
+	// 1st (ir) loop around the microkernel.
+	thrinfo_t* caucus = bli_thrinfo_sub_node( thread );
+
+	// Query the number of threads and thread ids for each loop.
+	dim_t jr_nt  = bli_thread_n_way( thread );
+	dim_t jr_tid = bli_thread_work_id( thread );
+	dim_t ir_nt  = bli_thread_n_way( caucus );
+	dim_t ir_tid = bli_thread_work_id( caucus );
+
+	dim_t jr_start, jr_end;
+	dim_t ir_start, ir_end;
+	dim_t jr_inc,   ir_inc;
+
+	// Determine the thread range and increment for the 2nd and 1st loops.
+	bli_thread_range_jrir( thread, n_iter, 1, FALSE, &jr_start, &jr_end, &jr_inc );
+	bli_thread_range_jrir( caucus, m_iter, 1, FALSE, &ir_start, &ir_end, &ir_inc );
+
+	// Loop over the n dimension (NR columns at a time).
+	for ( dim_t j = jr_start; j < jr_end; j += jr_inc )
+	{
+		const char* b1 = b_cast + j * cstep_b;
+
+		const dim_t n_cur = ( bli_is_not_edge_f( j, n_iter, n_left ) ? NR : n_left );
+
+		// Initialize our next panel of B to be the current panel of B.
+		const char* b2 = b1;
+
+		// Loop over the m dimension (MR rows at a time).
+		for ( dim_t i = ir_start; i < ir_end; i += ir_inc )
+		{
+			const char* a1 = a_cast + i * rstep_a;
+
+			const dim_t m_cur = ( bli_is_not_edge_f( i, m_iter, m_left ) ? MR : m_left );
+
+			// Compute the addresses of the next panels of A and B.
+			const char* a2 = bli_gemm_get_next_a_upanel( a1, rstep_a, ir_inc );
+			if ( bli_is_last_iter( i, ir_end, ir_tid, ir_nt ) )
+			{
+				a2 = a_cast;
+				b2 = bli_gemm_get_next_b_upanel( b1, cstep_b, jr_inc );
+				if ( bli_is_last_iter( j, jr_end, jr_tid, jr_nt ) )
+					b2 = b_cast;
+			}
+
+			// Save addresses of next panels of A and B to the auxinfo_t
+			// object.
+			bli_auxinfo_set_next_a( a2, &aux );
+			bli_auxinfo_set_next_b( b2, &aux );
+
+			const inc_t rs_c = rbs_c[ i * MR ];
+			const inc_t cs_c = cbs_c[ j * NR ];
+
+			if ( rs_c != 0 && cs_c != 0 )
+			{
+				// The microtile has constant row and column strides, so the
+				// microkernel can update it in place.
+				char* c11 = c_cast + ( rscat_c[ i * MR ] + cscat_c[ j * NR ] ) * dt_size;
+
+				// Invoke the gemm micro-kernel.
+				gemm_ukr
+				(
+				  m_cur,
+				  n_cur,
+				  k,
+				  ( void* )alpha_cast,
+				  ( void* )a1,
+				  ( void* )b1,
+				  ( void* )beta_cast,
+				           c11, rs_c, cs_c,
+				  &aux,
+				  ( cntx_t* )cntx
+				);
+			}
+			else
+			{
+				// Invoke the gemm micro-kernel.
+				gemm_ukr
+				(
+				  MR,
+				  NR,
+				  k,
+				  ( void* )alpha_cast,
+				  ( void* )a1,
+				  ( void* )b1,
+				  ( void* )zero,
+				           &ct, rs_ct, cs_ct,
+				  &aux,
+				  ( cntx_t* )cntx
+				);
+
+				// Scatter the microtile to C.
+				ftypes[ dt ]
+				(
+				  m_cur, n_cur,
+				  &ct, rs_ct, cs_ct,
+				  ( void* )beta_cast,
+				  c_cast, rscat_c + i * MR, cscat_c + j * NR
+				);
+			}
+		}
+	}
+}
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+             dim_t  m, \
+             dim_t  n, \
+             void*  x, inc_t rs_x, inc_t cs_x, \
+             void*  beta, \
+             void*  y, const inc_t* rscat_y, const inc_t* cscat_y  \
+     ) \
+{ \
+	ctype* restrict x_cast    = x; \
+	ctype* restrict beta_cast = beta; \
+	ctype* restrict y_cast    = y; \
+\
+	if ( PASTEMAC(ch,eq0)( *beta_cast ) ) \
+	{ \
+		for ( dim_t j = 0; j < n; ++j ) \
+		for ( dim_t i = 0; i < m; ++i ) \
+			PASTEMAC(ch,copys)( x_cast[ i * rs_x + j * cs_x ], \
+			                    y_cast[ rscat_y[ i ] + cscat_y[ j ] ] ); \
+	} \
+	else \
+	{ \
+		for ( dim_t j = 0; j < n; ++j ) \
+		for ( dim_t i = 0; i < m; ++i ) \
+			PASTEMAC(ch,xpbys)( x_cast[ i * rs_x + j * cs_x ], *beta_cast, \
+			                    y_cast[ rscat_y[ i ] + cscat_y[ j ] ] ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( tcontract_scatter_mxn )
+
@@ -0,0 +1,349 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+#include "blis.h"
+
+typedef void (*packm_cxk_fp)
+     (
+             conj_t  conja,
+             pack_t  schema,
+             dim_t   panel_dim,
+             dim_t   panel_len,
+             dim_t   panel_dim_max,
+             dim_t   panel_len_max,
+             void*   kappa,
+             void*   a, inc_t inca, const inc_t* rscat,
+                                    const inc_t* cbs, const inc_t* cscat,
+             void*   p, inc_t ldp,
+       const cntx_t* cntx
+     );
+
+// Define a function pointer array named ftypes and initialize its contents
+// with the addresses of the typed functions bao_?tcontract_packm_cxk().
+static packm_cxk_fp GENARRAY_PREF(ftypes,bao_,tcontract_packm_cxk);
+
+void bao_tcontract_packm
+     (
+       const obj_t*     a,
+             obj_t*     p,
+       const cntx_t*    cntx,
+             rntm_t*    rntm,
+             cntl_t*    cntl,
+       const thrinfo_t* thread
+     )
+{
+	// We begin by copying the fields of A.
+	bli_obj_alias_to( a, p );
+
+	num_t   dt           = bli_obj_dt( a );
+	siz_t   dt_size      = bli_dt_size( dt );
+
+	// Extract various fields from the control tree.
+	bszid_t bmult_id_m   = bli_cntl_packm_params_bmid_m( cntl );
+	bszid_t bmult_id_n   = bli_cntl_packm_params_bmid_n( cntl );
+	pack_t  schema       = bli_cntl_packm_params_pack_schema( cntl );
+	dim_t   bmult_m_def  = bli_cntx_get_blksz_def_dt( dt, bmult_id_m, cntx );
+	dim_t   bmult_m_pack = bli_cntx_get_blksz_max_dt( dt, bmult_id_m, cntx );
+	dim_t   bmult_n_def  = bli_cntx_get_blksz_def_dt( dt, bmult_id_n, cntx );
+
+	// Store the pack schema to the object.
+	bli_obj_set_pack_schema( schema, p );
+
+	// Clear the conjugation field from the object since matrix packing
+	// in BLIS is deemed to take care of all conjugation necessary.
+	bli_obj_set_conj( BLIS_NO_CONJUGATE, p );
+
+	// Since we are packing micropanels, mark P as dense.
+	bli_obj_set_uplo( BLIS_DENSE, p );
+
+	// Reset the view offsets to (0,0).
+	bli_obj_set_offs( 0, 0, p );
+
+	// Compute the dimensions padded by the dimension multiples, and save
+	// them into the packed object. (See bli_packm_init() for details.)
+	dim_t   m_p          = bli_obj_length( p );
+	dim_t   n_p          = bli_obj_width( p );
+	dim_t   m_p_pad      = bli_align_dim_to_mult( m_p, bmult_m_def );
+	dim_t   n_p_pad      = bli_align_dim_to_mult( n_p, bmult_n_def );
+
+	bli_obj_set_padded_dims( m_p_pad, n_p_pad, p );
+
+	// Compute the strides of the packed micropanels.
+	inc_t   ldp          = bmult_m_pack;
+	inc_t   ps_p         = ldp * n_p_pad;
+
+	if ( bli_is_odd( ps_p ) ) ps_p += 1;
+
+	// Store the strides and panel dimension in P.
+	bli_obj_set_strides( 1, ldp, p );
+	bli_obj_set_imag_stride( 1, p );
+	bli_obj_set_panel_dim( bmult_m_def, p );
+	bli_obj_set_panel_stride( ps_p, p );
+	bli_obj_set_panel_length( bmult_m_def, p );
+	bli_obj_set_panel_width( n_p, p );
+
+	// Compute the size of the packed buffer.
+	dim_t   n_iter       = m_p_pad / bmult_m_def;
+	siz_t   size_p       = ps_p * n_iter * dt_size;
+
+	if ( size_p == 0 ) return;
+
+	// The scatter and block-scatter vectors for the rows and columns of the
+	// current block of A are stored after the packed micropanels. Since
+	// ps_p is even and dt_size is at least four, no padding is needed to
+	// align them.
+	siz_t   scat_size    = 2 * ( m_p + n_p ) * sizeof( inc_t );
+
+	char*   p_cast       = bli_packm_alloc( size_p + scat_size, rntm, cntl, thread );
+	bli_obj_set_buffer( p_cast, p );
+
+	inc_t*  rscat        = ( inc_t* )( p_cast + size_p );
+	inc_t*  rbs          = rscat + m_p;
+	inc_t*  cscat        = rbs   + m_p;
+	inc_t*  cbs          = cscat + n_p;
+
+	// The offsets into the tensor are computed entirely by the scatter
+	// vectors, so we use the buffer at the origin of the tensor.
+	char*   a_cast       = bli_obj_buffer( a );
+	dim_t   panel_dim_off = bli_obj_row_off( a );
+	dim_t   panel_len_off = bli_obj_col_off( a );
+	conj_t  conja        = bli_obj_conj_status( a );
+
+	const tcontract_params_t* params = bli_obj_pack_params( a );
+
+	obj_t   kappa_local;
+	char*   kappa_cast   = bli_packm_scalar( &kappa_local, p );
+
+	packm_cxk_fp f       = ftypes[ dt ];
+
+	// Fill in the scatter and block-scatter vectors. This is done by the
+	// chief thread only.
+	if ( bli_thread_am_ochief( thread ) )
+	{
+		bao_tcontract_fill_scatter( &params->rows, bmult_m_def,
+		                            panel_dim_off, m_p, rscat, rbs );
+		bao_tcontract_fill_scatter( &params->cols, BAO_TCONTRACT_BS_K,
+		                            panel_len_off, n_p, cscat, cbs );
+	}
+
+	// Wait for the scatter vectors to be filled in.
+	bli_thread_barrier( thread );
+
+	// Query the number of threads and thread ids from the current thread's
+	// packm thrinfo_t node.
+	const dim_t nt  = bli_thread_n_way( thread );
+	const dim_t tid = bli_thread_work_id( thread );
+
+	// Suppress warnings in case tid isn't used (ie: as in slab partitioning).
+	( void )nt;
+	( void )tid;
+
+	// Determine the thread range and increment using the current thread's
+	// packm thrinfo_t node.
+	dim_t it_start, it_end, it_inc;
+	bli_thread_range_jrir( thread, n_iter, 1, FALSE, &it_start, &it_end, &it_inc );
+
+	// Iterate over every logical micropanel in the source tensor.
+	for ( dim_t ic = 0, it = 0; it < n_iter; ic += bmult_m_def, it += 1 )
+	{
+		if ( bli_packm_my_iter( it, it_start, it_end, tid, nt ) )
+		{
+			dim_t panel_dim_i = bli_min( bmult_m_def, m_p - ic );
+			char* p_begin     = p_cast + it * ps_p * dt_size;
+
+			f
+			(
+			  conja,
+			  schema,
+			  panel_dim_i,
+			  n_p,
+			  bmult_m_def,
+			  n_p_pad,
+			  kappa_cast,
+			  a_cast, rbs[ ic ], rscat + ic,
+			          cbs,       cscat,
+			  p_begin, ldp,
+			  cntx
+			);
+		}
+	}
+}
+
+//
+// Pack one micropanel of a tensor. If the rows of the micropanel have a
+// constant stride (inca != 0), then each run of columns that also have a
+// constant stride is packed with the context's packm kernel. Otherwise,
+// elements are gathered individually via the scatter vectors.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+             conj_t  conja, \
+             pack_t  schema, \
+             dim_t   panel_dim, \
+             dim_t   panel_len, \
+             dim_t   panel_dim_max, \
+             dim_t   panel_len_max, \
+             void*   kappa, \
+             void*   a, inc_t inca, const inc_t* rscat, \
+                                    const inc_t* cbs, const inc_t* cscat, \
+             void*   p, inc_t ldp, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	ctype* restrict kappa_cast = kappa; \
+	ctype* restrict a_cast     = a; \
+	ctype* restrict p_cast     = p; \
+\
+	const dim_t BS_K = BAO_TCONTRACT_BS_K; \
+\
+	const num_t dt     = PASTEMAC(ch,type); \
+	const ukr_t ker_id = bli_is_col_packed( schema ) ? BLIS_PACKM_NRXK_KER \
+	                                                 : BLIS_PACKM_MRXK_KER; \
+\
+	PASTECH2(ch,packm_cxk,_ker_ft) packm_ker = bli_cntx_get_ukr_dt( dt, ker_id, cntx ); \
+\
+	/* The number of leading columns that have been packed (including any
+	   zero-padding). */ \
+	dim_t j_done = 0; \
+\
+	if ( inca != 0 ) \
+	{ \
+		ctype* restrict a_i = a_cast + rscat[ 0 ]; \
+\
+		for ( dim_t j = 0; j < panel_len; ) \
+		{ \
+			const inc_t lda = cbs[ j ]; \
+\
+			if ( lda != 0 ) \
+			{ \
+				/* Extend the run of columns with stride lda across as many
+				   blocks as possible. */ \
+				dim_t j1 = bli_min( j + BS_K, panel_len ); \
+\
+				while ( j1 < panel_len && cbs[ j1 ] == lda && \
+				        cscat[ j1 ] == cscat[ j ] + ( j1 - j ) * lda ) \
+					j1 = bli_min( j1 + BS_K, panel_len ); \
+\
+				/* The last run is also responsible for zero-padding. */ \
+				const dim_t n_j     = j1 - j; \
+				const dim_t n_max_j = ( j1 == panel_len ? panel_len_max - j : n_j ); \
+\
+				packm_ker \
+				( \
+				  conja, \
+				  schema, \
+				  panel_dim, \
+				  n_j, \
+				  n_max_j, \
+				  kappa, \
+				  a_i + cscat[ j ], inca, lda, \
+				  p_cast + j * ldp,     ldp, \
+				  ( cntx_t* )cntx  \
+				); \
+\
+				j      = j1; \
+				j_done = j + n_max_j - n_j; \
+			} \
+			else \
+			{ \
+				const dim_t n_j = bli_min( BS_K, panel_len - j ); \
+\
+				for ( dim_t jj = j; jj < j + n_j; ++jj ) \
+				{ \
+					ctype* restrict a_j = a_i + cscat[ jj ]; \
+					ctype* restrict p_j = p_cast + jj * ldp; \
+\
+					if ( bli_is_conj( conja ) ) \
+					{ \
+						for ( dim_t i = 0; i < panel_dim; ++i ) \
+							PASTEMAC(ch,scal2js)( *kappa_cast, a_j[ i * inca ], p_j[ i ] ); \
+					} \
+					else \
+					{ \
+						for ( dim_t i = 0; i < panel_dim; ++i ) \
+							PASTEMAC(ch,scal2s)( *kappa_cast, a_j[ i * inca ], p_j[ i ] ); \
+					} \
+\
+					for ( dim_t i = panel_dim; i < panel_dim_max; ++i ) \
+						PASTEMAC(ch,set0s)( p_j[ i ] ); \
+				} \
+\
+				j      = j + n_j; \
+				j_done = j; \
+			} \
+		} \
+	} \
+	else \
+	{ \
+		for ( dim_t j = 0; j < panel_len; ++j ) \
+		{ \
+			ctype* restrict a_j = a_cast + cscat[ j ]; \
+			ctype* restrict p_j = p_cast + j * ldp; \
+\
+			if ( bli_is_conj( conja ) ) \
+			{ \
+				for ( dim_t i = 0; i < panel_dim; ++i ) \
+					PASTEMAC(ch,scal2js)( *kappa_cast, a_j[ rscat[ i ] ], p_j[ i ] ); \
+			} \
+			else \
+			{ \
+				for ( dim_t i = 0; i < panel_dim; ++i ) \
+					PASTEMAC(ch,scal2s)( *kappa_cast, a_j[ rscat[ i ] ], p_j[ i ] ); \
+			} \
+\
+			for ( dim_t i = panel_dim; i < panel_dim_max; ++i ) \
+				PASTEMAC(ch,set0s)( p_j[ i ] ); \
+		} \
+\
+		j_done = panel_len; \
+	} \
+\
+	/* Zero-pad the far end of the micropanel, if necessary. */ \
+	for ( dim_t j = j_done; j < panel_len_max; ++j ) \
+	{ \
+		ctype* restrict p_j = p_cast + j * ldp; \
+\
+		for ( dim_t i = 0; i < panel_dim_max; ++i ) \
+			PASTEMAC(ch,set0s)( p_j[ i ] ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( tcontract_packm_cxk )
+
@@ -361,10 +361,11 @@ ALL_H99_SUFS       := $(sort $(FRAME_HDR_SUFS) \
                              $(ADDON_HDR_SUFS) \
                              $(SANDBOX_H99_SUFS) )
 
-# The names of scripts that check output from the BLAS test drivers and
-# BLIS test suite.
+# The names of scripts that check output from the BLAS test drivers, the
+# BLIS test suite, and the standalone test drivers.
 BLASTEST_CHECK     := check-blastest.sh
 TESTSUITE_CHECK    := check-blistest.sh
+STANDALONE_CHECK   := check-standalone.sh
 
 # The names of the testsuite input/configuration files.
 TESTSUITE_CONF_GEN := input.general
@@ -38,5 +38,12 @@
 
 // -- REGISTER BLOCK SIZES (FOR REFERENCE KERNELS) ----------------------------
 
+
+// -- CACHE BLOCK SIZES --------------------------------------------------------
+
+// The generic configuration runs on hardware of which nothing is known, and
+// so its cache blocksizes are derived from the cache hierarchy at runtime.
+#define BLIS_UNTUNED_CACHE_BLKSZS
+
 //#endif
 
@@ -61,6 +61,9 @@ void bli_cntx_init_haswell( cntx_t* cntx )
 	  BLIS_GEMM_UKR,       BLIS_SCOMPLEX, bli_cgemm_haswell_asm_8x3,
 	  BLIS_GEMM_UKR,       BLIS_DCOMPLEX, bli_zgemm_haswell_asm_4x3,
 #endif
+	  // int8 gemm (stored in the BLIS_FLOAT slot)
+	  BLIS_GEMM_I8_UKR,    BLIS_FLOAT,    bli_i8gemm_haswell_int_6x16,
+
 	  // gemmtrsm_l
 	  BLIS_GEMMTRSM_L_UKR, BLIS_FLOAT,    bli_sgemmtrsm_l_haswell_asm_6x16,
 	  BLIS_GEMMTRSM_L_UKR, BLIS_DOUBLE,   bli_dgemmtrsm_l_haswell_asm_6x8,
@@ -79,6 +82,16 @@ void bli_cntx_init_haswell( cntx_t* cntx )
 	  BLIS_PACKM_NRXK_KER, BLIS_SCOMPLEX, bli_cpackm_haswell_asm_8xk,
 	  BLIS_PACKM_MRXK_KER, BLIS_DCOMPLEX, bli_zpackm_haswell_asm_3xk,
 	  BLIS_PACKM_NRXK_KER, BLIS_DCOMPLEX, bli_zpackm_haswell_asm_4xk,
+
+	  // packm (bfloat16/float16 sources)
+	  BLIS_PACKM_MRXK_BF16_KER, BLIS_FLOAT, bli_spackm_bf16_haswell_int_6xk,
+	  BLIS_PACKM_NRXK_BF16_KER, BLIS_FLOAT, bli_spackm_bf16_haswell_int_16xk,
+	  BLIS_PACKM_MRXK_F16_KER,  BLIS_FLOAT, bli_spackm_f16_haswell_int_6xk,
+	  BLIS_PACKM_NRXK_F16_KER,  BLIS_FLOAT, bli_spackm_f16_haswell_int_16xk,
+
+	  // packm (quantized sources)
+	  BLIS_PACKM_MRXK_QUANT_KER, BLIS_FLOAT, bli_spackm_quant_haswell_int_6xk,
+	  BLIS_PACKM_NRXK_QUANT_KER, BLIS_FLOAT, bli_spackm_quant_haswell_int_16xk,
 #endif
 
 	  // axpyf
@@ -207,6 +220,14 @@ void bli_cntx_init_haswell( cntx_t* cntx )
 	bli_blksz_init_easy( &blkszs[ BLIS_AF ],     8,     8,     8,     8 );
 	bli_blksz_init_easy( &blkszs[ BLIS_DF ],     8,     8,     8,     8 );
 
+	// Initialize int8 gemm blocksizes (stored in the BLIS_FLOAT slot).
+	//                                           s      d      c      z
+	bli_blksz_init_easy( &blkszs[ BLIS_MR_I8 ],     6,     0,     0,     0 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NR_I8 ],    16,     0,     0,     0 );
+	bli_blksz_init_easy( &blkszs[ BLIS_MC_I8 ],   144,     0,     0,     0 );
+	bli_blksz_init_easy( &blkszs[ BLIS_KC_I8 ],  1024,     0,     0,     0 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NC_I8 ],  4080,     0,     0,     0 );
+
 	// -------------------------------------------------------------------------
 
 	// Initialize sup thresholds with architecture-appropriate values.
@@ -254,6 +275,13 @@ void bli_cntx_init_haswell( cntx_t* cntx )
 	  BLIS_NR_SUP, &blkszs[ BLIS_NR_SUP ], BLIS_NR_SUP,
 	  BLIS_MR_SUP, &blkszs[ BLIS_MR_SUP ], BLIS_MR_SUP,
 
+	  // int8 gemm
+	  BLIS_NC_I8, &blkszs[ BLIS_NC_I8 ], BLIS_NR_I8,
+	  BLIS_KC_I8, &blkszs[ BLIS_KC_I8 ], BLIS_KR,
+	  BLIS_MC_I8, &blkszs[ BLIS_MC_I8 ], BLIS_MR_I8,
+	  BLIS_NR_I8, &blkszs[ BLIS_NR_I8 ], BLIS_NR_I8,
+	  BLIS_MR_I8, &blkszs[ BLIS_MR_I8 ], BLIS_MR_I8,
+
 	  BLIS_VA_END
 	);
 }
@@ -95,6 +95,52 @@ typedef void (*PASTECH3(ch,opname,_ker,tsuf)) \
 
 INSERT_GENTDEF( packm_cxk )
 
+// packm_ker for 16-bit floating-point source operands (ctype is the datatype
+// of the packed micropanel; the source is read as bfloat16 or float16)
+
+#undef  GENTDEF
+#define GENTDEF( ctype, ch, opname, tsuf ) \
+\
+typedef void (*PASTECH3(ch,opname,_ker,tsuf)) \
+     ( \
+       conj_t           conja, \
+       pack_t           schema, \
+       dim_t            cdim, \
+       dim_t            n, \
+       dim_t            n_max, \
+       ctype*  restrict kappa, \
+       void*   restrict a, inc_t inca, inc_t lda, \
+       ctype*  restrict p,             inc_t ldp, \
+       cntx_t*          cntx  \
+     );
+
+INSERT_GENTDEF( packm_cxk_half )
+
+// packm_ker for quantized source operands (ctype is the datatype of the
+// packed micropanel; the source is located via params and the offsets of
+// the micropanel, as described in bli_packm_struc_cxk_quant.h)
+
+#undef  GENTDEF
+#define GENTDEF( ctype, ch, opname, tsuf ) \
+\
+typedef void (*PASTECH3(ch,opname,_ker,tsuf)) \
+     ( \
+       conj_t           conja, \
+       pack_t           schema, \
+       dim_t            cdim, \
+       dim_t            n, \
+       dim_t            n_max, \
+       ctype*  restrict kappa, \
+       void*            params, \
+       dim_t            off_cdim, \
+       dim_t            off_n, \
+       inc_t            inca, inc_t lda, \
+       ctype*  restrict p,    inc_t ldp, \
+       cntx_t*          cntx  \
+     );
+
+INSERT_GENTDEF( packm_cxk_quant )
+
 // unpackm_ker
 
 #undef  GENTDEF
@@ -51,6 +51,28 @@ INSERT_GENTPROT_BASIC0( packm_mrxk_ker_name )
 INSERT_GENTPROT_BASIC0( packm_nrxk_ker_name )
 
 
+// packm kernels for 16-bit floating-point source operands (only defined for
+// single precision real packed micropanels)
+
+#undef  GENTPROT
+#define GENTPROT PACKM_HALF_KER_PROT
+
+GENTPROT( float, s, packm_mrxk_bf16_ker_name )
+GENTPROT( float, s, packm_nrxk_bf16_ker_name )
+GENTPROT( float, s, packm_mrxk_f16_ker_name )
+GENTPROT( float, s, packm_nrxk_f16_ker_name )
+
+
+// packm kernels for quantized source operands (only defined for single
+// precision real packed micropanels)
+
+#undef  GENTPROT
+#define GENTPROT PACKM_QUANT_KER_PROT
+
+GENTPROT( float, s, packm_mrxk_quant_ker_name )
+GENTPROT( float, s, packm_nrxk_quant_ker_name )
+
+
 // native unpackm kernels
 
 #undef  GENTPROT
@@ -69,6 +91,17 @@ INSERT_GENTPROT_BASIC0( packm_mrxk_1er_ker_name )
 INSERT_GENTPROT_BASIC0( packm_nrxk_1er_ker_name )
 
 
+// 4mi/3mi packm kernels
+
+#undef  GENTPROT
+#define GENTPROT PACKM_KER_PROT
+
+INSERT_GENTPROT_BASIC0( packm_mrxk_4mi_ker_name )
+INSERT_GENTPROT_BASIC0( packm_nrxk_4mi_ker_name )
+INSERT_GENTPROT_BASIC0( packm_mrxk_3mi_ker_name )
+INSERT_GENTPROT_BASIC0( packm_nrxk_3mi_ker_name )
+
+
 // packm kernels for diagonal blocks
 
 #undef  GENTPROT
@@ -55,6 +55,45 @@ void PASTEMAC(ch,varname) \
      );
 
 
+// packm kernels for 16-bit floating-point source operands
+
+#define PACKM_HALF_KER_PROT( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       conj_t           conja, \
+       pack_t           schema, \
+       dim_t            cdim, \
+       dim_t            n, \
+       dim_t            n_max, \
+       ctype*  restrict kappa, \
+       void*   restrict a, inc_t inca, inc_t lda, \
+       ctype*  restrict p,             inc_t ldp, \
+       cntx_t*          cntx  \
+     );
+
+
+// packm kernels for quantized source operands
+
+#define PACKM_QUANT_KER_PROT( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       conj_t           conja, \
+       pack_t           schema, \
+       dim_t            cdim, \
+       dim_t            n, \
+       dim_t            n_max, \
+       ctype*  restrict kappa, \
+       void*            params, \
+       dim_t            off_cdim, \
+       dim_t            off_n, \
+       inc_t            inca, inc_t lda, \
+       ctype*  restrict p,    inc_t ldp, \
+       cntx_t*          cntx  \
+     );
+
+
 // unpackm kernels
 
 #define UNPACKM_KER_PROT( ctype, ch, varname ) \
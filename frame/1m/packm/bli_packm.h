@@ -44,6 +44,9 @@
 
 #include "bli_packm_struc_cxk.h"
 
+// 16-bit floating-point (bfloat16/float16) source support.
+#include "bli_packm_struc_cxk_half.h"
+
 // Mixed datatype support.
 #ifdef BLIS_ENABLE_GEMM_MD
 #include "bli_packm_struc_cxk_md.h"
@@ -51,3 +54,12 @@
 
 #include "bli_packm_blk_var1.h"
 
+// Weight-only quantized source support.
+#include "bli_packm_struc_cxk_quant.h"
+
+// Diagonally-scaled source support.
+#include "bli_packm_struc_cxk_diag.h"
+
+// Concatenated (rank-2k) source support.
+#include "bli_packm_struc_cxk_r2k.h"
+
@@ -48,6 +48,12 @@ static func_t packm_struc_cxk_kers[BLIS_NUM_PACK_SCHEMA_TYPES] =
 // 0010 row/col panels: 1m-reordered (1r)
     { { NULL,                      bli_cpackm_struc_cxk,
         NULL,                      bli_zpackm_struc_cxk,  } },
+// 0011 row/col panels: 4m-interleaved (4mi)
+    { { NULL,                      bli_cpackm_struc_cxk,
+        NULL,                      bli_zpackm_struc_cxk,  } },
+// 0100 row/col panels: 3m-interleaved (3mi)
+    { { NULL,                      bli_cpackm_struc_cxk,
+        NULL,                      bli_zpackm_struc_cxk,  } },
 };
 
 static void_fp GENARRAY2_ALL(packm_struc_cxk_md,packm_struc_cxk_md);
@@ -118,8 +124,18 @@ void bli_packm_blk_var1
 	// Query the datatype-specific function pointer from the func_t object.
 	packm_ker_vft packm_ker_cast = bli_func_get_dt( dt_p, packm_kers );
 
-	// For mixed-precision gemm, select the proper kernel (only dense panels).
-	if ( dt_c != dt_p )
+	// For 16-bit floating-point source matrices, select the kernel that
+	// converts to the (float) packed datatype. Otherwise, for mixed-precision
+	// gemm, select the proper kernel (only dense panels).
+	if ( bli_is_bfloat16( dt_c ) )
+	{
+		packm_ker_cast = ( packm_ker_vft )bli_bspackm_struc_cxk_half;
+	}
+	else if ( bli_is_float16( dt_c ) )
+	{
+		packm_ker_cast = ( packm_ker_vft )bli_hspackm_struc_cxk_half;
+	}
+	else if ( dt_c != dt_p )
 	{
 		packm_ker_cast = packm_struc_cxk_md[ dt_c ][ dt_p ];
 	}
@@ -128,7 +144,7 @@ void bli_packm_blk_var1
 	// have set this field in order to specify a custom packm kernel.
 	packm_blk_var1_params_t* params = bli_obj_pack_params( c );
 
-	if ( params && params->ukr_fn[ dt_c ][ dt_p ] )
+	if ( params && !bli_is_half( dt_c ) && params->ukr_fn[ dt_c ][ dt_p ] )
 	{
 		// Query the user-provided packing kernel from the obj_t. If provided,
 		// this overrides the kernel determined above.
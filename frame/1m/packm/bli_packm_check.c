@@ -44,10 +44,14 @@ void bli_packm_init_check
 {
 	err_t e_val;
 
-	// Check object datatypes.
+	// Check object datatypes. 16-bit floating-point source matrices are
+	// converted to their (single precision) target datatype during packing.
 
-	e_val = bli_check_floating_object( a );
-	bli_check_error_code( e_val );
+	if ( !bli_obj_is_half( a ) )
+	{
+		e_val = bli_check_floating_object( a );
+		bli_check_error_code( e_val );
+	}
 
 	// Check control tree pointer.
 
@@ -66,10 +70,14 @@ void bli_packm_int_check
 {
 	err_t e_val;
 
-	// Check object datatypes.
+	// Check object datatypes. 16-bit floating-point source matrices are
+	// converted to their (single precision) target datatype during packing.
 
-	e_val = bli_check_floating_object( a );
-	bli_check_error_code( e_val );
+	if ( !bli_obj_is_half( a ) )
+	{
+		e_val = bli_check_floating_object( a );
+		bli_check_error_code( e_val );
+	}
 
 	e_val = bli_check_floating_object( p );
 	bli_check_error_code( e_val );
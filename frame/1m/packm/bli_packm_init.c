@@ -157,10 +157,26 @@ bool bli_packm_init
 	// Set the imaginary stride (in units of fundamental elements).
 	// This is the number of real elements that must be traversed before
 	// reaching the imaginary part of the packed micropanel. NOTE: the
-	// imaginary stride is mostly vestigial and left over from the 3m
-	// and 4m implementations.
+	// imaginary stride is only used by the 3m and 4m methods, which store
+	// the real and imaginary parts of each micropanel as separate real
+	// micropanels.
 	inc_t is_p = 1;
 
+	if ( bli_is_4mi_packed( schema ) )
+	{
+		// The real and imaginary micropanels each occupy ps_p real
+		// elements, which together fill the original micropanel.
+		is_p = ps_p;
+	}
+	else if ( bli_is_3mi_packed( schema ) )
+	{
+		// The real, imaginary, and real+imaginary micropanels each occupy
+		// ps_p real elements, and so the micropanel stride (in units of
+		// complex elements) must grow by half. Note that ps_p is even.
+		is_p = ps_p;
+		ps_p = ( ps_p * 3 ) / 2;
+	}
+
 	// Store the strides and panel dimension in P.
 	bli_obj_set_strides( rs_p, cs_p, p );
 	bli_obj_set_imag_stride( is_p, p );
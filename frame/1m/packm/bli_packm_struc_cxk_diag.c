@@ -0,0 +1,197 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+#include "blis.h"
+
+static void_fp GENARRAY(packm_struc_cxk_diag,packm_struc_cxk_diag);
+
+void bli_obj_attach_diag_params
+     (
+       const obj_t*               d,
+             bool                 real_d,
+             packm_diag_params_t* params,
+             obj_t*               b
+     )
+{
+	num_t dt = bli_obj_dt( b );
+
+	if ( bli_error_checking_is_enabled() )
+	{
+		err_t e_val;
+
+		e_val = bli_check_floating_object( b );
+		bli_check_error_code( e_val );
+
+		e_val = bli_check_vector_object( d );
+		bli_check_error_code( e_val );
+
+		e_val = bli_check_vector_dim_equals( d, bli_obj_length_after_trans( b ) );
+		bli_check_error_code( e_val );
+
+		e_val = bli_check_consistent_object_datatypes( b, d );
+		bli_check_error_code( e_val );
+
+		e_val = bli_check_null_pointer( params );
+		bli_check_error_code( e_val );
+	}
+
+	memset( params, 0, sizeof( packm_diag_params_t ) );
+
+	// Override the packm kernel for same-datatype packing. See
+	// bli_packm_blk_var1().
+	params->var1.ukr_fn[ dt ][ dt ] = ( packm_ker_vft )packm_struc_cxk_diag[ dt ];
+
+	params->d      = bli_obj_buffer_at_off( d );
+	params->incd   = bli_obj_vector_inc( d );
+	params->real_d = real_d;
+
+	bli_obj_set_pack_params( params, b );
+}
+
+void bli_obj_create_diag_scaled_copy
+     (
+       const obj_t* d,
+             bool   real_d,
+       const obj_t* b,
+             obj_t* w
+     )
+{
+	const dim_t k = bli_obj_length_after_trans( b );
+	const dim_t n = bli_obj_width_after_trans( b );
+
+	bli_obj_create( bli_obj_dt( b ), k, n, 0, 0, w );
+
+	bli_copym( b, w );
+
+	for ( dim_t l = 0; l < k; ++l )
+	{
+		obj_t d1, d1_r, w1;
+
+		bli_acquire_vpart_f2b( BLIS_SUBPART1, l, 1, d, &d1 );
+		bli_acquire_mpart_t2b( BLIS_SUBPART1, l, 1, w, &w1 );
+
+		bli_obj_real_part( &d1, &d1_r );
+
+		bli_scalv( real_d ? &d1_r : &d1, &w1 );
+	}
+}
+
+// Structure-aware packm "kernel" for diagonally-scaled source matrices. The
+// micropanel is first packed via the context's packm kernel, after which
+// each of its columns (i.e., each index along the k dimension) is scaled
+// by the corresponding diagonal element. Note that the level-3 front-ends
+// reset the origin of each operand, so panel_len_off is the k offset of the
+// micropanel relative to b as it was passed to the operation.
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       struc_t strucc, \
+       diag_t  diagc, \
+       uplo_t  uploc, \
+       conj_t  conjc, \
+       pack_t  schema, \
+       bool    invdiag, \
+       dim_t   panel_dim, \
+       dim_t   panel_len, \
+       dim_t   panel_dim_max, \
+       dim_t   panel_len_max, \
+       dim_t   panel_dim_off, \
+       dim_t   panel_len_off, \
+       ctype*  kappa, \
+       ctype*  c, inc_t incc, inc_t ldc, \
+       ctype*  p,             inc_t ldp, \
+                  inc_t is_p, \
+       cntx_t* cntx, \
+       void*   params  \
+     ) \
+{ \
+	const num_t                dt       = PASTEMAC(ch,type); \
+	const packm_diag_params_t* params_d = params; \
+\
+	/* Only dense micropanels packed for native execution are supported. */ \
+	if ( !bli_is_general( strucc ) || !bli_is_nat_packed( schema ) ) \
+		bli_check_error_code( BLIS_NOT_YET_IMPLEMENTED ); \
+\
+	ukr_t cxk_ker_id = bli_is_col_packed( schema ) ? BLIS_PACKM_NRXK_KER \
+	                                               : BLIS_PACKM_MRXK_KER; \
+\
+	PASTECH2(ch,packm_cxk,_ker_ft) f_cxk = bli_cntx_get_ukr_dt( dt, cxk_ker_id, cntx ); \
+\
+	f_cxk \
+	( \
+	  conjc, \
+	  schema, \
+	  panel_dim, \
+	  panel_len, \
+	  panel_len_max, \
+	  kappa, \
+	  c, incc, ldc, \
+	  p,       ldp, \
+	  cntx  \
+	); \
+\
+	const inc_t  incd = params_d->incd; \
+	const ctype* d    = ( const ctype* )params_d->d + panel_len_off * incd; \
+\
+	/* Scale the columns of the micropanel. The zero padding written by the
+	   packm kernel beyond panel_dim and panel_len is left unchanged. */ \
+	if ( params_d->real_d ) \
+	{ \
+		for ( dim_t j = 0; j < panel_len; ++j ) \
+		{ \
+			const ctype_r dj = PASTEMAC(ch,real)( d[ j*incd ] ); \
+\
+			for ( dim_t i = 0; i < panel_dim; ++i ) \
+				PASTEMAC2(chr,ch,scals)( dj, p[ i + j*ldp ] ); \
+		} \
+	} \
+	else \
+	{ \
+		for ( dim_t j = 0; j < panel_len; ++j ) \
+		{ \
+			const ctype dj = d[ j*incd ]; \
+\
+			for ( dim_t i = 0; i < panel_dim; ++i ) \
+				PASTEMAC(ch,scals)( dj, p[ i + j*ldp ] ); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNCR_BASIC0( packm_struc_cxk_diag )
+
@@ -0,0 +1,114 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+//
+// Diagonally-scaled matrix operands.
+//
+// An operand with diagonal params attached is packed as if it had been
+// scaled by a diagonal matrix D along its k dimension, so that gemm-like
+// operations (e.g. gemmt) may compute A*D*B without forming D*B. This is
+// the mechanism used by bli_syrkd() and bli_herkd(). Since the gemmsup code
+// path does not pack via bli_packm_blk_var1(), operands with diagonal params
+// are always computed via the conventional code path.
+//
+
+typedef struct
+{
+	// NOTE: This must be the first field so that a pointer to this struct
+	// may be interpreted as a packm_blk_var1_params_t.
+	packm_blk_var1_params_t var1;
+
+	// The diagonal element corresponding to the k offset l is stored at
+	// d[ l * incd ]. If real_d is set, only the real part of each diagonal
+	// element is referenced.
+	const void* d;
+	inc_t       incd;
+	bool        real_d;
+} packm_diag_params_t;
+
+// Initialize params and attach them to a k x n object b so that each row
+// of b is scaled by the corresponding element of the vector d (of length k
+// and of the same datatype as b) when b is packed. The params struct must
+// remain valid for as long as b is in use.
+BLIS_EXPORT_BLIS void bli_obj_attach_diag_params
+     (
+       const obj_t*               d,
+             bool                 real_d,
+             packm_diag_params_t* params,
+             obj_t*               b
+     );
+
+// Create w as a copy of the k x n object b (after any transposition) in
+// which each row is scaled by the corresponding element of the vector d (or,
+// if real_d is TRUE, by its real part). This may be used in place of
+// bli_obj_attach_diag_params() where diagonal params are not supported,
+// e.g. by the sup code path or by induced methods. The caller must free w.
+BLIS_EXPORT_BLIS void bli_obj_create_diag_scaled_copy
+     (
+       const obj_t* d,
+             bool   real_d,
+       const obj_t* b,
+             obj_t* w
+     );
+
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       struc_t strucc, \
+       diag_t  diagc, \
+       uplo_t  uploc, \
+       conj_t  conjc, \
+       pack_t  schema, \
+       bool    invdiag, \
+       dim_t   panel_dim, \
+       dim_t   panel_len, \
+       dim_t   panel_dim_max, \
+       dim_t   panel_len_max, \
+       dim_t   panel_dim_off, \
+       dim_t   panel_len_off, \
+       ctype*  kappa, \
+       ctype*  c, inc_t incc, inc_t ldc, \
+       ctype*  p,             inc_t ldp, \
+                  inc_t is_p, \
+       cntx_t* cntx, \
+       void*   params  \
+     );
+
+INSERT_GENTPROT_BASIC0( packm_struc_cxk_diag )
+
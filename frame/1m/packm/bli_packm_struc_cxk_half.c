@@ -0,0 +1,96 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+// Structure-aware packm "kernels" for bfloat16 and float16 source matrices.
+// The 16-bit elements are converted to float within the packm_*_bf16/f16
+// kernels (registered in the BLIS_FLOAT slot of the context) so that the
+// resulting micropanels may be consumed by the single precision real
+// microkernels.
+
+#undef  GENTFUNCH
+#define GENTFUNCH( ctype_c, ctype_p, chc, chp, varname, mr_ker_id, nr_ker_id ) \
+\
+void PASTEMAC2(chc,chp,varname) \
+     ( \
+       struc_t           strucc, \
+       diag_t            diagc, \
+       uplo_t            uploc, \
+       conj_t            conjc, \
+       pack_t            schema, \
+       bool              invdiag, \
+       dim_t             panel_dim, \
+       dim_t             panel_len, \
+       dim_t             panel_dim_max, \
+       dim_t             panel_len_max, \
+       dim_t             panel_dim_off, \
+       dim_t             panel_len_off, \
+       ctype_p* restrict kappa, \
+       ctype_c* restrict c, inc_t incc, inc_t ldc, \
+       ctype_p* restrict p,             inc_t ldp, \
+                            inc_t is_p, \
+       cntx_t*           cntx, \
+       void*             params \
+     ) \
+{ \
+	const num_t dt_p = PASTEMAC(chp,type); \
+\
+	/* Only dense micropanels packed for native execution are supported. */ \
+	if ( !bli_is_general( strucc ) || !bli_is_nat_packed( schema ) ) \
+		bli_check_error_code( BLIS_NOT_YET_IMPLEMENTED ); \
+\
+	ukr_t cxk_ker_id = bli_is_col_packed( schema ) ? nr_ker_id : mr_ker_id; \
+\
+	PASTECH2(chp,packm_cxk_half,_ker_ft) f_cxk \
+	= bli_cntx_get_ukr_dt( dt_p, cxk_ker_id, cntx ); \
+\
+	f_cxk \
+	( \
+	  conjc, \
+	  schema, \
+	  panel_dim, \
+	  panel_len, \
+	  panel_len_max, \
+	  kappa, \
+	  c, incc, ldc, \
+	  p,       ldp, \
+	  cntx  \
+	); \
+}
+
+GENTFUNCH( bfloat16, float, b, s, packm_struc_cxk_half, BLIS_PACKM_MRXK_BF16_KER, BLIS_PACKM_NRXK_BF16_KER )
+GENTFUNCH( float16,  float, h, s, packm_struc_cxk_half, BLIS_PACKM_MRXK_F16_KER,  BLIS_PACKM_NRXK_F16_KER )
+
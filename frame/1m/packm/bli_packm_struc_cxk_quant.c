@@ -0,0 +1,136 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+void bli_obj_attach_quant_params
+     (
+             quant_t               qtype,
+             dim_t                 group_size,
+       const float*                scale, inc_t rs_s, inc_t cs_s,
+       const float*                zero,  inc_t rs_z, inc_t cs_z,
+             packm_quant_params_t* params,
+             obj_t*                b
+     )
+{
+	if ( bli_error_checking_is_enabled() )
+	{
+		err_t e_val;
+
+		e_val = bli_check_real_object( b );
+		bli_check_error_code( e_val );
+
+		e_val = bli_check_null_pointer( scale );
+		bli_check_error_code( e_val );
+
+		e_val = bli_check_null_pointer( params );
+		bli_check_error_code( e_val );
+
+		if ( group_size < 1 || !bli_is_float( bli_obj_dt( b ) ) )
+			bli_check_error_code( BLIS_NOT_YET_IMPLEMENTED );
+	}
+
+	memset( params, 0, sizeof( packm_quant_params_t ) );
+
+	// Override the packm kernel for float -> float packing. See
+	// bli_packm_blk_var1().
+	params->var1.ukr_fn[ BLIS_FLOAT ][ BLIS_FLOAT ]
+	= ( packm_ker_vft )bli_spackm_struc_cxk_quant;
+
+	params->qtype      = qtype;
+	params->buf        = bli_obj_buffer( b );
+	params->group_size = group_size;
+	params->scale      = scale; params->rs_s = rs_s; params->cs_s = cs_s;
+	params->zero       = zero;  params->rs_z = rs_z; params->cs_z = cs_z;
+
+	bli_obj_set_pack_params( params, b );
+}
+
+// Structure-aware packm "kernel" for quantized source matrices. Since the
+// elements of the source are not floats, the address c computed by the
+// caller is ignored; the panel is instead located via its offsets within
+// the quantized buffer. Note that the source is always an (m or n) x k
+// view when packed, so panel_dim_off indexes the m or n dimension and
+// panel_len_off indexes the k dimension, even if the operation was
+// transposed.
+
+void bli_spackm_struc_cxk_quant
+     (
+       struc_t          strucc,
+       diag_t           diagc,
+       uplo_t           uploc,
+       conj_t           conjc,
+       pack_t           schema,
+       bool             invdiag,
+       dim_t            panel_dim,
+       dim_t            panel_len,
+       dim_t            panel_dim_max,
+       dim_t            panel_len_max,
+       dim_t            panel_dim_off,
+       dim_t            panel_len_off,
+       float*  restrict kappa,
+       float*  restrict c, inc_t incc, inc_t ldc,
+       float*  restrict p,             inc_t ldp,
+                           inc_t is_p,
+       cntx_t*          cntx,
+       void*            params
+     )
+{
+	// Only dense micropanels packed for native execution are supported.
+	if ( !bli_is_general( strucc ) || !bli_is_nat_packed( schema ) )
+		bli_check_error_code( BLIS_NOT_YET_IMPLEMENTED );
+
+	ukr_t cxk_ker_id = bli_is_col_packed( schema ) ? BLIS_PACKM_NRXK_QUANT_KER
+	                                               : BLIS_PACKM_MRXK_QUANT_KER;
+
+	spackm_cxk_quant_ker_ft f_cxk
+	= bli_cntx_get_ukr_dt( BLIS_FLOAT, cxk_ker_id, cntx );
+
+	f_cxk
+	(
+	  conjc,
+	  schema,
+	  panel_dim,
+	  panel_len,
+	  panel_len_max,
+	  kappa,
+	  params,
+	  panel_dim_off,
+	  panel_len_off,
+	  incc, ldc,
+	  p,    ldp,
+	  cntx
+	);
+}
@@ -0,0 +1,124 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+//
+// Weight-only quantized matrix operands.
+//
+// A quantized operand is an ordinary BLIS_FLOAT object whose buffer holds
+// 8-bit or 4-bit integers instead of floats, along with a set of per-group
+// scales (and, optionally, zero points) along the k dimension. When such an
+// object is packed via bli_packm_blk_var1(), its elements are dequantized
+//
+//   b(l,j) = kappa * scale(g,j) * ( q(l,j) - zero(g,j) ),  g = l / group_size
+//
+// directly into float micropanels, which may then be consumed by the
+// unmodified sgemm microkernel. Here l indexes the k dimension and j the
+// m or n dimension of the operation. Strides of the quantized buffer are
+// given in units of elements; for BLIS_QUANT_UINT4, element e is stored in
+// the low (e even) or high (e odd) nibble of byte e/2.
+//
+// NOTE: Only dense (general) operands are supported, and since the gemmsup
+// code path does not pack via bli_packm_blk_var1(), operands with custom
+// pack params are always computed via the conventional code path.
+//
+
+typedef enum
+{
+	BLIS_QUANT_INT8  = 0,
+	BLIS_QUANT_UINT4
+} quant_t;
+
+typedef struct
+{
+	// NOTE: This must be the first field so that a pointer to this struct
+	// may be interpreted as a packm_blk_var1_params_t.
+	packm_blk_var1_params_t var1;
+
+	quant_t      qtype;
+	const void*  buf;
+	dim_t        group_size;
+
+	// scale(g,j) is stored at scale[ g*rs_s + j*cs_s ]; similarly for
+	// zero(g,j), which is taken to be zero if zero is NULL.
+	const float* scale; inc_t rs_s, cs_s;
+	const float* zero;  inc_t rs_z, cs_z;
+} packm_quant_params_t;
+
+// Read the quantized element at (element) index e as a float.
+BLIS_INLINE float bli_quant_get( quant_t qtype, const void* buf, inc_t e )
+{
+	if ( qtype == BLIS_QUANT_INT8 )
+		return ( float )( ( const int8_t* )buf )[ e ];
+
+	const uint8_t byte = ( ( const uint8_t* )buf )[ e >> 1 ];
+
+	return ( float )( e & 1 ? byte >> 4 : byte & 0xF );
+}
+
+// Initialize params and attach them to a k x n object b (whose quantized
+// buffer must already be attached) so that b is dequantized when packed.
+// The params struct must remain valid for as long as b is in use.
+BLIS_EXPORT_BLIS void bli_obj_attach_quant_params
+     (
+             quant_t               qtype,
+             dim_t                 group_size,
+       const float*                scale, inc_t rs_s, inc_t cs_s,
+       const float*                zero,  inc_t rs_z, inc_t cs_z,
+             packm_quant_params_t* params,
+             obj_t*                b
+     );
+
+void bli_spackm_struc_cxk_quant
+     (
+       struc_t          strucc,
+       diag_t           diagc,
+       uplo_t           uploc,
+       conj_t           conjc,
+       pack_t           schema,
+       bool             invdiag,
+       dim_t            panel_dim,
+       dim_t            panel_len,
+       dim_t            panel_dim_max,
+       dim_t            panel_len_max,
+       dim_t            panel_dim_off,
+       dim_t            panel_len_off,
+       float*  restrict kappa,
+       float*  restrict c, inc_t incc, inc_t ldc,
+       float*  restrict p,             inc_t ldp,
+                           inc_t is_p,
+       cntx_t*          cntx,
+       void*            params
+     );
+
@@ -0,0 +1,191 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+#include "blis.h"
+
+static void_fp GENARRAY(packm_struc_cxk_r2k,packm_struc_cxk_r2k);
+
+void bli_obj_create_r2k_operand
+     (
+       const obj_t*              a0,
+       const obj_t*              a1,
+             conj_t              conj,
+       const obj_t*              scal0,
+       const obj_t*              scal1,
+             packm_r2k_params_t* params,
+             obj_t*              p
+     )
+{
+	const num_t  dt    = bli_obj_dt( a0 );
+	const dim_t  m     = bli_obj_length_after_trans( a0 );
+	const dim_t  k     = bli_obj_width_after_trans( a0 );
+	const obj_t* as[2] = { a0, a1 };
+	const obj_t* ss[2] = { scal0, scal1 };
+
+	if ( bli_error_checking_is_enabled() )
+	{
+		err_t e_val;
+
+		e_val = bli_check_floating_object( a0 );
+		bli_check_error_code( e_val );
+
+		e_val = bli_check_consistent_object_datatypes( a0, a1 );
+		bli_check_error_code( e_val );
+
+		e_val = bli_check_conformal_dims( a0, a1 );
+		bli_check_error_code( e_val );
+
+		e_val = bli_check_null_pointer( params );
+		bli_check_error_code( e_val );
+	}
+
+	memset( params, 0, sizeof( packm_r2k_params_t ) );
+
+	// Override the packm kernel for same-datatype packing. See
+	// bli_packm_blk_var1().
+	params->var1.ukr_fn[ dt ][ dt ] = ( packm_ker_vft )packm_struc_cxk_r2k[ dt ];
+
+	params->k = k;
+
+	for ( dim_t j = 0; j < 2; ++j )
+	{
+		// Record the strides of each matrix as if it were not transposed.
+		params->buf[ j ]  = bli_obj_buffer_at_off( as[ j ] );
+		params->rs[ j ]   = bli_obj_has_trans( as[ j ] ) ? bli_obj_col_stride( as[ j ] )
+		                                                 : bli_obj_row_stride( as[ j ] );
+		params->cs[ j ]   = bli_obj_has_trans( as[ j ] ) ? bli_obj_row_stride( as[ j ] )
+		                                                 : bli_obj_col_stride( as[ j ] );
+		params->conj[ j ] = bli_apply_conj( conj, bli_obj_conj_status( as[ j ] ) );
+		params->scal[ j ] = bli_obj_buffer_for_1x1( dt, ss[ j ] );
+	}
+
+	// The container is given the buffer of a0 (which is never referenced
+	// through the container) along with dense strides.
+	bli_obj_create_without_buffer( dt, m, 2*k, p );
+	bli_obj_set_buffer( ( void* )params->buf[ 0 ], p );
+	bli_obj_set_strides( 1, bli_max( m, 1 ), p );
+
+	bli_obj_set_pack_params( params, p );
+}
+
+// Structure-aware packm "kernel" for rank-2k container operands. Since the
+// container does not have a buffer of its own, the address c computed by
+// the caller is ignored; each micropanel is instead packed from A0 and/or A1
+// (a micropanel may straddle the two) via the context's packm kernel. Note
+// that the container is always an m x 2k view when packed, so panel_dim_off
+// indexes the m dimension and panel_len_off indexes the 2k dimension, even
+// if the container was transposed.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       struc_t strucc, \
+       diag_t  diagc, \
+       uplo_t  uploc, \
+       conj_t  conjc, \
+       pack_t  schema, \
+       bool    invdiag, \
+       dim_t   panel_dim, \
+       dim_t   panel_len, \
+       dim_t   panel_dim_max, \
+       dim_t   panel_len_max, \
+       dim_t   panel_dim_off, \
+       dim_t   panel_len_off, \
+       ctype*  kappa, \
+       ctype*  c, inc_t incc, inc_t ldc, \
+       ctype*  p,             inc_t ldp, \
+                  inc_t is_p, \
+       cntx_t* cntx, \
+       void*   params  \
+     ) \
+{ \
+	const num_t               dt         = PASTEMAC(ch,type); \
+	const packm_r2k_params_t* params_r2k = params; \
+\
+	/* Only dense micropanels packed for native execution are supported. */ \
+	if ( !bli_is_general( strucc ) || !bli_is_nat_packed( schema ) ) \
+		bli_check_error_code( BLIS_NOT_YET_IMPLEMENTED ); \
+\
+	ukr_t cxk_ker_id = bli_is_col_packed( schema ) ? BLIS_PACKM_NRXK_KER \
+	                                               : BLIS_PACKM_MRXK_KER; \
+\
+	PASTECH2(ch,packm_cxk,_ker_ft) f_cxk = bli_cntx_get_ukr_dt( dt, cxk_ker_id, cntx ); \
+\
+	const dim_t k       = params_r2k->k; \
+	const dim_t off_end = panel_len_off + panel_len; \
+\
+	for ( dim_t j = 0; j < 2; ++j ) \
+	{ \
+		/* Find the intersection of the micropanel with Aj, which spans
+		   columns [ j*k, (j+1)*k ) of the container. */ \
+		const dim_t off_j = bli_max( panel_len_off, j*k ); \
+		const dim_t len_j = bli_min( off_end, ( j + 1 )*k ) - off_j; \
+\
+		if ( len_j <= 0 ) continue; \
+\
+		/* The zero padding of the micropanel along the k dimension (if
+		   any) is written along with the last part of the micropanel. */ \
+		const dim_t p_off     = off_j - panel_len_off; \
+		const dim_t len_max_j = off_j + len_j == off_end ? panel_len_max - p_off \
+		                                                 : len_j; \
+\
+		const inc_t  rs  = params_r2k->rs[ j ]; \
+		const inc_t  cs  = params_r2k->cs[ j ]; \
+		const ctype* a_j = ( const ctype* )params_r2k->buf[ j ] + \
+		                   panel_dim_off * rs + ( off_j - j*k ) * cs; \
+\
+		ctype kappa_j; \
+		PASTEMAC(ch,scal2s)( *kappa, *( const ctype* )params_r2k->scal[ j ], kappa_j ); \
+\
+		f_cxk \
+		( \
+		  params_r2k->conj[ j ], \
+		  schema, \
+		  panel_dim, \
+		  len_j, \
+		  len_max_j, \
+		  &kappa_j, \
+		  ( ctype* )a_j, rs, cs, \
+		  p + p_off*ldp, ldp, \
+		  cntx  \
+		); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( packm_struc_cxk_r2k )
+
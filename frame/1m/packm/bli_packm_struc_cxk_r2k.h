@@ -0,0 +1,112 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+//
+// Concatenated (rank-2k) matrix operands.
+//
+// A rank-2k operand is a container object representing the m x 2k matrix
+//
+//   [ scal0 * conj?(A0)  scal1 * conj?(A1) ]
+//
+// where A0 and A1 are m x k matrices. The container has no buffer of its
+// own; instead, each micropanel is packed directly from A0 and/or A1 via
+// bli_packm_blk_var1(). This allows her2k and syr2k to be computed as a
+// single gemmt over a k dimension of length 2k, without first forming the
+// concatenated matrices. Only native (non-induced) execution is supported.
+//
+
+typedef struct
+{
+	// NOTE: This must be the first field so that a pointer to this struct
+	// may be interpreted as a packm_blk_var1_params_t.
+	packm_blk_var1_params_t var1;
+
+	// The k dimension of each of A0 and A1.
+	dim_t       k;
+
+	// Element (i,l) of Aj is stored at buf[j][ i*rs[j] + l*cs[j] ], and is
+	// conjugated if conj[j] is BLIS_CONJUGATE and scaled by *scal[j].
+	const void* buf[2];
+	inc_t       rs[2];
+	inc_t       cs[2];
+	conj_t      conj[2];
+	const void* scal[2];
+} packm_r2k_params_t;
+
+// Initialize params and create the m x 2k container object p representing
+// [ scal0 * conj?(a0)  scal1 * conj?(a1) ], where the conjugation of each
+// matrix is the conjugation given by conj applied on top of that of the
+// matrix itself. The scalars must have the same datatype as a0 and a1, and
+// must, along with params, remain valid for as long as p is in use.
+BLIS_EXPORT_BLIS void bli_obj_create_r2k_operand
+     (
+       const obj_t*              a0,
+       const obj_t*              a1,
+             conj_t              conj,
+       const obj_t*              scal0,
+       const obj_t*              scal1,
+             packm_r2k_params_t* params,
+             obj_t*              p
+     );
+
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       struc_t strucc, \
+       diag_t  diagc, \
+       uplo_t  uploc, \
+       conj_t  conjc, \
+       pack_t  schema, \
+       bool    invdiag, \
+       dim_t   panel_dim, \
+       dim_t   panel_len, \
+       dim_t   panel_dim_max, \
+       dim_t   panel_len_max, \
+       dim_t   panel_dim_off, \
+       dim_t   panel_len_off, \
+       ctype*  kappa, \
+       ctype*  c, inc_t incc, inc_t ldc, \
+       ctype*  p,             inc_t ldp, \
+                  inc_t is_p, \
+       cntx_t* cntx, \
+       void*   params  \
+     );
+
+INSERT_GENTPROT_BASIC0( packm_struc_cxk_r2k )
+
@@ -66,6 +66,7 @@
 
 // Prototype object API to small/unpacked matrix dispatcher.
 #include "bli_l3_sup.h"
+#include "bli_l3_sup_thresh.h"
 
 // Prototype reference implementation of small/unpacked matrix handler.
 #include "bli_l3_sup_ref.h"
@@ -90,3 +91,6 @@
 #include "bli_trmm3.h"
 #include "bli_trsm.h"
 #include "bli_gemmt.h"
+
+// int8 (u8 x s8 -> s32) gemm.
+#include "bli_i8gemm.h"
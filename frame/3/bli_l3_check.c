@@ -221,6 +221,62 @@ void bli_syrk_check
 	bli_check_error_code( e_val );
 }
 
+void bli_herkd_check
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  d,
+       const obj_t*  beta,
+       const obj_t*  c,
+       const cntx_t* cntx
+     )
+{
+	err_t e_val;
+
+	// Perform the checks of herk.
+
+	bli_herk_check( alpha, a, beta, c, cntx );
+
+	// Check the diagonal vector.
+
+	e_val = bli_check_vector_object( d );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_vector_dim_equals( d, bli_obj_width_after_trans( a ) );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_consistent_object_datatypes( c, d );
+	bli_check_error_code( e_val );
+}
+
+void bli_syrkd_check
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  d,
+       const obj_t*  beta,
+       const obj_t*  c,
+       const cntx_t* cntx
+     )
+{
+	err_t e_val;
+
+	// Perform the checks of syrk.
+
+	bli_syrk_check( alpha, a, beta, c, cntx );
+
+	// Check the diagonal vector.
+
+	e_val = bli_check_vector_object( d );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_vector_dim_equals( d, bli_obj_width_after_trans( a ) );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_consistent_object_datatypes( c, d );
+	bli_check_error_code( e_val );
+}
+
 void bli_syr2k_check
      (
        const obj_t*  alpha,
@@ -327,6 +383,14 @@ void bli_gemm_basic_check
 {
 	err_t e_val;
 
+	// bfloat16 and float16 operands are checked separately since they are
+	// only supported as the storage datatype of A and/or B.
+	if ( bli_obj_is_half( a ) || bli_obj_is_half( b ) )
+	{
+		bli_gemm_half_basic_check( alpha, a, b, beta, c, cntx );
+		return;
+	}
+
 	// Perform standard checks.
 
 	bli_l3_basic_check( alpha, a, b, beta, c, cntx );
@@ -365,6 +429,74 @@ void bli_gemm_basic_check
 #endif
 }
 
+void bli_gemm_half_basic_check
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c,
+       const cntx_t* cntx
+     )
+{
+	err_t e_val;
+
+	// Check object datatypes. A and B may each be stored as bfloat16,
+	// float16, or float, in which case C must be float.
+
+	e_val = bli_check_noninteger_object( alpha );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_noninteger_object( beta );
+	bli_check_error_code( e_val );
+
+	if ( !bli_obj_is_float( c ) ||
+	     !( bli_obj_is_half( a ) || bli_obj_is_float( a ) ) ||
+	     !( bli_obj_is_half( b ) || bli_obj_is_float( b ) ) )
+		bli_check_error_code( BLIS_INCONSISTENT_DATATYPES );
+
+	if ( !bli_obj_imag_is_zero( alpha ) ||
+	     !bli_obj_imag_is_zero( beta ) )
+		bli_check_error_code( BLIS_EXPECTED_REAL_VALUED_OBJECT );
+
+	// Check object dimensions.
+
+	e_val = bli_check_scalar_object( alpha );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_scalar_object( beta );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_matrix_object( a );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_matrix_object( b );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_matrix_object( c );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_level3_dims( a, b, c );
+	bli_check_error_code( e_val );
+
+	// Check object buffers (for non-NULLness).
+
+	e_val = bli_check_object_buffer( alpha );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( a );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( b );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( beta );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( c );
+	bli_check_error_code( e_val );
+}
+
 void bli_gemmt_basic_check
      (
        const obj_t*  alpha,
@@ -91,6 +91,23 @@ GENPROT( herk )
 GENPROT( syrk )
 
 
+#undef  GENPROT
+#define GENPROT( opname ) \
+\
+void PASTEMAC(opname,_check) \
+     ( \
+       const obj_t*  alpha, \
+       const obj_t*  a, \
+       const obj_t*  d, \
+       const obj_t*  beta, \
+       const obj_t*  c, \
+       const cntx_t* cntx  \
+    );
+
+GENPROT( herkd )
+GENPROT( syrkd )
+
+
 #undef  GENPROT
 #define GENPROT( opname ) \
 \
@@ -119,6 +136,16 @@ void bli_gemm_basic_check
        const cntx_t* cntx
      );
 
+void bli_gemm_half_basic_check
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c,
+       const cntx_t* cntx
+     );
+
 void bli_gemmt_basic_check
      (
        const obj_t*  alpha,
@@ -41,6 +41,8 @@ static bool bli_l3_ind_oper_impl[BLIS_NUM_IND_METHODS][BLIS_NUM_LEVEL3_OPS] =
 {
         /*   gemm  gemmt  hemm  herk  her2k  symm  syrk  syr2k  trmm3  trmm  trsm  */
 /* 1m   */ { TRUE, TRUE,  TRUE, TRUE, TRUE,  TRUE, TRUE, TRUE,  TRUE,  TRUE, TRUE  },
+/* 3m   */ { TRUE, FALSE, FALSE,FALSE,FALSE, FALSE,FALSE,FALSE, FALSE, FALSE,FALSE },
+/* 4m   */ { TRUE, FALSE, FALSE,FALSE,FALSE, FALSE,FALSE,FALSE, FALSE, FALSE,FALSE },
 /* nat  */ { TRUE, TRUE,  TRUE, TRUE, TRUE,  TRUE, TRUE, TRUE,  TRUE,  TRUE, TRUE  }
 };
 
@@ -60,10 +62,24 @@ bool bli_l3_ind_oper_st[BLIS_NUM_IND_METHODS][BLIS_NUM_LEVEL3_OPS][2] =
         /*    c     z    */
 /* 1m   */ { {FALSE,FALSE}, {FALSE,FALSE}, {FALSE,FALSE}, {FALSE,FALSE}, {FALSE,FALSE}, {FALSE,FALSE},
              {FALSE,FALSE}, {FALSE,FALSE}, {FALSE,FALSE}, {FALSE,FALSE}, {FALSE,FALSE}  },
+/* 3m   */ { {FALSE,FALSE}, {FALSE,FALSE}, {FALSE,FALSE}, {FALSE,FALSE}, {FALSE,FALSE}, {FALSE,FALSE},
+             {FALSE,FALSE}, {FALSE,FALSE}, {FALSE,FALSE}, {FALSE,FALSE}, {FALSE,FALSE}  },
+/* 4m   */ { {FALSE,FALSE}, {FALSE,FALSE}, {FALSE,FALSE}, {FALSE,FALSE}, {FALSE,FALSE}, {FALSE,FALSE},
+             {FALSE,FALSE}, {FALSE,FALSE}, {FALSE,FALSE}, {FALSE,FALSE}, {FALSE,FALSE}  },
 /* nat  */ { {TRUE,TRUE},   {TRUE,TRUE},   {TRUE,TRUE},   {TRUE,TRUE},   {TRUE,TRUE},   {TRUE,TRUE},
              {TRUE,TRUE},   {TRUE,TRUE},   {TRUE,TRUE},   {TRUE,TRUE},   {TRUE,TRUE}    },
 };
 
+// The order in which the induced methods are searched for the first one that
+// is available. This differs from the order of the ind_t values, which must
+// stay fixed for binary compatibility: 3m and 4m are only ever enabled on
+// request, and so they take precedence over 1m, which bli_ind_init() may
+// have enabled by default.
+static const ind_t bli_l3_ind_search_order[BLIS_NUM_IND_METHODS] =
+{
+	BLIS_3M, BLIS_4M, BLIS_1M, BLIS_NAT
+};
+
 // -----------------------------------------------------------------------------
 
 #undef  GENFUNC
@@ -110,7 +126,7 @@ ind_t bli_l3_ind_oper_find_avail( opid_t oper, num_t dt )
 {
 	bli_init_once();
 
-	ind_t im;
+	dim_t i;
 
 	// If the datatype is real, return native execution.
 	if ( !bli_is_complex( dt ) ) return BLIS_NAT;
@@ -118,13 +134,14 @@ ind_t bli_l3_ind_oper_find_avail( opid_t oper, num_t dt )
 	// If the operation is not level-3, return native execution.
 	if ( !bli_opid_is_level3( oper ) ) return BLIS_NAT;
 
-	// Iterate over all induced methods and search for the first one
-	// that is available (ie: both implemented and enabled) for the
-	// current operation and datatype.
-	for ( im = 0; im < BLIS_NUM_IND_METHODS; ++im )
+	// Iterate over all induced methods, in order of precedence, and search
+	// for the first one that is available (ie: both implemented and enabled)
+	// for the current operation and datatype.
+	for ( i = 0; i < BLIS_NUM_IND_METHODS; ++i )
 	{
-		bool enabled = bli_l3_ind_oper_is_impl( oper, im );
-		bool stat    = bli_l3_ind_oper_get_enable( oper, im, dt );
+		ind_t im      = bli_l3_ind_search_order[ i ];
+		bool  enabled = bli_l3_ind_oper_is_impl( oper, im );
+		bool  stat    = bli_l3_ind_oper_get_enable( oper, im, dt );
 
 		if ( enabled == TRUE &&
 		     stat    == TRUE ) return im;
@@ -36,7 +36,7 @@
 // Define template prototypes for level-3 micro-kernels.
 //
 
-// 1m micro-kernels
+// 1m, 3m, and 4m micro-kernels
 
 #undef  GENTPROT
 #define GENTPROT( ctype, ch, opname ) \
@@ -56,6 +56,8 @@ void PASTEMAC(ch,opname) \
      );
 
 INSERT_GENTPROT_BASIC0( gemm1m_ukr_name )
+INSERT_GENTPROT_BASIC0( gemm3m_ukr_name )
+INSERT_GENTPROT_BASIC0( gemm4m_ukr_name )
 
 
 #undef  GENTPROT
@@ -136,6 +136,8 @@ void bli_l3_int
 	// Extract the function pointer from the current control tree node.
 	l3_var_oft f = bli_cntl_var_func( cntl );
 
+	BLIS_STATS_START( t0 );
+
 	// Invoke the variant.
 	f
 	(
@@ -147,5 +149,11 @@ void bli_l3_int
 	  cntl,
 	  thread
 	);
+
+	// The macrokernels are the variants whose sub-node is the (variant-less)
+	// leaf of the control tree.
+	if ( bli_cntl_sub_node( cntl ) != NULL &&
+	     bli_cntl_is_leaf( bli_cntl_sub_node( cntl ) ) )
+		BLIS_STATS_STOP( BLIS_STATS_MACROKER, t0 );
 }
 
@@ -104,6 +104,27 @@ GENFRONT( herk )
 GENFRONT( syrk )
 
 
+#undef  GENFRONT
+#define GENFRONT( opname ) \
+\
+void PASTEMAC0(opname) \
+     ( \
+       const obj_t* alpha, \
+       const obj_t* a, \
+       const obj_t* d, \
+       const obj_t* beta, \
+       const obj_t* c  \
+     ) \
+{ \
+	/* Invoke the expert interface and request default cntx_t and rntm_t
+	   objects. */ \
+	PASTEMAC(opname,_ex)( alpha, a, d, beta, c, NULL, NULL ); \
+}
+
+GENFRONT( herkd )
+GENFRONT( syrkd )
+
+
 #undef  GENFRONT
 #define GENFRONT( opname ) \
 \
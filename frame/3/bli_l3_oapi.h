@@ -89,6 +89,22 @@ GENPROT( herk )
 GENPROT( syrk )
 
 
+#undef  GENPROT
+#define GENPROT( opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC0(opname) \
+     ( \
+       const obj_t* alpha, \
+       const obj_t* a, \
+       const obj_t* d, \
+       const obj_t* beta, \
+       const obj_t* c  \
+     );
+
+GENPROT( herkd )
+GENPROT( syrkd )
+
+
 #undef  GENPROT
 #define GENPROT( opname ) \
 \
@@ -67,9 +67,12 @@ void PASTEMAC(gemm,BLIS_OAPI_EX_SUF)
 		// other reason decides not to use the small/unpacked implementation,
 		// the function returns with BLIS_FAILURE, which causes execution to
 		// proceed towards the conventional implementation.
+		BLIS_STATS_START( t_sup );
+
 		err_t result = bli_gemmsup( alpha, a, b, beta, c, cntx, rntm );
 		if ( result == BLIS_SUCCESS )
 		{
+			BLIS_STATS_STOP( BLIS_STATS_GEMMSUP, t_sup );
 			return;
 		}
 	}
@@ -98,6 +101,18 @@ void PASTEMAC(gemm,BLIS_OAPI_EX_SUF)
 		// available but not enabled, or simply unavailable, BLIS_NAT will
 		// be returned here.)
 		im = bli_gemmind_find_avail( dt );
+
+		// The 3m and 4m methods are only implemented for operands whose
+		// storage datatypes (and computation precision) are all equal. If
+		// they are not, fall back to 1m (if enabled) or native execution.
+		if ( ( im == BLIS_3M || im == BLIS_4M ) &&
+		     ( bli_obj_dt( a ) != dt ||
+		       bli_obj_dt( b ) != dt ||
+		       bli_obj_comp_prec( c ) != bli_obj_prec( c ) ) )
+		{
+			im = bli_l3_ind_oper_get_enable( BLIS_GEMM, BLIS_1M, dt )
+			     ? BLIS_1M : BLIS_NAT;
+		}
 	}
 
 	// If necessary, obtain a valid context from the gks using the induced
@@ -108,8 +123,12 @@ void PASTEMAC(gemm,BLIS_OAPI_EX_SUF)
 	if ( bli_error_checking_is_enabled() )
 		bli_gemm_check( alpha, a, b, beta, c, cntx );
 
+	BLIS_STATS_START( t_gemm );
+
 	// Invoke the operation's front-end and request the default control tree.
 	bli_gemm_front( alpha, a, b, beta, c, cntx, rntm, NULL );
+
+	BLIS_STATS_STOP( BLIS_STATS_GEMM, t_gemm );
 }
 
 #endif
@@ -164,6 +183,54 @@ void PASTEMAC(gemmt,BLIS_OAPI_EX_SUF)
 }
 
 
+// Determine whether a rank-2k update may be computed as a single gemmt over
+// concatenated operands (see bli_packm_struc_cxk_r2k.h). This requires that
+// the operation be computed natively in the storage datatype of C, and that
+// neither A nor B already requests custom packing. If alpha is zero, we let
+// gemmt scale C by beta in the usual way. Since the rank-2k packm kernel
+// only supports native execution, and since the sup code path rejects
+// operands with custom packing, we also decline to fuse whenever gemmt
+// would otherwise use an induced method or the sup code path. bh is B (after
+// the transposition of the rank-2k update) and is used only to determine
+// the storage combination by which the sup thresholds are looked up.
+static bool bli_l3_r2k_can_fuse
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  bh,
+       const obj_t*  c,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	const num_t dt = bli_obj_dt( c );
+
+	if ( bli_obj_dt( a ) != dt ||
+	     bli_obj_dt( bh ) != dt ||
+	     bli_obj_comp_prec( c ) != bli_obj_prec( c ) ||
+	     bli_obj_pack_params( a ) != NULL ||
+	     bli_obj_pack_params( bh ) != NULL ||
+	     bli_obj_has_zero_dim( a ) ||
+	     bli_obj_equals( alpha, &BLIS_ZERO ) ) return FALSE;
+
+	if ( cntx == NULL )
+	{
+		if ( bli_gemmtind_find_avail( dt ) != BLIS_NAT ) return FALSE;
+
+		cntx = bli_gks_query_cntx();
+	}
+	else if ( bli_cntx_method( cntx ) != BLIS_NAT ) return FALSE;
+
+	#ifndef BLIS_DISABLE_SUP_HANDLING
+	if ( ( rntm == NULL || bli_rntm_l3_sup( rntm ) ) &&
+	     bli_l3_sup_thresh_is_met_obj( BLIS_GEMMT, a, bh, c, cntx, rntm ) )
+		return FALSE;
+	#endif
+
+	return TRUE;
+}
+
+
 void PASTEMAC(her2k,BLIS_OAPI_EX_SUF)
      (
        const obj_t*  alpha,
@@ -185,20 +252,49 @@ void PASTEMAC(her2k,BLIS_OAPI_EX_SUF)
 	if ( bli_error_checking_is_enabled() )
 		bli_her2k_check( alpha, a, b, beta, c, cntx );
 
-	bli_obj_alias_to( alpha, &alphah );
-	bli_obj_toggle_conj( &alphah );
-
-	bli_obj_alias_to( a, &ah );
-	bli_obj_toggle_trans( &ah );
-	bli_obj_toggle_conj( &ah );
-
 	bli_obj_alias_to( b, &bh );
 	bli_obj_toggle_trans( &bh );
 	bli_obj_toggle_conj( &bh );
 
-	// Invoke gemmt twice, using beta only the first time.
-	PASTEMAC(gemmt,BLIS_OAPI_EX_SUF)(   alpha, a, &bh,      beta, c, cntx, rntm );
-	PASTEMAC(gemmt,BLIS_OAPI_EX_SUF)( &alphah, b, &ah, &BLIS_ONE, c, cntx, rntm );
+	if ( bli_l3_r2k_can_fuse( alpha, a, &bh, c, cntx, rntm ) )
+	{
+		// Compute C := beta * C + [ alpha*A alpha'*B ] * [ B A ]' as a single
+		// gemmt over a k dimension of length 2k, so that C is only updated
+		// once. See bli_packm_struc_cxk_r2k.h.
+		const num_t dt = bli_obj_dt( c );
+
+		obj_t alpha_l, alphah_l;
+		obj_t ab, bah;
+		packm_r2k_params_t params_ab, params_bah;
+
+		bli_obj_scalar_init_detached_copy_of( dt, BLIS_NO_CONJUGATE, alpha, &alpha_l );
+		bli_obj_scalar_init_detached_copy_of( dt, BLIS_CONJUGATE,    alpha, &alphah_l );
+
+		bli_obj_create_r2k_operand( a, b, BLIS_NO_CONJUGATE, &alpha_l, &alphah_l,
+		                            &params_ab, &ab );
+		bli_obj_create_r2k_operand( b, a, BLIS_CONJUGATE, &BLIS_ONE, &BLIS_ONE,
+		                            &params_bah, &bah );
+		bli_obj_toggle_trans( &bah );
+
+		// The rank-2k packm kernel only supports native execution (see
+		// above).
+		if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+		PASTEMAC(gemmt,BLIS_OAPI_EX_SUF)( &BLIS_ONE, &ab, &bah, beta, c, cntx, rntm );
+	}
+	else
+	{
+		bli_obj_alias_to( alpha, &alphah );
+		bli_obj_toggle_conj( &alphah );
+
+		bli_obj_alias_to( a, &ah );
+		bli_obj_toggle_trans( &ah );
+		bli_obj_toggle_conj( &ah );
+
+		// Invoke gemmt twice, using beta only the first time.
+		PASTEMAC(gemmt,BLIS_OAPI_EX_SUF)(   alpha, a, &bh,      beta, c, cntx, rntm );
+		PASTEMAC(gemmt,BLIS_OAPI_EX_SUF)( &alphah, b, &ah, &BLIS_ONE, c, cntx, rntm );
+	}
 
 	// The Hermitian rank-2k product was computed as alpha*A*B'+alpha'*B*A', even for
 	// the diagonal elements. Mathematically, the imaginary components of
@@ -233,12 +329,40 @@ void PASTEMAC(syr2k,BLIS_OAPI_EX_SUF)
 	bli_obj_alias_to( b, &bt );
 	bli_obj_toggle_trans( &bt );
 
-	bli_obj_alias_to( a, &at );
-	bli_obj_toggle_trans( &at );
+	if ( bli_l3_r2k_can_fuse( alpha, a, &bt, c, cntx, rntm ) )
+	{
+		// Compute C := beta * C + [ alpha*A alpha*B ] * [ B A ]^T as a single
+		// gemmt over a k dimension of length 2k, so that C is only updated
+		// once. See bli_packm_struc_cxk_r2k.h.
+		const num_t dt = bli_obj_dt( c );
+
+		obj_t alpha_l;
+		obj_t ab, bat;
+		packm_r2k_params_t params_ab, params_bat;
 
-	// Invoke gemmt twice, using beta only the first time.
-	PASTEMAC(gemmt,BLIS_OAPI_EX_SUF)( alpha, a, &bt,      beta, c, cntx, rntm );
-	PASTEMAC(gemmt,BLIS_OAPI_EX_SUF)( alpha, b, &at, &BLIS_ONE, c, cntx, rntm );
+		bli_obj_scalar_init_detached_copy_of( dt, BLIS_NO_CONJUGATE, alpha, &alpha_l );
+
+		bli_obj_create_r2k_operand( a, b, BLIS_NO_CONJUGATE, &alpha_l, &alpha_l,
+		                            &params_ab, &ab );
+		bli_obj_create_r2k_operand( b, a, BLIS_NO_CONJUGATE, &BLIS_ONE, &BLIS_ONE,
+		                            &params_bat, &bat );
+		bli_obj_toggle_trans( &bat );
+
+		// The rank-2k packm kernel only supports native execution (see
+		// above).
+		if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+		PASTEMAC(gemmt,BLIS_OAPI_EX_SUF)( &BLIS_ONE, &ab, &bat, beta, c, cntx, rntm );
+	}
+	else
+	{
+		bli_obj_alias_to( a, &at );
+		bli_obj_toggle_trans( &at );
+
+		// Invoke gemmt twice, using beta only the first time.
+		PASTEMAC(gemmt,BLIS_OAPI_EX_SUF)( alpha, a, &bt,      beta, c, cntx, rntm );
+		PASTEMAC(gemmt,BLIS_OAPI_EX_SUF)( alpha, b, &at, &BLIS_ONE, c, cntx, rntm );
+	}
 }
 
 
@@ -451,6 +575,132 @@ void PASTEMAC(syrk,BLIS_OAPI_EX_SUF)
 }
 
 
+// Compute C := beta * C + alpha * A * D * B via the conventional gemmt code
+// path, where D is the diagonal matrix given by the vector d (or, if real_d
+// is TRUE, by the real parts of its elements). When gemmt would be computed
+// natively, the rows of B are scaled by D as B is packed. Otherwise, since
+// the diagonal-scaling packm kernel only supports native execution, W := D*B
+// is formed explicitly so that gemmt may use the induced method (e.g. 1m)
+// that it would use for A*W.
+static void bli_l3_gemmtd
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  d,
+             bool    real_d,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c,
+       const cntx_t* cntx,
+             rntm_t* rntm
+     )
+{
+	const num_t dt = bli_obj_dt( c );
+	const ind_t im = cntx != NULL ? bli_cntx_method( cntx )
+	                              : bli_obj_is_complex( c ) ? bli_gemmtind_find_avail( dt )
+	                                                        : BLIS_NAT;
+
+	if ( im == BLIS_NAT )
+	{
+		obj_t               bd;
+		packm_diag_params_t params;
+
+		bli_obj_alias_to( b, &bd );
+		bli_obj_attach_diag_params( d, real_d, &params, &bd );
+
+		if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+		PASTEMAC(gemmt,BLIS_OAPI_EX_SUF)( alpha, a, &bd, beta, c, cntx, rntm );
+	}
+	else
+	{
+		obj_t w;
+
+		bli_obj_create_diag_scaled_copy( d, real_d, b, &w );
+
+		PASTEMAC(gemmt,BLIS_OAPI_EX_SUF)( alpha, a, &w, beta, c, cntx, rntm );
+
+		bli_obj_free( &w );
+	}
+}
+
+
+void PASTEMAC(herkd,BLIS_OAPI_EX_SUF)
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  d,
+       const obj_t*  beta,
+       const obj_t*  c,
+       const cntx_t* cntx,
+             rntm_t* rntm
+     )
+{
+	bli_init_once();
+
+	obj_t ah;
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bli_herkd_check( alpha, a, d, beta, c, cntx );
+
+	bli_obj_alias_to( a, &ah );
+	bli_obj_toggle_trans( &ah );
+	bli_obj_toggle_conj( &ah );
+
+	// If the rntm is non-NULL, it may indicate that we should forgo sup
+	// handling altogether.
+	bool enable_sup = TRUE;
+	if ( rntm != NULL ) enable_sup = bli_rntm_l3_sup( rntm );
+
+	if ( !enable_sup ||
+	     bli_gemmtdsup( alpha, a, d, TRUE, &ah, beta, c, cntx, rntm ) != BLIS_SUCCESS )
+	{
+		// Only the real parts of the diagonal elements are referenced, which
+		// ensures that the product A*D*A' is Hermitian.
+		bli_l3_gemmtd( alpha, a, d, TRUE, &ah, beta, c, cntx, rntm );
+	}
+
+	// See bli_herk_ex().
+	bli_setid( &BLIS_ZERO, c );
+}
+
+
+void PASTEMAC(syrkd,BLIS_OAPI_EX_SUF)
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  d,
+       const obj_t*  beta,
+       const obj_t*  c,
+       const cntx_t* cntx,
+             rntm_t* rntm
+     )
+{
+	bli_init_once();
+
+	obj_t at;
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bli_syrkd_check( alpha, a, d, beta, c, cntx );
+
+	bli_obj_alias_to( a, &at );
+	bli_obj_toggle_trans( &at );
+
+	// If the rntm is non-NULL, it may indicate that we should forgo sup
+	// handling altogether.
+	bool enable_sup = TRUE;
+	if ( rntm != NULL ) enable_sup = bli_rntm_l3_sup( rntm );
+
+	if ( enable_sup &&
+	     bli_gemmtdsup( alpha, a, d, FALSE, &at, beta, c, cntx, rntm ) == BLIS_SUCCESS )
+		return;
+
+	bli_l3_gemmtd( alpha, a, d, FALSE, &at, beta, c, cntx, rntm );
+}
+
+
 void PASTEMAC(trmm,BLIS_OAPI_EX_SUF)
      (
              side_t  side,
@@ -95,6 +95,24 @@ GENPROT( herk )
 GENPROT( syrk )
 
 
+#undef  GENPROT
+#define GENPROT( opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(opname,BLIS_OAPI_EX_SUF) \
+     ( \
+       const obj_t*  alpha, \
+       const obj_t*  a, \
+       const obj_t*  d, \
+       const obj_t*  beta, \
+       const obj_t*  c, \
+       const cntx_t* cntx, \
+             rntm_t* rntm  \
+     );
+
+GENPROT( herkd )
+GENPROT( syrkd )
+
+
 #undef  GENPROT
 #define GENPROT( opname ) \
 \
@@ -54,6 +54,8 @@ void bli_l3_packa
 		bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, &a_local );
 	}
 
+	BLIS_STATS_START( t0 );
+
 	// Pack matrix A according to the control tree node.
 	bli_packm_int
 	(
@@ -65,6 +67,8 @@ void bli_l3_packa
 	  thread
 	);
 
+	BLIS_STATS_STOP( BLIS_STATS_PACKA, t0 );
+
 	// Proceed with execution using packed matrix A.
 	bli_l3_int
 	(
@@ -106,6 +110,8 @@ void bli_l3_packb
 		bli_obj_induce_trans( &bt_local );
 	}
 
+	BLIS_STATS_START( t0 );
+
 	// Pack matrix B according to the control tree node.
 	bli_packm_int
 	(
@@ -117,6 +123,8 @@ void bli_l3_packb
 	  thread
 	);
 
+	BLIS_STATS_STOP( BLIS_STATS_PACKB, t0 );
+
 	// Transpose packed object back to B.
 	bli_obj_induce_trans( &bt_pack );
 
@@ -34,6 +34,89 @@
 
 #include "blis.h"
 
+// Return the number of threads requested by a runtime.
+static dim_t bli_l3_sup_num_threads( const rntm_t* rntm )
+{
+	dim_t nt = bli_rntm_num_threads( rntm );
+
+	if ( nt < 1 ) nt = bli_rntm_calc_num_threads( rntm );
+
+	return bli_max( nt, 1 );
+}
+
+// Return whether the sup thresholds are met, reusing the decision made by a
+// previous call for the same operation, datatype, storage combination,
+// problem shape, number of threads, and context, if any.
+static bool bli_l3_sup_thresh_is_met
+     (
+             opid_t  op,
+             num_t   dt,
+             stor3_t stor_id,
+             dim_t   nt,
+             dim_t   m,
+             dim_t   n,
+             dim_t   k,
+       const cntx_t* cntx
+     )
+{
+	dkey_t key;
+	dim_t  vals[ BLIS_DCACHE_NUM_VALS ];
+
+	bli_dkey_init( BLIS_DEC_SUP, op, dt, stor_id, 0, m, n, k, nt, cntx, &key );
+
+	if ( bli_dcache_lookup( &key, vals ) ) return ( bool )vals[ 0 ];
+
+	vals[ 0 ] = bli_cntx_l3_sup_thresh_is_met_st( dt, stor_id, nt, m, n, k, cntx );
+
+	bli_dcache_insert( &key, vals );
+
+	return ( bool )vals[ 0 ];
+}
+
+bool bli_l3_sup_thresh_is_met_obj
+     (
+             opid_t  op,
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  c,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	const num_t dt      = bli_obj_dt( c );
+	      dim_t m       = bli_obj_length( c );
+	      dim_t n       = bli_obj_width( c );
+	const dim_t k       = bli_obj_width_after_trans( a );
+	    stor3_t stor_id = bli_obj_stor3_from_strides( c, a, b );
+
+	// If the microkernel dislikes the storage of C, the entire operation
+	// would be transposed, so we look up the thresholds of the transposed
+	// storage combination and pass in m and n reversed.
+	if ( bli_cntx_dislikes_storage_of( c, BLIS_GEMM_VIR_UKR, cntx ) )
+	{
+		const dim_t t = m; m = n; n = t;
+
+		if ( stor_id != BLIS_XXX ) stor_id = bli_stor3_trans( stor_id );
+	}
+
+	// Only calibrated thresholds are indexed by the number of threads, so
+	// avoid querying it (possibly from the global runtime) otherwise.
+	dim_t nt = 0;
+
+	if ( bli_cntx_get_l3_sup_thresh_near( dt, stor_id, 1, cntx ) != NULL )
+	{
+		if ( rntm != NULL ) nt = bli_l3_sup_num_threads( rntm );
+		else
+		{
+			rntm_t rntm_l;
+			bli_rntm_init_from_global( &rntm_l );
+			nt = bli_l3_sup_num_threads( &rntm_l );
+		}
+	}
+
+	return bli_l3_sup_thresh_is_met( op, dt, stor_id, nt, m, n, k, cntx );
+}
+
 err_t bli_gemmsup
      (
        const obj_t*  alpha,
@@ -55,36 +138,21 @@ err_t bli_gemmsup
 	     bli_obj_dt( c ) != bli_obj_dt( b ) ||
 	     bli_obj_comp_prec( c ) != bli_obj_prec( c ) ) return BLIS_FAILURE;
 
+	// Return early if A or B requests custom packing (e.g. of a quantized
+	// operand), since the sup code path does not use bli_packm_blk_var1().
+	if ( bli_obj_pack_params( a ) != NULL ||
+	     bli_obj_pack_params( b ) != NULL ) return BLIS_FAILURE;
+
 	// Obtain a valid (native) context from the gks if necessary.
 	// NOTE: This must be done before calling the _check() function, since
 	// that function assumes the context pointer is valid.
 	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
 
-	// Return early if a microkernel preference-induced transposition would
-	// have been performed and shifted the dimensions outside of the space
-	// of sup-handled problems.
-	if ( bli_cntx_dislikes_storage_of( c, BLIS_GEMM_VIR_UKR, cntx ) )
-	{
-		const num_t dt = bli_obj_dt( c );
-		const dim_t m  = bli_obj_length( c );
-		const dim_t n  = bli_obj_width( c );
-		const dim_t k  = bli_obj_width_after_trans( a );
-
-		// Pass in m and n reversed, which simulates a transposition of the
-		// entire operation pursuant to the microkernel storage preference.
-		if ( !bli_cntx_l3_sup_thresh_is_met( dt, n, m, k, cntx ) )
-			return BLIS_FAILURE;
-	}
-	else // ukr_prefers_storage_of( c, ... )
-	{
-		const num_t dt = bli_obj_dt( c );
-		const dim_t m  = bli_obj_length( c );
-		const dim_t n  = bli_obj_width( c );
-		const dim_t k  = bli_obj_width_after_trans( a );
-
-		if ( !bli_cntx_l3_sup_thresh_is_met( dt, m, n, k, cntx ) )
-			return BLIS_FAILURE;
-	}
+	// Return early if the problem dimensions (after any microkernel
+	// preference-induced transposition) fall outside of the space of
+	// sup-handled problems.
+	if ( !bli_l3_sup_thresh_is_met_obj( BLIS_GEMM, a, b, c, cntx, rntm ) )
+		return BLIS_FAILURE;
 
 	// Initialize a local runtime with global settings if necessary. Note
 	// that in the case that a runtime is passed in, we make a local copy.
@@ -153,23 +221,19 @@ err_t bli_gemmtsup
 	     bli_obj_dt( c ) != bli_obj_dt( b ) ||
 	     bli_obj_comp_prec( c ) != bli_obj_prec( c ) ) return BLIS_FAILURE;
 
+	// Return early if A or B requests custom packing (e.g. of a quantized
+	// operand), since the sup code path does not use bli_packm_blk_var1().
+	if ( bli_obj_pack_params( a ) != NULL ||
+	     bli_obj_pack_params( b ) != NULL ) return BLIS_FAILURE;
+
 	// Obtain a valid (native) context from the gks if necessary.
 	// NOTE: This must be done before calling the _check() function, since
 	// that function assumes the context pointer is valid.
 	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
 
 	// Return early if the problem dimensions exceed their sup thresholds.
-	// Notice that we do not bother to check whether the microkernel
-	// prefers or dislikes the storage of C, since the same check is called
-	// for either way.
-	{
-		const num_t dt = bli_obj_dt( c );
-		const dim_t m  = bli_obj_length( c );
-		const dim_t k  = bli_obj_width_after_trans( a );
-
-		if ( !bli_cntx_l3_sup_thresh_is_met( dt, m, m, k, cntx ) )
-			return BLIS_FAILURE;
-	}
+	if ( !bli_l3_sup_thresh_is_met_obj( BLIS_GEMMT, a, b, c, cntx, rntm ) )
+		return BLIS_FAILURE;
 
 	// Initialize a local runtime with global settings if necessary. Note
 	// that in the case that a runtime is passed in, we make a local copy.
@@ -201,3 +265,113 @@ err_t bli_gemmtsup
 }
 
 
+err_t bli_gemmtdsup
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  d,
+             bool    real_d,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c,
+       const cntx_t* cntx,
+             rntm_t* rntm
+     )
+{
+	// This function computes C := beta * C + alpha * A * D * B, where D is
+	// the diagonal matrix whose diagonal is given by the vector d (or, if
+	// real_d is TRUE, by the real parts of its elements), and where only
+	// the stored triangle of C is updated.
+	//
+	// Since the sup code path does not pack via bli_packm_blk_var1(), the
+	// diagonal scaling cannot be applied during packing. Instead, if the
+	// problem is small enough, we form W := D * B explicitly. Furthermore,
+	// since the gemmtsup handler's variants are not yet implemented, we then
+	// walk the diagonal of C in blocks of the sup MC blocksize: the part of
+	// each block row that lies strictly within the stored triangle is
+	// updated directly via gemm (which will then take the sup path), while
+	// each diagonal block is computed into a temporary matrix, only the
+	// stored triangle of which is accumulated into C.
+
+	// Return early if small matrix handling is disabled at configure-time.
+	#ifdef BLIS_DISABLE_SUP_HANDLING
+	return BLIS_FAILURE;
+	#endif
+
+	// Return early if this is a mixed-datatype computation.
+	if ( bli_obj_dt( c ) != bli_obj_dt( a ) ||
+	     bli_obj_dt( c ) != bli_obj_dt( b ) ||
+	     bli_obj_dt( c ) != bli_obj_dt( d ) ||
+	     bli_obj_comp_prec( c ) != bli_obj_prec( c ) ) return BLIS_FAILURE;
+
+	// Obtain a valid (native) context from the gks for the sup thresholds
+	// and blocksizes if necessary. The context passed in (if any) is passed
+	// on to bli_gemm_ex() below, which may then choose an induced method if
+	// it does not use the sup code path.
+	const cntx_t* cntx_sup = cntx != NULL ? cntx : bli_gks_query_cntx();
+
+	// Return early if the problem dimensions exceed their sup thresholds.
+	if ( !bli_l3_sup_thresh_is_met_obj( BLIS_GEMMT, a, b, c, cntx_sup, rntm ) )
+		return BLIS_FAILURE;
+
+	const num_t dt = bli_obj_dt( c );
+	const dim_t m  = bli_obj_length( c );
+
+	// If C has a zero dimension, return early.
+	if ( m == 0 ) return BLIS_SUCCESS;
+
+	// Form W := D * B, where B is k x m.
+	obj_t w;
+	bli_obj_create_diag_scaled_copy( d, real_d, b, &w );
+
+	const dim_t mc     = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_MC, cntx_sup );
+	const dim_t b_max  = bli_min( mc, m );
+	const bool  is_low = bli_obj_is_lower( c );
+
+	// Create the temporary matrix for the diagonal blocks, marking it with
+	// the same uplo as C so that bli_xpbym() only references its stored
+	// triangle.
+	obj_t t;
+	bli_obj_create( dt, b_max, b_max, 0, 0, &t );
+	bli_obj_set_uplo( is_low ? BLIS_LOWER : BLIS_UPPER, &t );
+
+	for ( dim_t i = 0; i < m; i += b_max )
+	{
+		const dim_t b_alg = bli_min( b_max, m - i );
+		const dim_t off_r = is_low ? 0     : i + b_alg;
+		const dim_t n_r   = is_low ? i     : m - i - b_alg;
+
+		obj_t a1, w1, w_r, c11, c_r, t11;
+
+		bli_acquire_mpart_t2b( BLIS_SUBPART1, i, b_alg, a, &a1 );
+		bli_acquire_mpart_l2r( BLIS_SUBPART1, i, b_alg, &w, &w1 );
+		bli_acquire_mpart( i, i, b_alg, b_alg, c, &c11 );
+		bli_acquire_mpart( 0, 0, b_alg, b_alg, &t, &t11 );
+
+		// Update the part of the current block row that lies strictly
+		// within the stored triangle.
+		if ( n_r > 0 )
+		{
+			bli_acquire_mpart_l2r( BLIS_SUBPART1, off_r, n_r, &w, &w_r );
+			bli_acquire_mpart( i, off_r, b_alg, n_r, c, &c_r );
+			bli_obj_set_struc( BLIS_GENERAL, &c_r );
+			bli_obj_set_uplo( BLIS_DENSE, &c_r );
+
+			bli_gemm_ex( alpha, &a1, &w_r, beta, &c_r, cntx, rntm );
+		}
+
+		// Compute the full diagonal block and accumulate its stored triangle.
+		bli_obj_set_struc( BLIS_GENERAL, &t11 );
+		bli_obj_set_uplo( BLIS_DENSE, &t11 );
+		bli_gemm_ex( alpha, &a1, &w1, &BLIS_ZERO, &t11, cntx, rntm );
+
+		bli_obj_set_uplo( is_low ? BLIS_LOWER : BLIS_UPPER, &t11 );
+		bli_xpbym( &t11, beta, &c11 );
+	}
+
+	bli_obj_free( &t );
+	bli_obj_free( &w );
+
+	return BLIS_SUCCESS;
+}
+
@@ -32,6 +32,22 @@
 
 */
 
+// Return whether the sup thresholds of the context are met for an operation
+// op that updates C with the product of A and B, taking into account the
+// transposition that would be performed if the gemm microkernel dislikes the
+// storage of C. Calibrated thresholds are indexed by the storage combination
+// and the number of threads requested by rntm (or, if rntm is NULL, by the
+// global runtime).
+bool bli_l3_sup_thresh_is_met_obj
+     (
+             opid_t  op,
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  c,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     );
+
 err_t bli_gemmsup
      (
        const obj_t*  alpha,
@@ -54,3 +70,16 @@ err_t bli_gemmtsup
              rntm_t* rntm
      );
 
+err_t bli_gemmtdsup
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  d,
+             bool    real_d,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c,
+       const cntx_t* cntx,
+             rntm_t* rntm
+     );
+
@@ -34,6 +34,51 @@
 
 #include "blis.h"
 
+// Compute the automatic factorization of the jc and ic loops for a problem
+// of mu x nu micropanels, or reuse the one computed by a previous call for
+// the same problem (the factorization depends on nothing else).
+static void bli_gemmsup_int_partition
+     (
+       bool   use_bp,
+       dim_t  n_threads,
+       dim_t  mu,
+       dim_t  nu,
+       dim_t* jc_new,
+       dim_t* ic_new
+     )
+{
+	dkey_t key;
+	dim_t  vals[ BLIS_DCACHE_NUM_VALS ];
+
+	bli_dkey_init( BLIS_DEC_SUP_VAR, BLIS_GEMM, 0, 0, 0, mu, nu, use_bp,
+	               n_threads, NULL, &key );
+
+	if ( bli_dcache_lookup( &key, vals ) )
+	{
+		*jc_new = vals[ 0 ];
+		*ic_new = vals[ 1 ];
+		return;
+	}
+
+	if ( use_bp )
+	{
+		// In the block-panel algorithm, the m dimension is parallelized
+		// with ic_nt and the n dimension is parallelized with jc_nt.
+		bli_thread_partition_2x2( n_threads, mu, nu, ic_new, jc_new );
+	}
+	else // if ( !use_bp )
+	{
+		// In the panel-block algorithm, the m dimension is parallelized
+		// with jc_nt and the n dimension is parallelized with ic_nt.
+		bli_thread_partition_2x2( n_threads, mu, nu, jc_new, ic_new );
+	}
+
+	vals[ 0 ] = *jc_new;
+	vals[ 1 ] = *ic_new;
+
+	bli_dcache_insert( &key, vals );
+}
+
 err_t bli_gemmsup_int
      (
        const obj_t*  alpha,
@@ -121,18 +166,7 @@ err_t bli_gemmsup_int
 		// of micropanels.
 		if ( auto_factor )
 		{
-			if ( use_bp )
-			{
-				// In the block-panel algorithm, the m dimension is parallelized
-				// with ic_nt and the n dimension is parallelized with jc_nt.
-				bli_thread_partition_2x2( n_threads, mu, nu, &ic_new, &jc_new );
-			}
-			else // if ( !use_bp )
-			{
-				// In the panel-block algorithm, the m dimension is parallelized
-				// with jc_nt and the n dimension is parallelized with ic_nt.
-				bli_thread_partition_2x2( n_threads, mu, nu, &jc_new, &ic_new );
-			}
+			bli_gemmsup_int_partition( use_bp, n_threads, mu, nu, &jc_new, &ic_new );
 
 			// Update the ways of parallelism for the jc and ic loops, and then
 			// update the current thread's root thrinfo_t node according to the
@@ -186,18 +220,7 @@ err_t bli_gemmsup_int
 		// of micropanels.
 		if ( auto_factor )
 		{
-			if ( use_bp )
-			{
-				// In the block-panel algorithm, the m dimension is parallelized
-				// with ic_nt and the n dimension is parallelized with jc_nt.
-				bli_thread_partition_2x2( n_threads, mu, nu, &ic_new, &jc_new );
-			}
-			else // if ( !use_bp )
-			{
-				// In the panel-block algorithm, the m dimension is parallelized
-				// with jc_nt and the n dimension is parallelized with ic_nt.
-				bli_thread_partition_2x2( n_threads, mu, nu, &jc_new, &ic_new );
-			}
+			bli_gemmsup_int_partition( use_bp, n_threads, mu, nu, &jc_new, &ic_new );
 
 			// Update the ways of parallelism for the jc and ic loops, and then
 			// update the current thread's root thrinfo_t node according to the
@@ -377,6 +377,8 @@ void PASTEMAC(ch,opname) \
 	} \
 	else /* if ( will_pack == TRUE ) */ \
 	{ \
+		BLIS_TRACE_START( t0 ); \
+\
 		if ( schema == BLIS_PACKED_COLUMNS ) \
 		{ \
 			/*
@@ -420,6 +422,8 @@ void PASTEMAC(ch,opname) \
 			  thread  \
 			); \
 		} \
+\
+		BLIS_TRACE_STOP( "packm_sup_b", "pack", t0 ); \
 \
 		/* Barrier so that packing is done before computation. */ \
 		bli_thread_barrier( thread ); \
@@ -0,0 +1,288 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+static const char* stor3_strs[ BLIS_NUM_3OP_RC_COMBOS ] =
+{
+	"rrr", "rrc", "rcr", "rcc", "crr", "crc", "ccr", "ccc", "xxx"
+};
+
+const char* bli_stor3_string( stor3_t stor_id )
+{
+	if ( stor_id < BLIS_RRR || stor_id > BLIS_XXX ) stor_id = BLIS_XXX;
+
+	return stor3_strs[ stor_id ];
+}
+
+// -----------------------------------------------------------------------------
+
+// The problem sizes at which the sup and conventional code paths are
+// compared.
+static const dim_t calib_sizes[] =
+{
+	8, 16, 24, 32, 48, 64, 80, 96, 112, 128, 160, 192, 224, 256,
+	320, 384, 448, 512, 640, 768, 896, 1024
+};
+
+static const dim_t n_calib_sizes = sizeof( calib_sizes ) / sizeof( dim_t );
+
+// A threshold that every problem meets.
+static const dim_t thresh_always = ( dim_t )1 << 30;
+
+// Create an m x n matrix that is row-stored if is_row and column-stored
+// otherwise.
+static void bli_l3_sup_thresh_create( num_t dt, bool is_row, dim_t m, dim_t n, obj_t* x )
+{
+	if ( is_row ) bli_obj_create( dt, m, n, n, 1, x );
+	else          bli_obj_create( dt, m, n, 1, m, x );
+
+	bli_randm( x );
+}
+
+// Return the best time per gemm over several repetitions, each of which
+// runs enough gemms to be measurable.
+static double bli_l3_sup_thresh_time
+     (
+             obj_t*  a,
+             obj_t*  b,
+             obj_t*  c,
+       const cntx_t* cntx,
+             rntm_t* rntm
+     )
+{
+	const double flops  = 2.0 * bli_obj_length( c ) * bli_obj_width( c ) * bli_obj_width( a );
+	const dim_t  n_iter = bli_max( ( dim_t )( 2.0e7 / flops ), 1 );
+	double       t_best = 1.0e9;
+
+	for ( dim_t r = 0; r < 3; ++r )
+	{
+		const double t = bli_clock();
+
+		for ( dim_t i = 0; i < n_iter; ++i )
+			bli_gemm_ex( &BLIS_ONE, a, b, &BLIS_ZERO, c, cntx, rntm );
+
+		t_best = bli_clock_min_diff( t_best, t );
+	}
+
+	return t_best / n_iter;
+}
+
+// Return the smallest size, in the dimension given by dim (0, 1, or 2 for
+// m, n, or k), at which the conventional code path is faster than the sup
+// code path when the other two dimensions are large, i.e. the sup threshold
+// for that dimension.
+static dim_t bli_l3_sup_thresh_calibrate_dim
+     (
+             num_t   dt,
+             stor3_t stor_id,
+             dim_t   dim,
+             dim_t   size_max,
+       const cntx_t* cntx,
+             rntm_t* rntm_sup,
+             rntm_t* rntm_conv
+     )
+{
+	const bool c_is_row = ( stor_id & 0x4 ) == 0;
+	const bool a_is_row = ( stor_id & 0x2 ) == 0;
+	const bool b_is_row = ( stor_id & 0x1 ) == 0;
+
+	dim_t n_conv = 0;
+	dim_t size   = size_max;
+
+	for ( dim_t i = 0; i < n_calib_sizes && calib_sizes[ i ] <= size_max; ++i )
+	{
+		const dim_t m = ( dim == 0 ? calib_sizes[ i ] : size_max );
+		const dim_t n = ( dim == 1 ? calib_sizes[ i ] : size_max );
+		const dim_t k = ( dim == 2 ? calib_sizes[ i ] : size_max );
+
+		obj_t a, b, c;
+
+		bli_l3_sup_thresh_create( dt, a_is_row, m, k, &a );
+		bli_l3_sup_thresh_create( dt, b_is_row, k, n, &b );
+		bli_l3_sup_thresh_create( dt, c_is_row, m, n, &c );
+
+		const double t_sup  = bli_l3_sup_thresh_time( &a, &b, &c, cntx, rntm_sup );
+		const double t_conv = bli_l3_sup_thresh_time( &a, &b, &c, cntx, rntm_conv );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+
+		// Require the conventional code path to win at two consecutive sizes
+		// so that a single noisy timing does not end the search.
+		if ( t_conv < t_sup )
+		{
+			if ( n_conv == 0 ) size = calib_sizes[ i ];
+			if ( ++n_conv == 2 ) return size;
+		}
+		else
+		{
+			n_conv = 0;
+			size   = size_max;
+		}
+	}
+
+	// Otherwise the sup code path is used up to the largest size.
+	return size;
+}
+
+void bli_l3_sup_thresh_calibrate
+     (
+       num_t   dt,
+       stor3_t stor_id,
+       dim_t   nt,
+       cntx_t* cntx
+     )
+{
+	if ( stor_id < BLIS_RRR || stor_id >= BLIS_XXX || nt < 1 ) return;
+
+	// Time the sup code path with a copy of the context whose thresholds are
+	// always met, so that only the rntm_t decides which path is taken.
+	cntx_t cntx_l = *cntx;
+
+	for ( dim_t c = 0; c < BLIS_NUM_SUP_NT_CLASSES; ++c )
+	{
+		bli_cntx_clear_l3_sup_thresh_st( dt, stor_id, c, &cntx_l );
+		bli_cntx_clear_l3_sup_thresh_st( dt, bli_stor3_trans( stor_id ), c, &cntx_l );
+	}
+
+	const dim_t mt_def = bli_cntx_get_blksz_def_dt( dt, BLIS_MT, cntx );
+	const dim_t nt_def = bli_cntx_get_blksz_def_dt( dt, BLIS_NT, cntx );
+	const dim_t kt_def = bli_cntx_get_blksz_def_dt( dt, BLIS_KT, cntx );
+
+	bli_cntx_set_blksz_def_dt( dt, BLIS_MT, thresh_always, &cntx_l );
+	bli_cntx_set_blksz_def_dt( dt, BLIS_NT, thresh_always, &cntx_l );
+	bli_cntx_set_blksz_def_dt( dt, BLIS_KT, thresh_always, &cntx_l );
+
+	// The sizes considered range up to four times the default thresholds.
+	const dim_t size_max = bli_min( bli_max( 4 * bli_max( mt_def, bli_max( nt_def, kt_def ) ),
+	                                         384 ), 1024 );
+
+	rntm_t rntm_sup, rntm_conv;
+
+	bli_rntm_init( &rntm_sup );
+	bli_rntm_set_num_threads( nt, &rntm_sup );
+	bli_rntm_enable_l3_sup( &rntm_sup );
+
+	rntm_conv = rntm_sup;
+	bli_rntm_disable_l3_sup( &rntm_conv );
+
+	dim_t mt = bli_l3_sup_thresh_calibrate_dim( dt, stor_id, 0, size_max, &cntx_l, &rntm_sup, &rntm_conv );
+	dim_t nt_ = bli_l3_sup_thresh_calibrate_dim( dt, stor_id, 1, size_max, &cntx_l, &rntm_sup, &rntm_conv );
+	dim_t kt = bli_l3_sup_thresh_calibrate_dim( dt, stor_id, 2, size_max, &cntx_l, &rntm_sup, &rntm_conv );
+
+	// bli_gemmsup() transposes the operation if the microkernel dislikes the
+	// storage of C, in which case it looks up the thresholds of the
+	// transposed storage combination with m and n swapped.
+	bool c_is_row = ( stor_id & 0x4 ) == 0;
+
+	if ( c_is_row != bli_cntx_ukr_prefers_rows_dt( dt, BLIS_GEMM_VIR_UKR, cntx ) )
+	{
+		const dim_t t = mt; mt = nt_; nt_ = t;
+
+		stor_id = bli_stor3_trans( stor_id );
+	}
+
+	bli_cntx_set_l3_sup_thresh_st( dt, stor_id, bli_cntx_l3_sup_nt_class( nt ),
+	                               mt, nt_, kt, cntx );
+
+	// Discard any sup decisions made with the old thresholds.
+	bli_dcache_invalidate();
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_l3_sup_thresh_fprint
+     (
+             FILE*   file,
+       const cntx_t* cntx
+     )
+{
+	const char dt_chars[ BLIS_NUM_FP_TYPES ] = { 's', 'c', 'd', 'z' };
+
+	fprintf( file, "sup is used if m < MT, n < NT, or k < KT.\n" );
+	fprintf( file, "%2s %4s %7s %6s %6s %6s  %s\n",
+	         "dt", "stor", "threads", "MT", "NT", "KT", "source" );
+
+	for ( num_t dt = BLIS_FLOAT; dt <= BLIS_DCOMPLEX; ++dt )
+	{
+		for ( stor3_t stor_id = BLIS_RRR; stor_id < BLIS_XXX; ++stor_id )
+		{
+			// Skip storage combinations that bli_gemmsup() transposes.
+			const bool c_is_row = ( stor_id & 0x4 ) == 0;
+
+			if ( c_is_row != bli_cntx_ukr_prefers_rows_dt( dt, BLIS_GEMM_VIR_UKR, cntx ) )
+				continue;
+
+			// If no thread count class was calibrated, the MT/NT/KT
+			// blocksizes apply to all thread counts.
+			if ( bli_cntx_get_l3_sup_thresh_near( dt, stor_id, 1, cntx ) == NULL )
+			{
+				fprintf( file, "%2c %4s %7s %6ld %6ld %6ld  %s\n",
+				         dt_chars[ dt ], bli_stor3_string( stor_id ), "any",
+				         ( long )bli_cntx_get_blksz_def_dt( dt, BLIS_MT, cntx ),
+				         ( long )bli_cntx_get_blksz_def_dt( dt, BLIS_NT, cntx ),
+				         ( long )bli_cntx_get_blksz_def_dt( dt, BLIS_KT, cntx ),
+				         "default" );
+				continue;
+			}
+
+			// Otherwise each class uses the thresholds of the nearest
+			// calibrated class.
+			for ( dim_t c = 0; c < BLIS_NUM_SUP_NT_CLASSES; ++c )
+			{
+				const dim_t* t      = bli_cntx_get_l3_sup_thresh_st( dt, stor_id, c, cntx );
+				const dim_t  nt_min = ( dim_t )1 << c;
+				const dim_t* th     = bli_cntx_get_l3_sup_thresh_near( dt, stor_id, nt_min, cntx );
+				char         nt_str[ 16 ];
+
+				if ( c == BLIS_NUM_SUP_NT_CLASSES - 1 )
+					snprintf( nt_str, sizeof( nt_str ), "%ld+", ( long )nt_min );
+				else if ( c == 0 )
+					snprintf( nt_str, sizeof( nt_str ), "1" );
+				else
+					snprintf( nt_str, sizeof( nt_str ), "%ld-%ld",
+					          ( long )nt_min, ( long )( 2 * nt_min - 1 ) );
+
+				fprintf( file, "%2c %4s %7s %6ld %6ld %6ld  %s\n",
+				         dt_chars[ dt ], bli_stor3_string( stor_id ), nt_str,
+				         ( long )th[ 0 ], ( long )th[ 1 ], ( long )th[ 2 ],
+				         th == t ? "calibrated" : "nearest" );
+			}
+		}
+	}
+}
+
@@ -552,6 +552,8 @@ void PASTEMAC(ch,varname) \
 			/*for ( dim_t ii = 0; ii < ic_iter; ii += 1 )*/ \
 			for ( dim_t ii = ic_start; ii < ic_end; ii += MC ) \
 			{ \
+				BLIS_TRACE_START( t_ic ); \
+\
 				/* Calculate the thread's current IC block dimension. */ \
 				const dim_t mc_cur = ( MC <= ic_end - ii ? MC : ic_left ); \
 \
@@ -670,6 +672,8 @@ void PASTEMAC(ch,varname) \
 						); \
 					} \
 				} \
+\
+				BLIS_TRACE_STOP( "gemmsup_ref_var1n", "loop", t_ic ); \
 			} \
 \
 			/* NOTE: This barrier is only needed if we are packing A (since
@@ -1172,6 +1176,8 @@ void PASTEMAC(ch,varname) \
 			/*for ( dim_t ii = 0; ii < ic_iter; ii += 1 )*/ \
 			for ( dim_t ii = ic_start; ii < ic_end; ii += MC ) \
 			{ \
+				BLIS_TRACE_START( t_ic ); \
+\
 				/* Calculate the thread's current IC block dimension. */ \
 				const dim_t mc_cur = ( MC <= ic_end - ii ? MC : ic_left ); \
 \
@@ -1288,6 +1294,8 @@ void PASTEMAC(ch,varname) \
 						); \
 					} \
 				} \
+\
+				BLIS_TRACE_STOP( "gemmsup_ref_var2m", "loop", t_ic ); \
 			} \
 \
 			/* NOTE: This barrier is only needed if we are packing B (since
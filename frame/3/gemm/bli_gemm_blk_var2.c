@@ -79,6 +79,8 @@ void bli_gemm_blk_var2
 		bli_acquire_mpart_ndim( direct, BLIS_SUBPART1,
 		                        i, b_alg, &cp, &c1 );
 
+		BLIS_TRACE_START( t0 );
+
 		// Perform gemm subproblem.
 		bli_l3_int
 		(
@@ -92,6 +94,8 @@ void bli_gemm_blk_var2
 		  bli_cntl_sub_node( cntl ),
 		  bli_thrinfo_sub_node( thread )
 		);
+
+		BLIS_TRACE_STOP( "gemm_blk_var2", "loop", t0 );
 	}
 }
 
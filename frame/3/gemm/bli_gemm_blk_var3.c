@@ -74,6 +74,8 @@ void bli_gemm_blk_var3
 		bli_acquire_mpart_mdim( direct, BLIS_SUBPART1,
 		                        i, b_alg, &bp, &b1 );
 
+		BLIS_TRACE_START( t0 );
+
 		// Perform gemm subproblem.
 		bli_l3_int
 		(
@@ -88,6 +90,8 @@ void bli_gemm_blk_var3
 		  bli_thrinfo_sub_node( thread )
 		);
 
+		BLIS_TRACE_STOP( "gemm_blk_var3", "loop", t0 );
+
 		bli_thread_barrier( bli_thrinfo_sub_node( thread ) );
 
 		// This variant executes multiple rank-k updates. Therefore, if the
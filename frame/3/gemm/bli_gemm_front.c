@@ -121,9 +121,13 @@ void bli_gemm_front
 	// domain explicitly, we will need to check the computation dt against the
 	// storage dt of C (instead of the computation precision against the
 	// storage precision of C).
-	if ( bli_obj_dt( &c_local ) != bli_obj_dt( &a_local ) ||
-	     bli_obj_dt( &c_local ) != bli_obj_dt( &b_local ) ||
-	     bli_obj_comp_prec( &c_local ) != bli_obj_prec( &c_local ) )
+	// NOTE: bfloat16 and float16 operands are not handled here; they are
+	// converted to float (the datatype of C) when A and B are packed.
+	if ( !bli_obj_is_half( &a_local ) &&
+	     !bli_obj_is_half( &b_local ) &&
+	     ( bli_obj_dt( &c_local ) != bli_obj_dt( &a_local ) ||
+	       bli_obj_dt( &c_local ) != bli_obj_dt( &b_local ) ||
+	       bli_obj_comp_prec( &c_local ) != bli_obj_prec( &c_local ) ) )
 	{
 		// Handle mixed datatype cases in bli_gemm_md(), which may modify
 		// the objects or the context. (If the context is modified, cntx
@@ -0,0 +1,272 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+static void bli_i8gemm_check
+     (
+             trans_t           transa,
+             trans_t           transb,
+             dim_t             m,
+             dim_t             n,
+             dim_t             k,
+       const int32_t*          alpha,
+       const uint8_t*          a, inc_t rs_a, inc_t cs_a,
+       const int8_t*           b, inc_t rs_b, inc_t cs_b,
+       const int32_t*          beta,
+       const int32_t*          c, inc_t rs_c, inc_t cs_c,
+       const i8gemm_qparams_t* qp
+     )
+{
+	err_t e_val;
+
+	e_val = bli_check_valid_trans( transa );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_valid_trans( transb );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_null_pointer( alpha );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_null_pointer( beta );
+	bli_check_error_code( e_val );
+
+	// Check the strides of each matrix against its stored dimensions.
+	const dim_t m_a = ( bli_does_trans( transa ) ? k : m );
+	const dim_t n_a = ( bli_does_trans( transa ) ? m : k );
+	const dim_t m_b = ( bli_does_trans( transb ) ? n : k );
+	const dim_t n_b = ( bli_does_trans( transb ) ? k : n );
+
+	e_val = bli_check_matrix_strides( m_a, n_a, rs_a, cs_a, 1 );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_matrix_strides( m_b, n_b, rs_b, cs_b, 1 );
+	bli_check_error_code( e_val );
+
+	if ( m > 0 && n > 0 && k > 0 )
+	{
+		e_val = bli_check_null_pointer( a );
+		bli_check_error_code( e_val );
+
+		e_val = bli_check_null_pointer( b );
+		bli_check_error_code( e_val );
+	}
+
+	// C is only allowed to be NULL if it is neither read nor written.
+	if ( qp == NULL || qp->q_c == NULL || *beta != 0 )
+	{
+		e_val = bli_check_matrix_strides( m, n, rs_c, cs_c, 1 );
+		bli_check_error_code( e_val );
+
+		if ( m > 0 && n > 0 )
+		{
+			e_val = bli_check_null_pointer( c );
+			bli_check_error_code( e_val );
+		}
+	}
+
+	if ( qp != NULL && qp->q_c != NULL )
+	{
+		e_val = bli_check_matrix_strides( m, n, qp->rs_q, qp->cs_q, 1 );
+		bli_check_error_code( e_val );
+	}
+}
+
+//
+// -- Define the int8 gemm operation's typed API -------------------------------
+//
+
+void bli_i8gemm
+     (
+       trans_t  transa,
+       trans_t  transb,
+       dim_t    m,
+       dim_t    n,
+       dim_t    k,
+       int32_t* alpha,
+       uint8_t* a, inc_t rs_a, inc_t cs_a,
+       int8_t*  b, inc_t rs_b, inc_t cs_b,
+       int32_t* beta,
+       int32_t* c, inc_t rs_c, inc_t cs_c
+     )
+{
+	bli_i8gemm_ex
+	(
+	  transa,
+	  transb,
+	  m, n, k,
+	  alpha,
+	  a, rs_a, cs_a,
+	  b, rs_b, cs_b,
+	  beta,
+	  c, rs_c, cs_c,
+	  NULL,
+	  NULL,
+	  NULL
+	);
+}
+
+void bli_i8gemm_ex
+     (
+             trans_t           transa,
+             trans_t           transb,
+             dim_t             m,
+             dim_t             n,
+             dim_t             k,
+             int32_t*          alpha,
+             uint8_t*          a, inc_t rs_a, inc_t cs_a,
+             int8_t*           b, inc_t rs_b, inc_t cs_b,
+             int32_t*          beta,
+             int32_t*          c, inc_t rs_c, inc_t cs_c,
+       const i8gemm_qparams_t* qp,
+       const cntx_t*           cntx,
+             rntm_t*           rntm
+     )
+{
+	bli_init_once();
+
+	// Initialize a local runtime with global settings if necessary. Note
+	// that in the case that a runtime is passed in, we make a local copy.
+	rntm_t rntm_l;
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); rntm = &rntm_l; }
+	else                { rntm_l = *rntm;                       rntm = &rntm_l; }
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bli_i8gemm_check( transa, transb, m, n, k,
+		                  alpha, a, rs_a, cs_a, b, rs_b, cs_b,
+		                  beta, c, rs_c, cs_c, qp );
+
+	// If C has a zero dimension, return early.
+	if ( m == 0 || n == 0 ) return;
+
+	// Induce transpositions of A and B by swapping their strides.
+	if ( bli_does_trans( transa ) ) bli_swap_incs( &rs_a, &cs_a );
+	if ( bli_does_trans( transb ) ) bli_swap_incs( &rs_b, &cs_b );
+
+	// Wrap the operands in objects so that they may be passed through the
+	// sup thread decorator. Since there is no num_t for 8-bit integers, the
+	// objects are merely containers: they are marked as BLIS_INT, and only
+	// their buffers, dimensions, and strides are used by bli_i8gemm_int().
+	obj_t alpha_o, beta_o, a_o, b_o, c_o;
+
+	bli_obj_create_without_buffer( BLIS_INT, 1, 1, &alpha_o );
+	bli_obj_create_without_buffer( BLIS_INT, 1, 1, &beta_o );
+	bli_obj_create_without_buffer( BLIS_INT, m, k, &a_o );
+	bli_obj_create_without_buffer( BLIS_INT, k, n, &b_o );
+	bli_obj_create_without_buffer( BLIS_INT, m, n, &c_o );
+
+	bli_obj_set_elem_size( sizeof( int32_t ), &alpha_o );
+	bli_obj_set_elem_size( sizeof( int32_t ), &beta_o );
+	bli_obj_set_elem_size( sizeof( uint8_t ), &a_o );
+	bli_obj_set_elem_size( sizeof( int8_t ),  &b_o );
+	bli_obj_set_elem_size( sizeof( int32_t ), &c_o );
+
+	bli_obj_set_buffer( alpha, &alpha_o );
+	bli_obj_set_buffer( beta,  &beta_o );
+	bli_obj_set_buffer( a, &a_o ); bli_obj_set_strides( rs_a, cs_a, &a_o );
+	bli_obj_set_buffer( b, &b_o ); bli_obj_set_strides( rs_b, cs_b, &b_o );
+	bli_obj_set_buffer( c, &c_o ); bli_obj_set_strides( rs_c, cs_c, &c_o );
+
+	// Pass the quantization parameters (if any) along with C.
+	bli_obj_set_ker_params( ( void* )qp, &c_o );
+
+	// Parse and interpret the contents of the rntm_t object to properly
+	// set the ways of parallelism for each loop.
+	bli_rntm_set_ways_for_op
+	(
+	  BLIS_GEMM,
+	  BLIS_LEFT, // ignored for gemm/hemm/symm
+	  m, n, k,
+	  rntm
+	);
+
+	// Both A and B are always packed. Note that the sup thrinfo_t tree only
+	// creates the communicators needed to share packed blocks among threads
+	// when these fields are set.
+	bli_rntm_set_pack_a( TRUE, rntm );
+	bli_rntm_set_pack_b( TRUE, rntm );
+
+	// Spawn threads (if applicable), where bli_i8gemm_int() is the thread
+	// entry point function for each thread.
+	bli_l3_sup_thread_decorator
+	(
+	  bli_i8gemm_int,
+	  BLIS_GEMM, // operation family id
+	  &alpha_o,
+	  &a_o,
+	  &b_o,
+	  &beta_o,
+	  &c_o,
+	  cntx,
+	  rntm
+	);
+}
+
+//
+// -- Define the int8 gemm operation's thread entry point ----------------------
+//
+
+err_t bli_i8gemm_int
+     (
+       const obj_t*     alpha,
+       const obj_t*     a,
+       const obj_t*     b,
+       const obj_t*     beta,
+       const obj_t*     c,
+       const cntx_t*    cntx,
+             rntm_t*    rntm,
+             thrinfo_t* thread
+     )
+{
+	// There is only one variant: a gemmlike block-panel algorithm.
+	bli_i8gemm_bp_var1
+	(
+	  alpha,
+	  a,
+	  b,
+	  beta,
+	  c,
+	  cntx,
+	  rntm,
+	  thread
+	);
+
+	return BLIS_SUCCESS;
+}
@@ -0,0 +1,194 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+//
+// int8 gemm (u8 x s8 -> s32).
+//
+// Computes
+//
+//   C := beta * C + alpha * ( A - za ) * ( B - zb )
+//
+// where A is m x k and stored as uint8_t, B is k x n and stored as int8_t,
+// C is m x n and stored as int32_t, and alpha and beta are int32_t. The
+// optional zero points za and zb are subtracted from each row of A and each
+// column of B, respectively. Optionally, the int32_t result may instead be
+// requantized to uint8_t as it is written out (see i8gemm_qparams_t).
+//
+
+typedef struct
+{
+	// Zero points for the rows of A and the columns of B, respectively.
+	// NULL implies zero; an increment of zero applies a single value to
+	// the entire matrix.
+	const int32_t* zp_a; inc_t inc_zp_a;
+	const int32_t* zp_b; inc_t inc_zp_b;
+
+	// If q_c is non-NULL, C is not updated. Instead, the result
+	//
+	//   t(i,j) = beta * C(i,j) + alpha * [ ( A - za ) * ( B - zb ) ](i,j)
+	//
+	// is requantized and written to the m x n matrix Q:
+	//
+	//   Q(i,j) = clamp( zp_q + round( scale_m(i) * scale_n(j) * t(i,j) ), 0, 255 )
+	//
+	// where a NULL scale vector implies a scale of 1.0 and an increment of
+	// zero applies a single scale to every row (or column). C is not read
+	// if beta is zero, in which case it may be NULL.
+	uint8_t*       q_c; inc_t rs_q, cs_q;
+	const float*   scale_m; inc_t inc_scale_m;
+	const float*   scale_n; inc_t inc_scale_n;
+	int32_t        zp_q;
+} i8gemm_qparams_t;
+
+BLIS_EXPORT_BLIS void bli_i8gemm
+     (
+       trans_t  transa,
+       trans_t  transb,
+       dim_t    m,
+       dim_t    n,
+       dim_t    k,
+       int32_t* alpha,
+       uint8_t* a, inc_t rs_a, inc_t cs_a,
+       int8_t*  b, inc_t rs_b, inc_t cs_b,
+       int32_t* beta,
+       int32_t* c, inc_t rs_c, inc_t cs_c
+     );
+
+BLIS_EXPORT_BLIS void bli_i8gemm_ex
+     (
+             trans_t           transa,
+             trans_t           transb,
+             dim_t             m,
+             dim_t             n,
+             dim_t             k,
+             int32_t*          alpha,
+             uint8_t*          a, inc_t rs_a, inc_t cs_a,
+             int8_t*           b, inc_t rs_b, inc_t cs_b,
+             int32_t*          beta,
+             int32_t*          c, inc_t rs_c, inc_t cs_c,
+       const i8gemm_qparams_t* qparams,
+       const cntx_t*           cntx,
+             rntm_t*           rntm
+     );
+
+//
+// Micro-kernel function pointer type. The kernel is stored in the context
+// under BLIS_GEMM_I8_UKR in the BLIS_FLOAT slot (as are the int8 blocksizes
+// BLIS_MR_I8, etc.). Elements of A are interpreted as uint8_t.
+//
+
+typedef void (*i8gemm_ukr_ft)
+     (
+       dim_t               m,
+       dim_t               n,
+       dim_t               k,
+       int32_t*   restrict alpha,
+       int8_t*    restrict a,
+       int8_t*    restrict b,
+       int32_t*   restrict beta,
+       int32_t*   restrict c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t*          data,
+       cntx_t*             cntx
+     );
+
+//
+// Prototype the thread entry point and block-panel algorithm.
+//
+
+err_t bli_i8gemm_int
+     (
+       const obj_t*     alpha,
+       const obj_t*     a,
+       const obj_t*     b,
+       const obj_t*     beta,
+       const obj_t*     c,
+       const cntx_t*    cntx,
+             rntm_t*    rntm,
+             thrinfo_t* thread
+     );
+
+void bli_i8gemm_bp_var1
+     (
+       const obj_t*     alpha,
+       const obj_t*     a,
+       const obj_t*     b,
+       const obj_t*     beta,
+       const obj_t*     c,
+       const cntx_t*    cntx,
+             rntm_t*    rntm,
+             thrinfo_t* thread
+     );
+
+//
+// Prototype the packing routines.
+//
+
+void bli_i8gemm_packm_a
+     (
+             dim_t      m_alloc,
+             dim_t      k_alloc,
+             dim_t      m,
+             dim_t      k,
+             dim_t      mr,
+       const uint8_t*   a, inc_t rs_a, inc_t cs_a,
+             uint8_t**  p, inc_t* ps_p,
+             int32_t**  sums,
+             rntm_t*    rntm,
+             mem_t*     mem,
+             thrinfo_t* thread
+     );
+
+void bli_i8gemm_packm_b
+     (
+             dim_t      k_alloc,
+             dim_t      n_alloc,
+             dim_t      k,
+             dim_t      n,
+             dim_t      nr,
+       const int8_t*    b, inc_t rs_b, inc_t cs_b,
+             int8_t**   p, inc_t* ps_p,
+             int32_t**  sums,
+             rntm_t*    rntm,
+             mem_t*     mem,
+             thrinfo_t* thread
+     );
+
+void bli_i8gemm_packm_finalize_mem
+     (
+       rntm_t*    rntm,
+       mem_t*     mem,
+       thrinfo_t* thread
+     );
+
@@ -0,0 +1,408 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+//
+// Apply the zero point corrections, alpha, and beta to an m x n tile of
+// int32_t products ct = A * B, where i0 and j0 are the global row and column
+// offsets of the tile, and either update C or requantize to Q.
+//
+
+static void bli_i8gemm_epilogue
+     (
+             dim_t             m,
+             dim_t             n,
+             dim_t             k,
+             dim_t             i0,
+             dim_t             j0,
+       const int32_t*          ct, inc_t rs_ct, inc_t cs_ct,
+       const int32_t*          sums_a,
+       const int32_t*          sums_b,
+             int32_t           alpha,
+             int32_t           beta,
+             int32_t*          c, inc_t rs_c, inc_t cs_c,
+       const i8gemm_qparams_t* qp
+     )
+{
+	const int32_t* zp_a = qp->zp_a;
+	const int32_t* zp_b = qp->zp_b;
+
+	for ( dim_t j = 0; j < n; ++j )
+	{
+		const int32_t zb = ( zp_b ? zp_b[ ( j0 + j ) * qp->inc_zp_b ] : 0 );
+		const int32_t sb = ( zp_a ? sums_b[ j ] : 0 );
+
+		for ( dim_t i = 0; i < m; ++i )
+		{
+			const int32_t za = ( zp_a ? zp_a[ ( i0 + i ) * qp->inc_zp_a ] : 0 );
+			const int32_t sa = ( zp_b ? sums_a[ i ] : 0 );
+
+			// ( A - za ) * ( B - zb ) = A*B - zb*rowsum(A) - za*colsum(B)
+			//                           + k*za*zb
+			int32_t t = ct[ i*rs_ct + j*cs_ct ] - zb * sa - za * sb
+			                                    + ( int32_t )k * za * zb;
+
+			t *= alpha;
+			if ( beta != 0 ) t += beta * c[ i*rs_c + j*cs_c ];
+
+			if ( qp->q_c == NULL )
+			{
+				c[ i*rs_c + j*cs_c ] = t;
+			}
+			else
+			{
+				const float sm = ( qp->scale_m ? qp->scale_m[ ( i0 + i ) * qp->inc_scale_m ] : 1.0f );
+				const float sn = ( qp->scale_n ? qp->scale_n[ ( j0 + j ) * qp->inc_scale_n ] : 1.0f );
+
+				float q = ( float )qp->zp_q + nearbyintf( sm * sn * ( float )t );
+				q = bli_min( bli_max( q, 0.0f ), 255.0f );
+
+				qp->q_c[ ( i0 + i ) * qp->rs_q + ( j0 + j ) * qp->cs_q ] = ( uint8_t )q;
+			}
+		}
+	}
+}
+
+void bli_i8gemm_bp_var1
+     (
+       const obj_t*     alpha,
+       const obj_t*     a,
+       const obj_t*     b,
+       const obj_t*     beta,
+       const obj_t*     c,
+       const cntx_t*    cntx,
+             rntm_t*    rntm,
+             thrinfo_t* thread
+     )
+{
+	const dim_t    m         = bli_obj_length( c );
+	const dim_t    n         = bli_obj_width( c );
+	const dim_t    k         = bli_obj_width( a );
+
+	const uint8_t* a_00      = bli_obj_buffer( a );
+	const inc_t    rs_a      = bli_obj_row_stride( a );
+	const inc_t    cs_a      = bli_obj_col_stride( a );
+
+	const int8_t*  b_00      = bli_obj_buffer( b );
+	const inc_t    rs_b      = bli_obj_row_stride( b );
+	const inc_t    cs_b      = bli_obj_col_stride( b );
+
+	int32_t*       c_00      = bli_obj_buffer( c );
+	const inc_t    rs_c      = bli_obj_row_stride( c );
+	const inc_t    cs_c      = bli_obj_col_stride( c );
+
+	const i8gemm_qparams_t* qp = bli_obj_ker_params( c );
+
+	// Determine whether the micro-kernel may update C directly, or whether
+	// its output must be post-processed.
+	const bool do_zp_a = ( qp != NULL && qp->zp_a != NULL );
+	const bool do_zp_b = ( qp != NULL && qp->zp_b != NULL );
+	const bool do_qc   = ( qp != NULL && qp->q_c  != NULL );
+	const bool do_epi  = ( do_zp_a || do_zp_b || do_qc );
+
+	// Query the context for the int8 blocksizes, which are stored in the
+	// BLIS_FLOAT slot.
+	const dim_t NR  = bli_cntx_get_blksz_def_dt( BLIS_FLOAT, BLIS_NR_I8, cntx );
+	const dim_t MR  = bli_cntx_get_blksz_def_dt( BLIS_FLOAT, BLIS_MR_I8, cntx );
+	const dim_t NC  = bli_cntx_get_blksz_def_dt( BLIS_FLOAT, BLIS_NC_I8, cntx );
+	const dim_t MC  = bli_cntx_get_blksz_def_dt( BLIS_FLOAT, BLIS_MC_I8, cntx );
+	      dim_t KC  = bli_cntx_get_blksz_def_dt( BLIS_FLOAT, BLIS_KC_I8, cntx );
+
+	// The micro-kernel consumes k in groups of four.
+	KC = bli_max( 4, ( KC / 4 ) * 4 );
+
+	// Requantization is not linear, and so it must be applied to the final
+	// int32_t result. Since C is not updated in this case, we do not block
+	// the k dimension at all.
+	if ( do_qc ) KC = bli_max( 4, ( ( k + 3 ) / 4 ) * 4 );
+
+	// Query the context for the micro-kernel address.
+	i8gemm_ukr_ft gemm_ukr = bli_cntx_get_ukr_dt( BLIS_FLOAT, BLIS_GEMM_I8_UKR, cntx );
+
+	// Make local copies of the scalars to prevent any unnecessary sharing of
+	// cache lines between the cores' caches.
+	int32_t        alpha_local = *( int32_t* )bli_obj_buffer( alpha );
+	int32_t        beta_local  = *( int32_t* )bli_obj_buffer( beta );
+	int32_t        one_local   = 1;
+	int32_t        zero_local  = 0;
+
+	auxinfo_t      aux;
+
+	mem_t mem_a = BLIS_MEM_INITIALIZER;
+	mem_t mem_b = BLIS_MEM_INITIALIZER;
+
+	// Define an array of bszid_t ids, which will act as our substitute for
+	// the cntl_t tree.
+	bszid_t bszids[8] = { BLIS_NC,      // 5th loop
+	                      BLIS_KC,      // 4th loop
+	                      BLIS_NO_PART, // pack B
+	                      BLIS_MC,      // 3rd loop
+	                      BLIS_NO_PART, // pack A
+	                      BLIS_NR,      // 2nd loop
+	                      BLIS_MR,      // 1st loop
+	                      BLIS_KR };    // microkernel loop
+
+	bszid_t* restrict bszids_jc = &bszids[0];
+	bszid_t* restrict bszids_pc = &bszids[1];
+	bszid_t* restrict bszids_ic = &bszids[3];
+	bszid_t* restrict bszids_jr = &bszids[5];
+
+	thrinfo_t* restrict thread_jc = NULL;
+	thrinfo_t* restrict thread_pc = NULL;
+	thrinfo_t* restrict thread_pb = NULL;
+	thrinfo_t* restrict thread_ic = NULL;
+	thrinfo_t* restrict thread_pa = NULL;
+	thrinfo_t* restrict thread_jr = NULL;
+	thrinfo_t* restrict thread_ir = NULL;
+
+	// Identify the current thrinfo_t node and then grow the tree.
+	thread_jc = thread;
+	bli_thrinfo_sup_grow( rntm, bszids_jc, thread_jc );
+
+	// Compute the JC loop thread range for the current thread.
+	dim_t jc_start, jc_end;
+	bli_thread_range_sub( thread_jc, n, NR, FALSE, &jc_start, &jc_end );
+
+	// Loop over the n dimension (NC columns at a time).
+	for ( dim_t jj = jc_start; jj < jc_end; jj += NC )
+	{
+		const dim_t nc_cur = bli_min( NC, jc_end - jj );
+
+		const int8_t*  b_jc = b_00 + jj * cs_b;
+		      int32_t* c_jc = c_00 + jj * cs_c;
+
+		// Identify the current thrinfo_t node and then grow the tree.
+		thread_pc = bli_thrinfo_sub_node( thread_jc );
+		bli_thrinfo_sup_grow( rntm, bszids_pc, thread_pc );
+
+		// Loop over the k dimension (KC at a time). Note that we always
+		// execute at least one iteration so that C is scaled by beta (or
+		// requantized) even when k is zero.
+		for ( dim_t pp = 0; pp == 0 || pp < k; pp += KC )
+		{
+			const dim_t kc_cur = bli_min( KC, k - pp );
+			const dim_t kc_pad = ( ( kc_cur + 3 ) / 4 ) * 4;
+
+			const uint8_t* a_pc = a_00 + pp * cs_a;
+			const int8_t*  b_pc = b_jc + pp * rs_b;
+
+			// Only apply beta to the first iteration of the pc loop.
+			const int32_t beta_use = ( pp == 0 ? beta_local : one_local );
+
+			int8_t*  b_use;
+			inc_t    ps_b_use;
+			int32_t* sums_b = NULL;
+
+			thread_pb = bli_thrinfo_sub_node( thread_pc );
+
+			// Pack the current panel of B, computing its column sums if
+			// the rows of A have zero points.
+			bli_i8gemm_packm_b
+			(
+			  KC,     NC,
+			  kc_cur, nc_cur, NR,
+			  b_pc, rs_b, cs_b,
+			  &b_use, &ps_b_use,
+			  ( do_zp_a ? &sums_b : NULL ),
+			  rntm,
+			  &mem_b,
+			  thread_pb
+			);
+
+			// Identify the current thrinfo_t node and then grow the tree.
+			thread_ic = bli_thrinfo_sub_node( thread_pb );
+			bli_thrinfo_sup_grow( rntm, bszids_ic, thread_ic );
+
+			// Compute the IC loop thread range for the current thread.
+			dim_t ic_start, ic_end;
+			bli_thread_range_sub( thread_ic, m, MR, FALSE, &ic_start, &ic_end );
+
+			// Loop over the m dimension (MC rows at a time).
+			for ( dim_t ii = ic_start; ii < ic_end; ii += MC )
+			{
+				const dim_t mc_cur = bli_min( MC, ic_end - ii );
+
+				const uint8_t* a_ic = a_pc + ii * rs_a;
+				      int32_t* c_ic = c_jc + ii * rs_c;
+
+				uint8_t* a_use;
+				inc_t    ps_a_use;
+				int32_t* sums_a = NULL;
+
+				thread_pa = bli_thrinfo_sub_node( thread_ic );
+
+				// Pack the current block of A, computing its row sums if the
+				// columns of B have zero points.
+				bli_i8gemm_packm_a
+				(
+				  MC,     KC,
+				  mc_cur, kc_cur, MR,
+				  a_ic, rs_a, cs_a,
+				  &a_use, &ps_a_use,
+				  ( do_zp_b ? &sums_a : NULL ),
+				  rntm,
+				  &mem_a,
+				  thread_pa
+				);
+
+				// Identify the current thrinfo_t node and then grow the tree.
+				thread_jr = bli_thrinfo_sub_node( thread_pa );
+				bli_thrinfo_sup_grow( rntm, bszids_jr, thread_jr );
+
+				const dim_t jr_nt  = bli_thread_n_way( thread_jr );
+				const dim_t jr_tid = bli_thread_work_id( thread_jr );
+
+				dim_t jr_iter = ( nc_cur + NR - 1 ) / NR;
+				dim_t jr_left =   nc_cur % NR;
+
+				dim_t jr_start, jr_end;
+				bli_thread_range_sub( thread_jr, jr_iter, 1, FALSE, &jr_start, &jr_end );
+
+				// Loop over the n dimension (NR columns at a time).
+				for ( dim_t j = jr_start; j < jr_end; j += 1 )
+				{
+					const dim_t nr_cur
+					= ( bli_is_not_edge_f( j, jr_iter, jr_left ) ? NR : jr_left );
+
+					int8_t*  b_jr = b_use + j * ps_b_use;
+					int32_t* c_jr = c_ic  + j * NR * cs_c;
+
+					int8_t*  b2   = b_jr;
+
+					thread_ir = bli_thrinfo_sub_node( thread_jr );
+
+					const dim_t ir_nt  = bli_thread_n_way( thread_ir );
+					const dim_t ir_tid = bli_thread_work_id( thread_ir );
+
+					dim_t ir_iter = ( mc_cur + MR - 1 ) / MR;
+					dim_t ir_left =   mc_cur % MR;
+
+					dim_t ir_start, ir_end;
+					bli_thread_range_sub( thread_ir, ir_iter, 1, FALSE, &ir_start, &ir_end );
+
+					// Loop over the m dimension (MR rows at a time).
+					for ( dim_t i = ir_start; i < ir_end; i += 1 )
+					{
+						const dim_t mr_cur
+						= ( bli_is_not_edge_f( i, ir_iter, ir_left ) ? MR : ir_left );
+
+						uint8_t* a_ir = a_use + i * ps_a_use;
+						int32_t* c_ir = c_jr  + i * MR * rs_c;
+
+						// Compute the addresses of the next micropanels of A and B.
+						uint8_t* a2 = bli_gemm_get_next_a_upanel( a_ir, ps_a_use, 1 );
+						if ( bli_is_last_iter( i, ir_end, ir_tid, ir_nt ) )
+						{
+							a2 = a_use;
+							b2 = bli_gemm_get_next_b_upanel( b_jr, ps_b_use, 1 );
+							if ( bli_is_last_iter( j, jr_end, jr_tid, jr_nt ) )
+								b2 = b_use;
+						}
+
+						bli_auxinfo_set_next_a( a2, &aux );
+						bli_auxinfo_set_next_b( b2, &aux );
+
+						if ( !do_epi )
+						{
+							// Invoke the micro-kernel directly on C.
+							gemm_ukr
+							(
+							  mr_cur,
+							  nr_cur,
+							  kc_pad,
+							  &alpha_local,
+							  ( int8_t* )a_ir,
+							  b_jr,
+							  ( int32_t* )&beta_use,
+							  c_ir, rs_c, cs_c,
+							  &aux,
+							  ( cntx_t* )cntx
+							);
+						}
+						else
+						{
+							// Compute A * B into a temporary tile and then
+							// apply the zero points, scalars and (if
+							// requested) requantization.
+							int32_t ct[ BLIS_STACK_BUF_MAX_SIZE
+							            / sizeof( int32_t ) ]
+							            __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE)));
+
+							gemm_ukr
+							(
+							  mr_cur,
+							  nr_cur,
+							  kc_pad,
+							  &one_local,
+							  ( int8_t* )a_ir,
+							  b_jr,
+							  &zero_local,
+							  ct, 1, MR,
+							  &aux,
+							  ( cntx_t* )cntx
+							);
+
+							bli_i8gemm_epilogue
+							(
+							  mr_cur,
+							  nr_cur,
+							  kc_cur,
+							  ii + i * MR,
+							  jj + j * NR,
+							  ct, 1, MR,
+							  ( sums_a ? sums_a + i * MR : NULL ),
+							  ( sums_b ? sums_b + j * NR : NULL ),
+							  alpha_local,
+							  beta_use,
+							  c_ir, rs_c, cs_c,
+							  qp
+							);
+						}
+					}
+				}
+			}
+
+			// This barrier is needed to prevent threads from starting to pack
+			// the next row panel of B before the current row panel is fully
+			// computed upon.
+			bli_thread_barrier( thread_pb );
+		}
+	}
+
+	// Release any memory that was acquired for packing matrices A and B.
+	bli_i8gemm_packm_finalize_mem( rntm, &mem_a, thread_pa );
+	bli_i8gemm_packm_finalize_mem( rntm, &mem_b, thread_pb );
+}
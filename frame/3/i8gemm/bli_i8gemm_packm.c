@@ -0,0 +1,266 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+// Acquire (or re-use) a block from the packed block allocator large enough
+// to hold size_needed bytes and share it among the threads in thread. This
+// mirrors the logic used by the gemmlike sandbox.
+static void bli_i8gemm_packm_init_mem
+     (
+       siz_t      size_needed,
+       packbuf_t  pack_buf_type,
+       rntm_t*    rntm,
+       mem_t*     mem,
+       thrinfo_t* thread
+     )
+{
+	// Barrier to make sure all threads are caught up and ready to begin the
+	// packm stage (and, in particular, are done reading the previous contents
+	// of the packed buffer).
+	bli_thread_barrier( thread );
+
+	// If the mem_t entry provided by the caller is allocated and large enough,
+	// then we use it as-is.
+	if ( bli_mem_is_alloc( mem ) && size_needed <= bli_mem_size( mem ) )
+		return;
+
+	if ( bli_thread_am_ochief( thread ) )
+	{
+		// Acquire directly to the chief thread's mem_t that was passed in,
+		// releasing any existing (but too small) block first.
+		if ( bli_mem_is_alloc( mem ) )
+			bli_pba_release( rntm, mem );
+
+		bli_pba_acquire_m( rntm, size_needed, pack_buf_type, mem );
+	}
+
+	// Broadcast the address of the chief thread's passed-in mem_t to all
+	// threads, and then copy its contents to the non-chief threads' mem_t.
+	mem_t* mem_p = bli_thread_broadcast( thread, mem );
+
+	if ( !bli_thread_am_ochief( thread ) )
+	{
+		*mem = *mem_p;
+	}
+}
+
+void bli_i8gemm_packm_finalize_mem
+     (
+       rntm_t*    rntm,
+       mem_t*     mem,
+       thrinfo_t* thread
+     )
+{
+	if ( thread != NULL )
+	if ( bli_thread_am_ochief( thread ) )
+	{
+		if ( bli_mem_is_alloc( mem ) )
+			bli_pba_release( rntm, mem );
+	}
+}
+
+//
+// Pack an m x k block of A into micropanels of mr rows, with k grouped by
+// four: element (i,l) of a micropanel is stored at (l/4)*mr*4 + i*4 + l%4.
+// The k dimension of each micropanel is zero-padded to a multiple of four
+// and the m edge is zero-padded to mr. If sums is non-NULL, the sums of the
+// rows of A are also computed and stored (as int32_t) after the micropanels.
+//
+
+void bli_i8gemm_packm_a
+     (
+             dim_t      m_alloc,
+             dim_t      k_alloc,
+             dim_t      m,
+             dim_t      k,
+             dim_t      mr,
+       const uint8_t*   a, inc_t rs_a, inc_t cs_a,
+             uint8_t**  p, inc_t* ps_p,
+             int32_t**  sums,
+             rntm_t*    rntm,
+             mem_t*     mem,
+             thrinfo_t* thread
+     )
+{
+	// Compute the size of the memory block needed using the maximum (alloc)
+	// dimensions so that the block may be re-used for subsequent blocks.
+	const dim_t m_pack = ( ( m_alloc + mr - 1 ) / mr ) * mr;
+	const dim_t k_pack = ( ( k_alloc + 3 ) / 4 ) * 4;
+
+	const siz_t size_needed = sizeof( uint8_t ) * m_pack * k_pack +
+	                          sizeof( int32_t ) * m_pack;
+
+	bli_i8gemm_packm_init_mem( size_needed, BLIS_BUFFER_FOR_A_BLOCK,
+	                           rntm, mem, thread );
+
+	uint8_t* restrict p_use = bli_mem_buffer( mem );
+	int32_t* restrict s_use = ( int32_t* )( p_use + m_pack * k_pack );
+
+	const dim_t k_pad = ( ( k + 3 ) / 4 ) * 4;
+	const inc_t ps    = mr * k_pad;
+
+	// Partition the micropanels among the threads.
+	const dim_t n_iter = ( m + mr - 1 ) / mr;
+	dim_t it_start, it_end;
+	bli_thread_range_sub( thread, n_iter, 1, FALSE, &it_start, &it_end );
+
+	for ( dim_t it = it_start; it < it_end; ++it )
+	{
+		const dim_t i0    = it * mr;
+		const dim_t m_cur = bli_min( mr, m - i0 );
+
+		uint8_t* restrict pi = p_use + it * ps;
+
+		for ( dim_t i = 0; i < mr; ++i )
+		{
+			int32_t sum = 0;
+
+			if ( i < m_cur )
+			{
+				const uint8_t* restrict ai = a + ( i0 + i ) * rs_a;
+
+				for ( dim_t l = 0; l < k; ++l )
+				{
+					const uint8_t a_il = ai[ l * cs_a ];
+
+					pi[ ( l / 4 ) * mr * 4 + i * 4 + l % 4 ] = a_il;
+					sum += a_il;
+				}
+				for ( dim_t l = k; l < k_pad; ++l )
+					pi[ ( l / 4 ) * mr * 4 + i * 4 + l % 4 ] = 0;
+			}
+			else
+			{
+				for ( dim_t l = 0; l < k_pad; ++l )
+					pi[ ( l / 4 ) * mr * 4 + i * 4 + l % 4 ] = 0;
+			}
+
+			if ( sums != NULL ) s_use[ i0 + i ] = sum;
+		}
+	}
+
+	// Make sure all threads are done packing before the block is used.
+	bli_thread_barrier( thread );
+
+	*p    = p_use;
+	*ps_p = ps;
+	if ( sums != NULL ) *sums = s_use;
+}
+
+//
+// Pack a k x n block of B into micropanels of nr columns, with k grouped by
+// four: element (l,j) of a micropanel is stored at (l/4)*nr*4 + j*4 + l%4.
+// The k dimension of each micropanel is zero-padded to a multiple of four
+// and the n edge is zero-padded to nr. If sums is non-NULL, the sums of the
+// columns of B are also computed and stored (as int32_t) after the
+// micropanels.
+//
+
+void bli_i8gemm_packm_b
+     (
+             dim_t      k_alloc,
+             dim_t      n_alloc,
+             dim_t      k,
+             dim_t      n,
+             dim_t      nr,
+       const int8_t*    b, inc_t rs_b, inc_t cs_b,
+             int8_t**   p, inc_t* ps_p,
+             int32_t**  sums,
+             rntm_t*    rntm,
+             mem_t*     mem,
+             thrinfo_t* thread
+     )
+{
+	const dim_t n_pack = ( ( n_alloc + nr - 1 ) / nr ) * nr;
+	const dim_t k_pack = ( ( k_alloc + 3 ) / 4 ) * 4;
+
+	const siz_t size_needed = sizeof( int8_t  ) * k_pack * n_pack +
+	                          sizeof( int32_t ) * n_pack;
+
+	bli_i8gemm_packm_init_mem( size_needed, BLIS_BUFFER_FOR_B_PANEL,
+	                           rntm, mem, thread );
+
+	int8_t*  restrict p_use = bli_mem_buffer( mem );
+	int32_t* restrict s_use = ( int32_t* )( p_use + k_pack * n_pack );
+
+	const dim_t k_pad = ( ( k + 3 ) / 4 ) * 4;
+	const inc_t ps    = nr * k_pad;
+
+	const dim_t n_iter = ( n + nr - 1 ) / nr;
+	dim_t it_start, it_end;
+	bli_thread_range_sub( thread, n_iter, 1, FALSE, &it_start, &it_end );
+
+	for ( dim_t it = it_start; it < it_end; ++it )
+	{
+		const dim_t j0    = it * nr;
+		const dim_t n_cur = bli_min( nr, n - j0 );
+
+		int8_t* restrict pj = p_use + it * ps;
+
+		for ( dim_t j = 0; j < nr; ++j )
+		{
+			int32_t sum = 0;
+
+			if ( j < n_cur )
+			{
+				const int8_t* restrict bj = b + ( j0 + j ) * cs_b;
+
+				for ( dim_t l = 0; l < k; ++l )
+				{
+					const int8_t b_lj = bj[ l * rs_b ];
+
+					pj[ ( l / 4 ) * nr * 4 + j * 4 + l % 4 ] = b_lj;
+					sum += b_lj;
+				}
+				for ( dim_t l = k; l < k_pad; ++l )
+					pj[ ( l / 4 ) * nr * 4 + j * 4 + l % 4 ] = 0;
+			}
+			else
+			{
+				for ( dim_t l = 0; l < k_pad; ++l )
+					pj[ ( l / 4 ) * nr * 4 + j * 4 + l % 4 ] = 0;
+			}
+
+			if ( sums != NULL ) s_use[ j0 + j ] = sum;
+		}
+	}
+
+	bli_thread_barrier( thread );
+
+	*p    = p_use;
+	*ps_p = ps;
+	if ( sums != NULL ) *sums = s_use;
+}
@@ -96,6 +96,8 @@ void bli_trsm_blk_var1
 		        (int)bli_obj_row_off( &a11_1 ), (int)bli_obj_col_off( &a11_1 ) );
 #endif
 
+		BLIS_TRACE_START( t0 );
+
 		// Perform trsm subproblem.
 		bli_l3_int
 		(
@@ -109,6 +111,8 @@ void bli_trsm_blk_var1
 		  bli_cntl_sub_prenode( cntl ),
 		  bli_thrinfo_sub_prenode( thread )
 		);
+
+		BLIS_TRACE_STOP( "trsm_blk_var1 (trsm)", "loop", t0 );
 	}
 
 #ifdef PRINT
@@ -167,6 +171,8 @@ void bli_trsm_blk_var1
 		        (int)bli_obj_row_off( &a11 ), (int)bli_obj_col_off( &a11 ) );
 #endif
 
+		BLIS_TRACE_START( t0 );
+
 		// Perform gemm subproblem. (Note that we use the same backend
 		// function as before, since we're calling the same macrokernel.)
 		bli_l3_int
@@ -181,6 +187,8 @@ void bli_trsm_blk_var1
 		  bli_cntl_sub_node( cntl ),
 		  bli_thrinfo_sub_node( thread )
 		);
+
+		BLIS_TRACE_STOP( "trsm_blk_var1 (gemm)", "loop", t0 );
 	}
 #ifdef PRINT
 	printf( "bli_trsm_blk_var1(): finishing gemm subproblem loop.\n" );
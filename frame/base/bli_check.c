@@ -149,7 +149,9 @@ err_t bli_check_valid_datatype( num_t dt )
 	     dt != BLIS_SCOMPLEX &&
 	     dt != BLIS_DCOMPLEX &&
 	     dt != BLIS_INT &&
-	     dt != BLIS_CONSTANT )
+	     dt != BLIS_CONSTANT &&
+	     dt != BLIS_BFLOAT16 &&
+	     dt != BLIS_FLOAT16 )
 		e_val = BLIS_INVALID_DATATYPE;
 
 	return e_val;
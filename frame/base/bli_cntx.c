@@ -108,6 +108,9 @@ void bli_cntx_set_blkszs( cntx_t* cntx, ... )
 
 	// Shutdown variable argument environment and clean up stack.
 	va_end( args );
+
+	// Discard any dispatch decisions made with the old blocksizes.
+	bli_dcache_invalidate();
 }
 
 // -----------------------------------------------------------------------------
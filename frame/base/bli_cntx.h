@@ -67,6 +67,11 @@ BLIS_INLINE ind_t bli_cntx_method( const cntx_t* cntx )
 	return cntx->method;
 }
 
+BLIS_INLINE bool bli_cntx_untuned_blkszs( const cntx_t* cntx )
+{
+	return cntx->untuned_blkszs;
+}
+
 // -----------------------------------------------------------------------------
 
 //
@@ -78,6 +83,11 @@ BLIS_INLINE void bli_cntx_set_method( ind_t method, cntx_t* cntx )
 	cntx->method = method;
 }
 
+BLIS_INLINE void bli_cntx_set_untuned_blkszs( bool untuned, cntx_t* cntx )
+{
+	cntx->untuned_blkszs = untuned;
+}
+
 // -----------------------------------------------------------------------------
 
 //
@@ -183,6 +193,54 @@ BLIS_INLINE bool bli_cntx_l3_sup_thresh_is_met( num_t dt, dim_t m, dim_t n, dim_
 	return FALSE;
 }
 
+BLIS_INLINE dim_t bli_cntx_l3_sup_nt_class( dim_t nt )
+{
+	dim_t nt_class = 0;
+
+	while ( nt > 1 && nt_class < BLIS_NUM_SUP_NT_CLASSES - 1 ) { nt /= 2; ++nt_class; }
+
+	return nt_class;
+}
+
+BLIS_INLINE const dim_t* bli_cntx_get_l3_sup_thresh_st( num_t dt, stor3_t stor_id, dim_t nt_class, const cntx_t* cntx )
+{
+	return cntx->l3_sup_thresh[ dt ][ stor_id ][ nt_class ];
+}
+
+BLIS_INLINE const dim_t* bli_cntx_get_l3_sup_thresh_near( num_t dt, stor3_t stor_id, dim_t nt, const cntx_t* cntx )
+{
+	const dim_t nt_class = bli_cntx_l3_sup_nt_class( nt );
+
+	// Return the calibrated thresholds for the nearest thread count class
+	// that was calibrated for this datatype and storage combination
+	// (preferring fewer threads), or NULL if there is none.
+	for ( dim_t d = 0; d < BLIS_NUM_SUP_NT_CLASSES; ++d )
+	{
+		for ( dim_t sgn = -1; sgn <= 1; sgn += 2 )
+		{
+			const dim_t c = nt_class + sgn * d;
+
+			if ( c < 0 || c >= BLIS_NUM_SUP_NT_CLASSES ) continue;
+
+			const dim_t* t = bli_cntx_get_l3_sup_thresh_st( dt, stor_id, c, cntx );
+
+			if ( t[ 0 ] != 0 ) return t;
+		}
+	}
+
+	return NULL;
+}
+
+BLIS_INLINE bool bli_cntx_l3_sup_thresh_is_met_st( num_t dt, stor3_t stor_id, dim_t nt, dim_t m, dim_t n, dim_t k, const cntx_t* cntx )
+{
+	// Fall back to the MT/NT/KT blocksizes if no thresholds were calibrated.
+	const dim_t* t = bli_cntx_get_l3_sup_thresh_near( dt, stor_id, nt, cntx );
+
+	if ( t != NULL ) return m < t[ 0 ] || n < t[ 1 ] || k < t[ 2 ];
+
+	return bli_cntx_l3_sup_thresh_is_met( dt, m, n, k, cntx );
+}
+
 // -----------------------------------------------------------------------------
 
 BLIS_INLINE void_fp bli_cntx_get_l3_sup_handler( opid_t op, const cntx_t* cntx )
@@ -286,6 +344,25 @@ BLIS_INLINE void bli_cntx_set_blksz_max_dt( num_t dt, bszid_t bs_id, dim_t bs, c
 	bli_blksz_set_max( bs, dt, &cntx->blkszs[ bs_id ]);
 }
 
+BLIS_INLINE void bli_cntx_set_l3_sup_thresh_st( num_t dt, stor3_t stor_id, dim_t nt_class, dim_t mt, dim_t nt, dim_t kt, cntx_t* cntx )
+{
+	// Thresholds are stored as at least one so that zero may denote an
+	// uncalibrated entry. (A threshold of one is never met by a nonempty
+	// problem, just as a threshold of zero.)
+	dim_t* t = cntx->l3_sup_thresh[ dt ][ stor_id ][ nt_class ];
+
+	t[ 0 ] = bli_max( mt, 1 );
+	t[ 1 ] = bli_max( nt, 1 );
+	t[ 2 ] = bli_max( kt, 1 );
+}
+
+BLIS_INLINE void bli_cntx_clear_l3_sup_thresh_st( num_t dt, stor3_t stor_id, dim_t nt_class, cntx_t* cntx )
+{
+	dim_t* t = cntx->l3_sup_thresh[ dt ][ stor_id ][ nt_class ];
+
+	t[ 0 ] = t[ 1 ] = t[ 2 ] = 0;
+}
+
 BLIS_INLINE void bli_cntx_set_ukr( ukr_t ukr_id, const func_t* func, cntx_t* cntx )
 {
 	cntx->ukrs[ ukr_id ] = *func;
@@ -1352,3 +1352,227 @@ char* find_string_in( char* target, char* buffer, size_t buf_len, char* filepath
 
 #endif
 
+// -----------------------------------------------------------------------------
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386) || defined(_M_IX86) || \
+    defined(__linux__)
+
+// Insert a cache description into caches, which is kept sorted by level,
+// and return the new number of entries.
+static uint32_t bli_cpuid_add_cache
+     (
+       const cpuid_cache_t* cache,
+             cpuid_cache_t* caches,
+             uint32_t       n,
+             uint32_t       n_max
+     )
+{
+	if ( n >= n_max || cache->size == 0 || cache->ways == 0 ||
+	     cache->sets == 0 || cache->line_size == 0 ) return n;
+
+	uint32_t i = n;
+
+	while ( i > 0 && caches[ i - 1 ].level > cache->level )
+	{
+		caches[ i ] = caches[ i - 1 ];
+		--i;
+	}
+
+	caches[ i ] = *cache;
+
+	return n + 1;
+}
+
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386) || defined(_M_IX86)
+
+uint32_t bli_cpuid_query_caches( cpuid_cache_t* caches, uint32_t n_max )
+{
+	uint32_t eax, ebx, ecx, edx;
+	uint32_t leaf;
+	uint32_t n = 0;
+
+	uint32_t cpuid_max     = __get_cpuid_max( 0,           0 );
+	uint32_t cpuid_max_ext = __get_cpuid_max( 0x80000000u, 0 );
+
+	// Intel enumerates its caches via the deterministic cache parameters in
+	// leaf 4. AMD uses the same layout in leaf 0x8000001D, which is present
+	// only if the topology extensions are (cpuid[eax=0x80000001]:ecx[22]).
+	uint32_t vendor_string[4] = { 0, 0, 0, 0 };
+
+	__cpuid( 0, eax, vendor_string[0],
+	                 vendor_string[2],
+	                 vendor_string[1] );
+
+	if ( strcmp( ( char* )vendor_string, "AuthenticAMD" ) == 0 )
+	{
+		if ( cpuid_max_ext < 0x8000001Du ) return 0;
+
+		__cpuid( 0x80000001u, eax, ebx, ecx, edx );
+
+		if ( !bli_cpuid_has_features( ecx, 1u << 22 ) ) return 0;
+
+		leaf = 0x8000001Du;
+	}
+	else
+	{
+		if ( cpuid_max < 4 ) return 0;
+
+		leaf = 4;
+	}
+
+	for ( uint32_t i = 0; i < 16; ++i )
+	{
+		cpuid_cache_t cache;
+
+		__cpuid_count( leaf, i, eax, ebx, ecx, edx );
+
+		/*
+		   cpuid(eax=4 or 0x8000001D, ecx=i):
+
+		   eax[ 4: 0] - Cache type (0: no more caches, 1: data, 2: instruction,
+		                3: unified)
+		   eax[ 7: 5] - Cache level
+		   eax[25:14] - Number of logical processors sharing the cache - 1
+		   ebx[11: 0] - Line size - 1
+		   ebx[21:12] - Physical line partitions - 1
+		   ebx[31:22] - Ways of associativity - 1
+		   ecx[31: 0] - Number of sets - 1
+		*/
+
+		const uint32_t type = eax & 0x1F;
+
+		if ( type == 0 ) break;
+		if ( type == 2 ) continue;
+
+		const uint32_t parts = ( ( ebx >> 12 ) & 0x3FF ) + 1;
+
+		cache.level     = ( eax >>  5 ) & 0x7;
+		cache.n_sharing = ( ( eax >> 14 ) & 0xFFF ) + 1;
+		cache.line_size = ( ebx & 0xFFF ) + 1;
+		cache.ways      = ( ( ebx >> 22 ) & 0x3FF ) + 1;
+		cache.sets      = ecx + 1;
+		cache.size      = cache.ways * parts * cache.line_size * cache.sets;
+
+		// Fold the line partitions into the line size so that the capacity
+		// of one way is always sets * line_size.
+		cache.line_size *= parts;
+
+		n = bli_cpuid_add_cache( &cache, caches, n, n_max );
+	}
+
+	return n;
+}
+
+#elif defined(__linux__)
+
+// Read an unsigned integer from a cache attribute file in sysfs, honoring a
+// 'K' or 'M' suffix (as used by the size attribute).
+static uint32_t bli_cpuid_read_sysfs( uint32_t index, const char* attr )
+{
+	char          path[ 128 ];
+	char          suffix = '\0';
+	unsigned long value  = 0;
+
+	snprintf( path, sizeof( path ),
+	          "/sys/devices/system/cpu/cpu0/cache/index%u/%s",
+	          ( unsigned )index, attr );
+
+	FILE* fp = fopen( path, "r" );
+
+	if ( fp == NULL ) return 0;
+
+	if ( fscanf( fp, "%lu%c", &value, &suffix ) < 1 ) value = 0;
+
+	fclose( fp );
+
+	if      ( suffix == 'K' ) value *= 1024;
+	else if ( suffix == 'M' ) value *= 1024 * 1024;
+
+	return ( uint32_t )value;
+}
+
+// Count the processors in a sysfs cpu list such as "0-3,8-11".
+static uint32_t bli_cpuid_count_sysfs_cpus( uint32_t index )
+{
+	char path[ 128 ];
+	char list[ 1024 ];
+
+	snprintf( path, sizeof( path ),
+	          "/sys/devices/system/cpu/cpu0/cache/index%u/shared_cpu_list",
+	          ( unsigned )index );
+
+	FILE* fp = fopen( path, "r" );
+
+	if ( fp == NULL ) return 1;
+
+	char*    r_val = fgets( list, sizeof( list ), fp );
+	uint32_t n     = 0;
+
+	fclose( fp );
+
+	if ( r_val == NULL ) return 1;
+
+	for ( char* tok = strtok( list, ",\n" ); tok != NULL; tok = strtok( NULL, ",\n" ) )
+	{
+		unsigned lo, hi;
+		int      n_read = sscanf( tok, "%u-%u", &lo, &hi );
+
+		if      ( n_read == 2 && hi >= lo ) n += hi - lo + 1;
+		else if ( n_read >= 1 )             n += 1;
+	}
+
+	return n > 0 ? n : 1;
+}
+
+uint32_t bli_cpuid_query_caches( cpuid_cache_t* caches, uint32_t n_max )
+{
+	uint32_t n = 0;
+
+	for ( uint32_t i = 0; i < 16; ++i )
+	{
+		char          path[ 128 ];
+		char          type[ 32 ] = "";
+		cpuid_cache_t cache;
+
+		snprintf( path, sizeof( path ),
+		          "/sys/devices/system/cpu/cpu0/cache/index%u/type", ( unsigned )i );
+
+		FILE* fp = fopen( path, "r" );
+
+		if ( fp == NULL ) break;
+
+		if ( fscanf( fp, "%31s", type ) != 1 ) type[ 0 ] = '\0';
+
+		fclose( fp );
+
+		if ( strcmp( type, "Data" ) != 0 && strcmp( type, "Unified" ) != 0 ) continue;
+
+		cache.level     = bli_cpuid_read_sysfs( i, "level" );
+		cache.size      = bli_cpuid_read_sysfs( i, "size" );
+		cache.ways      = bli_cpuid_read_sysfs( i, "ways_of_associativity" );
+		cache.sets      = bli_cpuid_read_sysfs( i, "number_of_sets" );
+		cache.line_size = bli_cpuid_read_sysfs( i, "coherency_line_size" );
+		cache.n_sharing = bli_cpuid_count_sysfs_cpus( i );
+
+		// Some kernels do not report the geometry of every cache. Infer the
+		// number of sets from the capacity when possible.
+		if ( cache.sets == 0 && cache.ways != 0 && cache.line_size != 0 )
+			cache.sets = cache.size / ( cache.ways * cache.line_size );
+
+		n = bli_cpuid_add_cache( &cache, caches, n, n_max );
+	}
+
+	return n;
+}
+
+#else
+
+uint32_t bli_cpuid_query_caches( cpuid_cache_t* caches, uint32_t n_max )
+{
+	return 0;
+}
+
+#endif
+
@@ -80,6 +80,24 @@ bool bli_cpuid_is_cortexa9( uint32_t model, uint32_t part, uint32_t features );
 
 uint32_t bli_cpuid_query( uint32_t* family, uint32_t* model, uint32_t* features );
 
+// A description of one level of the data (or unified) cache hierarchy.
+typedef struct
+{
+	uint32_t level;
+	uint32_t size;      // capacity in bytes
+	uint32_t ways;      // associativity
+	uint32_t sets;
+	uint32_t line_size; // in bytes
+	uint32_t n_sharing; // number of logical processors that share the cache
+} cpuid_cache_t;
+
+#define BLIS_CPUID_MAX_CACHES 4
+
+// Query the data caches of the processor on which the calling thread runs,
+// storing up to n_max of them (ordered by level) in caches and returning
+// the number stored. Zero is returned if the caches cannot be discovered.
+BLIS_EXPORT_BLIS uint32_t bli_cpuid_query_caches( cpuid_cache_t* caches, uint32_t n_max );
+
 // -----------------------------------------------------------------------------
 
 //
@@ -0,0 +1,168 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#include "blis.h"
+
+// The number of entries in each thread's cache (a power of two).
+#define BLIS_DCACHE_SIZE 32
+
+typedef struct
+{
+	dkey_t key;
+	dim_t  vals[ BLIS_DCACHE_NUM_VALS ];
+	bool   valid;
+} dcache_entry_t;
+
+typedef struct
+{
+	dcache_entry_t entries[ BLIS_DCACHE_SIZE ];
+	uint64_t       gen;
+} dcache_t;
+
+// Without thread-local storage, one cache would be shared by all threads,
+// so no decisions are cached.
+#ifdef BLIS_HAS_THREAD_LOCAL
+
+// The generation of the native context. A thread's cache is cleared when it
+// is first used after the generation changes.
+static uint64_t      dcache_gen  = 1;
+static const cntx_t* dcache_cntx = NULL;
+
+static BLIS_THREAD_LOCAL dcache_t dcache = { .gen = 0 };
+
+#endif
+
+void bli_dcache_init( const cntx_t* cntx )
+{
+#ifdef BLIS_HAS_THREAD_LOCAL
+	__atomic_store_n( &dcache_cntx, cntx, __ATOMIC_RELAXED );
+	__atomic_add_fetch( &dcache_gen, 1, __ATOMIC_RELEASE );
+#endif
+}
+
+void bli_dcache_finalize( void )
+{
+	bli_dcache_init( NULL );
+}
+
+void bli_dcache_invalidate( void )
+{
+#ifdef BLIS_HAS_THREAD_LOCAL
+	__atomic_add_fetch( &dcache_gen, 1, __ATOMIC_RELEASE );
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+#ifdef BLIS_HAS_THREAD_LOCAL
+
+static bool bli_dkey_equals( const dkey_t* k1, const dkey_t* k2 )
+{
+	return k1->dec     == k2->dec     &&
+	       k1->m       == k2->m       &&
+	       k1->n       == k2->n       &&
+	       k1->k       == k2->k       &&
+	       k1->nt      == k2->nt      &&
+	       k1->op      == k2->op      &&
+	       k1->dt      == k2->dt      &&
+	       k1->stor_id == k2->stor_id &&
+	       k1->side    == k2->side    &&
+	       k1->cntx    == k2->cntx;
+}
+
+// Return the entry of the calling thread's cache in which a decision may be
+// stored, or NULL if the decision may not be cached.
+static dcache_entry_t* bli_dcache_entry( const dkey_t* key )
+{
+	const uint64_t gen = __atomic_load_n( &dcache_gen, __ATOMIC_ACQUIRE );
+
+	if ( dcache.gen != gen )
+	{
+		for ( dim_t i = 0; i < BLIS_DCACHE_SIZE; ++i )
+			dcache.entries[ i ].valid = FALSE;
+
+		dcache.gen = gen;
+	}
+
+	// Decisions that depend on a context other than the native context are
+	// not cached, since such a context may be modified (or another context
+	// created at the same address) between calls.
+	if ( key->cntx != NULL &&
+	     key->cntx != __atomic_load_n( &dcache_cntx, __ATOMIC_RELAXED ) ) return NULL;
+
+	uint64_t h = ( uint64_t )key->dec;
+
+	h = h * 0x9e3779b97f4a7c15ULL + ( uint64_t )key->m;
+	h = h * 0x9e3779b97f4a7c15ULL + ( uint64_t )key->n;
+	h = h * 0x9e3779b97f4a7c15ULL + ( uint64_t )key->k;
+	h = h * 0x9e3779b97f4a7c15ULL + ( uint64_t )key->nt;
+	h = h * 0x9e3779b97f4a7c15ULL + ( uint64_t )( key->op + 16 * ( key->dt + 16 * key->stor_id ) );
+
+	return &dcache.entries[ ( h >> 32 ) & ( BLIS_DCACHE_SIZE - 1 ) ];
+}
+
+#endif
+
+bool bli_dcache_lookup( const dkey_t* key, dim_t* vals )
+{
+#ifdef BLIS_HAS_THREAD_LOCAL
+	const dcache_entry_t* e = bli_dcache_entry( key );
+
+	if ( e == NULL || !e->valid || !bli_dkey_equals( &e->key, key ) ) return FALSE;
+
+	for ( dim_t i = 0; i < BLIS_DCACHE_NUM_VALS; ++i ) vals[ i ] = e->vals[ i ];
+
+	return TRUE;
+#else
+	return FALSE;
+#endif
+}
+
+void bli_dcache_insert( const dkey_t* key, const dim_t* vals )
+{
+#ifdef BLIS_HAS_THREAD_LOCAL
+	dcache_entry_t* e = bli_dcache_entry( key );
+
+	if ( e == NULL ) return;
+
+	e->key   = *key;
+	e->valid = TRUE;
+
+	for ( dim_t i = 0; i < BLIS_DCACHE_NUM_VALS; ++i ) e->vals[ i ] = vals[ i ];
+#endif
+}
+
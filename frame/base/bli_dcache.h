@@ -0,0 +1,125 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef BLIS_DCACHE_H
+#define BLIS_DCACHE_H
+
+//
+// A per-thread cache of dispatch decisions (e.g. the choice between the sup
+// and conventional code paths, or an automatic thread factorization) that
+// BLIS would otherwise recompute on every call for the same problem shape.
+// Because each thread has its own cache, lookups and insertions require no
+// synchronization.
+//
+
+typedef enum
+{
+	BLIS_DEC_SUP = 0,  // bli_gemmsup() (et al.): sup thresholds met?
+	BLIS_DEC_WAYS,     // bli_rntm_set_ways_for_op(): ways of parallelism
+	BLIS_DEC_SUP_WAYS, // bli_rntm_set_ways_from_rntm_sup(): ways of parallelism
+	BLIS_DEC_SUP_VAR,  // bli_gemmsup_int(): variant and thread factorization
+} dec_t;
+
+// The number of values that may be stored for each decision.
+#define BLIS_DCACHE_NUM_VALS 8
+
+// A decision is keyed by the fields of dkey_t that it depends on; fields that
+// do not apply to a decision should be zero. A decision that depends on the
+// context must give the context, and is cached only for the native context
+// of the gks.
+typedef struct
+{
+	dec_t         dec;
+	opid_t        op;
+	num_t         dt;
+	stor3_t       stor_id;
+	side_t        side;
+	dim_t         m;
+	dim_t         n;
+	dim_t         k;
+	dim_t         nt;
+	const cntx_t* cntx;
+} dkey_t;
+
+BLIS_INLINE void bli_dkey_init
+     (
+             dec_t   dec,
+             opid_t  op,
+             num_t   dt,
+             stor3_t stor_id,
+             side_t  side,
+             dim_t   m,
+             dim_t   n,
+             dim_t   k,
+             dim_t   nt,
+       const cntx_t* cntx,
+             dkey_t* key
+     )
+{
+	key->dec     = dec;
+	key->op      = op;
+	key->dt      = dt;
+	key->stor_id = stor_id;
+	key->side    = side;
+	key->m       = m;
+	key->n       = n;
+	key->k       = k;
+	key->nt      = nt;
+	key->cntx    = cntx;
+}
+
+// Look up a decision in the calling thread's cache, copying its values to
+// vals and returning TRUE if it is found.
+bool bli_dcache_lookup( const dkey_t* key, dim_t* vals );
+
+// Store the values of a decision in the calling thread's cache, possibly
+// evicting another decision.
+void bli_dcache_insert( const dkey_t* key, const dim_t* vals );
+
+// Called by the gks when the native context is (re)initialized and when it
+// is finalized, respectively.
+void bli_dcache_init( const cntx_t* cntx );
+void bli_dcache_finalize( void );
+
+// Invalidate the caches of all threads, e.g. after modifying the native
+// context in place. bli_cntx_set_blkszs(), bli_tune_read_file(),
+// bli_tune_cache_model(), and bli_l3_sup_thresh_calibrate() call this
+// function; callers that modify a context with the inline blocksize and
+// threshold setters (e.g. bli_cntx_set_blksz_def_dt()) must call it
+// themselves.
+BLIS_EXPORT_BLIS void bli_dcache_invalidate( void );
+
+#endif
+
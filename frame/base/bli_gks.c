@@ -208,6 +208,20 @@ void bli_gks_init( void )
 		                                              bli_cntx_init_generic_ref,
 		                                              bli_cntx_init_generic_ind );
 #endif
+
+		// Apply the blocksizes from the tuning profile named by the
+		// BLIS_TUNING_FILE environment variable (or, if there is none, the
+		// blocksizes modeled from the cache hierarchy) to the native context
+		// of the architecture that will be used at runtime. This must happen
+		// before bli_memsys_init() sizes the packing pools.
+		cntx_t** gks_id = gks[ bli_arch_query_id() ];
+
+		if ( gks_id != NULL && gks_id[ BLIS_NAT ] != NULL )
+			bli_tune_init( gks_id[ BLIS_NAT ] );
+
+		// Discard any dispatch decisions cached for a previous context, and
+		// allow decisions that depend on the native context to be cached.
+		bli_dcache_init( gks_id != NULL ? gks_id[ BLIS_NAT ] : NULL );
 	}
 }
 
@@ -222,6 +236,9 @@ void bli_gks_finalize( void )
 	// NOTE: This critical section is implicit. We assume this function is only
 	// called from within the critical section within bli_finalize().
 	{
+		// Discard any cached dispatch decisions before the contexts on which
+		// they depend are freed.
+		bli_dcache_finalize();
 
 		// Iterate over the architectures in the gks array.
 		for ( id = 0; id < BLIS_NUM_ARCHS; ++id )
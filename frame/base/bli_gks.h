@@ -40,9 +40,9 @@ void                           bli_gks_finalize( void );
 
 void                           bli_gks_init_index( void );
 
-const cntx_t*                  bli_gks_lookup_nat_cntx( arch_t id );
+BLIS_EXPORT_BLIS const cntx_t* bli_gks_lookup_nat_cntx( arch_t id );
 const cntx_t*                  bli_gks_lookup_ind_cntx( arch_t id, ind_t ind );
-const cntx_t* const *          bli_gks_lookup_id( arch_t id );
+BLIS_EXPORT_BLIS const cntx_t* const * bli_gks_lookup_id( arch_t id );
 void                           bli_gks_register_cntx( arch_t id, void_fp nat_fp, void_fp ref_fp, void_fp ind_fp );
 
 BLIS_EXPORT_BLIS const cntx_t* bli_gks_query_cntx( void );
@@ -0,0 +1,147 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef BLIS_HALF_H
+#define BLIS_HALF_H
+
+// -- Scalar conversions between 16-bit floating-point formats and float -------
+
+// bfloat16 is simply the upper half of an IEEE 754 binary32 value, so
+// widening is a shift and narrowing rounds the discarded bits to nearest
+// (ties to even). Conversions involving IEEE 754 binary16 (float16) handle
+// subnormals, infinities, and NaNs explicitly.
+
+typedef union
+{
+	float    f;
+	uint32_t u;
+} bli_f32bits_t;
+
+BLIS_INLINE float bli_bf16tos( bfloat16 h )
+{
+	bli_f32bits_t v;
+
+	v.u = ( uint32_t )h << 16;
+
+	return v.f;
+}
+
+BLIS_INLINE bfloat16 bli_stobf16( float s )
+{
+	bli_f32bits_t v;
+
+	v.f = s;
+
+	// Quiet any NaN rather than allowing rounding to turn it into infinity.
+	if ( ( v.u & 0x7fffffff ) > 0x7f800000 )
+		return ( bfloat16 )( ( v.u >> 16 ) | 0x0040 );
+
+	v.u += 0x7fff + ( ( v.u >> 16 ) & 1 );
+
+	return ( bfloat16 )( v.u >> 16 );
+}
+
+BLIS_INLINE float bli_f16tos( float16 h )
+{
+	bli_f32bits_t v;
+
+	const uint32_t sign = ( ( uint32_t )h & 0x8000 ) << 16;
+	const uint32_t expo = ( ( uint32_t )h >> 10 ) & 0x1f;
+	const uint32_t mant = ( ( uint32_t )h & 0x03ff );
+
+	if ( expo == 0 )
+	{
+		// Zero or subnormal: the value is mant * 2^-24.
+		v.f = ( float )mant * 5.9604644775390625e-8f;
+		v.u |= sign;
+	}
+	else if ( expo == 0x1f )
+	{
+		// Infinity or NaN.
+		v.u = sign | 0x7f800000 | ( mant << 13 );
+	}
+	else
+	{
+		// Normal: rebias the exponent from 15 to 127.
+		v.u = sign | ( ( expo + 112 ) << 23 ) | ( mant << 13 );
+	}
+
+	return v.f;
+}
+
+BLIS_INLINE float16 bli_stof16( float s )
+{
+	bli_f32bits_t v;
+
+	v.f = s;
+
+	const uint32_t sign = ( v.u >> 16 ) & 0x8000;
+	uint32_t       x    = v.u & 0x7fffffff;
+	uint32_t       h;
+
+	if ( x >= 0x7f800000 )
+	{
+		// Infinity or NaN (quieted).
+		h = ( x > 0x7f800000 ? 0x7e00 : 0x7c00 );
+	}
+	else if ( x >= 0x477ff000 )
+	{
+		// Values that round to a magnitude of 65520 or more overflow.
+		h = 0x7c00;
+	}
+	else if ( x < 0x38800000 )
+	{
+		// Subnormal (or zero) result. Adding 0.5 aligns the binary16
+		// subnormal ulp (2^-24) with the ulp of the float sum, so the FPU
+		// performs the round-to-nearest-even for us.
+		bli_f32bits_t t;
+
+		t.u  = x;
+		t.f += 0.5f;
+		h    = t.u - 0x3f000000;
+	}
+	else
+	{
+		// Normal result: rebias the exponent and round to nearest even.
+		const uint32_t odd = ( x >> 13 ) & 1;
+
+		x += ( ( uint32_t )( 15 - 127 ) << 23 ) + 0xfff + odd;
+		h  = x >> 13;
+	}
+
+	return ( float16 )( sign | h );
+}
+
+#endif
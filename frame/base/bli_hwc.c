@@ -0,0 +1,257 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#ifdef __linux__
+// syscall(2) is not declared when only _POSIX_C_SOURCE is defined.
+#define _GNU_SOURCE
+#endif
+
+#include "blis.h"
+
+#if defined(BLIS_ENABLE_STATS) && defined(BLIS_OS_LINUX) && \
+    defined(BLIS_HAS_THREAD_LOCAL)
+#define BLIS_HWC_PERF
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+static const char* hwc_counter_strs[ BLIS_HWC_NUM_COUNTERS ] =
+{
+	"cycles", "instructions", "l1d_misses", "llc_misses", "dtlb_misses"
+};
+
+const char* bli_hwc_counter_string( hwc_counter_t counter )
+{
+	return hwc_counter_strs[ counter ];
+}
+
+#ifdef BLIS_ENABLE_STATS
+bool bli_hwc_enabled = FALSE;
+#endif
+
+// The counters opened by any thread.
+static uint32_t hwc_avail = 0;
+
+#ifdef BLIS_HWC_PERF
+
+#define HWC_CACHE_READ_MISS( cache ) \
+	( ( cache ) | ( PERF_COUNT_HW_CACHE_OP_READ << 8 ) | \
+	              ( PERF_COUNT_HW_CACHE_RESULT_MISS << 16 ) )
+
+static const struct { uint32_t type; uint64_t config; }
+hwc_events[ BLIS_HWC_NUM_COUNTERS ] =
+{
+	{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+	{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+	{ PERF_TYPE_HW_CACHE, HWC_CACHE_READ_MISS( PERF_COUNT_HW_CACHE_L1D ) },
+	{ PERF_TYPE_HW_CACHE, HWC_CACHE_READ_MISS( PERF_COUNT_HW_CACHE_LL ) },
+	{ PERF_TYPE_HW_CACHE, HWC_CACHE_READ_MISS( PERF_COUNT_HW_CACHE_DTLB ) },
+};
+
+// The counters of one thread, opened as a single group so that they can all
+// be read at once. The members of the group appear in the order given by
+// counter.
+typedef struct
+{
+	int      fd[ BLIS_HWC_NUM_COUNTERS ];
+	int      counter[ BLIS_HWC_NUM_COUNTERS ];
+	int      n;
+	uint32_t mask;
+} hwc_thread_t;
+
+static BLIS_THREAD_LOCAL hwc_thread_t* hwc_thread = NULL;
+static BLIS_THREAD_LOCAL bool          hwc_tried  = FALSE;
+
+// The counters of a thread are closed when it exits (via a destructor of
+// this key) or, for the thread that calls bli_finalize(), by
+// bli_hwc_finalize().
+static pthread_key_t      hwc_key;
+static bli_pthread_once_t hwc_key_once = BLIS_PTHREAD_ONCE_INIT;
+
+static void bli_hwc_close( void* arg )
+{
+	hwc_thread_t* t = arg;
+
+	if ( t == NULL ) return;
+
+	for ( int i = t->n - 1; 0 <= i; --i ) close( t->fd[ i ] );
+
+	free( t );
+}
+
+static void bli_hwc_key_create( void )
+{
+	pthread_key_create( &hwc_key, bli_hwc_close );
+}
+
+static void bli_hwc_open( void )
+{
+	hwc_tried = TRUE;
+
+	hwc_thread_t* t = malloc( sizeof( hwc_thread_t ) );
+
+	if ( t == NULL ) return;
+
+	t->n    = 0;
+	t->mask = 0;
+
+	for ( int c = 0; c < BLIS_HWC_NUM_COUNTERS; ++c )
+	{
+		struct perf_event_attr attr;
+
+		memset( &attr, 0, sizeof( attr ) );
+		attr.size           = sizeof( attr );
+		attr.type           = hwc_events[ c ].type;
+		attr.config         = hwc_events[ c ].config;
+		attr.read_format    = PERF_FORMAT_GROUP;
+		attr.exclude_kernel = 1;
+		attr.exclude_hv     = 1;
+
+		// Count the calling thread on any cpu. A counter that cannot be
+		// opened, or that cannot be scheduled along with the others, is
+		// skipped.
+		const int leader = ( t->n == 0 ? -1 : t->fd[ 0 ] );
+		const long fd    = syscall( __NR_perf_event_open, &attr, 0, -1,
+		                            leader, 0 );
+
+		if ( fd < 0 ) continue;
+
+		t->fd[ t->n ]      = fd;
+		t->counter[ t->n ] = c;
+		t->n              += 1;
+		t->mask           |= 1u << c;
+	}
+
+	if ( t->n == 0 ) { free( t ); return; }
+
+	bli_pthread_once( &hwc_key_once, bli_hwc_key_create );
+	pthread_setspecific( hwc_key, t );
+
+	__atomic_fetch_or( &hwc_avail, t->mask, __ATOMIC_RELAXED );
+
+	hwc_thread = t;
+}
+
+void bli_hwc_read( hwc_mark_t* mark )
+{
+	mark->mask = 0;
+
+	if ( !hwc_tried ) bli_hwc_open();
+
+	const hwc_thread_t* t = hwc_thread;
+
+	if ( t == NULL ) return;
+
+	// With PERF_FORMAT_GROUP, a read returns the number of members followed
+	// by their values.
+	uint64_t buf[ 1 + BLIS_HWC_NUM_COUNTERS ];
+
+	const ssize_t size = ( 1 + t->n ) * sizeof( uint64_t );
+
+	if ( read( t->fd[ 0 ], buf, size ) != size ) return;
+
+	for ( int i = 0; i < t->n; ++i )
+		mark->val[ t->counter[ i ] ] = buf[ 1 + i ];
+
+	mark->mask = t->mask;
+}
+
+#elif defined(BLIS_ENABLE_STATS)
+
+void bli_hwc_read( hwc_mark_t* mark )
+{
+	mark->mask = 0;
+}
+
+#endif
+
+// -----------------------------------------------------------------------------
+
+void bli_hwc_init( void )
+{
+	if ( bli_env_get_var( "BLIS_HWC", 0 ) != 0 ) bli_hwc_enable();
+}
+
+void bli_hwc_finalize( void )
+{
+	bli_hwc_disable();
+
+#ifdef BLIS_HWC_PERF
+	if ( hwc_thread != NULL )
+	{
+		pthread_setspecific( hwc_key, NULL );
+		bli_hwc_close( hwc_thread );
+	}
+
+	hwc_thread = NULL;
+	hwc_tried  = FALSE;
+#endif
+
+	__atomic_store_n( &hwc_avail, 0, __ATOMIC_RELAXED );
+}
+
+void bli_hwc_enable( void )
+{
+#ifdef BLIS_HWC_PERF
+	if ( !hwc_tried ) bli_hwc_open();
+
+	if ( hwc_thread != NULL ) bli_hwc_enabled = TRUE;
+#endif
+}
+
+void bli_hwc_disable( void )
+{
+#ifdef BLIS_ENABLE_STATS
+	bli_hwc_enabled = FALSE;
+#endif
+}
+
+bool bli_hwc_is_enabled( void )
+{
+#ifdef BLIS_ENABLE_STATS
+	return bli_hwc_enabled;
+#else
+	return FALSE;
+#endif
+}
+
+bool bli_hwc_is_available( hwc_counter_t counter )
+{
+	return ( __atomic_load_n( &hwc_avail, __ATOMIC_RELAXED ) >> counter ) & 1;
+}
+
@@ -0,0 +1,100 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+#ifndef BLIS_HWC_H
+#define BLIS_HWC_H
+
+//
+// Hardware performance counters, read via perf_event_open(2) on Linux and
+// attributed to the same events as the level-3 statistics (see bli_stats.h).
+// Counters are read only if BLIS was configured with --enable-stats, the
+// statistics are being collected, and the counters were enabled at runtime,
+// either with bli_hwc_enable() or by setting the BLIS_HWC environment
+// variable to a nonzero value before BLIS is initialized.
+//
+// Each thread opens its counters the first time it records an event. Any
+// counter that cannot be opened (e.g. because of the perf_event_paranoid
+// setting, a container or hypervisor that does not expose the PMU, or a
+// processor without the event) is simply not counted, and
+// bli_hwc_is_available() reports which counters were opened.
+//
+
+typedef enum
+{
+	BLIS_HWC_CYCLES = 0,
+	BLIS_HWC_INSTRUCTIONS,
+	BLIS_HWC_L1D_MISSES,  // L1 data cache read misses
+	BLIS_HWC_LLC_MISSES,  // last-level cache read misses
+	BLIS_HWC_DTLB_MISSES, // data TLB read misses
+} hwc_counter_t;
+
+#define BLIS_HWC_NUM_COUNTERS 5
+
+// Enabling the counters first opens them for the calling thread. If none of
+// them can be opened, the counters remain disabled.
+BLIS_EXPORT_BLIS void bli_hwc_enable( void );
+BLIS_EXPORT_BLIS void bli_hwc_disable( void );
+BLIS_EXPORT_BLIS bool bli_hwc_is_enabled( void );
+
+// Query whether a counter was opened by any thread since BLIS was
+// initialized.
+BLIS_EXPORT_BLIS bool bli_hwc_is_available( hwc_counter_t counter );
+
+BLIS_EXPORT_BLIS const char* bli_hwc_counter_string( hwc_counter_t counter );
+
+// -- Internal interface --
+
+// A reading of the counters of the calling thread. Only the counters whose
+// bits are set in mask were read.
+typedef struct
+{
+	uint64_t val[ BLIS_HWC_NUM_COUNTERS ];
+	uint32_t mask;
+} hwc_mark_t;
+
+void bli_hwc_init( void );
+void bli_hwc_finalize( void );
+
+#ifdef BLIS_ENABLE_STATS
+
+extern bool bli_hwc_enabled;
+
+void bli_hwc_read( hwc_mark_t* mark );
+
+#endif
+
+#endif
+
@@ -37,6 +37,8 @@
 static const char* bli_ind_impl_str[BLIS_NUM_IND_METHODS] =
 {
 /* 1m   */ "1m",
+/* 3m   */ "3m",
+/* 4m   */ "4m",
 /* nat  */ "native",
 };
 
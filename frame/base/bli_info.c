@@ -101,6 +101,14 @@ gint_t bli_info_get_enable_sba_pools( void )
 	return 0;
 #endif
 }
+gint_t bli_info_get_enable_stats( void )
+{
+#ifdef BLIS_ENABLE_STATS
+	return 1;
+#else
+	return 0;
+#endif
+}
 gint_t bli_info_get_enable_threading( void )
 {
 	if ( bli_info_get_enable_openmp() ||
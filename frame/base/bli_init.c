@@ -90,6 +90,9 @@ void bli_init_apis( void )
 	bli_thread_init();
 	bli_pack_init();
 	bli_memsys_init();
+	bli_stats_init();
+	bli_trace_init();
+	bli_hwc_init();
 
 	// Reset the control variable that will allow finalization.
 	// NOTE: We must initialize a fresh pthread_once_t object and THEN copy the
@@ -104,6 +107,8 @@ void bli_init_apis( void )
 void bli_finalize_apis( void )
 {
 	// Finalize various sub-APIs.
+	bli_hwc_finalize();
+	bli_trace_finalize();
 	bli_memsys_finalize();
 	bli_pack_finalize();
 	bli_thread_finalize();
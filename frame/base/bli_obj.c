@@ -104,13 +104,18 @@ void bli_obj_create_without_buffer
 	// top-level 'frame' directory to see them.
 	bli_obj_set_as_root( obj );
 
+	// Matrices stored in one of the 16-bit floating-point formats are only
+	// ever computed with in single precision (after being converted during
+	// packing), so we target the float datatype from the outset.
+	num_t dt_tar = ( bli_is_half( dt ) ? BLIS_FLOAT : dt );
+
 	// Set individual fields.
 	bli_obj_set_buffer( NULL, obj );
 	bli_obj_set_dt( dt, obj );
 	bli_obj_set_elem_size( elem_size, obj );
-	bli_obj_set_target_dt( dt, obj );
-	bli_obj_set_exec_dt( dt, obj );
-	bli_obj_set_comp_dt( dt, obj );
+	bli_obj_set_target_dt( dt_tar, obj );
+	bli_obj_set_exec_dt( dt_tar, obj );
+	bli_obj_set_comp_dt( dt_tar, obj );
 	bli_obj_set_dims( m, n, obj );
 	bli_obj_set_offs( 0, 0, obj );
 	bli_obj_set_diag_offset( 0, obj );
@@ -121,7 +126,7 @@ void bli_obj_create_without_buffer
 	bli_obj_set_ker_params( NULL, obj );
 
 	// Set the internal scalar to 1.0.
-	bli_obj_set_scalar_dt( dt, obj );
+	bli_obj_set_scalar_dt( dt_tar, obj );
 	void* s = bli_obj_internal_scalar_buffer( obj );
 
 	// Always writing the imaginary component is needed in mixed-domain
@@ -130,10 +135,10 @@ void bli_obj_create_without_buffer
 	// for A and B are merged).
 	//if      ( bli_is_float( dt )    ) { bli_sset1s( *(( float*    )s) ); }
 	//else if ( bli_is_double( dt )   ) { bli_dset1s( *(( double*   )s) ); }
-	if      ( bli_is_float( dt )    ) { bli_cset1s( *(( scomplex* )s) ); }
-	else if ( bli_is_double( dt )   ) { bli_zset1s( *(( dcomplex* )s) ); }
-	else if ( bli_is_scomplex( dt ) ) { bli_cset1s( *(( scomplex* )s) ); }
-	else if ( bli_is_dcomplex( dt ) ) { bli_zset1s( *(( dcomplex* )s) ); }
+	if      ( bli_is_float( dt_tar )    ) { bli_cset1s( *(( scomplex* )s) ); }
+	else if ( bli_is_double( dt_tar )   ) { bli_zset1s( *(( dcomplex* )s) ); }
+	else if ( bli_is_scomplex( dt_tar ) ) { bli_cset1s( *(( scomplex* )s) ); }
+	else if ( bli_is_dcomplex( dt_tar ) ) { bli_zset1s( *(( dcomplex* )s) ); }
 }
 
 void bli_obj_alloc_buffer
@@ -515,14 +520,16 @@ void bli_adjust_strides
 	}
 }
 
-static siz_t dt_sizes[6] =
+static siz_t dt_sizes[8] =
 {
 	sizeof( float ),
 	sizeof( scomplex ),
 	sizeof( double ),
 	sizeof( dcomplex ),
 	sizeof( gint_t ),
-	sizeof( constdata_t )
+	sizeof( constdata_t ),
+	sizeof( bfloat16 ),
+	sizeof( float16 )
 };
 
 siz_t bli_dt_size
@@ -536,13 +543,16 @@ siz_t bli_dt_size
 	return dt_sizes[dt];
 }
 
-static char* dt_names[ BLIS_NUM_FP_TYPES+1 ] =
+static char* dt_names[8] =
 {
 	"float",
 	"scomplex",
 	"double",
 	"dcomplex",
-	"int"
+	"int",
+	"constant",
+	"bfloat16",
+	"float16"
 };
 
 const char* bli_dt_string
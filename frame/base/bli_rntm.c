@@ -36,7 +36,7 @@
 
 // The global rntm_t structure, which holds the global thread settings
 // along with a few other key parameters.
-rntm_t global_rntm;
+rntm_t global_rntm = BLIS_RNTM_INITIALIZER;
 
 // A mutex to allow synchronous access to global_rntm.
 bli_pthread_mutex_t global_rntm_mutex = BLIS_PTHREAD_MUTEX_INITIALIZER;
@@ -59,7 +59,27 @@ void bli_rntm_init_from_global( rntm_t* rntm )
 
 // -----------------------------------------------------------------------------
 
-void bli_rntm_set_ways_for_op
+// Save the fields of a runtime that are set by the bli_rntm_set_ways_*()
+// functions to (or restore them from) the values of a cached decision.
+static void bli_rntm_save_ways( const rntm_t* rntm, dim_t* vals )
+{
+	vals[ 0 ] = bli_rntm_auto_factor( rntm );
+	vals[ 1 ] = bli_rntm_num_threads( rntm );
+	vals[ 2 ] = bli_rntm_jc_ways( rntm );
+	vals[ 3 ] = bli_rntm_pc_ways( rntm );
+	vals[ 4 ] = bli_rntm_ic_ways( rntm );
+	vals[ 5 ] = bli_rntm_jr_ways( rntm );
+	vals[ 6 ] = bli_rntm_ir_ways( rntm );
+}
+
+static void bli_rntm_load_ways( const dim_t* vals, rntm_t* rntm )
+{
+	bli_rntm_set_auto_factor_only( ( bool )vals[ 0 ], rntm );
+	bli_rntm_set_num_threads_only( vals[ 1 ], rntm );
+	bli_rntm_set_ways_only( vals[ 2 ], vals[ 3 ], vals[ 4 ], vals[ 5 ], vals[ 6 ], rntm );
+}
+
+static void bli_rntm_set_ways_for_op_int
      (
        opid_t  l3_op,
        side_t  side,
@@ -153,6 +173,44 @@ bli_rntm_print( rntm );
 	}
 }
 
+void bli_rntm_set_ways_for_op
+     (
+       opid_t  l3_op,
+       side_t  side,
+       dim_t   m,
+       dim_t   n,
+       dim_t   k,
+       rntm_t* rntm
+     )
+{
+	// Reuse the ways of parallelism computed by a previous call for the same
+	// operation, problem shape, and number of threads (unless the caller
+	// set the ways explicitly, in which case there is little to compute).
+	const bool use_dcache = !bli_rntm_ways_are_set( rntm );
+	dkey_t     key;
+	dim_t      vals[ BLIS_DCACHE_NUM_VALS ];
+
+	if ( use_dcache )
+	{
+		bli_dkey_init( BLIS_DEC_WAYS, l3_op, 0, 0, side, m, n, k,
+		               bli_rntm_num_threads( rntm ), NULL, &key );
+
+		if ( bli_dcache_lookup( &key, vals ) )
+		{
+			bli_rntm_load_ways( vals, rntm );
+			return;
+		}
+	}
+
+	bli_rntm_set_ways_for_op_int( l3_op, side, m, n, k, rntm );
+
+	if ( use_dcache )
+	{
+		bli_rntm_save_ways( rntm, vals );
+		bli_dcache_insert( &key, vals );
+	}
+}
+
 void bli_rntm_set_ways_from_rntm
      (
        dim_t   m,
@@ -278,7 +336,7 @@ void bli_rntm_set_ways_from_rntm
 	bli_rntm_set_ways_only( jc, pc, ic, jr, ir, rntm );
 }
 
-void bli_rntm_set_ways_from_rntm_sup
+static void bli_rntm_set_ways_from_rntm_sup_int
      (
        dim_t   m,
        dim_t   n,
@@ -408,6 +466,41 @@ void bli_rntm_set_ways_from_rntm_sup
 	bli_rntm_set_ways_only( jc, pc, ic, jr, ir, rntm );
 }
 
+void bli_rntm_set_ways_from_rntm_sup
+     (
+       dim_t   m,
+       dim_t   n,
+       dim_t   k,
+       rntm_t* rntm
+     )
+{
+	// As with bli_rntm_set_ways_for_op(), reuse the ways computed by a
+	// previous call for the same problem shape and number of threads.
+	const bool use_dcache = !bli_rntm_ways_are_set( rntm );
+	dkey_t     key;
+	dim_t      vals[ BLIS_DCACHE_NUM_VALS ];
+
+	if ( use_dcache )
+	{
+		bli_dkey_init( BLIS_DEC_SUP_WAYS, 0, 0, 0, 0, m, n, k,
+		               bli_rntm_num_threads( rntm ), NULL, &key );
+
+		if ( bli_dcache_lookup( &key, vals ) )
+		{
+			bli_rntm_load_ways( vals, rntm );
+			return;
+		}
+	}
+
+	bli_rntm_set_ways_from_rntm_sup_int( m, n, k, rntm );
+
+	if ( use_dcache )
+	{
+		bli_rntm_save_ways( rntm, vals );
+		bli_dcache_insert( &key, vals );
+	}
+}
+
 void bli_rntm_print
      (
        const rntm_t* rntm
@@ -101,6 +101,13 @@ BLIS_INLINE dim_t bli_rntm_pr_ways( const rntm_t* rntm )
 	return bli_rntm_ways_for( BLIS_KR, rntm );
 }
 
+BLIS_INLINE bool bli_rntm_ways_are_set( const rntm_t* rntm )
+{
+	return bli_rntm_jc_ways( rntm ) > 0 || bli_rntm_pc_ways( rntm ) > 0 ||
+	       bli_rntm_ic_ways( rntm ) > 0 || bli_rntm_jr_ways( rntm ) > 0 ||
+	       bli_rntm_ir_ways( rntm ) > 0;
+}
+
 BLIS_INLINE bool bli_rntm_pack_a( const rntm_t* rntm )
 {
 	return ( bool )( rntm->pack_a );
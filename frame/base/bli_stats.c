@@ -0,0 +1,295 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#include "blis.h"
+
+static const char* stats_event_strs[ BLIS_STATS_NUM_EVENTS ] =
+{
+	"gemm", "gemmsup", "packa", "packb", "macroker", "barrier"
+};
+
+#ifdef BLIS_ENABLE_STATS
+// The categories of the events in the timeline (see bli_trace.h).
+static const char* stats_event_cats[ BLIS_STATS_NUM_EVENTS ] =
+{
+	"op", "op", "pack", "pack", "kernel", "barrier"
+};
+#endif
+
+const char* bli_stats_event_string( stats_event_t event )
+{
+	return stats_event_strs[ event ];
+}
+
+#ifdef BLIS_ENABLE_STATS
+
+// The statistics of each thread, with times in nanoseconds. Since threads of
+// concurrent operations may share an entry, entries are updated atomically.
+typedef struct
+{
+	uint64_t count[ BLIS_STATS_NUM_EVENTS ];
+	uint64_t time_ns[ BLIS_STATS_NUM_EVENTS ];
+	uint64_t hwc[ BLIS_STATS_NUM_EVENTS ][ BLIS_HWC_NUM_COUNTERS ];
+} stats_entry_t;
+
+static stats_entry_t stats_entries[ BLIS_STATS_MAX_THREADS ];
+static dim_t         stats_n_threads = 0;
+
+bool bli_stats_enabled = FALSE;
+
+// The id of the calling thread within the operation it is executing. Without
+// thread-local storage, all events are attributed to thread 0.
+#ifdef BLIS_HAS_THREAD_LOCAL
+static BLIS_THREAD_LOCAL dim_t stats_tid = 0;
+#endif
+
+double bli_stats_clock( void )
+{
+	return bli_clock();
+}
+
+void bli_stats_set_tid( dim_t tid )
+{
+#ifdef BLIS_HAS_THREAD_LOCAL
+	stats_tid = bli_min( tid, BLIS_STATS_MAX_THREADS - 1 );
+#endif
+}
+
+dim_t bli_stats_get_tid( void )
+{
+#ifdef BLIS_HAS_THREAD_LOCAL
+	return stats_tid;
+#else
+	return 0;
+#endif
+}
+
+double bli_stats_start( hwc_mark_t* mark )
+{
+	mark->mask = 0;
+
+	if ( bli_hwc_enabled && bli_stats_enabled ) bli_hwc_read( mark );
+
+	return bli_clock();
+}
+
+void bli_stats_add( stats_event_t event, double t0, const hwc_mark_t* mark )
+{
+	hwc_mark_t mark1;
+
+	mark1.mask = 0;
+
+	if ( mark->mask != 0 ) bli_hwc_read( &mark1 );
+
+	const dim_t  tid = bli_stats_get_tid();
+	const double t1  = bli_clock();
+
+	if ( bli_trace_enabled )
+		bli_trace_add( stats_event_strs[ event ], stats_event_cats[ event ], t0, t1 );
+
+	if ( !bli_stats_enabled ) return;
+
+	stats_entry_t* e = &stats_entries[ tid ];
+
+	const uint64_t ns = ( uint64_t )( bli_max( t1 - t0, 0.0 ) * 1.0e9 );
+
+	__atomic_fetch_add( &e->count[ event ], 1, __ATOMIC_RELAXED );
+	__atomic_fetch_add( &e->time_ns[ event ], ns, __ATOMIC_RELAXED );
+
+	// Accumulate the counters that were read both at the start and the end.
+	const uint32_t mask = mark->mask & mark1.mask;
+
+	for ( dim_t c = 0; c < BLIS_HWC_NUM_COUNTERS; ++c )
+		if ( ( mask >> c ) & 1 )
+			__atomic_fetch_add( &e->hwc[ event ][ c ],
+			                    mark1.val[ c ] - mark->val[ c ], __ATOMIC_RELAXED );
+
+	// Track the number of threads that recorded events.
+	dim_t n = __atomic_load_n( &stats_n_threads, __ATOMIC_RELAXED );
+
+	while ( n <= tid &&
+	        !__atomic_compare_exchange_n( &stats_n_threads, &n, tid + 1, TRUE,
+	                                      __ATOMIC_RELAXED, __ATOMIC_RELAXED ) )
+		;
+}
+
+#endif
+
+// -----------------------------------------------------------------------------
+
+void bli_stats_init( void )
+{
+	if ( bli_env_get_var( "BLIS_STATS", 0 ) != 0 ) bli_stats_enable();
+}
+
+void bli_stats_enable( void )
+{
+#ifdef BLIS_ENABLE_STATS
+	bli_stats_enabled = TRUE;
+#endif
+}
+
+void bli_stats_disable( void )
+{
+#ifdef BLIS_ENABLE_STATS
+	bli_stats_enabled = FALSE;
+#endif
+}
+
+bool bli_stats_is_enabled( void )
+{
+#ifdef BLIS_ENABLE_STATS
+	return bli_stats_enabled;
+#else
+	return FALSE;
+#endif
+}
+
+void bli_stats_reset( void )
+{
+#ifdef BLIS_ENABLE_STATS
+	for ( dim_t i = 0; i < BLIS_STATS_MAX_THREADS; ++i )
+	for ( dim_t j = 0; j < BLIS_STATS_NUM_EVENTS; ++j )
+	{
+		__atomic_store_n( &stats_entries[ i ].count[ j ],   0, __ATOMIC_RELAXED );
+		__atomic_store_n( &stats_entries[ i ].time_ns[ j ], 0, __ATOMIC_RELAXED );
+
+		for ( dim_t c = 0; c < BLIS_HWC_NUM_COUNTERS; ++c )
+			__atomic_store_n( &stats_entries[ i ].hwc[ j ][ c ], 0, __ATOMIC_RELAXED );
+	}
+
+	__atomic_store_n( &stats_n_threads, 0, __ATOMIC_RELAXED );
+#endif
+}
+
+dim_t bli_stats_num_threads( void )
+{
+#ifdef BLIS_ENABLE_STATS
+	return __atomic_load_n( &stats_n_threads, __ATOMIC_RELAXED );
+#else
+	return 0;
+#endif
+}
+
+void bli_stats_get_thread( dim_t tid, stats_t* stats )
+{
+	memset( stats, 0, sizeof( stats_t ) );
+
+#ifdef BLIS_ENABLE_STATS
+	if ( tid < 0 || tid >= BLIS_STATS_MAX_THREADS ) return;
+
+	for ( dim_t j = 0; j < BLIS_STATS_NUM_EVENTS; ++j )
+	{
+		stats->count[ j ] = __atomic_load_n( &stats_entries[ tid ].count[ j ], __ATOMIC_RELAXED );
+		stats->time[ j ]  = __atomic_load_n( &stats_entries[ tid ].time_ns[ j ], __ATOMIC_RELAXED ) * 1.0e-9;
+
+		for ( dim_t c = 0; c < BLIS_HWC_NUM_COUNTERS; ++c )
+			stats->hwc[ j ][ c ] = __atomic_load_n( &stats_entries[ tid ].hwc[ j ][ c ], __ATOMIC_RELAXED );
+	}
+#endif
+}
+
+void bli_stats_get( stats_t* stats )
+{
+	const dim_t n_threads = bli_stats_num_threads();
+
+	memset( stats, 0, sizeof( stats_t ) );
+
+	for ( dim_t i = 0; i < n_threads; ++i )
+	{
+		stats_t st;
+
+		bli_stats_get_thread( i, &st );
+
+		for ( dim_t j = 0; j < BLIS_STATS_NUM_EVENTS; ++j )
+		{
+			stats->count[ j ] += st.count[ j ];
+			stats->time[ j ]  += st.time[ j ];
+
+			for ( dim_t c = 0; c < BLIS_HWC_NUM_COUNTERS; ++c )
+				stats->hwc[ j ][ c ] += st.hwc[ j ][ c ];
+		}
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+static void bli_stats_fprint_one( FILE* file, const stats_t* stats )
+{
+	fprintf( file, "{" );
+
+	for ( dim_t j = 0; j < BLIS_STATS_NUM_EVENTS; ++j )
+	{
+		fprintf( file, "%s\"%s\": {\"count\": %llu, \"time\": %.9f",
+		         j == 0 ? " " : ", ", bli_stats_event_string( j ),
+		         ( unsigned long long )stats->count[ j ], stats->time[ j ] );
+
+		// Only the hardware counters that could be opened are written.
+		for ( dim_t c = 0; c < BLIS_HWC_NUM_COUNTERS; ++c )
+			if ( bli_hwc_is_available( c ) )
+				fprintf( file, ", \"%s\": %llu", bli_hwc_counter_string( c ),
+				         ( unsigned long long )stats->hwc[ j ][ c ] );
+
+		fprintf( file, "}" );
+	}
+
+	fprintf( file, " }" );
+}
+
+void bli_stats_fprint( FILE* file )
+{
+	const dim_t n_threads = bli_stats_num_threads();
+	stats_t     stats;
+
+	fprintf( file, "{\n  \"enabled\": %s,\n  \"threads\": [",
+	         bli_stats_is_enabled() ? "true" : "false" );
+
+	for ( dim_t i = 0; i < n_threads; ++i )
+	{
+		bli_stats_get_thread( i, &stats );
+
+		fprintf( file, "%s\n    ", i == 0 ? "" : "," );
+		bli_stats_fprint_one( file, &stats );
+	}
+
+	bli_stats_get( &stats );
+
+	fprintf( file, "%s],\n  \"total\": ", n_threads > 0 ? "\n  " : "" );
+	bli_stats_fprint_one( file, &stats );
+	fprintf( file, "\n}\n" );
+}
+
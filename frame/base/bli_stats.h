@@ -0,0 +1,133 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef BLIS_STATS_H
+#define BLIS_STATS_H
+
+//
+// Performance counters and timers for level-3 operations. Statistics are
+// collected only if BLIS was configured with --enable-stats and collection
+// was enabled at runtime, either with bli_stats_enable() or by setting the
+// BLIS_STATS environment variable to a nonzero value before BLIS is
+// initialized.
+//
+// Each event is counted and timed separately for each
+// thread of a multithreaded operation, as identified by its thread id within
+// the operation. Events of concurrent operations with the same thread id are
+// accumulated together.
+//
+
+typedef enum
+{
+	BLIS_STATS_GEMM = 0, // calls to the conventional gemm code path
+	BLIS_STATS_GEMMSUP,  // calls handled by the sup gemm code path
+	BLIS_STATS_PACKA,    // packing of A (bli_l3_packa())
+	BLIS_STATS_PACKB,    // packing of B (bli_l3_packb())
+	BLIS_STATS_MACROKER, // macrokernels of the conventional code path
+	BLIS_STATS_BARRIER,  // thread barriers (bli_thread_barrier())
+} stats_event_t;
+
+#define BLIS_STATS_NUM_EVENTS 6
+
+// The number of threads whose statistics are kept separately; threads with
+// larger ids are accumulated with the last of them.
+#define BLIS_STATS_MAX_THREADS 128
+
+typedef struct
+{
+	uint64_t count[ BLIS_STATS_NUM_EVENTS ];
+	double   time[ BLIS_STATS_NUM_EVENTS ]; // in seconds
+
+	// The hardware counters, if enabled (see bli_hwc.h).
+	uint64_t hwc[ BLIS_STATS_NUM_EVENTS ][ BLIS_HWC_NUM_COUNTERS ];
+} stats_t;
+
+BLIS_EXPORT_BLIS void bli_stats_enable( void );
+BLIS_EXPORT_BLIS void bli_stats_disable( void );
+BLIS_EXPORT_BLIS bool bli_stats_is_enabled( void );
+
+// Clear the statistics of all threads.
+BLIS_EXPORT_BLIS void bli_stats_reset( void );
+
+// Query the statistics summed over all threads, or those of one thread.
+// bli_stats_num_threads() returns one more than the largest thread id for
+// which an event was recorded since the last reset.
+BLIS_EXPORT_BLIS void  bli_stats_get( stats_t* stats );
+BLIS_EXPORT_BLIS void  bli_stats_get_thread( dim_t tid, stats_t* stats );
+BLIS_EXPORT_BLIS dim_t bli_stats_num_threads( void );
+
+BLIS_EXPORT_BLIS const char* bli_stats_event_string( stats_event_t event );
+
+// Write the statistics of each thread and their sum to a file as a JSON
+// object.
+BLIS_EXPORT_BLIS void bli_stats_fprint( FILE* file );
+
+// -- Internal interface --
+
+void bli_stats_init( void );
+
+#ifdef BLIS_ENABLE_STATS
+
+extern bool bli_stats_enabled;
+
+double bli_stats_clock( void );
+double bli_stats_start( hwc_mark_t* mark );
+void   bli_stats_set_tid( dim_t tid );
+dim_t  bli_stats_get_tid( void );
+void   bli_stats_add( stats_event_t event, double t0, const hwc_mark_t* mark );
+
+// Record an event that begins at BLIS_STATS_START() and ends at
+// BLIS_STATS_STOP(), in the statistics and, if tracing is enabled, in the
+// timeline (see bli_trace.h). When both are disabled at runtime, these cost
+// two loads and one branch each.
+#define BLIS_STATS_START( t0 ) \
+	hwc_mark_t t0##_hwc; \
+	const double t0 = ( ( bli_stats_enabled || bli_trace_enabled ) ? \
+	                    bli_stats_start( &t0##_hwc ) : -1.0 )
+#define BLIS_STATS_STOP( event, t0 ) \
+	do { if ( t0 >= 0.0 ) bli_stats_add( event, t0, &t0##_hwc ); } while ( 0 )
+#define BLIS_STATS_SET_TID( tid ) \
+	bli_stats_set_tid( tid )
+
+#else
+
+#define BLIS_STATS_START( t0 )
+#define BLIS_STATS_STOP( event, t0 )
+#define BLIS_STATS_SET_TID( tid )
+
+#endif
+
+#endif
+
@@ -0,0 +1,236 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#include "blis.h"
+
+// The file named by the BLIS_TRACE environment variable, if any.
+static char* trace_path = NULL;
+
+#ifdef BLIS_ENABLE_STATS
+
+typedef struct
+{
+	const char* name;
+	const char* cat;
+	double      t0;
+	double      t1;
+} trace_event_t;
+
+// A ring buffer of the events of one thread. Slots are claimed by atomically
+// incrementing head, so threads of concurrent operations that share a buffer
+// never write to the same slot (unless the buffer wraps around).
+typedef struct
+{
+	uint64_t      head;
+	trace_event_t events[ BLIS_TRACE_BUF_LEN ];
+} trace_buf_t;
+
+static trace_buf_t* trace_bufs[ BLIS_STATS_MAX_THREADS ];
+
+bool bli_trace_enabled = FALSE;
+
+static trace_buf_t* bli_trace_buf( dim_t tid )
+{
+	trace_buf_t* buf = __atomic_load_n( &trace_bufs[ tid ], __ATOMIC_ACQUIRE );
+
+	if ( buf != NULL ) return buf;
+
+	// Allocate the buffer of this thread on its first event. If another
+	// thread installs a buffer first, use that one instead.
+	err_t r_val;
+	trace_buf_t* buf_new = bli_malloc_intl( sizeof( trace_buf_t ), &r_val );
+
+	if ( buf_new == NULL ) return NULL;
+
+	buf_new->head = 0;
+
+	if ( !__atomic_compare_exchange_n( &trace_bufs[ tid ], &buf, buf_new, FALSE,
+	                                   __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE ) )
+	{
+		bli_free_intl( buf_new );
+		return buf;
+	}
+
+	return buf_new;
+}
+
+void bli_trace_add( const char* name, const char* cat, double t0, double t1 )
+{
+	trace_buf_t* buf = bli_trace_buf( bli_stats_get_tid() );
+
+	if ( buf == NULL ) return;
+
+	const uint64_t i = __atomic_fetch_add( &buf->head, 1, __ATOMIC_RELAXED );
+
+	trace_event_t* e = &buf->events[ i % BLIS_TRACE_BUF_LEN ];
+
+	e->name = name;
+	e->cat  = cat;
+	e->t0   = t0;
+	e->t1   = t1;
+}
+
+#endif
+
+// -----------------------------------------------------------------------------
+
+void bli_trace_init( void )
+{
+	const char* path = getenv( "BLIS_TRACE" );
+
+	if ( path == NULL || *path == '\0' ) return;
+
+	err_t r_val;
+	trace_path = bli_malloc_intl( strlen( path ) + 1, &r_val );
+
+	if ( trace_path == NULL ) return;
+
+	strcpy( trace_path, path );
+
+	bli_trace_enable();
+}
+
+void bli_trace_finalize( void )
+{
+	if ( trace_path != NULL )
+	{
+		bli_trace_write_file( trace_path );
+
+		bli_free_intl( trace_path );
+		trace_path = NULL;
+	}
+
+#ifdef BLIS_ENABLE_STATS
+	bli_trace_enabled = FALSE;
+
+	for ( dim_t i = 0; i < BLIS_STATS_MAX_THREADS; ++i )
+	{
+		if ( trace_bufs[ i ] != NULL ) bli_free_intl( trace_bufs[ i ] );
+		trace_bufs[ i ] = NULL;
+	}
+#endif
+}
+
+void bli_trace_enable( void )
+{
+#ifdef BLIS_ENABLE_STATS
+	bli_trace_enabled = TRUE;
+#endif
+}
+
+void bli_trace_disable( void )
+{
+#ifdef BLIS_ENABLE_STATS
+	bli_trace_enabled = FALSE;
+#endif
+}
+
+bool bli_trace_is_enabled( void )
+{
+#ifdef BLIS_ENABLE_STATS
+	return bli_trace_enabled;
+#else
+	return FALSE;
+#endif
+}
+
+void bli_trace_reset( void )
+{
+#ifdef BLIS_ENABLE_STATS
+	for ( dim_t i = 0; i < BLIS_STATS_MAX_THREADS; ++i )
+		if ( trace_bufs[ i ] != NULL )
+			__atomic_store_n( &trace_bufs[ i ]->head, 0, __ATOMIC_RELAXED );
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_trace_fprint( FILE* file )
+{
+	uint64_t n_dropped = 0;
+	bool     first     = TRUE;
+
+	fprintf( file, "{\"traceEvents\": [" );
+
+#ifdef BLIS_ENABLE_STATS
+	for ( dim_t tid = 0; tid < BLIS_STATS_MAX_THREADS; ++tid )
+	{
+		const trace_buf_t* buf = trace_bufs[ tid ];
+
+		if ( buf == NULL ) continue;
+
+		const uint64_t head = __atomic_load_n( &buf->head, __ATOMIC_ACQUIRE );
+		const uint64_t n    = bli_min( head, BLIS_TRACE_BUF_LEN );
+
+		if ( n == 0 ) continue;
+
+		n_dropped += head - n;
+
+		fprintf( file, "%s\n{\"name\": \"thread_name\", \"ph\": \"M\", "
+		               "\"pid\": 0, \"tid\": %ld, \"args\": {\"name\": \"thread %ld\"}}",
+		         first ? "" : ",", ( long )tid, ( long )tid );
+		first = FALSE;
+
+		// Timestamps and durations are in microseconds.
+		for ( uint64_t i = head - n; i < head; ++i )
+		{
+			const trace_event_t* e = &buf->events[ i % BLIS_TRACE_BUF_LEN ];
+
+			fprintf( file, ",\n{\"name\": \"%s\", \"cat\": \"%s\", \"ph\": \"X\", "
+			               "\"ts\": %.3f, \"dur\": %.3f, \"pid\": 0, \"tid\": %ld}",
+			         e->name, e->cat, e->t0 * 1.0e6,
+			         bli_max( e->t1 - e->t0, 0.0 ) * 1.0e6, ( long )tid );
+		}
+	}
+#endif
+
+	fprintf( file, "%s],\n\"displayTimeUnit\": \"ns\",\n"
+	               "\"otherData\": {\"dropped_events\": %llu}}\n",
+	         first ? "" : "\n", ( unsigned long long )n_dropped );
+}
+
+err_t bli_trace_write_file( const char* path )
+{
+	FILE* fp = fopen( path, "w" );
+
+	if ( fp == NULL ) return BLIS_FAILURE;
+
+	bli_trace_fprint( fp );
+
+	return fclose( fp ) == 0 ? BLIS_SUCCESS : BLIS_FAILURE;
+}
+
@@ -0,0 +1,98 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+#ifndef BLIS_TRACE_H
+#define BLIS_TRACE_H
+
+//
+// A per-thread timeline of level-3 operations, written in the Chrome trace
+// event format (which can be viewed with chrome://tracing or Perfetto).
+// Events are recorded only if BLIS was configured with --enable-stats and
+// tracing was enabled at runtime, either with bli_trace_enable() or by
+// setting the BLIS_TRACE environment variable to the name of a file, to which
+// the timeline is then written by bli_finalize().
+//
+// The events recorded are the iterations of the partitioning loops of the
+// conventional (bli_*_blk_var*()) and sup (bli_gemmsup_ref_var*()) code
+// paths, the macrokernels, packing, thread barriers, and the operations
+// themselves (see bli_stats.h). Each thread records its events in its own
+// ring buffer, which keeps only the most recent BLIS_TRACE_BUF_LEN events.
+// As with bli_stats, threads are identified by their id within the operation
+// they execute.
+//
+
+#define BLIS_TRACE_BUF_LEN 16384
+
+BLIS_EXPORT_BLIS void bli_trace_enable( void );
+BLIS_EXPORT_BLIS void bli_trace_disable( void );
+BLIS_EXPORT_BLIS bool bli_trace_is_enabled( void );
+
+// Discard the events recorded so far.
+BLIS_EXPORT_BLIS void bli_trace_reset( void );
+
+// Write the events recorded so far as a Chrome trace JSON object, to a file
+// stream or to the file at path. These should be called only while no
+// level-3 operation is in progress.
+BLIS_EXPORT_BLIS void  bli_trace_fprint( FILE* file );
+BLIS_EXPORT_BLIS err_t bli_trace_write_file( const char* path );
+
+// -- Internal interface --
+
+void bli_trace_init( void );
+void bli_trace_finalize( void );
+
+#ifdef BLIS_ENABLE_STATS
+
+extern bool bli_trace_enabled;
+
+void bli_trace_add( const char* name, const char* cat, double t0, double t1 );
+
+// Record the event name, of category cat, that begins at BLIS_TRACE_START()
+// and ends at BLIS_TRACE_STOP().
+#define BLIS_TRACE_START( t0 ) \
+	const double t0 = ( bli_trace_enabled ? bli_stats_clock() : -1.0 )
+#define BLIS_TRACE_STOP( name, cat, t0 ) \
+	do { if ( t0 >= 0.0 ) bli_trace_add( name, cat, t0, bli_stats_clock() ); } while ( 0 )
+
+#else
+
+#define BLIS_TRACE_START( t0 )
+#define BLIS_TRACE_STOP( name, cat, t0 )
+
+#endif
+
+#endif
+
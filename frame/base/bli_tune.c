@@ -0,0 +1,496 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+// -- Tuning profiles ----------------------------------------------------------
+//
+// A tuning profile is a plain text file that overrides the cache blocksizes
+// and sup thresholds that a sub-configuration's bli_cntx_init_*() function
+// registers in its context. Each non-blank line (after removing any comment
+// that begins with '#') has one of the following forms:
+//
+//   arch <name>
+//   <dt> <bsname> <value>
+//
+// where <dt> is one of s, d, c, or z; <bsname> is one of the names in the
+// table below; and <value> is the new default blocksize. An 'arch' line
+// restricts the profile to the named sub-configuration; a profile written
+// for a different sub-configuration is ignored in its entirety.
+
+typedef struct
+{
+	const char* name;
+	bszid_t     bs_id;
+} tune_bsz_t;
+
+static const tune_bsz_t tune_bszs[] =
+{
+	{ "MC",     BLIS_MC     },
+	{ "KC",     BLIS_KC     },
+	{ "NC",     BLIS_NC     },
+	{ "MC_SUP", BLIS_MC_SUP },
+	{ "KC_SUP", BLIS_KC_SUP },
+	{ "NC_SUP", BLIS_NC_SUP },
+	{ "MT",     BLIS_MT     },
+	{ "NT",     BLIS_NT     },
+	{ "KT",     BLIS_KT     },
+};
+
+static const dim_t tune_n_bszs = sizeof( tune_bszs ) / sizeof( tune_bsz_t );
+
+static const char tune_dt_chars[ BLIS_NUM_FP_TYPES ] = { 's', 'c', 'd', 'z' };
+
+static bool bli_tune_is_thresh( bszid_t bs_id )
+{
+	return bs_id == BLIS_MT || bs_id == BLIS_NT || bs_id == BLIS_KT;
+}
+
+static const tune_bsz_t* bli_tune_find_bsz( const char* name )
+{
+	for ( dim_t i = 0; i < tune_n_bszs; ++i )
+		if ( strcmp( tune_bszs[ i ].name, name ) == 0 ) return &tune_bszs[ i ];
+
+	return NULL;
+}
+
+static bool bli_tune_find_dt( const char* str, num_t* dt )
+{
+	if ( strlen( str ) != 1 ) return FALSE;
+
+	for ( num_t i = 0; i < BLIS_NUM_FP_TYPES; ++i )
+	{
+		if ( tune_dt_chars[ i ] == str[ 0 ] ) { *dt = i; return TRUE; }
+	}
+
+	return FALSE;
+}
+
+// Apply a single blocksize override to a context, returning FALSE (and
+// leaving the context untouched) if the value is not admissible.
+static bool bli_tune_set_bsz
+     (
+       num_t   dt,
+       bszid_t bs_id,
+       dim_t   value,
+       cntx_t* cntx
+     )
+{
+	const dim_t   def_old = bli_cntx_get_blksz_def_dt( dt, bs_id, cntx );
+	const dim_t   max_old = bli_cntx_get_blksz_max_dt( dt, bs_id, cntx );
+
+	// Thresholds are not blocksizes: any value is admissible, and a negative
+	// value disables sup for the dimension (which is how the reference
+	// contexts disable sup for datatypes that lack sup kernels).
+	if ( bli_tune_is_thresh( bs_id ) )
+	{
+		bli_cntx_set_blksz_def_dt( dt, bs_id, value, cntx );
+		bli_cntx_set_blksz_max_dt( dt, bs_id, value, cntx );
+		return TRUE;
+	}
+
+	// A cache blocksize must be a positive multiple of the register blocksize
+	// that the context associates with it (e.g. MR for MC). A blocksize whose
+	// multiple is unset is not used by the sub-configuration.
+	const dim_t bmult = bli_cntx_get_bmult_dt( dt, bs_id, cntx );
+
+	if ( value <= 0 || bmult <= 0 || value % bmult != 0 ) return FALSE;
+
+	// Scale the maximum blocksize along with the default so that the edge
+	// case merging described in bli_blksz.h keeps its relative slack.
+	dim_t max_new = value;
+
+	if ( def_old > 0 && max_old > def_old )
+		max_new = ( dim_t )( ( ( double )max_old / def_old ) * value );
+
+	bli_cntx_set_blksz_def_dt( dt, bs_id, value,   cntx );
+	bli_cntx_set_blksz_max_dt( dt, bs_id, max_new, cntx );
+
+	return TRUE;
+}
+
+// Apply the sup thresholds of a "thresh" line, whose fields th[] are the
+// number of threads followed by MT, NT, and KT.
+static bool bli_tune_set_thresh( const char* dt_str, const char* stor_str, const long* th, cntx_t* cntx )
+{
+	num_t   dt;
+	stor3_t stor_id;
+
+	if ( !bli_tune_find_dt( dt_str, &dt ) ) return FALSE;
+
+	for ( stor_id = BLIS_RRR; stor_id < BLIS_XXX; ++stor_id )
+		if ( strcmp( stor_str, bli_stor3_string( stor_id ) ) == 0 ) break;
+
+	if ( stor_id == BLIS_XXX ) return FALSE;
+
+	if ( th[ 0 ] < 1 || th[ 1 ] < 1 || th[ 2 ] < 1 || th[ 3 ] < 1 ) return FALSE;
+
+	bli_cntx_set_l3_sup_thresh_st( dt, stor_id, bli_cntx_l3_sup_nt_class( th[ 0 ] ),
+	                               th[ 1 ], th[ 2 ], th[ 3 ], cntx );
+
+	return TRUE;
+}
+
+err_t bli_tune_read_file( const char* path, cntx_t* cntx )
+{
+	if ( path == NULL || cntx == NULL ) return BLIS_FAILURE;
+
+	FILE* fp = fopen( path, "r" );
+
+	if ( fp == NULL ) return BLIS_FAILURE;
+
+	// Stage the overrides on a copy of the context so that a profile is
+	// applied either in full or not at all.
+	cntx_t cntx_l = *cntx;
+	err_t  r_val  = BLIS_SUCCESS;
+	char   line[ 256 ];
+	dim_t  n_line = 0;
+
+	while ( fgets( line, sizeof( line ), fp ) != NULL )
+	{
+		char  tok0[ 64 ], tok1[ 64 ], tok2[ 64 ];
+		long  th[ 4 ];
+		char* hash = strchr( line, '#' );
+
+		n_line += 1;
+
+		if ( hash != NULL ) *hash = '\0';
+
+		const int n_tok = sscanf( line, "%63s %63s %63s %ld %ld %ld %ld", tok0, tok1, tok2,
+		                          &th[ 0 ], &th[ 1 ], &th[ 2 ], &th[ 3 ] );
+
+		if ( n_tok <= 0 ) continue;
+
+		if ( n_tok >= 2 && strcmp( tok1, "thresh" ) == 0 )
+		{
+			if ( n_tok != 7 || !bli_tune_set_thresh( tok0, tok2, th, &cntx_l ) )
+			{
+				bli_arch_log( "tuning profile '%s': rejecting line %d.\n",
+				              path, ( int )n_line );
+				r_val = BLIS_FAILURE;
+				break;
+			}
+
+			continue;
+		}
+
+		if ( n_tok == 2 && strcmp( tok0, "arch" ) == 0 )
+		{
+			const char* arch_str = bli_arch_string( bli_arch_query_id() );
+
+			if ( strcmp( tok1, arch_str ) != 0 )
+			{
+				bli_arch_log( "tuning profile '%s' is for '%s', not '%s'.\n",
+				              path, tok1, arch_str );
+				r_val = BLIS_FAILURE;
+				break;
+			}
+
+			continue;
+		}
+
+		num_t             dt;
+		const tune_bsz_t* bsz   = NULL;
+		char*             end   = NULL;
+		long              value = 0;
+
+		if ( n_tok == 3 )
+		{
+			bsz   = bli_tune_find_bsz( tok1 );
+			value = strtol( tok2, &end, 10 );
+		}
+
+		if ( bsz == NULL || end == tok2 || *end != '\0' ||
+		     !bli_tune_find_dt( tok0, &dt ) ||
+		     !bli_tune_set_bsz( dt, bsz->bs_id, ( dim_t )value, &cntx_l ) )
+		{
+			bli_arch_log( "tuning profile '%s': rejecting line %d.\n",
+			              path, ( int )n_line );
+			r_val = BLIS_FAILURE;
+			break;
+		}
+	}
+
+	fclose( fp );
+
+	if ( r_val == BLIS_SUCCESS )
+	{
+		*cntx = cntx_l;
+
+		// Discard any dispatch decisions made with the old blocksizes and
+		// thresholds.
+		bli_dcache_invalidate();
+	}
+
+	return r_val;
+}
+
+err_t bli_tune_write_file( const char* path, const cntx_t* cntx )
+{
+	if ( path == NULL || cntx == NULL ) return BLIS_FAILURE;
+
+	FILE* fp = fopen( path, "w" );
+
+	if ( fp == NULL ) return BLIS_FAILURE;
+
+	fprintf( fp, "# BLIS tuning profile\n" );
+	fprintf( fp, "arch %s\n", bli_arch_string( bli_arch_query_id() ) );
+
+	for ( num_t dt = BLIS_FLOAT; dt <= BLIS_DCOMPLEX; ++dt )
+	{
+		for ( dim_t i = 0; i < tune_n_bszs; ++i )
+		{
+			const tune_bsz_t* bsz   = &tune_bszs[ i ];
+			const dim_t       value = bli_cntx_get_blksz_def_dt( dt, bsz->bs_id, cntx );
+
+			// Skip blocksizes that the sub-configuration does not use, since
+			// they would be rejected when the profile is read back.
+			if ( !bli_tune_is_thresh( bsz->bs_id ) &&
+			     ( value <= 0 || bli_cntx_get_bmult_dt( dt, bsz->bs_id, cntx ) <= 0 ) )
+				continue;
+
+			fprintf( fp, "%c %-6s %ld\n", tune_dt_chars[ dt ], bsz->name,
+			         ( long )value );
+		}
+	}
+
+	// Write the calibrated sup thresholds, if any, naming each thread count
+	// class by the smallest number of threads in it.
+	for ( num_t dt = BLIS_FLOAT; dt <= BLIS_DCOMPLEX; ++dt )
+	for ( stor3_t stor_id = BLIS_RRR; stor_id < BLIS_XXX; ++stor_id )
+	for ( dim_t c = 0; c < BLIS_NUM_SUP_NT_CLASSES; ++c )
+	{
+		const dim_t* t = bli_cntx_get_l3_sup_thresh_st( dt, stor_id, c, cntx );
+
+		if ( t[ 0 ] == 0 ) continue;
+
+		fprintf( fp, "%c thresh %s %ld %ld %ld %ld\n", tune_dt_chars[ dt ],
+		         bli_stor3_string( stor_id ), ( long )1 << c,
+		         ( long )t[ 0 ], ( long )t[ 1 ], ( long )t[ 2 ] );
+	}
+
+	const bool failed = ferror( fp );
+
+	if ( fclose( fp ) != 0 || failed ) return BLIS_FAILURE;
+
+	return BLIS_SUCCESS;
+}
+
+// -- Analytical blocksizes -----------------------------------------------------
+//
+// When no tuning profile is given and the sub-configuration's cache blocksizes
+// are untuned placeholders (or BLIS_CACHE_MODEL=1 is set), the blocksizes are
+// derived from the discovered cache hierarchy with the analytical model of
+// Low et al. [1]: KC is chosen so that a micropanel of A occupies a fraction
+// of the ways of the L1 cache (leaving room for a micropanel of B and one way
+// for C), MC so that a block of A fills the L2 cache less the ways needed by
+// a micropanel of B and one way for C, and NC likewise for a panel of B in
+// the L3 cache.
+//
+// With several threads, each cache is shared among the threads that run on
+// the processors that share it, and each thread group that works on a
+// distinct block or panel needs its own copy in the cache. For example, the
+// threads that share a block of A are those that differ only in their jr and
+// ir ways, so an L2 cache shared by s threads holds ceil(s/(jr*ir)) blocks
+// of A. The ways of each cache are divided among such copies.
+//
+// [1] T. M. Low, F. D. Igual, T. M. Smith, and E. S. Quintana-Orti.
+//     Analytical Modeling Is Enough for High-Performance BLIS. ACM TOMS,
+//     43(2), 2016.
+
+// Return the number of copies of an object, shared by groups of g threads,
+// that a cache holds when nt threads run.
+static dim_t bli_tune_cache_copies( const cpuid_cache_t* cache, dim_t nt, dim_t g )
+{
+	const dim_t s = bli_min( ( dim_t )cache->n_sharing, nt );
+
+	return bli_max( ( s + g - 1 ) / g, 1 );
+}
+
+static const cpuid_cache_t* bli_tune_find_cache( const cpuid_cache_t* caches, dim_t n_caches, uint32_t level )
+{
+	for ( dim_t i = 0; i < n_caches; ++i )
+		if ( caches[ i ].level == level ) return &caches[ i ];
+
+	return NULL;
+}
+
+// Round a modeled blocksize down to a multiple of the register blocksize that
+// the context associates with it, and keep it within a factor of four of the
+// sub-configuration's default so that an implausible cache description (as
+// some hypervisors report) cannot lead to a pathological blocking.
+static void bli_tune_set_model_bsz( num_t dt, bszid_t bs_id, double value, cntx_t* cntx )
+{
+	const dim_t def   = bli_cntx_get_blksz_def_dt( dt, bs_id, cntx );
+	const dim_t bmult = bli_cntx_get_bmult_dt( dt, bs_id, cntx );
+
+	if ( def <= 0 || bmult <= 0 || !( value > 0.0 ) ) return;
+
+	dim_t bs = ( dim_t )bli_min( value, ( double )( 4 * def ) );
+
+	bs = bli_max( bs, def / 4 );
+	bs = bli_max( ( bs / bmult ) * bmult, bmult );
+
+	bli_tune_set_bsz( dt, bs_id, bs, cntx );
+}
+
+void bli_tune_cache_model
+     (
+       const cpuid_cache_t* caches,
+             dim_t          n_caches,
+       const rntm_t*        rntm,
+             cntx_t*        cntx
+     )
+{
+	const cpuid_cache_t* l1 = bli_tune_find_cache( caches, n_caches, 1 );
+	const cpuid_cache_t* l2 = bli_tune_find_cache( caches, n_caches, 2 );
+	const cpuid_cache_t* l3 = bli_tune_find_cache( caches, n_caches, 3 );
+
+	if ( l1 == NULL || l2 == NULL ) return;
+
+	const dim_t jc = bli_max( bli_rntm_jc_ways( rntm ), 1 );
+	const dim_t pc = bli_max( bli_rntm_pc_ways( rntm ), 1 );
+	const dim_t ic = bli_max( bli_rntm_ic_ways( rntm ), 1 );
+	const dim_t jr = bli_max( bli_rntm_jr_ways( rntm ), 1 );
+	const dim_t ir = bli_max( bli_rntm_ir_ways( rntm ), 1 );
+	const dim_t nt = jc * pc * ic * jr * ir;
+
+	// The capacity of one way of each cache.
+	const double way1 = ( double )l1->sets * l1->line_size;
+	const double way2 = ( double )l2->sets * l2->line_size;
+
+	// The ways of each cache available to one copy of the object it holds:
+	// a micropanel of B (shared by the ir ways) in L1, a block of A (shared
+	// by the jr and ir ways) in L2, and a panel of B (shared by the ic, jr,
+	// and ir ways) in L3.
+	const dim_t  c1 = bli_tune_cache_copies( l1, nt, ir );
+	const dim_t  c2 = bli_tune_cache_copies( l2, nt, jr * ir );
+	const double w1 = ( double )l1->ways / c1;
+	const double w2 = ( double )l2->ways / c2;
+
+	for ( num_t dt = BLIS_FLOAT; dt <= BLIS_DCOMPLEX; ++dt )
+	{
+		const dim_t  mr = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx );
+		const dim_t  nr = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+		const double sz = ( double )bli_dt_size( dt );
+
+		if ( mr <= 0 || nr <= 0 ) continue;
+
+		// KC: a micropanel of A occupies C_Ar ways of the L1 cache.
+		const double c_ar = bli_max( floor( ( w1 - 1.0 ) / ( 1.0 + ( double )nr / mr ) ), 1.0 );
+		const double kc   = floor( c_ar * way1 / ( mr * sz ) );
+
+		if ( kc < 1.0 ) continue;
+
+		// MC: a block of A occupies the ways of the L2 cache not needed by a
+		// micropanel of B and C.
+		const double c_br2 = ceil( kc * nr * sz / way2 );
+		const double c_ac  = bli_max( floor( w2 - 1.0 - c_br2 ), 1.0 );
+		const double mc    = floor( c_ac * way2 / ( kc * sz ) );
+
+		bli_tune_set_model_bsz( dt, BLIS_KC, kc, cntx );
+		bli_tune_set_model_bsz( dt, BLIS_MC, mc, cntx );
+
+		if ( l3 == NULL ) continue;
+
+		// NC: a panel of B occupies the ways of the L3 cache not needed by
+		// the blocks of A that are computed with it and by C.
+		const double way3  = ( double )l3->sets * l3->line_size;
+		const dim_t  c3    = bli_tune_cache_copies( l3, nt, ic * jr * ir );
+		const double a3    = ( double )bli_tune_cache_copies( l3, nt, jr * ir ) / c3;
+		const double w3    = ( double )l3->ways / c3;
+		const double c_ac3 = ceil( a3 * mc * kc * sz / way3 );
+		const double c_bc  = bli_max( floor( w3 - 1.0 - c_ac3 ), 1.0 );
+		const double nc    = floor( c_bc * way3 / ( kc * sz ) );
+
+		bli_tune_set_model_bsz( dt, BLIS_NC, nc, cntx );
+	}
+
+	bli_dcache_invalidate();
+}
+
+void bli_tune_init( cntx_t* cntx )
+{
+	const char* path = getenv( "BLIS_TUNING_FILE" );
+
+	if ( path != NULL && *path != '\0' )
+	{
+		if ( bli_tune_read_file( path, cntx ) == BLIS_SUCCESS )
+		{
+			bli_arch_log( "applied tuning profile '%s'.\n", path );
+			return;
+		}
+
+		char msg[ 320 ];
+		snprintf( msg, sizeof( msg ), "Ignoring tuning profile '%s'.", path );
+		bli_print_msg( msg, __FILE__, __LINE__ );
+	}
+
+	// Without a profile, the cache blocksizes are derived from the cache
+	// hierarchy if the sub-configuration flags its own as untuned. Setting
+	// BLIS_CACHE_MODEL overrides this: 1 applies the model to any
+	// sub-configuration, and 0 keeps the sub-configuration's blocksizes.
+	const gint_t model = bli_env_get_var( "BLIS_CACHE_MODEL", -1 );
+
+	if ( model == 0 ) return;
+	if ( model <  0 && !bli_cntx_untuned_blkszs( cntx ) ) return;
+
+	cpuid_cache_t caches[ BLIS_CPUID_MAX_CACHES ];
+	const dim_t   n_caches = bli_cpuid_query_caches( caches, BLIS_CPUID_MAX_CACHES );
+
+	if ( n_caches == 0 ) return;
+
+	// Model the thread factorization of a large gemm with the threading
+	// requested in the environment. Note that bli_thread_init() has not yet
+	// run, so the environment is read here.
+	rntm_t rntm;
+	bli_rntm_init( &rntm );
+	bli_thread_init_rntm_from_env( &rntm );
+	bli_rntm_set_ways_for_op( BLIS_GEMM, BLIS_LEFT, 4096, 4096, 4096, &rntm );
+
+	bli_tune_cache_model( caches, n_caches, &rntm, cntx );
+
+	for ( dim_t i = 0; i < n_caches; ++i )
+		bli_arch_log( "L%d cache: %u bytes, %u-way, %u sets, %u-byte lines, "
+		              "shared by %u.\n", ( int )caches[ i ].level,
+		              caches[ i ].size, caches[ i ].ways, caches[ i ].sets,
+		              caches[ i ].line_size, caches[ i ].n_sharing );
+
+	bli_arch_log( "modeled dgemm blocksizes: MC %d KC %d NC %d.\n",
+	              ( int )bli_cntx_get_blksz_def_dt( BLIS_DOUBLE, BLIS_MC, cntx ),
+	              ( int )bli_cntx_get_blksz_def_dt( BLIS_DOUBLE, BLIS_KC, cntx ),
+	              ( int )bli_cntx_get_blksz_def_dt( BLIS_DOUBLE, BLIS_NC, cntx ) );
+}
+
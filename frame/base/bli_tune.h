@@ -0,0 +1,67 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef BLIS_TUNE_H
+#define BLIS_TUNE_H
+
+// Read a tuning profile from path and, if every entry in the profile is
+// valid for the given context, apply its blocksizes and sup thresholds to
+// the context. The context is left untouched if any entry is rejected.
+BLIS_EXPORT_BLIS err_t bli_tune_read_file( const char* path, cntx_t* cntx );
+
+// Write the tunable blocksizes and calibrated sup thresholds of a context
+// to path as a tuning profile that may later be read by
+// bli_tune_read_file().
+BLIS_EXPORT_BLIS err_t bli_tune_write_file( const char* path, const cntx_t* cntx );
+
+// Derive the cache blocksizes (MC, KC, NC) of a context from a description
+// of the cache hierarchy and the thread factorization given by rntm.
+BLIS_EXPORT_BLIS void bli_tune_cache_model
+     (
+       const cpuid_cache_t* caches,
+             dim_t          n_caches,
+       const rntm_t*        rntm,
+             cntx_t*        cntx
+     );
+
+// Apply the profile named by the BLIS_TUNING_FILE environment variable (if
+// set) to a context or, failing that, the blocksizes modeled from the cache
+// hierarchy of the running processor if the context's blocksizes are untuned
+// (or if BLIS_CACHE_MODEL=1; BLIS_CACHE_MODEL=0 disables the model). Called
+// by bli_gks_init() for the native context of the running architecture.
+void bli_tune_init( cntx_t* cntx );
+
+#endif
+
@@ -80,6 +80,22 @@ void bli_castm
 	if ( bli_error_checking_is_enabled() )
 		bli_castm_check( a, b );
 
+	// Casts involving the 16-bit floating-point storage types are only
+	// supported to and from single precision real.
+	if ( bli_is_half( dt_a ) || bli_is_half( dt_b ) )
+	{
+		FUNCPTR_T f = NULL;
+
+		if      ( dt_a == BLIS_BFLOAT16 && dt_b == BLIS_FLOAT    ) f = bli_bscastm;
+		else if ( dt_a == BLIS_FLOAT16  && dt_b == BLIS_FLOAT    ) f = bli_hscastm;
+		else if ( dt_a == BLIS_FLOAT    && dt_b == BLIS_BFLOAT16 ) f = bli_sbcastm;
+		else if ( dt_a == BLIS_FLOAT    && dt_b == BLIS_FLOAT16  ) f = bli_shcastm;
+		else bli_check_error_code( BLIS_INCONSISTENT_DATATYPES );
+
+		f( transa, m, n, buf_a, rs_a, cs_a, buf_b, rs_b, cs_b );
+		return;
+	}
+
 #if 0
 	if ( bli_obj_dt( a ) == bli_obj_dt( b ) )
 	{
@@ -210,6 +226,59 @@ INSERT_GENTFUNC2_MIXDP0( castm )
 
 // -----------------------------------------------------------------------------
 
+//
+// Define typed interfaces for the 16-bit floating-point storage types. Here,
+// 'b' denotes bfloat16 and 'h' denotes float16 (IEEE 754 binary16). Since
+// both the source and destination are real, transa only affects the
+// traversal of a.
+//
+
+#undef  GENTFUNCH
+#define GENTFUNCH( ctype_a, ctype_b, cha, chb, opname, cvt ) \
+\
+void PASTEMAC2(cha,chb,opname) \
+     ( \
+             trans_t transa, \
+             dim_t   m, \
+             dim_t   n, \
+       const void*   a, inc_t rs_a, inc_t cs_a, \
+             void*   b, inc_t rs_b, inc_t cs_b  \
+     ) \
+{ \
+	const ctype_a* restrict a_cast = a; \
+	      ctype_b* restrict b_cast = b; \
+	      dim_t             n_iter; \
+	      dim_t             n_elem; \
+	      inc_t             lda, inca; \
+	      inc_t             ldb, incb; \
+\
+	/* Set various loop parameters. */ \
+	bli_set_dims_incs_2m \
+	( \
+	  transa, \
+	  m,       n,       rs_a,  cs_a, rs_b,  cs_b, \
+	  &n_elem, &n_iter, &inca, &lda, &incb, &ldb  \
+	); \
+\
+	for ( dim_t j = 0; j < n_iter; ++j ) \
+	{ \
+		const ctype_a* restrict a1 = a_cast + (j  )*lda; \
+		      ctype_b* restrict b1 = b_cast + (j  )*ldb; \
+\
+		for ( dim_t i = 0; i < n_elem; ++i ) \
+		{ \
+			b1[ i*incb ] = cvt( a1[ i*inca ] ); \
+		} \
+	} \
+}
+
+GENTFUNCH( bfloat16, float,    b, s, castm, bli_bf16tos )
+GENTFUNCH( float16,  float,    h, s, castm, bli_f16tos )
+GENTFUNCH( float,    bfloat16, s, b, castm, bli_stobf16 )
+GENTFUNCH( float,    float16,  s, h, castm, bli_stof16 )
+
+// -----------------------------------------------------------------------------
+
 //
 // Define object-based _check() function.
 //
@@ -222,22 +291,29 @@ void bli_castm_check
 {
 	err_t e_val;
 
-	// Check object datatypes.
+	// Check object datatypes. The 16-bit floating-point storage types are
+	// validated against their counterpart in bli_castm().
 
-	e_val = bli_check_floating_object( a );
-	bli_check_error_code( e_val );
+	if ( !bli_obj_is_half( a ) )
+	{
+		e_val = bli_check_floating_object( a );
+		bli_check_error_code( e_val );
+	}
 
-	e_val = bli_check_floating_object( b );
-	bli_check_error_code( e_val );
+	if ( !bli_obj_is_half( b ) )
+	{
+		e_val = bli_check_floating_object( b );
+		bli_check_error_code( e_val );
+	}
 
 	// Check structure.
 	// NOTE: We enforce general structure for now in order to simplify the
 	// implementation.
 
-	bli_check_general_object( a );
+	e_val = bli_check_general_object( a );
 	bli_check_error_code( e_val );
 
-	bli_check_general_object( b );
+	e_val = bli_check_general_object( b );
 	bli_check_error_code( e_val );
 
 	// Check object dimensions.
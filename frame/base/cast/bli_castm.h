@@ -61,6 +61,14 @@ BLIS_EXPORT_BLIS void PASTEMAC2(cha,chb,opname) \
 INSERT_GENTPROT2_BASIC0( castm )
 INSERT_GENTPROT2_MIXDP0( castm )
 
+// Casts to and from the 16-bit floating-point storage types ('b' denotes
+// bfloat16 and 'h' denotes float16).
+
+GENTPROT2( bfloat16, float,    b, s, castm )
+GENTPROT2( float16,  float,    h, s, castm )
+GENTPROT2( float,    bfloat16, s, b, castm )
+GENTPROT2( float,    float16,  s, h, castm )
+
 //
 // Prototype object-based _check() function.
 //
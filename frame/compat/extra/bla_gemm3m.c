@@ -98,12 +98,13 @@ void PASTEF77(ch,blasname) \
 	const inc_t rs_c = 1; \
 	const inc_t cs_c = *ldc; \
 \
-	/* As a placeholder, invoke 1m since BLIS does no longer contains an
-	   official 3m implementation. Note that we do this by inlining an
+	/* Invoke the 3m method, which performs the complex product with three
+	   real matrix products (instead of four), regardless of which induced
+	   methods are currently enabled. Note that we do this by inlining an
 	   abbreviated version of bli_gemm_ex() so that we can bypass
 	   consideration of sup, which doesn't make sense in this context. */ \
 	{ \
-		cntx_t* cntx = ( cntx_t* )bli_gks_query_ind_cntx( BLIS_1M, dt ); \
+		cntx_t* cntx = ( cntx_t* )bli_gks_query_ind_cntx( BLIS_3M, dt ); \
 \
 		rntm_t  rntm_l; \
 		rntm_t* rntm = &rntm_l; \
@@ -217,12 +218,13 @@ void PASTEF77(ch,blasname) \
 	bli_obj_set_conjtrans( blis_transa, &ao ); \
 	bli_obj_set_conjtrans( blis_transb, &bo ); \
 \
-	/* As a placeholder, invoke 1m since BLIS does no longer contains an
-	   official 3m implementation. Note that we do this by inlining an
+	/* Invoke the 3m method, which performs the complex product with three
+	   real matrix products (instead of four), regardless of which induced
+	   methods are currently enabled. Note that we do this by inlining an
 	   abbreviated version of bli_gemm_ex() so that we can bypass
 	   consideration of sup, which doesn't make sense in this context. */ \
 	{ \
-		cntx_t* cntx = ( cntx_t* )bli_gks_query_ind_cntx( BLIS_1M, dt ); \
+		cntx_t* cntx = ( cntx_t* )bli_gks_query_ind_cntx( BLIS_3M, dt ); \
 \
 		rntm_t  rntm_l; \
 		rntm_t* rntm = &rntm_l; \
@@ -75,6 +75,7 @@
 // for building BLIS is low.
 #if defined(__GNUC__) || defined(__clang__) || defined(__ICC) || defined(__IBMC__)
   #define BLIS_THREAD_LOCAL __thread
+  #define BLIS_HAS_THREAD_LOCAL
 #else
   #define BLIS_THREAD_LOCAL
 #endif
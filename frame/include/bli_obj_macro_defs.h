@@ -84,6 +84,25 @@ BLIS_INLINE bool bli_obj_is_const( const obj_t* obj )
 	       ( bli_obj_dt( obj ) == BLIS_BITVAL_CONST_TYPE );
 }
 
+BLIS_INLINE bool bli_obj_is_bfloat16( const obj_t* obj )
+{
+	return ( bool )
+	       ( bli_obj_dt( obj ) == BLIS_BITVAL_BFLOAT16_TYPE );
+}
+
+BLIS_INLINE bool bli_obj_is_float16( const obj_t* obj )
+{
+	return ( bool )
+	       ( bli_obj_dt( obj ) == BLIS_BITVAL_FLOAT16_TYPE );
+}
+
+BLIS_INLINE bool bli_obj_is_half( const obj_t* obj )
+{
+	return ( bool )
+	       ( bli_obj_is_bfloat16( obj ) ||
+	         bli_obj_is_float16( obj ) );
+}
+
 BLIS_INLINE dom_t bli_obj_domain( const obj_t* obj )
 {
 	return ( dom_t )
@@ -123,15 +142,17 @@ BLIS_INLINE num_t bli_obj_dt_proj_to_double_prec( const obj_t* obj )
 BLIS_INLINE bool bli_obj_is_real( const obj_t* obj )
 {
 	return ( bool )
-	       ( bli_obj_domain( obj ) == BLIS_BITVAL_REAL &&
-	         !bli_obj_is_const( obj ) );
+	       ( ( bli_obj_domain( obj ) == BLIS_BITVAL_REAL &&
+	           !bli_obj_is_const( obj ) ) ||
+	         bli_obj_is_half( obj ) );
 }
 
 BLIS_INLINE bool bli_obj_is_complex( const obj_t* obj )
 {
 	return ( bool )
 	       ( bli_obj_domain( obj ) == BLIS_BITVAL_COMPLEX &&
-	         !bli_obj_is_const( obj ) );
+	         !bli_obj_is_const( obj ) &&
+	         !bli_obj_is_half( obj ) );
 }
 
 BLIS_INLINE num_t bli_obj_dt_proj_to_real( const obj_t* obj )
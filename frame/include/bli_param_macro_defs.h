@@ -98,6 +98,25 @@ BLIS_INLINE bool bli_is_int( num_t dt )
 	       ( dt == BLIS_INT );
 }
 
+BLIS_INLINE bool bli_is_bfloat16( num_t dt )
+{
+	return ( bool )
+	       ( dt == BLIS_BFLOAT16 );
+}
+
+BLIS_INLINE bool bli_is_float16( num_t dt )
+{
+	return ( bool )
+	       ( dt == BLIS_FLOAT16 );
+}
+
+BLIS_INLINE bool bli_is_half( num_t dt )
+{
+	return ( bool )
+	       ( bli_is_bfloat16( dt ) ||
+	         bli_is_float16( dt ) );
+}
+
 BLIS_INLINE bool bli_is_real( num_t dt )
 {
 	return ( bool )
@@ -1031,6 +1050,18 @@ BLIS_INLINE bool bli_is_1m_packed( pack_t schema )
 	         bli_is_1e_packed( schema ) );
 }
 
+BLIS_INLINE bool bli_is_4mi_packed( pack_t schema )
+{
+	return ( bool )
+	       ( ( schema & BLIS_PACK_FORMAT_BITS ) == BLIS_BITVAL_4MI );
+}
+
+BLIS_INLINE bool bli_is_3mi_packed( pack_t schema )
+{
+	return ( bool )
+	       ( ( schema & BLIS_PACK_FORMAT_BITS ) == BLIS_BITVAL_3MI );
+}
+
 BLIS_INLINE bool bli_is_nat_packed( pack_t schema )
 {
 	return ( bool )
@@ -170,6 +170,14 @@ typedef uint32_t objbits_t;  // object information bit field
 
 #endif // BLIS_ENABLE_C99_COMPLEX
 
+// -- 16-bit floating-point storage types --
+
+// BLIS never computes in bfloat16 or IEEE 754 binary16 (half precision).
+// Matrices stored in these formats are converted to single precision as
+// they are packed, and so we only need types that hold the raw encodings.
+typedef uint16_t bfloat16;
+typedef uint16_t float16;
+
 // -- Atom type --
 
 // Note: atom types are used to hold "bufferless" scalar object values. Note
@@ -252,6 +260,10 @@ typedef void  (*free_ft)  ( void*  p    );
            - 1 0001 11: packed by 1m expanded column panels
            - 1 0010 10: packed by 1m reordered row panels
            - 1 0010 11: packed by 1m reordered column panels
+           - 1 0011 10: packed by 4m interleaved row panels
+           - 1 0011 11: packed by 4m interleaved column panels
+           - 1 0100 10: packed by 3m interleaved row panels
+           - 1 0100 11: packed by 3m interleaved column panels
        23  Packed panel order if upper-stored
            - 0 == forward order if upper
            - 1 == reverse order if upper
@@ -283,6 +295,12 @@ typedef void  (*free_ft)  ( void*  p    );
            -  2: used to encode integer, constant types
 */
 
+// NOTE: The 16-bit floating-point storage datatypes (bfloat16 and float16)
+// are encoded using the two remaining values of the 3-bit datatype fields
+// (see BLIS_BITVAL_BFLOAT16_TYPE and BLIS_BITVAL_FLOAT16_TYPE). Since those
+// values also have bit 2 set, the domain and precision bits of these types
+// carry no meaning; use bli_is_half() and friends to identify them.
+
 // info
 #define BLIS_DATATYPE_SHIFT                0
 #define   BLIS_DOMAIN_SHIFT                0
@@ -376,6 +394,8 @@ typedef void  (*free_ft)  ( void*  p    );
 #define   BLIS_BITVAL_DCOMPLEX_TYPE         ( BLIS_DOMAIN_BIT | BLIS_PRECISION_BIT )
 #define   BLIS_BITVAL_INT_TYPE                0x04
 #define   BLIS_BITVAL_CONST_TYPE              0x05
+#define   BLIS_BITVAL_BFLOAT16_TYPE           0x06
+#define   BLIS_BITVAL_FLOAT16_TYPE            0x07
 #define BLIS_BITVAL_NO_TRANS                  0x0
 #define BLIS_BITVAL_TRANS                     BLIS_TRANS_BIT
 #define BLIS_BITVAL_NO_CONJ                   0x0
@@ -391,6 +411,8 @@ typedef void  (*free_ft)  ( void*  p    );
 #define BLIS_BITVAL_NOT_PACKED                0x0
 #define   BLIS_BITVAL_1E                    ( 0x1  << BLIS_PACK_FORMAT_SHIFT )
 #define   BLIS_BITVAL_1R                    ( 0x2  << BLIS_PACK_FORMAT_SHIFT )
+#define   BLIS_BITVAL_4MI                   ( 0x3  << BLIS_PACK_FORMAT_SHIFT )
+#define   BLIS_BITVAL_3MI                   ( 0x4  << BLIS_PACK_FORMAT_SHIFT )
 #define   BLIS_BITVAL_PACKED_UNSPEC         ( BLIS_PACK_BIT                                                            )
 #define   BLIS_BITVAL_PACKED_ROWS           ( BLIS_PACK_BIT                                                            )
 #define   BLIS_BITVAL_PACKED_COLUMNS        ( BLIS_PACK_BIT                                         | BLIS_PACK_RC_BIT )
@@ -400,6 +422,10 @@ typedef void  (*free_ft)  ( void*  p    );
 #define   BLIS_BITVAL_PACKED_COL_PANELS_1E  ( BLIS_PACK_BIT | BLIS_BITVAL_1E  | BLIS_PACK_PANEL_BIT | BLIS_PACK_RC_BIT )
 #define   BLIS_BITVAL_PACKED_ROW_PANELS_1R  ( BLIS_PACK_BIT | BLIS_BITVAL_1R  | BLIS_PACK_PANEL_BIT                    )
 #define   BLIS_BITVAL_PACKED_COL_PANELS_1R  ( BLIS_PACK_BIT | BLIS_BITVAL_1R  | BLIS_PACK_PANEL_BIT | BLIS_PACK_RC_BIT )
+#define   BLIS_BITVAL_PACKED_ROW_PANELS_4MI ( BLIS_PACK_BIT | BLIS_BITVAL_4MI | BLIS_PACK_PANEL_BIT                    )
+#define   BLIS_BITVAL_PACKED_COL_PANELS_4MI ( BLIS_PACK_BIT | BLIS_BITVAL_4MI | BLIS_PACK_PANEL_BIT | BLIS_PACK_RC_BIT )
+#define   BLIS_BITVAL_PACKED_ROW_PANELS_3MI ( BLIS_PACK_BIT | BLIS_BITVAL_3MI | BLIS_PACK_PANEL_BIT                    )
+#define   BLIS_BITVAL_PACKED_COL_PANELS_3MI ( BLIS_PACK_BIT | BLIS_BITVAL_3MI | BLIS_PACK_PANEL_BIT | BLIS_PACK_RC_BIT )
 #define BLIS_BITVAL_PACK_FWD_IF_UPPER         0x0
 #define BLIS_BITVAL_PACK_REV_IF_UPPER         BLIS_PACK_REV_IF_UPPER_BIT
 #define BLIS_BITVAL_PACK_FWD_IF_LOWER         0x0
@@ -479,6 +505,8 @@ typedef enum
 	BLIS_DCOMPLEX          = BLIS_BITVAL_DCOMPLEX_TYPE,
 	BLIS_INT               = BLIS_BITVAL_INT_TYPE,
 	BLIS_CONSTANT          = BLIS_BITVAL_CONST_TYPE,
+	BLIS_BFLOAT16          = BLIS_BITVAL_BFLOAT16_TYPE,
+	BLIS_FLOAT16           = BLIS_BITVAL_FLOAT16_TYPE,
 	BLIS_DT_LO             = BLIS_FLOAT,
 	BLIS_DT_HI             = BLIS_DCOMPLEX
 } num_t;
@@ -510,12 +538,16 @@ typedef enum
 	BLIS_PACKED_ROW_PANELS_1E  = BLIS_BITVAL_PACKED_ROW_PANELS_1E,
 	BLIS_PACKED_COL_PANELS_1E  = BLIS_BITVAL_PACKED_COL_PANELS_1E,
 	BLIS_PACKED_ROW_PANELS_1R  = BLIS_BITVAL_PACKED_ROW_PANELS_1R,
-	BLIS_PACKED_COL_PANELS_1R  = BLIS_BITVAL_PACKED_COL_PANELS_1R
+	BLIS_PACKED_COL_PANELS_1R  = BLIS_BITVAL_PACKED_COL_PANELS_1R,
+	BLIS_PACKED_ROW_PANELS_4MI = BLIS_BITVAL_PACKED_ROW_PANELS_4MI,
+	BLIS_PACKED_COL_PANELS_4MI = BLIS_BITVAL_PACKED_COL_PANELS_4MI,
+	BLIS_PACKED_ROW_PANELS_3MI = BLIS_BITVAL_PACKED_ROW_PANELS_3MI,
+	BLIS_PACKED_COL_PANELS_3MI = BLIS_BITVAL_PACKED_COL_PANELS_3MI
 } pack_t;
 
 // We combine row and column packing into one "type", and we start
 // with BLIS_PACKED_ROW_PANELS, _COLUMN_PANELS.
-#define BLIS_NUM_PACK_SCHEMA_TYPES 3
+#define BLIS_NUM_PACK_SCHEMA_TYPES 5
 
 
 // -- Pack order type --
@@ -609,6 +641,8 @@ typedef enum
 typedef enum
 {
 	BLIS_1M        = 0,
+	BLIS_3M,
+	BLIS_4M,
 	BLIS_NAT,
 	BLIS_IND_FIRST = 0,
 	BLIS_IND_LAST  = BLIS_NAT
@@ -619,6 +653,8 @@ typedef enum
 // These are used in bli_l3_*_oapi.c to construct the ind_t values from
 // the induced method substrings that go into function names.
 #define bli_1m   BLIS_1M
+#define bli_3m   BLIS_3M
+#define bli_4m   BLIS_4M
 #define bli_nat  BLIS_NAT
 
 
@@ -659,6 +695,18 @@ typedef enum
 	BLIS_PACKM_MRXMR_DIAG_1ER_KER,
 	BLIS_PACKM_NRXNR_DIAG_1ER_KER,
 
+	// pack kernels for 16-bit floating-point source operands (which are
+	// registered to the BLIS_FLOAT slot since they produce float panels)
+	BLIS_PACKM_MRXK_BF16_KER,
+	BLIS_PACKM_NRXK_BF16_KER,
+	BLIS_PACKM_MRXK_F16_KER,
+	BLIS_PACKM_NRXK_F16_KER,
+
+	// pack kernels for weight-only quantized source operands (also
+	// registered to the BLIS_FLOAT slot)
+	BLIS_PACKM_MRXK_QUANT_KER,
+	BLIS_PACKM_NRXK_QUANT_KER,
+
 	// unpack kernels
 	BLIS_UNPACKM_MRXK_KER,
 	BLIS_UNPACKM_NRXK_KER,
@@ -688,6 +736,10 @@ typedef enum
 	BLIS_GEMMSUP_CCC_UKR,
 	BLIS_GEMMSUP_XXX_UKR,
 
+	// int8 (u8 x s8 -> s32) gemm kernels (which are registered to the
+	// BLIS_FLOAT slot since, like sgemm, they accumulate in 32-bit lanes)
+	BLIS_GEMM_I8_UKR,
+
 	// BLIS_NUM_UKRS must be last!
 	BLIS_NUM_UKRS
 } ukr_t;
@@ -800,6 +852,10 @@ typedef enum
 } stor3_t;
 
 #define BLIS_NUM_3OP_RC_COMBOS 9
+
+// The number of thread count classes (1, 2-3, 4-7, ..., 128 and up) by which
+// calibrated sup thresholds are indexed.
+#define BLIS_NUM_SUP_NT_CLASSES 8
 //#define BLIS_NUM_3OP_RCG_COMBOS 27
 
 
@@ -892,6 +948,13 @@ typedef enum
 	BLIS_KC_SUP,
 	BLIS_NC_SUP,
 
+	// int8 gemm block sizes (stored in the BLIS_FLOAT slot; see BLIS_GEMM_I8_UKR)
+	BLIS_MR_I8,
+	BLIS_NR_I8,
+	BLIS_MC_I8,
+	BLIS_KC_I8,
+	BLIS_NC_I8,
+
 	// BLIS_NO_PART (= BLIS_NUM_BLKSZS) must be last!
 	BLIS_NO_PART, // used as a placeholder when blocksizes are not applicable,
 	              // such as when characterizing a packm operation.
@@ -1416,8 +1479,18 @@ typedef struct cntx_s
 
 	void_fp   l3_sup_handlers[ BLIS_NUM_LEVEL3_OPS ];
 
+	// Calibrated sup thresholds (m, n, k) per datatype, storage combination,
+	// and thread count class. Zero denotes an uncalibrated entry, for which
+	// the BLIS_MT, BLIS_NT, and BLIS_KT blocksizes apply.
+	dim_t     l3_sup_thresh[ BLIS_NUM_FP_TYPES ][ BLIS_NUM_3OP_RC_COMBOS ]
+	                       [ BLIS_NUM_SUP_NT_CLASSES ][ 3 ];
+
 	ind_t     method;
 
+	// Whether the cache blocksizes (MC, KC, and NC) are placeholders rather
+	// than values tuned for the hardware. See bli_tune_init().
+	bool      untuned_blkszs;
+
 } cntx_t;
 
 
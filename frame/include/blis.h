@@ -80,6 +80,13 @@ extern "C" {
 #include "bli_pragma_macro_defs.h"
 
 
+// -- Statistics and tracing definitions --
+
+#include "bli_hwc.h"
+#include "bli_stats.h"
+#include "bli_trace.h"
+
+
 // -- Threading definitions --
 
 #include "bli_thread.h"
@@ -112,6 +119,7 @@ extern "C" {
 #include "bli_const.h"
 #include "bli_obj.h"
 #include "bli_obj_scalar.h"
+#include "bli_half.h"
 #include "bli_blksz.h"
 #include "bli_func.h"
 #include "bli_mbool.h"
@@ -144,6 +152,8 @@ extern "C" {
 #include "bli_info.h"
 #include "bli_arch.h"
 #include "bli_cpuid.h"
+#include "bli_tune.h"
+#include "bli_dcache.h"
 #include "bli_string.h"
 #include "bli_setgetijm.h"
 #include "bli_setgetijv.h"
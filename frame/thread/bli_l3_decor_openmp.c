@@ -99,6 +99,9 @@ void bli_l3_thread_decorator
 		// Query the thread's id from OpenMP.
 		const dim_t tid = omp_get_thread_num();
 
+		// Attribute the statistics recorded by this thread (if any) to its id.
+		BLIS_STATS_SET_TID( tid );
+
 		// Check for a somewhat obscure OpenMP thread-mistmatch issue.
 		bli_l3_thread_decorator_thread_check( n_threads, tid, gl_comm, rntm_p );
 
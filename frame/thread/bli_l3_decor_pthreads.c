@@ -74,6 +74,9 @@ void* bli_l3_thread_entry( void* data_void )
 	      array_t*       array    = data->array;
 	      thrcomm_t*     gl_comm  = data->gl_comm;
 
+	// Attribute the statistics recorded by this thread (if any) to its id.
+	BLIS_STATS_SET_TID( tid );
+
 	// Create a thread-local copy of the master thread's rntm_t. This is
 	// necessary since we want each thread to be able to track its own
 	// small block pool_t as it executes down the function stack.
@@ -93,6 +93,9 @@ err_t bli_l3_sup_thread_decorator
 		// Query the thread's id from OpenMP.
 		const dim_t tid = omp_get_thread_num();
 
+		// Attribute the statistics recorded by this thread (if any) to its id.
+		BLIS_STATS_SET_TID( tid );
+
 		// Check for a somewhat obscure OpenMP thread-mistmatch issue.
 		// NOTE: This calls the same function used for the conventional/large
 		// code path.
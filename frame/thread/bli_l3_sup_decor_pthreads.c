@@ -72,6 +72,9 @@ void* bli_l3_sup_thread_entry( void* data_void )
 	      array_t*       array    = data->array;
 	      thrcomm_t*     gl_comm  = data->gl_comm;
 
+	// Attribute the statistics recorded by this thread (if any) to its id.
+	BLIS_STATS_SET_TID( tid );
+
 	( void )family;
 
 	// Create a thread-local copy of the master thread's rntm_t. This is
@@ -83,6 +83,9 @@ err_t bli_l3_sup_thread_decorator
 		// There is only one thread id (for the thief thread).
 		const dim_t tid = 0;
 
+		// Attribute the statistics recorded by this thread (if any) to its id.
+		BLIS_STATS_SET_TID( tid );
+
 		// Use the thread id to access the appropriate pool_t* within the
 		// array_t, and use it to set the sba_pool field within the rntm_t.
 		// If the pool_t* element within the array_t is NULL, it will first
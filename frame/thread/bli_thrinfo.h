@@ -178,7 +178,11 @@ BLIS_INLINE void* bli_thread_broadcast( const thrinfo_t* t, void* p )
 
 BLIS_INLINE void bli_thread_barrier( const thrinfo_t* t )
 {
+	BLIS_STATS_START( t0 );
+
 	bli_thrcomm_barrier( t->ocomm_id, t->ocomm );
+
+	BLIS_STATS_STOP( BLIS_STATS_BARRIER, t0 );
 }
 
 
@@ -0,0 +1,198 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "immintrin.h"
+#include "blis.h"
+
+// Packing kernels that read bfloat16 or float16 (IEEE 754 binary16) source
+// micropanels and write single precision real micropanels for use with the
+// sgemm microkernel. Conversion is performed eight elements at a time:
+// bfloat16 is widened by zero-extending to 32 bits and shifting left by 16,
+// while float16 is converted with the F16C vcvtph2ps instruction.
+
+// Convert eight contiguous 16-bit values to float.
+BLIS_INLINE __m256 bli_cvt8_half_ps( const uint16_t* restrict x, bool is_bf16 )
+{
+	const __m128i h = _mm_loadu_si128( ( const __m128i* )x );
+
+	if ( is_bf16 )
+		return _mm256_castsi256_ps( _mm256_slli_epi32( _mm256_cvtepu16_epi32( h ), 16 ) );
+	else
+		return _mm256_cvtph_ps( h );
+}
+
+// Convert a single 16-bit value to float.
+BLIS_INLINE float bli_cvt1_half_ps( uint16_t x, bool is_bf16 )
+{
+	return is_bf16 ? bli_bf16tos( x ) : bli_f16tos( x );
+}
+
+BLIS_INLINE void bli_spackm_half_haswell_int
+     (
+       bool                is_bf16,
+       dim_t               mnr,
+       dim_t               cdim0,
+       dim_t               k0,
+       dim_t               k0_max,
+       float*     restrict kappa,
+       uint16_t*  restrict a, inc_t inca, inc_t lda,
+       float*     restrict p,             inc_t ldp
+     )
+{
+	const __m256 kappav = _mm256_broadcast_ss( kappa );
+	const float  kappas = *kappa;
+
+	// NOTE: As with the other packm kernels, we interpret inca and lda as
+	// rs_a and cs_a, respectively, and ldp as cs_p (with unit rs_p).
+
+	if ( cdim0 == mnr && inca == 1 )
+	{
+		// Elements along the panel dimension are contiguous. Convert whole
+		// vectors of the panel dimension and use a masked store for the
+		// remainder (e.g. mnr = 6), staging the source through a local
+		// buffer to avoid reading past the end of each column.
+		const dim_t   n_vec  = mnr / 8;
+		const dim_t   n_left = mnr % 8;
+		const __m256i mask   = _mm256_cmpgt_epi32
+		(
+		  _mm256_set1_epi32( ( int )n_left ),
+		  _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 )
+		);
+
+		for ( dim_t k = 0; k < k0; ++k )
+		{
+			uint16_t* restrict a1 = a + k*lda;
+			float*    restrict p1 = p + k*ldp;
+
+			for ( dim_t v = 0; v < n_vec; ++v )
+			{
+				__m256 x = bli_cvt8_half_ps( a1 + v*8, is_bf16 );
+				_mm256_storeu_ps( p1 + v*8, _mm256_mul_ps( kappav, x ) );
+			}
+
+			if ( n_left )
+			{
+				uint16_t t[ 8 ] = { 0 };
+
+				for ( dim_t i = 0; i < n_left; ++i ) t[ i ] = a1[ n_vec*8 + i ];
+
+				__m256 x = bli_cvt8_half_ps( t, is_bf16 );
+				_mm256_maskstore_ps( p1 + n_vec*8, mask, _mm256_mul_ps( kappav, x ) );
+			}
+		}
+	}
+	else if ( lda == 1 )
+	{
+		// Elements along k are contiguous. Convert eight values of k for each
+		// row of the micropanel and scatter them across the columns of p.
+		const dim_t k_iter = k0 / 8;
+		const dim_t k_left = k0 % 8;
+
+		for ( dim_t kk = 0; kk < k_iter; ++kk )
+		{
+			float t[ 8 ] __attribute__((aligned(32)));
+
+			for ( dim_t i = 0; i < cdim0; ++i )
+			{
+				__m256 x = bli_cvt8_half_ps( a + i*inca + kk*8, is_bf16 );
+				_mm256_store_ps( t, _mm256_mul_ps( kappav, x ) );
+
+				for ( dim_t k = 0; k < 8; ++k ) p[ i + ( kk*8 + k )*ldp ] = t[ k ];
+			}
+		}
+
+		for ( dim_t k = k_iter*8; k < k_iter*8 + k_left; ++k )
+		for ( dim_t i = 0; i < cdim0; ++i )
+			p[ i + k*ldp ] = kappas * bli_cvt1_half_ps( a[ i*inca + k ], is_bf16 );
+	}
+	else
+	{
+		// General stride (or an edge case with non-unit inca).
+		for ( dim_t k = 0; k < k0; ++k )
+		for ( dim_t i = 0; i < cdim0; ++i )
+			p[ i + k*ldp ] = kappas * bli_cvt1_half_ps( a[ i*inca + k*lda ], is_bf16 );
+	}
+
+	if ( cdim0 < mnr )
+	{
+		// Handle zero-filling along the "long" edge of the micropanel.
+		bli_sset0s_mxn
+		(
+		  mnr - cdim0,
+		  k0_max,
+		  p + cdim0, 1, ldp
+		);
+	}
+
+	if ( k0 < k0_max )
+	{
+		// Handle zero-filling along the "short" (far) edge of the micropanel.
+		bli_sset0s_mxn
+		(
+		  mnr,
+		  k0_max - k0,
+		  p + k0*ldp, 1, ldp
+		);
+	}
+}
+
+#undef  GENTFUNC
+#define GENTFUNC( opname, mnr, is_bf16 ) \
+\
+void PASTEMAC(s,opname) \
+     ( \
+       conj_t              conja, \
+       pack_t              schema, \
+       dim_t               cdim0, \
+       dim_t               k0, \
+       dim_t               k0_max, \
+       float*     restrict kappa, \
+       void*      restrict a, inc_t inca0, inc_t lda0, \
+       float*     restrict p,              inc_t ldp0, \
+       cntx_t*             cntx \
+     ) \
+{ \
+	bli_spackm_half_haswell_int \
+	( \
+	  is_bf16, mnr, cdim0, k0, k0_max, \
+	  kappa, a, inca0, lda0, p, ldp0 \
+	); \
+}
+
+GENTFUNC( packm_bf16_haswell_int_6xk,   6, TRUE  )
+GENTFUNC( packm_bf16_haswell_int_16xk, 16, TRUE  )
+GENTFUNC( packm_f16_haswell_int_6xk,    6, FALSE )
+GENTFUNC( packm_f16_haswell_int_16xk,  16, FALSE )
+
@@ -0,0 +1,272 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "immintrin.h"
+#include "blis.h"
+
+// Packing kernels that read weight-only quantized (int8 or uint4) source
+// micropanels and write dequantized single precision real micropanels for
+// use with the sgemm microkernel. Eight elements are dequantized at a time:
+// int8 values are sign-extended with vpmovsxbd, while uint4 values are split
+// into nibbles, interleaved, and zero-extended with vpmovzxbd. The scale and
+// zero point (pre-multiplied by kappa) are then applied with a single fused
+// multiply-subtract.
+
+// Load eight consecutive quantized elements, starting at element index e,
+// as floats.
+BLIS_INLINE __m256 bli_quant_load8_ps( quant_t qtype, const void* buf, inc_t e )
+{
+	if ( qtype == BLIS_QUANT_INT8 )
+	{
+		const __m128i x = _mm_loadl_epi64( ( const __m128i* )( ( const int8_t* )buf + e ) );
+
+		return _mm256_cvtepi32_ps( _mm256_cvtepi8_epi32( x ) );
+	}
+	else if ( ( e & 1 ) == 0 )
+	{
+		int32_t b4;
+		memcpy( &b4, ( const uint8_t* )buf + e/2, sizeof( int32_t ) );
+
+		const __m128i x    = _mm_cvtsi32_si128( b4 );
+		const __m128i m4   = _mm_set1_epi8( 0xF );
+		const __m128i lo   = _mm_and_si128( x, m4 );
+		const __m128i hi   = _mm_and_si128( _mm_srli_epi16( x, 4 ), m4 );
+		const __m128i nibs = _mm_unpacklo_epi8( lo, hi );
+
+		return _mm256_cvtepi32_ps( _mm256_cvtepu8_epi32( nibs ) );
+	}
+	else
+	{
+		// The first element is in the high nibble of a byte.
+		float t[ 8 ];
+
+		for ( dim_t i = 0; i < 8; ++i ) t[ i ] = bli_quant_get( qtype, buf, e + i );
+
+		return _mm256_loadu_ps( t );
+	}
+}
+
+BLIS_INLINE void bli_spackm_quant_haswell_int
+     (
+             dim_t                 mnr,
+             dim_t                 cdim0,
+             dim_t                 k0,
+             dim_t                 k0_max,
+             float*       restrict kappa,
+       const packm_quant_params_t* qp,
+             dim_t                 off_cdim,
+             dim_t                 off_k,
+             inc_t                 inca,
+             inc_t                 lda,
+             float*       restrict p,
+             inc_t                 ldp
+     )
+{
+	const quant_t     qtype  = qp->qtype;
+	const void*       buf    = qp->buf;
+	const dim_t       gs     = qp->group_size;
+	const float       kappas = *kappa;
+
+	// Return kappa * scale(g,j) and kappa * scale(g,j) * zero(g,j).
+	#define QUANT_SCALE( g, j ) \
+	  ( kappas * qp->scale[ (g)*qp->rs_s + (j)*qp->cs_s ] )
+	#define QUANT_ZERO( g, j ) \
+	  ( qp->zero ? qp->zero[ (g)*qp->rs_z + (j)*qp->cs_z ] : 0.0f )
+
+	if ( cdim0 == mnr && inca == 1 && mnr <= 16 )
+	{
+		// Elements along the panel dimension are contiguous. Dequantize whole
+		// vectors of the panel dimension and use a masked store for the
+		// remainder (e.g. mnr = 6), staging the source through a local
+		// buffer to avoid reading past the end of each column.
+		const dim_t   n_vec  = mnr / 8;
+		const dim_t   n_left = mnr % 8;
+		const __m256i mask   = _mm256_cmpgt_epi32
+		(
+		  _mm256_set1_epi32( ( int )n_left ),
+		  _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 )
+		);
+
+		float sc[ 16 ] __attribute__((aligned(32)));
+		float zs[ 16 ] __attribute__((aligned(32)));
+		dim_t g_cur = -1;
+
+		for ( dim_t k = 0; k < k0; ++k )
+		{
+			const dim_t l  = off_k + k;
+			const dim_t g  = l / gs;
+			const inc_t e0 = off_cdim + l*lda;
+
+			float* restrict p1 = p + k*ldp;
+
+			// Refresh the scales and zero points when entering a new group.
+			if ( g != g_cur )
+			{
+				for ( dim_t i = 0; i < mnr; ++i )
+				{
+					sc[ i ] = QUANT_SCALE( g, off_cdim + i );
+					zs[ i ] = sc[ i ] * QUANT_ZERO( g, off_cdim + i );
+				}
+				for ( dim_t i = mnr; i < 16; ++i ) sc[ i ] = zs[ i ] = 0.0f;
+
+				g_cur = g;
+			}
+
+			for ( dim_t v = 0; v < n_vec; ++v )
+			{
+				__m256 x = bli_quant_load8_ps( qtype, buf, e0 + v*8 );
+				x = _mm256_fmsub_ps( x, _mm256_load_ps( sc + v*8 ),
+				                        _mm256_load_ps( zs + v*8 ) );
+				_mm256_storeu_ps( p1 + v*8, x );
+			}
+
+			if ( n_left )
+			{
+				float t[ 8 ] = { 0 };
+
+				for ( dim_t i = 0; i < n_left; ++i )
+					t[ i ] = bli_quant_get( qtype, buf, e0 + n_vec*8 + i );
+
+				__m256 x = _mm256_loadu_ps( t );
+				x = _mm256_fmsub_ps( x, _mm256_load_ps( sc + n_vec*8 ),
+				                        _mm256_load_ps( zs + n_vec*8 ) );
+				_mm256_maskstore_ps( p1 + n_vec*8, mask, x );
+			}
+		}
+	}
+	else if ( lda == 1 )
+	{
+		// Elements along k are contiguous. For each row of the micropanel,
+		// dequantize eight values of k at a time within each group and
+		// scatter them across the columns of p.
+		for ( dim_t i = 0; i < cdim0; ++i )
+		{
+			const dim_t j  = off_cdim + i;
+			const inc_t e0 = j*inca + off_k;
+
+			for ( dim_t k = 0; k < k0; )
+			{
+				const dim_t g     = ( off_k + k ) / gs;
+				const dim_t k_end = bli_min( ( g + 1 )*gs - off_k, k0 );
+				const float s     = QUANT_SCALE( g, j );
+				const float z     = s * QUANT_ZERO( g, j );
+
+				const __m256 sv   = _mm256_set1_ps( s );
+				const __m256 zv   = _mm256_set1_ps( z );
+
+				for ( ; k + 8 <= k_end; k += 8 )
+				{
+					float t[ 8 ] __attribute__((aligned(32)));
+
+					__m256 x = bli_quant_load8_ps( qtype, buf, e0 + k );
+					_mm256_store_ps( t, _mm256_fmsub_ps( x, sv, zv ) );
+
+					for ( dim_t kk = 0; kk < 8; ++kk ) p[ i + ( k + kk )*ldp ] = t[ kk ];
+				}
+
+				for ( ; k < k_end; ++k )
+					p[ i + k*ldp ] = s * bli_quant_get( qtype, buf, e0 + k ) - z;
+			}
+		}
+	}
+	else
+	{
+		// General stride (or an edge case with non-unit inca).
+		for ( dim_t k = 0; k < k0; ++k )
+		for ( dim_t i = 0; i < cdim0; ++i )
+		{
+			const dim_t g = ( off_k + k ) / gs;
+			const dim_t j = off_cdim + i;
+			const float s = QUANT_SCALE( g, j );
+
+			p[ i + k*ldp ] = s * ( bli_quant_get( qtype, buf, j*inca + ( off_k + k )*lda )
+			                       - QUANT_ZERO( g, j ) );
+		}
+	}
+
+	#undef QUANT_SCALE
+	#undef QUANT_ZERO
+
+	if ( cdim0 < mnr )
+	{
+		// Handle zero-filling along the "long" edge of the micropanel.
+		bli_sset0s_mxn
+		(
+		  mnr - cdim0,
+		  k0_max,
+		  p + cdim0, 1, ldp
+		);
+	}
+
+	if ( k0 < k0_max )
+	{
+		// Handle zero-filling along the "short" (far) edge of the micropanel.
+		bli_sset0s_mxn
+		(
+		  mnr,
+		  k0_max - k0,
+		  p + k0*ldp, 1, ldp
+		);
+	}
+}
+
+#undef  GENTFUNC
+#define GENTFUNC( opname, mnr ) \
+\
+void PASTEMAC(s,opname) \
+     ( \
+       conj_t              conja, \
+       pack_t              schema, \
+       dim_t               cdim0, \
+       dim_t               k0, \
+       dim_t               k0_max, \
+       float*     restrict kappa, \
+       void*               params, \
+       dim_t               off_cdim, \
+       dim_t               off_k, \
+       inc_t               inca0, inc_t lda0, \
+       float*     restrict p,     inc_t ldp0, \
+       cntx_t*             cntx \
+     ) \
+{ \
+	bli_spackm_quant_haswell_int \
+	( \
+	  mnr, cdim0, k0, k0_max, \
+	  kappa, params, off_cdim, off_k, inca0, lda0, p, ldp0 \
+	); \
+}
+
+GENTFUNC( packm_quant_haswell_int_6xk,   6 )
+GENTFUNC( packm_quant_haswell_int_16xk, 16 )
@@ -0,0 +1,217 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "immintrin.h"
+#include "blis.h"
+
+// An int8 gemm micro-kernel that computes a 6x16 tile of
+//
+//   C := beta * C + alpha * A * B
+//
+// where A (uint8_t) and B (int8_t) are packed in groups of four along k as
+// described in bli_i8gemm_ref.c. For each group of four k, the four bytes of
+// each row of A are broadcast and multiplied with the bytes of B by
+// vpmaddubsw, which sums adjacent pairs of products as int16_t, and vpmaddwd
+// with a vector of ones then sums adjacent pairs of those as int32_t. Since
+// the four k of each column of B are adjacent, every 32-bit element of the
+// result belongs to one column, in the natural order.
+//
+// vpmaddubsw saturates its pair sums, which can reach 255*(-128)*2, so it is
+// only exact if the elements of A are at most 127. The packed micropanel of A
+// is therefore scanned first. If any element exceeds 127, A is split into its
+// low seven bits and its high bit, A = A_lo + A_hi with A_hi either 0 or 128,
+// whose pair sums with B each fit in int16_t (being at least 127*(-128)*2 and
+// 128*(-128)*2, respectively), and the two are summed in int32_t. The result
+// is exact for all u8 and s8 inputs.
+
+void bli_i8gemm_haswell_int_6x16
+     (
+       dim_t               m,
+       dim_t               n,
+       dim_t               k,
+       int32_t*   restrict alpha,
+       int8_t*    restrict a,
+       int8_t*    restrict b,
+       int32_t*   restrict beta,
+       int32_t*   restrict c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t*          data,
+       cntx_t*             cntx
+     )
+{
+	const dim_t mr    = 6;
+	const dim_t nr    = 16;
+	const dim_t k_grp = k / 4;
+
+	__m256i c00 = _mm256_setzero_si256(), c01 = _mm256_setzero_si256();
+	__m256i c10 = _mm256_setzero_si256(), c11 = _mm256_setzero_si256();
+	__m256i c20 = _mm256_setzero_si256(), c21 = _mm256_setzero_si256();
+	__m256i c30 = _mm256_setzero_si256(), c31 = _mm256_setzero_si256();
+	__m256i c40 = _mm256_setzero_si256(), c41 = _mm256_setzero_si256();
+	__m256i c50 = _mm256_setzero_si256(), c51 = _mm256_setzero_si256();
+
+	const __m256i ones = _mm256_set1_epi16( 1 );
+
+	// Check whether any element of the micropanel of A has its high bit set.
+	// The micropanel holds mr * 4 bytes per group, a multiple of eight.
+	uint64_t a_or = 0;
+
+	for ( dim_t l = 0; l < k_grp * mr * 4; l += 8 )
+	{
+		uint64_t al;
+		memcpy( &al, a + l, sizeof( uint64_t ) );
+		a_or |= al;
+	}
+
+	const bool a_is_u7 = ( a_or & 0x8080808080808080ULL ) == 0;
+
+	if ( a_is_u7 )
+	{
+		// Multiply the broadcast of the four bytes of A with B0 and B1, and
+		// accumulate into the two int32_t accumulators of the given row.
+		#define I8GEMM_ROW( i, ci0, ci1 ) \
+		{ \
+			int32_t ai; \
+			memcpy( &ai, a + (i)*4, sizeof( int32_t ) ); \
+			const __m256i av = _mm256_set1_epi32( ai ); \
+			ci0 = _mm256_add_epi32( ci0, _mm256_madd_epi16( _mm256_maddubs_epi16( av, b0 ), ones ) ); \
+			ci1 = _mm256_add_epi32( ci1, _mm256_madd_epi16( _mm256_maddubs_epi16( av, b1 ), ones ) ); \
+		}
+
+		for ( dim_t g = 0; g < k_grp; ++g )
+		{
+			// Each of b0 and b1 holds four k values of each of eight columns.
+			const __m256i b0 = _mm256_loadu_si256( ( const __m256i* )( b      ) );
+			const __m256i b1 = _mm256_loadu_si256( ( const __m256i* )( b + 32 ) );
+
+			I8GEMM_ROW( 0, c00, c01 );
+			I8GEMM_ROW( 1, c10, c11 );
+			I8GEMM_ROW( 2, c20, c21 );
+			I8GEMM_ROW( 3, c30, c31 );
+			I8GEMM_ROW( 4, c40, c41 );
+			I8GEMM_ROW( 5, c50, c51 );
+
+			a += mr * 4;
+			b += nr * 4;
+		}
+
+		#undef I8GEMM_ROW
+	}
+	else
+	{
+		// As above, but with the low seven bits and the high bit of A
+		// multiplied with B separately.
+		#define I8GEMM_ROW( i, ci0, ci1 ) \
+		{ \
+			uint32_t ai; \
+			memcpy( &ai, a + (i)*4, sizeof( uint32_t ) ); \
+			const __m256i alo = _mm256_set1_epi32( ai & 0x7F7F7F7FU ); \
+			const __m256i ahi = _mm256_set1_epi32( ai & 0x80808080U ); \
+			ci0 = _mm256_add_epi32( ci0, _mm256_madd_epi16( _mm256_maddubs_epi16( alo, b0 ), ones ) ); \
+			ci0 = _mm256_add_epi32( ci0, _mm256_madd_epi16( _mm256_maddubs_epi16( ahi, b0 ), ones ) ); \
+			ci1 = _mm256_add_epi32( ci1, _mm256_madd_epi16( _mm256_maddubs_epi16( alo, b1 ), ones ) ); \
+			ci1 = _mm256_add_epi32( ci1, _mm256_madd_epi16( _mm256_maddubs_epi16( ahi, b1 ), ones ) ); \
+		}
+
+		for ( dim_t g = 0; g < k_grp; ++g )
+		{
+			const __m256i b0 = _mm256_loadu_si256( ( const __m256i* )( b      ) );
+			const __m256i b1 = _mm256_loadu_si256( ( const __m256i* )( b + 32 ) );
+
+			I8GEMM_ROW( 0, c00, c01 );
+			I8GEMM_ROW( 1, c10, c11 );
+			I8GEMM_ROW( 2, c20, c21 );
+			I8GEMM_ROW( 3, c30, c31 );
+			I8GEMM_ROW( 4, c40, c41 );
+			I8GEMM_ROW( 5, c50, c51 );
+
+			a += mr * 4;
+			b += nr * 4;
+		}
+
+		#undef I8GEMM_ROW
+	}
+
+	// Store the accumulators to a row-major temporary tile.
+	int32_t ab[ 6 * 16 ] __attribute__((aligned(BLIS_SIMD_ALIGN_SIZE)));
+
+	_mm256_store_si256( ( __m256i* )( ab + 0*nr + 0 ), c00 );
+	_mm256_store_si256( ( __m256i* )( ab + 0*nr + 8 ), c01 );
+	_mm256_store_si256( ( __m256i* )( ab + 1*nr + 0 ), c10 );
+	_mm256_store_si256( ( __m256i* )( ab + 1*nr + 8 ), c11 );
+	_mm256_store_si256( ( __m256i* )( ab + 2*nr + 0 ), c20 );
+	_mm256_store_si256( ( __m256i* )( ab + 2*nr + 8 ), c21 );
+	_mm256_store_si256( ( __m256i* )( ab + 3*nr + 0 ), c30 );
+	_mm256_store_si256( ( __m256i* )( ab + 3*nr + 8 ), c31 );
+	_mm256_store_si256( ( __m256i* )( ab + 4*nr + 0 ), c40 );
+	_mm256_store_si256( ( __m256i* )( ab + 4*nr + 8 ), c41 );
+	_mm256_store_si256( ( __m256i* )( ab + 5*nr + 0 ), c50 );
+	_mm256_store_si256( ( __m256i* )( ab + 5*nr + 8 ), c51 );
+
+	const int32_t alpha0 = *alpha;
+	const int32_t beta0  = *beta;
+
+	if ( m == mr && n == nr && cs_c == 1 )
+	{
+		// Row-stored full tile: update C eight elements at a time.
+		const __m256i alphav = _mm256_set1_epi32( alpha0 );
+		const __m256i betav  = _mm256_set1_epi32( beta0 );
+
+		for ( dim_t i = 0; i < mr; ++i )
+		for ( dim_t j = 0; j < nr; j += 8 )
+		{
+			int32_t* restrict cij = c + i*rs_c + j;
+
+			__m256i t = _mm256_mullo_epi32( alphav,
+			              _mm256_load_si256( ( const __m256i* )( ab + i*nr + j ) ) );
+
+			if ( beta0 != 0 )
+				t = _mm256_add_epi32( t, _mm256_mullo_epi32( betav,
+				      _mm256_loadu_si256( ( const __m256i* )cij ) ) );
+
+			_mm256_storeu_si256( ( __m256i* )cij, t );
+		}
+	}
+	else
+	{
+		for ( dim_t i = 0; i < m; ++i )
+		for ( dim_t j = 0; j < n; ++j )
+		{
+			int32_t* restrict cij = c + i*rs_c + j*cs_c;
+
+			if ( beta0 == 0 ) *cij =                 alpha0 * ab[ i*nr + j ];
+			else              *cij = beta0 * *cij + alpha0 * ab[ i*nr + j ];
+		}
+	}
+}
@@ -48,6 +48,16 @@ PACKM_KER_PROT( scomplex, c, packm_haswell_asm_8xk )
 PACKM_KER_PROT( dcomplex, z, packm_haswell_asm_3xk )
 PACKM_KER_PROT( dcomplex, z, packm_haswell_asm_4xk )
 
+// packm (intrinsics, 16-bit floating-point sources)
+PACKM_HALF_KER_PROT( float, s, packm_bf16_haswell_int_6xk )
+PACKM_HALF_KER_PROT( float, s, packm_bf16_haswell_int_16xk )
+PACKM_HALF_KER_PROT( float, s, packm_f16_haswell_int_6xk )
+PACKM_HALF_KER_PROT( float, s, packm_f16_haswell_int_16xk )
+
+// packm (intrinsics, quantized sources)
+PACKM_QUANT_KER_PROT( float, s, packm_quant_haswell_int_6xk )
+PACKM_QUANT_KER_PROT( float, s, packm_quant_haswell_int_16xk )
+
 
 // -- level-3 ------------------------------------------------------------------
 
@@ -63,6 +73,9 @@ GEMM_UKR_PROT( double,   d, gemm_haswell_asm_8x6 )
 GEMM_UKR_PROT( scomplex, c, gemm_haswell_asm_8x3 )
 GEMM_UKR_PROT( dcomplex, z, gemm_haswell_asm_4x3 )
 
+// int8 gemm (NOTE: elements of A are interpreted as uint8_t)
+GEMM_UKR_PROT2( int8_t, int32_t, i8, gemm_haswell_int_6x16 )
+
 // gemmtrsm_l (asm d6x8)
 GEMMTRSM_UKR_PROT( float,    s, gemmtrsm_l_haswell_asm_6x16 )
 GEMMTRSM_UKR_PROT( double,   d, gemmtrsm_l_haswell_asm_6x8 )
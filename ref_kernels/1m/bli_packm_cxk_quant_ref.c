@@ -0,0 +1,97 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+// Reference packm kernels for quantized source matrices (see
+// bli_packm_struc_cxk_quant.h). Each element is dequantized using the scale
+// and zero point of its group along k, scaled by kappa, and written to the
+// (float) micropanel. Conjugation is a no-op since the source is real.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, mnr0, bb0, arch, suf ) \
+\
+void PASTEMAC3(ch,opname,arch,suf) \
+     ( \
+       conj_t           conja, \
+       pack_t           schema, \
+       dim_t            cdim, \
+       dim_t            n, \
+       dim_t            n_max, \
+       ctype*  restrict kappa, \
+       void*            params, \
+       dim_t            off_cdim, \
+       dim_t            off_n, \
+       inc_t            inca, inc_t lda, \
+       ctype*  restrict p,    inc_t ldp, \
+       cntx_t*          cntx  \
+     ) \
+{ \
+	const num_t       dt         = PASTEMAC(ch,type); \
+	const dim_t       cdim_max   = bli_cntx_get_blksz_def_dt( dt, mnr0, cntx ); \
+	const dim_t       dfac       = PASTECH2(bb0, _, ch); \
+\
+	const packm_quant_params_t* qp = params; \
+	const dim_t       gs         = qp->group_size; \
+	const ctype       kappa_cast = *kappa; \
+\
+	for ( dim_t k = 0; k < n; ++k ) \
+	{ \
+		const dim_t l = off_n + k; \
+		const dim_t g = l / gs; \
+\
+		for ( dim_t mn = 0; mn < cdim; ++mn ) \
+		{ \
+			const dim_t j     = off_cdim + mn; \
+			const float scale = qp->scale[ g*qp->rs_s + j*qp->cs_s ]; \
+			const float zero  = ( qp->zero ? qp->zero[ g*qp->rs_z + j*qp->cs_z ] : 0.0f ); \
+			const float q     = bli_quant_get( qp->qtype, qp->buf, j*inca + l*lda ); \
+			const ctype x     = kappa_cast * scale * ( q - zero ); \
+\
+			for ( dim_t d = 0; d < dfac; ++d ) \
+				*(p + mn*dfac + d + k*ldp) = x; \
+		} \
+	} \
+\
+	PASTEMAC(ch,set0s_edge) \
+	( \
+	  cdim*dfac, cdim_max*dfac, \
+	  n, n_max, \
+	  p, ldp  \
+	); \
+}
+
+GENTFUNC( float, s, packm_mrxk_quant, BLIS_MR, BLIS_BBM, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+GENTFUNC( float, s, packm_nrxk_quant, BLIS_NR, BLIS_BBN, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
@@ -0,0 +1,112 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+// Reference int8 gemm micro-kernel, which computes
+//
+//   C := beta * C + alpha * A * B
+//
+// where A is an m x k micropanel of uint8_t values, B is a k x n micropanel
+// of int8_t values, and alpha, beta, and C are int32_t. The micropanels are
+// packed in groups of four along k: element (i,l) of A is stored at
+// a[ (l/4)*MR*4 + i*4 + l%4 ] and element (l,j) of B is stored at
+// b[ (l/4)*NR*4 + j*4 + l%4 ], where k is a multiple of four (the packing
+// routines zero-fill the remainder). Products are accumulated exactly in
+// 32-bit arithmetic. MR and NR are queried from the context at runtime.
+
+#undef  GENTFUNC
+#define GENTFUNC( opname, arch, suf ) \
+\
+void PASTEMAC3(i8,opname,arch,suf) \
+     ( \
+       dim_t               m, \
+       dim_t               n, \
+       dim_t               k, \
+       int32_t*   restrict alpha, \
+       int8_t*    restrict a, \
+       int8_t*    restrict b, \
+       int32_t*   restrict beta, \
+       int32_t*   restrict c, inc_t rs_c, inc_t cs_c, \
+       auxinfo_t*          data, \
+       cntx_t*             cntx  \
+     ) \
+{ \
+	const dim_t     mr    = bli_cntx_get_blksz_def_dt( BLIS_FLOAT, BLIS_MR_I8, cntx ); \
+	const dim_t     nr    = bli_cntx_get_blksz_def_dt( BLIS_FLOAT, BLIS_NR_I8, cntx ); \
+\
+	const uint8_t*  a_u8  = ( const uint8_t* )a; \
+	const dim_t     k_grp = k / 4; \
+\
+	int32_t         ab[ BLIS_STACK_BUF_MAX_SIZE \
+	                    / sizeof( int32_t ) ] \
+	                    __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+\
+	/* Initialize the accumulator elements in ab to zero. */ \
+	for ( dim_t i = 0; i < m * n; ++i ) ab[ i ] = 0; \
+\
+	/* Perform a series of rank-4 updates into ab. */ \
+	for ( dim_t g = 0; g < k_grp; ++g ) \
+	{ \
+		for ( dim_t j = 0; j < n; ++j ) \
+		for ( dim_t i = 0; i < m; ++i ) \
+		{ \
+			const uint8_t* restrict ai = a_u8 + i*4; \
+			const int8_t*  restrict bj = b    + j*4; \
+\
+			ab[ i + j*m ] += ( int32_t )ai[0] * bj[0] + \
+			                 ( int32_t )ai[1] * bj[1] + \
+			                 ( int32_t )ai[2] * bj[2] + \
+			                 ( int32_t )ai[3] * bj[3]; \
+		} \
+\
+		a_u8 += mr * 4; \
+		b    += nr * 4; \
+	} \
+\
+	/* Scale by alpha and accumulate into c, scaling by beta unless beta is
+	   zero (in which case c is overwritten). */ \
+	for ( dim_t j = 0; j < n; ++j ) \
+	for ( dim_t i = 0; i < m; ++i ) \
+	{ \
+		int32_t* restrict cij = c + i*rs_c + j*cs_c; \
+\
+		if ( *beta == 0 ) *cij =                 *alpha * ab[ i + j*m ]; \
+		else              *cij = *beta * *cij + *alpha * ab[ i + j*m ]; \
+	} \
+}
+
+GENTFUNC( gemm, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+
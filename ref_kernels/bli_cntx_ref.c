@@ -64,6 +64,14 @@
 // template.
 #include "bli_l3_ukr.h"
 
+// -- int8 gemm micro-kernel prototype redefinition ----------------------------
+
+#undef  i8gemm_ukr_name
+#define i8gemm_ukr_name     GENARNAME(gemm)
+
+// NOTE: Elements of A are interpreted as uint8_t.
+GEMM_UKR_PROT2( int8_t, int32_t, i8, i8gemm_ukr_name )
+
 // -- Level-3 virtual micro-kernel prototype redefinitions ---------------------
 
 // -- Prototypes for induced method level-3 microkernels --
@@ -81,6 +89,13 @@
 #undef  trsm1m_u_ukr_name
 #define trsm1m_u_ukr_name      GENARNAME(trsm1m_u)
 
+// -- 3m and 4m --
+
+#undef  gemm3m_ukr_name
+#define gemm3m_ukr_name        GENARNAME(gemm3m)
+#undef  gemm4m_ukr_name
+#define gemm4m_ukr_name        GENARNAME(gemm4m)
+
 // Instantiate prototypes for above functions via the virtual micro-kernel API
 // template.
 #include "bli_l3_ind_ukr.h"
@@ -117,6 +132,15 @@
 #undef  packm_nrxk_1er_ker_name
 #define packm_nrxk_1er_ker_name  GENARNAME(packm_nrxk_1er)
 
+#undef  packm_mrxk_4mi_ker_name
+#define packm_mrxk_4mi_ker_name  GENARNAME(packm_mrxk_4mi)
+#undef  packm_nrxk_4mi_ker_name
+#define packm_nrxk_4mi_ker_name  GENARNAME(packm_nrxk_4mi)
+#undef  packm_mrxk_3mi_ker_name
+#define packm_mrxk_3mi_ker_name  GENARNAME(packm_mrxk_3mi)
+#undef  packm_nrxk_3mi_ker_name
+#define packm_nrxk_3mi_ker_name  GENARNAME(packm_nrxk_3mi)
+
 #undef  packm_mrxmr_diag_ker_name
 #define packm_mrxmr_diag_ker_name  GENARNAME(packm_mrxmr_diag)
 #undef  packm_nrxnr_diag_ker_name
@@ -127,6 +151,20 @@
 #undef  packm_nrxnr_diag_1er_ker_name
 #define packm_nrxnr_diag_1er_ker_name  GENARNAME(packm_nrxnr_diag_1er)
 
+#undef  packm_mrxk_bf16_ker_name
+#define packm_mrxk_bf16_ker_name  GENARNAME(packm_mrxk_bf16)
+#undef  packm_nrxk_bf16_ker_name
+#define packm_nrxk_bf16_ker_name  GENARNAME(packm_nrxk_bf16)
+#undef  packm_mrxk_f16_ker_name
+#define packm_mrxk_f16_ker_name  GENARNAME(packm_mrxk_f16)
+#undef  packm_nrxk_f16_ker_name
+#define packm_nrxk_f16_ker_name  GENARNAME(packm_nrxk_f16)
+
+#undef  packm_mrxk_quant_ker_name
+#define packm_mrxk_quant_ker_name  GENARNAME(packm_mrxk_quant)
+#undef  packm_nrxk_quant_ker_name
+#define packm_nrxk_quant_ker_name  GENARNAME(packm_nrxk_quant)
+
 #undef  unpackm_mrxk_ker_name
 #define unpackm_mrxk_ker_name  GENARNAME(unpackm_mrxk)
 #undef  unpackm_nrxk_ker_name
@@ -264,6 +302,17 @@ void GENBARNAME(cntx_init)
 	bli_blksz_init_easy( &blkszs[ BLIS_BBM ],    BLIS_BBM_s,    BLIS_BBM_d,    BLIS_BBM_c,    BLIS_BBM_z );
 	bli_blksz_init_easy( &blkszs[ BLIS_BBN ],    BLIS_BBN_s,    BLIS_BBN_d,    BLIS_BBN_c,    BLIS_BBN_z );
 
+	// -- Set int8 gemm blocksizes ---------------------------------------------
+
+	// NOTE: Only the BLIS_FLOAT slot is used. KC_I8 must be a multiple of 4
+	// since the int8 micropanels are packed in groups of four along k.
+	//                                             s     d     c     z
+	bli_blksz_init_easy( &blkszs[ BLIS_MR_I8 ],    4,    0,    0,    0 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NR_I8 ],    8,    0,    0,    0 );
+	bli_blksz_init_easy( &blkszs[ BLIS_MC_I8 ],  128,    0,    0,    0 );
+	bli_blksz_init_easy( &blkszs[ BLIS_KC_I8 ], 1024,    0,    0,    0 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NC_I8 ], 4096,    0,    0,    0 );
+
 	// -- Set level-3 small/unpacked thresholds --------------------------------
 
 	// NOTE: The default thresholds are set to zero so that the sup framework
@@ -300,6 +349,11 @@ void GENBARNAME(cntx_init)
 	  BLIS_KT,  &blkszs[ BLIS_KT  ], BLIS_KT,
 	  BLIS_BBM, &blkszs[ BLIS_BBM ], BLIS_BBM,
 	  BLIS_BBN, &blkszs[ BLIS_BBN ], BLIS_BBN,
+	  BLIS_NC_I8, &blkszs[ BLIS_NC_I8 ], BLIS_NR_I8,
+	  BLIS_KC_I8, &blkszs[ BLIS_KC_I8 ], BLIS_KR,
+	  BLIS_MC_I8, &blkszs[ BLIS_MC_I8 ], BLIS_MR_I8,
+	  BLIS_NR_I8, &blkszs[ BLIS_NR_I8 ], BLIS_NR_I8,
+	  BLIS_MR_I8, &blkszs[ BLIS_MR_I8 ], BLIS_MR_I8,
 	  BLIS_VA_END
 	);
 
@@ -330,6 +384,9 @@ void GENBARNAME(cntx_init)
 	gen_func_init( &funcs[ BLIS_TRSM_L_UKR ],     trsm_l_ukr_name     );
 	gen_func_init( &funcs[ BLIS_TRSM_U_UKR ],     trsm_u_ukr_name     );
 
+	// The int8 gemm micro-kernel only occupies the BLIS_FLOAT slot.
+	bli_func_init( &funcs[ BLIS_GEMM_I8_UKR ], PASTEMAC(i8,i8gemm_ukr_name), NULL, NULL, NULL );
+
 	//                                                           s      d      c      z
 	bli_mbool_init( &mbools[ BLIS_GEMM_UKR_ROW_PREF ],        TRUE,  TRUE,  TRUE,  TRUE );
 	bli_mbool_init( &mbools[ BLIS_GEMMTRSM_L_UKR_ROW_PREF ], FALSE, FALSE, FALSE, FALSE );
@@ -410,6 +467,16 @@ void GENBARNAME(cntx_init)
 	gen_func_init_co( &funcs[ BLIS_PACKM_MRXMR_DIAG_1ER_KER ],  packm_mrxmr_diag_1er_ker_name );
 	gen_func_init_co( &funcs[ BLIS_PACKM_NRXNR_DIAG_1ER_KER ],  packm_nrxnr_diag_1er_ker_name );
 
+	// The 16-bit floating-point packm kernels only produce float micropanels.
+	bli_func_init( &funcs[ BLIS_PACKM_MRXK_BF16_KER ], PASTEMAC(s,packm_mrxk_bf16_ker_name), NULL, NULL, NULL );
+	bli_func_init( &funcs[ BLIS_PACKM_NRXK_BF16_KER ], PASTEMAC(s,packm_nrxk_bf16_ker_name), NULL, NULL, NULL );
+	bli_func_init( &funcs[ BLIS_PACKM_MRXK_F16_KER ],  PASTEMAC(s,packm_mrxk_f16_ker_name),  NULL, NULL, NULL );
+	bli_func_init( &funcs[ BLIS_PACKM_NRXK_F16_KER ],  PASTEMAC(s,packm_nrxk_f16_ker_name),  NULL, NULL, NULL );
+
+	// Likewise, the quantized packm kernels only produce float micropanels.
+	bli_func_init( &funcs[ BLIS_PACKM_MRXK_QUANT_KER ], PASTEMAC(s,packm_mrxk_quant_ker_name), NULL, NULL, NULL );
+	bli_func_init( &funcs[ BLIS_PACKM_NRXK_QUANT_KER ], PASTEMAC(s,packm_nrxk_quant_ker_name), NULL, NULL, NULL );
+
 	gen_func_init( &funcs[ BLIS_UNPACKM_MRXK_KER ],  unpackm_mrxk_ker_name );
 	gen_func_init( &funcs[ BLIS_UNPACKM_NRXK_KER ],  unpackm_nrxk_ker_name );
 
@@ -432,6 +499,12 @@ void GENBARNAME(cntx_init)
 	// -- Set miscellaneous fields ---------------------------------------------
 
 	bli_cntx_set_method( BLIS_NAT, cntx );
+
+	// A sub-configuration whose cache blocksizes have not been tuned for its
+	// hardware says so in its bli_kernel_defs_*.h header.
+#ifdef BLIS_UNTUNED_CACHE_BLKSZS
+	bli_cntx_set_untuned_blkszs( TRUE, cntx );
+#endif
 }
 
 // -----------------------------------------------------------------------------
@@ -462,6 +535,23 @@ void GENBAINAME(cntx_init)
 		gen_func_init_co( &funcs[ BLIS_TRSM_L_VIR_UKR ],     trsm1m_l_ukr_name     );
 		gen_func_init_co( &funcs[ BLIS_TRSM_U_VIR_UKR ],     trsm1m_u_ukr_name     );
 	}
+	else if ( method == BLIS_3M || method == BLIS_4M )
+	{
+		// The 3m and 4m methods are only implemented for gemm, and so only
+		// the gemm virtual micro-kernel differs from native execution.
+		if ( method == BLIS_3M )
+		{
+			gen_func_init_co( &funcs[ BLIS_GEMM_VIR_UKR ],   gemm3m_ukr_name     );
+		}
+		else
+		{
+			gen_func_init_co( &funcs[ BLIS_GEMM_VIR_UKR ],   gemm4m_ukr_name     );
+		}
+		gen_func_init_co( &funcs[ BLIS_GEMMTRSM_L_VIR_UKR ], gemmtrsm_l_ukr_name );
+		gen_func_init_co( &funcs[ BLIS_GEMMTRSM_U_VIR_UKR ], gemmtrsm_u_ukr_name );
+		gen_func_init_co( &funcs[ BLIS_TRSM_L_VIR_UKR ],     trsm_l_ukr_name     );
+		gen_func_init_co( &funcs[ BLIS_TRSM_U_VIR_UKR ],     trsm_u_ukr_name     );
+	}
 	else // if ( method == BLIS_NAT )
 	{
 		gen_func_init_co( &funcs[ BLIS_GEMM_VIR_UKR ],       gemm_ukr_name       );
@@ -498,6 +588,16 @@ void GENBAINAME(cntx_init)
 		gen_func_init_co( &funcs[ BLIS_PACKM_MRXK_KER ],  packm_mrxk_1er_ker_name );
 		gen_func_init_co( &funcs[ BLIS_PACKM_NRXK_KER ],  packm_nrxk_1er_ker_name );
 	}
+	else if ( method == BLIS_4M )
+	{
+		gen_func_init_co( &funcs[ BLIS_PACKM_MRXK_KER ],  packm_mrxk_4mi_ker_name );
+		gen_func_init_co( &funcs[ BLIS_PACKM_NRXK_KER ],  packm_nrxk_4mi_ker_name );
+	}
+	else if ( method == BLIS_3M )
+	{
+		gen_func_init_co( &funcs[ BLIS_PACKM_MRXK_KER ],  packm_mrxk_3mi_ker_name );
+		gen_func_init_co( &funcs[ BLIS_PACKM_NRXK_KER ],  packm_nrxk_3mi_ker_name );
+	}
 	else // if ( method == BLIS_NAT )
 	{
 		gen_func_init( &funcs[ BLIS_PACKM_MRXK_KER ],  packm_mrxk_ker_name );
@@ -524,6 +624,41 @@ void GENBAINAME(cntx_init)
 		GENBAINAME(cntx_init_blkszs)( method, BLIS_SCOMPLEX, cntx );
 		GENBAINAME(cntx_init_blkszs)( method, BLIS_DCOMPLEX, cntx );
 	}
+	else if ( method == BLIS_3M || method == BLIS_4M )
+	{
+		// The 3m and 4m methods use the real domain register blocksizes
+		// (since each complex element occupies one element of each real
+		// micropanel). Since the packed micropanels occupy three (3m) or
+		// two (4m) times the space of their real domain counterparts, we
+		// halve kc to keep the cache footprint of the packed blocks of A
+		// and panels of B close to that of the real domain. (Dividing kc by
+		// three for 3m was found to be slower in practice, since it makes
+		// each of the real micro-kernel calls shorter.)
+		const double kc_scalr = 2.0;
+
+		bli_cntx_set_ind_blkszs
+		(
+		  method, BLIS_SCOMPLEX, cntx,
+		  BLIS_NC, 1.0,      1.0,
+		  BLIS_KC, kc_scalr, kc_scalr,
+		  BLIS_MC, 1.0,      1.0,
+		  BLIS_NR, 1.0,      1.0,
+		  BLIS_MR, 1.0,      1.0,
+		  BLIS_KR, 1.0,      1.0,
+		  BLIS_VA_END
+		);
+		bli_cntx_set_ind_blkszs
+		(
+		  method, BLIS_DCOMPLEX, cntx,
+		  BLIS_NC, 1.0,      1.0,
+		  BLIS_KC, kc_scalr, kc_scalr,
+		  BLIS_MC, 1.0,      1.0,
+		  BLIS_NR, 1.0,      1.0,
+		  BLIS_MR, 1.0,      1.0,
+		  BLIS_KR, 1.0,      1.0,
+		  BLIS_VA_END
+		);
+	}
 	else // if ( method == BLIS_NAT )
 	{
 		// No change in blocksizes needed for native execution.
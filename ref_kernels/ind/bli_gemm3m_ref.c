@@ -0,0 +1,137 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#undef  GENTFUNCCO
+#define GENTFUNCCO( ctype, ctype_r, ch, chr, opname, arch, suf ) \
+\
+void PASTEMAC3(ch,opname,arch,suf) \
+     ( \
+       dim_t               m, \
+       dim_t               n, \
+       dim_t               k, \
+       ctype*     restrict alpha, \
+       ctype*     restrict a, \
+       ctype*     restrict b, \
+       ctype*     restrict beta, \
+       ctype*     restrict c, inc_t rs_c, inc_t cs_c, \
+       auxinfo_t*          data, \
+       cntx_t*             cntx  \
+     ) \
+{ \
+	const num_t       dt_r      = PASTEMAC(chr,type); \
+\
+	PASTECH(chr,gemm_ukr_ft) \
+	                  rgemm_ukr = bli_cntx_get_ukr_dt( dt_r, BLIS_GEMM_UKR, cntx ); \
+	const bool        col_pref  = bli_cntx_ukr_prefers_cols_dt( dt_r, BLIS_GEMM_UKR, cntx ); \
+\
+	const dim_t       mr_r      = bli_cntx_get_blksz_def_dt( dt_r, BLIS_MR, cntx ); \
+	const dim_t       nr_r      = bli_cntx_get_blksz_def_dt( dt_r, BLIS_NR, cntx ); \
+\
+	const inc_t       is_a      = bli_auxinfo_is_a( data ); \
+	const inc_t       is_b      = bli_auxinfo_is_b( data ); \
+\
+	ctype_r           ct_1[ BLIS_STACK_BUF_MAX_SIZE \
+	                        / sizeof( ctype_r ) ] \
+	                        __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+	ctype_r           ct_2[ BLIS_STACK_BUF_MAX_SIZE \
+	                        / sizeof( ctype_r ) ] \
+	                        __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+	ctype_r           ct_3[ BLIS_STACK_BUF_MAX_SIZE \
+	                        / sizeof( ctype_r ) ] \
+	                        __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+	const inc_t       rs_ct     = ( col_pref ? 1 : nr_r ); \
+	const inc_t       cs_ct     = ( col_pref ? mr_r : 1 ); \
+\
+	ctype_r* restrict a_r       = ( ctype_r* )a; \
+	ctype_r* restrict a_i       = ( ctype_r* )a +   is_a; \
+	ctype_r* restrict a_ri      = ( ctype_r* )a + 2*is_a; \
+\
+	ctype_r* restrict b_r       = ( ctype_r* )b; \
+	ctype_r* restrict b_i       = ( ctype_r* )b +   is_b; \
+	ctype_r* restrict b_ri      = ( ctype_r* )b + 2*is_b; \
+\
+	ctype_r* restrict zero_r    = PASTEMAC(chr,0); \
+\
+	ctype_r           alpha_r   = PASTEMAC(ch,real)( *alpha ); \
+	ctype_r           alpha_i   = PASTEMAC(ch,imag)( *alpha ); \
+\
+	/* SAFETY CHECK: The higher level implementation should never
+	   allow an alpha with non-zero imaginary component to be passed
+	   in, because it is applied when packing the micropanels. If alpha
+	   is not real, then something is very wrong. */ \
+	if ( !PASTEMAC(chr,eq0)( alpha_i ) ) \
+		bli_check_error_code( BLIS_NOT_YET_IMPLEMENTED ); \
+\
+	/* The following three real gemm micro-kernel calls implement the 3m
+	   method, which induces a complex matrix multiplication with one fewer
+	   real matrix product than 4m by computing
+
+	     ct_1 = alpha_r * ( a_r          * b_r          );
+	     ct_2 = alpha_r * ( a_i          * b_i          );
+	     ct_3 = alpha_r * ( ( a_r + a_i ) * ( b_r + b_i ) );
+
+	   where the real, imaginary, and real+imaginary micropanels were packed
+	   according to the 3mi format. The real and imaginary parts of the
+	   product are then ct_1 - ct_2 and ct_3 - ct_1 - ct_2, respectively. */ \
+	rgemm_ukr( m, n, k, &alpha_r, a_r,  b_r,  zero_r, ct_1, rs_ct, cs_ct, data, cntx ); \
+	rgemm_ukr( m, n, k, &alpha_r, a_i,  b_i,  zero_r, ct_2, rs_ct, cs_ct, data, cntx ); \
+	rgemm_ukr( m, n, k, &alpha_r, a_ri, b_ri, zero_r, ct_3, rs_ct, cs_ct, data, cntx ); \
+\
+	/* Combine the products and accumulate the final result back to c. */ \
+	for ( dim_t j = 0; j < n; ++j ) \
+	for ( dim_t i = 0; i < m; ++i ) \
+	{ \
+		const ctype_r p1 = *(ct_1 + i*rs_ct + j*cs_ct); \
+		const ctype_r p2 = *(ct_2 + i*rs_ct + j*cs_ct); \
+		const ctype_r p3 = *(ct_3 + i*rs_ct + j*cs_ct); \
+		ctype         ct; \
+\
+		PASTEMAC(ch,sets)( p1 - p2, p3 - p1 - p2, ct ); \
+\
+		if ( PASTEMAC(ch,eq0)( *beta ) ) \
+		{ \
+			PASTEMAC(ch,copys)( ct, *(c + i*rs_c + j*cs_c) ); \
+		} \
+		else \
+		{ \
+			PASTEMAC(ch,xpbys)( ct, *beta, *(c + i*rs_c + j*cs_c) ); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNCCO_BASIC2( gemm3m, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+
@@ -0,0 +1,136 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#undef  GENTFUNCCO
+#define GENTFUNCCO( ctype, ctype_r, ch, chr, opname, arch, suf ) \
+\
+void PASTEMAC3(ch,opname,arch,suf) \
+     ( \
+       dim_t               m, \
+       dim_t               n, \
+       dim_t               k, \
+       ctype*     restrict alpha, \
+       ctype*     restrict a, \
+       ctype*     restrict b, \
+       ctype*     restrict beta, \
+       ctype*     restrict c, inc_t rs_c, inc_t cs_c, \
+       auxinfo_t*          data, \
+       cntx_t*             cntx  \
+     ) \
+{ \
+	const num_t       dt_r      = PASTEMAC(chr,type); \
+\
+	PASTECH(chr,gemm_ukr_ft) \
+	                  rgemm_ukr = bli_cntx_get_ukr_dt( dt_r, BLIS_GEMM_UKR, cntx ); \
+	const bool        col_pref  = bli_cntx_ukr_prefers_cols_dt( dt_r, BLIS_GEMM_UKR, cntx ); \
+\
+	const dim_t       mr_r      = bli_cntx_get_blksz_def_dt( dt_r, BLIS_MR, cntx ); \
+	const dim_t       nr_r      = bli_cntx_get_blksz_def_dt( dt_r, BLIS_NR, cntx ); \
+\
+	const inc_t       is_a      = bli_auxinfo_is_a( data ); \
+	const inc_t       is_b      = bli_auxinfo_is_b( data ); \
+\
+	ctype_r           ct_r[ BLIS_STACK_BUF_MAX_SIZE \
+	                        / sizeof( ctype_r ) ] \
+	                        __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+	ctype_r           ct_i[ BLIS_STACK_BUF_MAX_SIZE \
+	                        / sizeof( ctype_r ) ] \
+	                        __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+	const inc_t       rs_ct     = ( col_pref ? 1 : nr_r ); \
+	const inc_t       cs_ct     = ( col_pref ? mr_r : 1 ); \
+\
+	ctype_r* restrict a_r       = ( ctype_r* )a; \
+	ctype_r* restrict a_i       = ( ctype_r* )a + is_a; \
+\
+	ctype_r* restrict b_r       = ( ctype_r* )b; \
+	ctype_r* restrict b_i       = ( ctype_r* )b + is_b; \
+\
+	ctype_r* restrict zero_r    = PASTEMAC(chr,0); \
+	ctype_r* restrict one_r     = PASTEMAC(chr,1); \
+\
+	ctype_r           alpha_r   = PASTEMAC(ch,real)( *alpha ); \
+	ctype_r           alpha_i   = PASTEMAC(ch,imag)( *alpha ); \
+	ctype_r           m_alpha_r = -alpha_r; \
+\
+	/* SAFETY CHECK: The higher level implementation should never
+	   allow an alpha with non-zero imaginary component to be passed
+	   in, because it is applied when packing the micropanels. If alpha
+	   is not real, then something is very wrong. */ \
+	if ( !PASTEMAC(chr,eq0)( alpha_i ) ) \
+		bli_check_error_code( BLIS_NOT_YET_IMPLEMENTED ); \
+\
+	/* The following four real gemm micro-kernel calls implement the 4m
+	   method, which induces a complex matrix multiplication by computing
+	   the real and imaginary parts of the product separately:
+
+	     ct_r = alpha_r * ( a_r * b_r - a_i * b_i );
+	     ct_i = alpha_r * ( a_r * b_i + a_i * b_r );
+
+	   where the real and imaginary micropanels were packed according to
+	   the 4mi format. */ \
+	rgemm_ukr( m, n, k, &alpha_r,   a_r, b_r, zero_r, ct_r, rs_ct, cs_ct, data, cntx ); \
+	rgemm_ukr( m, n, k, &m_alpha_r, a_i, b_i, one_r,  ct_r, rs_ct, cs_ct, data, cntx ); \
+	rgemm_ukr( m, n, k, &alpha_r,   a_r, b_i, zero_r, ct_i, rs_ct, cs_ct, data, cntx ); \
+	rgemm_ukr( m, n, k, &alpha_r,   a_i, b_r, one_r,  ct_i, rs_ct, cs_ct, data, cntx ); \
+\
+	/* Accumulate the final result in ct_r and ct_i back to c. */ \
+	if ( PASTEMAC(ch,eq0)( *beta ) ) \
+	{ \
+		for ( dim_t j = 0; j < n; ++j ) \
+		for ( dim_t i = 0; i < m; ++i ) \
+		{ \
+			PASTEMAC(ch,sets)( *(ct_r + i*rs_ct + j*cs_ct), \
+			                   *(ct_i + i*rs_ct + j*cs_ct), \
+			                   *(c    + i*rs_c  + j*cs_c ) ); \
+		} \
+	} \
+	else \
+	{ \
+		for ( dim_t j = 0; j < n; ++j ) \
+		for ( dim_t i = 0; i < m; ++i ) \
+		{ \
+			ctype ct; \
+\
+			PASTEMAC(ch,sets)( *(ct_r + i*rs_ct + j*cs_ct), \
+			                   *(ct_i + i*rs_ct + j*cs_ct), ct ); \
+			PASTEMAC(ch,xpbys)( ct, *beta, *(c + i*rs_c + j*cs_c) ); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNCCO_BASIC2( gemm4m, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+
@@ -0,0 +1,328 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "blis.h"
+
+//
+// Accuracy and throughput of the fused attention addon (bao_?attn()).
+//
+// With no arguments, each (real) datatype is checked against a reference
+// computed in double precision, which forms the matrix of scores of each
+// head explicitly, for several shapes (including numbers of keys greater
+// than KC and numbers of queries greater than MC), with and without a
+// causal mask, with row- and column-stored operands, with several heads,
+// and with one and with several threads.
+//
+// With "-p" followed by a list of problem sizes n, the throughput of single-
+// precision attention with n queries and n keys, each with 64 features, is
+// compared with that of the unfused computation: bli_sgemm() to form the
+// n x n matrix of scores, a row-wise softmax, and bli_sgemm() to multiply
+// by V. The number of threads is taken from the environment (e.g.
+// BLIS_NUM_THREADS).
+//
+
+static double rand_val( void )
+{
+	return 2.0 * rand() / RAND_MAX - 1.0;
+}
+
+// O := softmax( alpha Q K^T ) V for one head, where all operands are given
+// with their strides (in units of elements).
+static void ref_attn( bool causal, dim_t m, dim_t n, dim_t d, dim_t dv, double alpha,
+                      const double* q, inc_t rs_q, inc_t cs_q,
+                      const double* k, inc_t rs_k, inc_t cs_k,
+                      const double* v, inc_t rs_v, inc_t cs_v,
+                            double* o, inc_t rs_o, inc_t cs_o )
+{
+	double* s = malloc( ( n + 1 ) * sizeof( double ) );
+
+	for ( dim_t i = 0; i < m; ++i )
+	{
+		const dim_t nk = causal ? bli_max( bli_min( n, i + n - m + 1 ), 0 ) : n;
+
+		double mx = -INFINITY, sum = 0.0;
+
+		for ( dim_t j = 0; j < nk; ++j )
+		{
+			double acc = 0.0;
+			for ( dim_t p = 0; p < d; ++p )
+				acc += q[ i * rs_q + p * cs_q ] * k[ j * rs_k + p * cs_k ];
+			s[ j ] = alpha * acc;
+			mx = bli_max( mx, s[ j ] );
+		}
+
+		for ( dim_t j = 0; j < nk; ++j )
+		{
+			s[ j ] = exp( s[ j ] - mx );
+			sum += s[ j ];
+		}
+
+		for ( dim_t p = 0; p < dv; ++p )
+		{
+			double acc = 0.0;
+			for ( dim_t j = 0; j < nk; ++j )
+				acc += s[ j ] * v[ j * rs_v + p * cs_v ];
+			o[ i * rs_o + p * cs_o ] = ( nk > 0 ? acc / sum : 0.0 );
+		}
+	}
+
+	free( s );
+}
+
+static int test_attn( num_t dt, dim_t h, dim_t m, dim_t n, dim_t d, dim_t dv,
+                      bool causal, bool row, dim_t nt )
+{
+	const size_t es = bli_dt_size( dt );
+
+	// The strides of an r x c matrix, and the stride between heads.
+	#define STRIDES( r, c ) ( row ? ( c ) : 1 ), ( row ? 1 : ( r ) ), ( ( r ) * ( c ) )
+
+	const inc_t sq[ 3 ] = { STRIDES( m, d ) };
+	const inc_t sk[ 3 ] = { STRIDES( n, d ) };
+	const inc_t sv[ 3 ] = { STRIDES( n, dv ) };
+	const inc_t so[ 3 ] = { STRIDES( m, dv ) };
+
+	const size_t nq = h * m * d, nk = h * n * d, nv = h * n * dv, no = h * m * dv;
+
+	double* qd = malloc( nq * sizeof( double ) );
+	double* kd = malloc( nk * sizeof( double ) );
+	double* vd = malloc( nv * sizeof( double ) );
+	double* od = malloc( no * sizeof( double ) );
+	void*   q  = malloc( nq * es );
+	void*   k  = malloc( nk * es );
+	void*   v  = malloc( nv * es );
+	void*   o  = malloc( no * es );
+
+	// Generate the operands in the precision being tested, so that the
+	// reference computes with exactly the same values.
+	#define FILL( x, xd, len ) \
+	for ( size_t i = 0; i < len; ++i ) \
+	{ \
+		if ( dt == BLIS_FLOAT ) { ( ( float* )x )[ i ] = rand_val(); xd[ i ] = ( ( float* )x )[ i ]; } \
+		else                    { ( ( double* )x )[ i ] = rand_val(); xd[ i ] = ( ( double* )x )[ i ]; } \
+	}
+
+	FILL( q, qd, nq );
+	FILL( k, kd, nk );
+	FILL( v, vd, nv );
+
+	// Fill O with NaN, which must be overwritten.
+	for ( size_t i = 0; i < no; ++i )
+	{
+		if ( dt == BLIS_FLOAT ) ( ( float*  )o )[ i ] = NAN;
+		else                    ( ( double* )o )[ i ] = NAN;
+	}
+
+	// Scale the scores so that the softmax is neither flat nor one-hot.
+	const double alpha = 4.0 / sqrt( ( double )d );
+	const uplo_t mask  = causal ? BLIS_LOWER : BLIS_DENSE;
+
+
+	// The typed API has no _ex() form, so set the global number of threads.
+	bli_thread_set_num_threads( nt );
+
+	if ( dt == BLIS_FLOAT )
+	{
+		float alpha_s = alpha;
+		bao_sattn( mask, h, m, n, d, dv, &alpha_s,
+		           q, sq[ 0 ], sq[ 1 ], sq[ 2 ],
+		           k, sk[ 0 ], sk[ 1 ], sk[ 2 ],
+		           v, sv[ 0 ], sv[ 1 ], sv[ 2 ],
+		           o, so[ 0 ], so[ 1 ], so[ 2 ] );
+	}
+	else
+	{
+		double alpha_d = alpha;
+		bao_dattn( mask, h, m, n, d, dv, &alpha_d,
+		           q, sq[ 0 ], sq[ 1 ], sq[ 2 ],
+		           k, sk[ 0 ], sk[ 1 ], sk[ 2 ],
+		           v, sv[ 0 ], sv[ 1 ], sv[ 2 ],
+		           o, so[ 0 ], so[ 1 ], so[ 2 ] );
+	}
+
+	for ( dim_t i = 0; i < h; ++i )
+		ref_attn( causal, m, n, d, dv, alpha,
+		          qd + i * sq[ 2 ], sq[ 0 ], sq[ 1 ],
+		          kd + i * sk[ 2 ], sk[ 0 ], sk[ 1 ],
+		          vd + i * sv[ 2 ], sv[ 0 ], sv[ 1 ],
+		          od + i * so[ 2 ], so[ 0 ], so[ 1 ] );
+
+	// The elements of O are convex combinations of those of V, so measure
+	// the largest absolute error in units of the machine epsilon.
+	double diff = 0.0;
+
+	for ( size_t i = 0; i < no; ++i )
+	{
+		const double x = ( dt == BLIS_FLOAT ? ( ( float* )o )[ i ] : ( ( double* )o )[ i ] );
+		const double e = fabs( x - od[ i ] );
+
+		diff = ( e == e ? bli_max( diff, e ) : INFINITY );
+	}
+
+	double eps   = ( dt == BLIS_FLOAT ) ? 5.96e-8 : 1.11e-16;
+	double resid = diff / ( ( d + 1 ) * eps );
+	int    fail  = !( resid < 10.0 );
+
+	printf( "%cattn %s %s nt %d h %d m %4d n %4d d %3d dv %3d: resid = %8.2e %s\n",
+	        dt == BLIS_FLOAT ? 's' : 'd', causal ? "causal" : "dense ",
+	        row ? "row" : "col", ( int )nt, ( int )h, ( int )m, ( int )n,
+	        ( int )d, ( int )dv, resid, fail ? "FAIL" : "PASS" );
+
+	free( qd ); free( kd ); free( vd ); free( od );
+	free( q );  free( k );  free( v );  free( o );
+
+	return fail;
+}
+
+// The unfused computation, with row-stored operands.
+static void unfused_sattn( dim_t n, dim_t d, float alpha, float* q, float* k,
+                           float* v, float* s, float* o )
+{
+	float zero = 0.0f, one = 1.0f;
+
+	bli_sgemm( BLIS_NO_TRANSPOSE, BLIS_TRANSPOSE, n, n, d,
+	           &alpha, q, d, 1, k, d, 1, &zero, s, n, 1 );
+
+	for ( dim_t i = 0; i < n; ++i )
+	{
+		float* s_i = s + i * n;
+		float  mx  = -INFINITY, sum = 0.0f;
+
+		for ( dim_t j = 0; j < n; ++j ) mx = bli_max( mx, s_i[ j ] );
+		for ( dim_t j = 0; j < n; ++j ) { s_i[ j ] = expf( s_i[ j ] - mx ); sum += s_i[ j ]; }
+		for ( dim_t j = 0; j < n; ++j ) s_i[ j ] /= sum;
+	}
+
+	bli_sgemm( BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE, n, d, n,
+	           &one, s, n, 1, v, d, 1, &zero, o, d, 1 );
+}
+
+static void time_attn( dim_t n, double* gflops_ref, double* gflops_bao )
+{
+	const dim_t d = 64;
+
+	float* q = malloc( n * d * sizeof( float ) );
+	float* k = malloc( n * d * sizeof( float ) );
+	float* v = malloc( n * d * sizeof( float ) );
+	float* o = malloc( n * d * sizeof( float ) );
+	float* s = malloc( n * n * sizeof( float ) );
+
+	for ( dim_t i = 0; i < n * d; ++i )
+	{
+		q[ i ] = rand_val(); k[ i ] = rand_val(); v[ i ] = rand_val();
+	}
+
+	float alpha = 1.0f / sqrtf( ( float )d );
+
+	double dtime_ref = 1.0e9;
+	double dtime_bao = 1.0e9;
+
+	for ( int r = 0; r < 3; ++r )
+	{
+		double dtime = bli_clock();
+		unfused_sattn( n, d, alpha, q, k, v, s, o );
+		dtime_ref = bli_clock_min_diff( dtime_ref, dtime );
+
+		dtime = bli_clock();
+		bao_sattn( BLIS_DENSE, 1, n, n, d, d, &alpha,
+		           q, d, 1, 0, k, d, 1, 0, v, d, 1, 0, o, d, 1, 0 );
+		dtime_bao = bli_clock_min_diff( dtime_bao, dtime );
+	}
+
+	const double flops = 4.0 * n * n * d;
+
+	*gflops_ref = flops / ( dtime_ref * 1.0e9 );
+	*gflops_bao = flops / ( dtime_bao * 1.0e9 );
+
+	free( q ); free( k ); free( v ); free( o ); free( s );
+}
+
+int main( int argc, char** argv )
+{
+	bli_init();
+
+	if ( argc > 1 && strcmp( argv[ 1 ], "-p" ) == 0 )
+	{
+		printf( "%8s %10s %10s\n", "n", "unfused", "bao" );
+
+		for ( int i = 2; i < argc; ++i )
+		{
+			dim_t  n = atoi( argv[ i ] );
+			double gf_ref, gf_bao;
+
+			time_attn( n, &gf_ref, &gf_bao );
+
+			printf( "%8d %10.2f %10.2f\n", ( int )n, gf_ref, gf_bao );
+		}
+
+		bli_finalize();
+		return 0;
+	}
+
+	const num_t dts[]       = { BLIS_FLOAT, BLIS_DOUBLE };
+	const dim_t shapes[][4] = { {   1,   1,   1,   1 }, {  17,  33,   8,   5 },
+	                            { 100,  80,  64,  64 }, { 300, 500,  40,  24 },
+	                            {  37, 700, 128,  72 }, { 200, 300,  17, 100 },
+	                            { 600, 600,  64,  64 }, {  50,  20,  16,  16 } };
+	const dim_t nts[]       = { 1, 3 };
+
+	int n_fail = 0, n_test = 0;
+
+	for ( int idt = 0; idt < 2; ++idt )
+	for ( int is = 0; is < 8; ++is )
+	for ( int st = 0; st < 4; ++st )
+	for ( int it = 0; it < 2; ++it )
+	{
+		const dim_t* s = shapes[ is ];
+
+		n_fail += test_attn( dts[ idt ], 1 + ( is + st ) % 3,
+		                     s[ 0 ], s[ 1 ], s[ 2 ], s[ 3 ],
+		                     st & 1, st >> 1, nts[ it ] );
+		++n_test;
+	}
+
+	printf( "%d of %d tests passed\n", n_test - n_fail, n_test );
+
+	bli_finalize();
+
+	return n_fail ? 1 : 0;
+}
+
@@ -0,0 +1,712 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "blis.h"
+#include "bench_util.h"
+
+//
+// Unified level-3 benchmark driver.
+//
+// Each requested operation is timed for each datatype, storage combination,
+// shape, problem size, and thread count, and the results are written as CSV
+// (the default) or JSON. For each problem, the best, mean, and standard
+// deviation of the GFLOPS over the repetitions are reported (after one
+// untimed warm-up run), along with the percentage of the theoretical peak of
+// the cores used, which is derived from the vector width and FMA throughput
+// of the running sub-configuration and the clock rate.
+//
+// The shapes are defined in terms of each size s of the sweep (with s/8
+// written as t):
+//
+//   square    m = s, n = s, k = s
+//   tall      m = s, n = t, k = s   (tall-skinny C)
+//   wide      m = t, n = s, k = s   (short-wide C)
+//   smallk    m = s, n = s, k = t   (rank-k update)
+//
+// gemmt and herk compute an m x m lower triangle of C and ignore n, and
+// trsm, trmm, and symm apply an m x m lower triangular or symmetric matrix A
+// from the left and ignore k; shapes that thereby duplicate an earlier one
+// are skipped. The characters of a storage combination give the storage ('r'
+// for rows or 'c' for columns) of C, A, and B, in that order, where for trsm
+// and trmm "C" is the right-hand side B and the third character is unused.
+//
+// If a baseline (a CSV file written by an earlier run) is given, each result
+// is compared with the baseline result for the same problem, and flagged as
+// a regression if its best GFLOPS fell by more than the tolerance or, if
+// larger, twice its coefficient of variation. The driver then exits with
+// status 1 if any regression was flagged.
+//
+// Usage: bench_l3.x [-o ops] [-d dts] [-s stors] [-a shapes] [-p sizes]
+//                   [-t nts] [-r reps] [-c ghz] [-f fmt] [-b file] [-T pct]
+//
+//   -o ops     comma-separated operations, a subset of
+//              gemm,gemmt,herk,trsm,trmm,symm (default: all of them)
+//   -d dts     datatypes, a subset of "sdcz" (default: "d")
+//   -s stors   comma-separated storage combinations (default: "ccc")
+//   -a shapes  comma-separated shapes, a subset of square,tall,wide,smallk
+//              (default: all of them)
+//   -p sizes   sweep of sizes as first:last:inc (default: 256:1024:256)
+//   -t nts     comma-separated thread counts (default: from the
+//              environment, e.g. BLIS_NUM_THREADS)
+//   -r reps    timed repetitions per problem (default: 3)
+//   -c ghz     clock rate in GHz (default: the maximum clock rate reported
+//              by cpufreq or, failing that, the clock rate reported by
+//              /proc/cpuinfo; if neither is available, the percentage of
+//              peak is omitted)
+//   -f fmt     csv or json (default: csv)
+//   -b file    baseline CSV file to compare against
+//   -T pct     regression tolerance in percent (default: 5)
+//
+
+typedef enum
+{
+	OP_GEMM = 0,
+	OP_GEMMT,
+	OP_HERK,
+	OP_TRSM,
+	OP_TRMM,
+	OP_SYMM,
+	OP_NUM
+} op_t;
+
+static const char* op_strs[ OP_NUM ] =
+{
+	"gemm", "gemmt", "herk", "trsm", "trmm", "symm"
+};
+
+typedef enum
+{
+	SHAPE_SQUARE = 0,
+	SHAPE_TALL,
+	SHAPE_WIDE,
+	SHAPE_SMALLK,
+	SHAPE_NUM
+} shape_t;
+
+static const char* shape_strs[ SHAPE_NUM ] =
+{
+	"square", "tall", "wide", "smallk"
+};
+
+// A result of this run or of the baseline.
+typedef struct
+{
+	char   op[ 8 ];
+	char   dt;
+	char   stor[ 4 ];
+	char   shape[ 8 ];
+	dim_t  m, n, k, nt;
+	double gflops;
+} result_t;
+
+// -- Theoretical peak ---------------------------------------------------------
+
+// The theoretical peak GFLOPS of one core for a datatype, or zero if it is
+// unknown.
+static double peak_gflops_core( num_t dt, double ghz )
+{
+	return ghz * peak_flops_per_cycle( bli_arch_query_id(), dt );
+}
+
+// -- Problems -----------------------------------------------------------------
+
+static void shape_dims( shape_t shape, dim_t s, dim_t* m, dim_t* n, dim_t* k )
+{
+	const dim_t t = bli_max( s / 8, 1 );
+
+	*m = ( shape == SHAPE_WIDE   ? t : s );
+	*n = ( shape == SHAPE_TALL   ? t : s );
+	*k = ( shape == SHAPE_SMALLK ? t : s );
+}
+
+// Replace the dimensions that an operation ignores with the ones it uses.
+static void op_dims( op_t op, dim_t* m, dim_t* n, dim_t* k )
+{
+	if      ( op == OP_GEMMT || op == OP_HERK ) *n = *m;
+	else if ( op == OP_TRSM || op == OP_TRMM || op == OP_SYMM ) *k = *m;
+}
+
+static double op_flops( op_t op, num_t dt, dim_t m, dim_t n, dim_t k )
+{
+	double flops;
+
+	if      ( op == OP_GEMM )  flops = 2.0 * m * n * k;
+	else if ( op == OP_GEMMT ||
+	          op == OP_HERK )  flops = 1.0 * m * m * k;
+	else if ( op == OP_SYMM )  flops = 2.0 * m * m * n;
+	else /* trsm, trmm */      flops = 1.0 * m * m * n;
+
+	if ( bli_is_complex( dt ) ) flops *= 4.0;
+
+	return flops;
+}
+
+static void obj_create_stor( num_t dt, dim_t m, dim_t n, char stor, obj_t* x )
+{
+	if ( stor == 'r' ) bli_obj_create( dt, m, n, n, 1, x );
+	else               bli_obj_create( dt, m, n, 1, m, x );
+
+	bli_randm( x );
+}
+
+typedef struct
+{
+	op_t  op;
+	obj_t a, b, c, c_save;
+} prob_t;
+
+static void prob_create( op_t op, num_t dt, const char* stor,
+                         dim_t m, dim_t n, dim_t k, prob_t* p )
+{
+	p->op = op;
+
+	if ( op == OP_GEMM )
+	{
+		obj_create_stor( dt, m, n, stor[ 0 ], &p->c );
+		obj_create_stor( dt, m, k, stor[ 1 ], &p->a );
+		obj_create_stor( dt, k, n, stor[ 2 ], &p->b );
+	}
+	else if ( op == OP_GEMMT || op == OP_HERK )
+	{
+		obj_create_stor( dt, m, m, stor[ 0 ], &p->c );
+		obj_create_stor( dt, m, k, stor[ 1 ], &p->a );
+		obj_create_stor( dt, k, m, stor[ 2 ], &p->b );
+
+		bli_obj_set_struc( op == OP_HERK ? BLIS_HERMITIAN : BLIS_TRIANGULAR, &p->c );
+		bli_obj_set_uplo( BLIS_LOWER, &p->c );
+	}
+	else if ( op == OP_SYMM )
+	{
+		obj_create_stor( dt, m, n, stor[ 0 ], &p->c );
+		obj_create_stor( dt, m, m, stor[ 1 ], &p->a );
+		obj_create_stor( dt, m, n, stor[ 2 ], &p->b );
+
+		bli_obj_set_struc( BLIS_SYMMETRIC, &p->a );
+		bli_obj_set_uplo( BLIS_LOWER, &p->a );
+	}
+	else // trsm, trmm
+	{
+		obj_create_stor( dt, m, n, stor[ 0 ], &p->c );
+		obj_create_stor( dt, m, m, stor[ 1 ], &p->a );
+		bli_obj_create( dt, 1, 1, 0, 0, &p->b );
+
+		// Make A well-conditioned.
+		bli_obj_set_struc( BLIS_TRIANGULAR, &p->a );
+		bli_obj_set_uplo( BLIS_LOWER, &p->a );
+		bli_shiftd( &BLIS_TWO, &p->a );
+	}
+
+	// Since trsm and trmm overwrite their right-hand side, it is restored
+	// before each run.
+	bli_obj_create( dt, 1, 1, 0, 0, &p->c_save );
+	if ( op == OP_TRSM || op == OP_TRMM )
+	{
+		bli_obj_free( &p->c_save );
+		bli_obj_create( dt, m, n, 0, 0, &p->c_save );
+		bli_copym( &p->c, &p->c_save );
+	}
+}
+
+static void prob_free( prob_t* p )
+{
+	bli_obj_free( &p->a );
+	bli_obj_free( &p->b );
+	bli_obj_free( &p->c );
+	bli_obj_free( &p->c_save );
+}
+
+// Run a problem, returning the time it took (excluding any restoration of
+// the right-hand side).
+static double prob_run( prob_t* p, rntm_t* rntm )
+{
+	if ( p->op == OP_TRSM || p->op == OP_TRMM )
+		bli_copym( &p->c_save, &p->c );
+
+	double t = bli_clock();
+
+	switch ( p->op )
+	{
+		case OP_GEMM:
+			bli_gemm_ex( &BLIS_ONE, &p->a, &p->b, &BLIS_ONE, &p->c, NULL, rntm );
+			break;
+		case OP_GEMMT:
+			bli_gemmt_ex( &BLIS_ONE, &p->a, &p->b, &BLIS_ONE, &p->c, NULL, rntm );
+			break;
+		case OP_HERK:
+			bli_herk_ex( &BLIS_ONE, &p->a, &BLIS_ONE, &p->c, NULL, rntm );
+			break;
+		case OP_TRSM:
+			bli_trsm_ex( BLIS_LEFT, &BLIS_ONE, &p->a, &p->c, NULL, rntm );
+			break;
+		case OP_TRMM:
+			bli_trmm_ex( BLIS_LEFT, &BLIS_ONE, &p->a, &p->c, NULL, rntm );
+			break;
+		case OP_SYMM:
+			bli_symm_ex( BLIS_LEFT, &BLIS_ONE, &p->a, &p->b, &BLIS_ONE, &p->c, NULL, rntm );
+			break;
+		default:
+			break;
+	}
+
+	return bli_clock() - t;
+}
+
+// -- Baseline -----------------------------------------------------------------
+
+static bool result_matches( const result_t* r1, const result_t* r2 )
+{
+	return strcmp( r1->op, r2->op ) == 0 && r1->dt == r2->dt &&
+	       strcmp( r1->stor, r2->stor ) == 0 &&
+	       strcmp( r1->shape, r2->shape ) == 0 &&
+	       r1->m == r2->m && r1->n == r2->n && r1->k == r2->k &&
+	       r1->nt == r2->nt;
+}
+
+// Read the results of a CSV file written by this driver, returning their
+// number, or -1 if the file cannot be read. The columns are located by name
+// in the header, so baselines written by versions of the driver with other
+// columns can still be read.
+static long baseline_read( const char* path, result_t** results )
+{
+	enum { C_OP, C_DT, C_STOR, C_SHAPE, C_M, C_N, C_K, C_NT, C_GFLOPS, C_NUM };
+	static const char* names[ C_NUM ] =
+	{
+		"op", "dt", "stor", "shape", "m", "n", "k", "nt", "gflops"
+	};
+	int   cols[ C_NUM ];
+	char  line[ 1024 ];
+	long  n = 0, n_alloc = 0;
+	FILE* fp = fopen( path, "r" );
+
+	*results = NULL;
+
+	if ( fp == NULL || fgets( line, sizeof( line ), fp ) == NULL )
+	{
+		if ( fp != NULL ) fclose( fp );
+		return -1;
+	}
+
+	// Locate the columns in the header.
+	for ( int j = 0; j < C_NUM; ++j ) cols[ j ] = -1;
+
+	int col = 0;
+	for ( char* tok = strtok( line, ",\r\n" ); tok != NULL;
+	      tok = strtok( NULL, ",\r\n" ), ++col )
+		for ( int j = 0; j < C_NUM; ++j )
+			if ( strcmp( tok, names[ j ] ) == 0 ) cols[ j ] = col;
+
+	for ( int j = 0; j < C_NUM; ++j )
+		if ( cols[ j ] < 0 ) { fclose( fp ); return -1; }
+
+	while ( fgets( line, sizeof( line ), fp ) != NULL )
+	{
+		result_t r;
+		int      found = 0;
+
+		memset( &r, 0, sizeof( r ) );
+
+		// Split the line on commas, keeping empty fields.
+		col = 0;
+		for ( char* tok = line; tok != NULL; ++col )
+		{
+			char* end = strpbrk( tok, ",\r\n" );
+			if ( end != NULL ) *end = '\0';
+
+			for ( int j = 0; j < C_NUM; ++j )
+			{
+				if ( cols[ j ] != col ) continue;
+
+				found += 1;
+
+				switch ( j )
+				{
+					case C_OP:     snprintf( r.op, sizeof( r.op ), "%.7s", tok ); break;
+					case C_DT:     r.dt = tok[ 0 ]; break;
+					case C_STOR:   snprintf( r.stor, sizeof( r.stor ), "%.3s", tok ); break;
+					case C_SHAPE:  snprintf( r.shape, sizeof( r.shape ), "%.7s", tok ); break;
+					case C_M:      r.m = atol( tok ); break;
+					case C_N:      r.n = atol( tok ); break;
+					case C_K:      r.k = atol( tok ); break;
+					case C_NT:     r.nt = atol( tok ); break;
+					case C_GFLOPS: r.gflops = atof( tok ); break;
+				}
+			}
+
+			tok = ( end != NULL && *( end + 1 ) != '\0' ? end + 1 : NULL );
+		}
+
+		if ( found < C_NUM ) continue;
+
+		if ( n == n_alloc )
+		{
+			n_alloc = 2 * n_alloc + 64;
+			*results = realloc( *results, n_alloc * sizeof( result_t ) );
+		}
+
+		( *results )[ n++ ] = r;
+	}
+
+	fclose( fp );
+
+	return n;
+}
+
+// -- Output -------------------------------------------------------------------
+
+// Write a number, or an empty (CSV) or null (JSON) field if it is not known.
+static void print_num( FILE* fp, bool json, const char* fmt, double x, bool known )
+{
+	if      ( known ) fprintf( fp, fmt, x );
+	else if ( json )  fprintf( fp, "null" );
+}
+
+static void print_result
+     (
+       FILE* fp, bool json, bool first,
+       const result_t* r, int reps, double mean, double stddev,
+       double peak, const result_t* base, bool regression
+     )
+{
+	const double cv     = ( mean > 0.0 ? 100.0 * stddev / mean : 0.0 );
+	const double change = ( base != NULL && base->gflops > 0.0 ?
+	                        100.0 * ( r->gflops / base->gflops - 1.0 ) : 0.0 );
+
+	if ( json )
+	{
+		fprintf( fp, "%s\n    {\"op\": \"%s\", \"dt\": \"%c\", \"stor\": \"%s\", "
+		             "\"shape\": \"%s\", \"m\": %ld, \"n\": %ld, \"k\": %ld, "
+		             "\"nt\": %ld, \"reps\": %d, \"gflops\": %.3f, "
+		             "\"gflops_mean\": %.3f, \"gflops_stddev\": %.3f, "
+		             "\"cv_pct\": %.2f, \"peak_gflops\": ",
+		         first ? "" : ",", r->op, r->dt, r->stor, r->shape,
+		         ( long )r->m, ( long )r->n, ( long )r->k, ( long )r->nt,
+		         reps, r->gflops, mean, stddev, cv );
+		print_num( fp, json, "%.3f", peak, peak > 0.0 );
+		fprintf( fp, ", \"pct_peak\": " );
+		print_num( fp, json, "%.2f", 100.0 * r->gflops / peak, peak > 0.0 );
+		fprintf( fp, ", \"baseline_gflops\": " );
+		print_num( fp, json, "%.3f", base ? base->gflops : 0.0, base != NULL );
+		fprintf( fp, ", \"change_pct\": " );
+		print_num( fp, json, "%.2f", change, base != NULL );
+		fprintf( fp, ", \"regression\": %s}", regression ? "true" : "false" );
+	}
+	else
+	{
+		fprintf( fp, "%s,%c,%s,%s,%ld,%ld,%ld,%ld,%d,%.3f,%.3f,%.3f,%.2f,",
+		         r->op, r->dt, r->stor, r->shape,
+		         ( long )r->m, ( long )r->n, ( long )r->k, ( long )r->nt,
+		         reps, r->gflops, mean, stddev, cv );
+		print_num( fp, json, "%.3f", peak, peak > 0.0 );
+		fprintf( fp, "," );
+		print_num( fp, json, "%.2f", 100.0 * r->gflops / peak, peak > 0.0 );
+		fprintf( fp, "," );
+		print_num( fp, json, "%.3f", base ? base->gflops : 0.0, base != NULL );
+		fprintf( fp, "," );
+		print_num( fp, json, "%.2f", change, base != NULL );
+		fprintf( fp, ",%d\n", regression ? 1 : 0 );
+	}
+}
+
+// -- Driver -------------------------------------------------------------------
+
+// Parse a comma-separated list of names into flags, returning FALSE if a
+// name is not one of the n_names given.
+static bool parse_names( const char* list, const char** names, int n_names,
+                         bool* flags )
+{
+	char buf[ 256 ];
+
+	snprintf( buf, sizeof( buf ), "%s", list );
+
+	for ( int j = 0; j < n_names; ++j ) flags[ j ] = FALSE;
+
+	for ( char* tok = strtok( buf, "," ); tok != NULL; tok = strtok( NULL, "," ) )
+	{
+		int j;
+		for ( j = 0; j < n_names; ++j )
+			if ( strcmp( tok, names[ j ] ) == 0 ) { flags[ j ] = TRUE; break; }
+		if ( j == n_names ) return FALSE;
+	}
+
+	return TRUE;
+}
+
+int main( int argc, char** argv )
+{
+	const char* ops    = "gemm,gemmt,herk,trsm,trmm,symm";
+	const char* dts    = "d";
+	const char* stors  = "ccc";
+	const char* shapes = "square,tall,wide,smallk";
+	const char* sizes  = "256:1024:256";
+	const char* nts    = NULL;
+	int         reps   = 3;
+	double      ghz    = 0.0;
+	const char* fmt    = "csv";
+	const char* bname  = NULL;
+	double      tol    = 5.0;
+	bool        op_on[ OP_NUM ];
+	bool        shape_on[ SHAPE_NUM ];
+	long        first, last, inc;
+
+	for ( int i = 1; i < argc; ++i )
+	{
+		if      ( strcmp( argv[ i ], "-o" ) == 0 && i + 1 < argc ) ops    = argv[ ++i ];
+		else if ( strcmp( argv[ i ], "-d" ) == 0 && i + 1 < argc ) dts    = argv[ ++i ];
+		else if ( strcmp( argv[ i ], "-s" ) == 0 && i + 1 < argc ) stors  = argv[ ++i ];
+		else if ( strcmp( argv[ i ], "-a" ) == 0 && i + 1 < argc ) shapes = argv[ ++i ];
+		else if ( strcmp( argv[ i ], "-p" ) == 0 && i + 1 < argc ) sizes  = argv[ ++i ];
+		else if ( strcmp( argv[ i ], "-t" ) == 0 && i + 1 < argc ) nts    = argv[ ++i ];
+		else if ( strcmp( argv[ i ], "-r" ) == 0 && i + 1 < argc ) reps   = atoi( argv[ ++i ] );
+		else if ( strcmp( argv[ i ], "-c" ) == 0 && i + 1 < argc ) ghz    = atof( argv[ ++i ] );
+		else if ( strcmp( argv[ i ], "-f" ) == 0 && i + 1 < argc ) fmt    = argv[ ++i ];
+		else if ( strcmp( argv[ i ], "-b" ) == 0 && i + 1 < argc ) bname  = argv[ ++i ];
+		else if ( strcmp( argv[ i ], "-T" ) == 0 && i + 1 < argc ) tol    = atof( argv[ ++i ] );
+		else
+		{
+			fprintf( stderr, "usage: %s [-o ops] [-d dts] [-s stors] [-a shapes] [-p sizes]\n"
+			                 "       %*s [-t nts] [-r reps] [-c ghz] [-f fmt] [-b file] [-T pct]\n",
+			         argv[ 0 ], ( int )strlen( argv[ 0 ] ), "" );
+			return 2;
+		}
+	}
+
+	if ( !parse_names( ops, op_strs, OP_NUM, op_on ) )
+	{
+		fprintf( stderr, "invalid operation list '%s'\n", ops );
+		return 2;
+	}
+	if ( !parse_names( shapes, shape_strs, SHAPE_NUM, shape_on ) )
+	{
+		fprintf( stderr, "invalid shape list '%s'\n", shapes );
+		return 2;
+	}
+	if ( sscanf( sizes, "%ld:%ld:%ld", &first, &last, &inc ) != 3 ||
+	     first < 1 || last < first || inc < 1 )
+	{
+		fprintf( stderr, "invalid size sweep '%s'\n", sizes );
+		return 2;
+	}
+	for ( const char* d = dts; *d != '\0'; ++d )
+	{
+		if ( strchr( "sdcz", *d ) == NULL )
+		{
+			fprintf( stderr, "unknown datatype '%c'\n", *d );
+			return 2;
+		}
+	}
+	for ( const char* s = stors; *s != '\0'; s += ( s[ 3 ] == ',' ? 4 : 3 ) )
+	{
+		if ( strspn( s, "rc" ) < 3 || ( s[ 3 ] != ',' && s[ 3 ] != '\0' ) )
+		{
+			fprintf( stderr, "invalid storage list '%s'\n", stors );
+			return 2;
+		}
+	}
+	reps = bli_max( reps, 1 );
+
+	const bool json = ( strcmp( fmt, "json" ) == 0 );
+
+	if ( !json && strcmp( fmt, "csv" ) != 0 )
+	{
+		fprintf( stderr, "unknown format '%s'\n", fmt );
+		return 2;
+	}
+
+	bli_init();
+
+	// Read the baseline, if any.
+	result_t* base    = NULL;
+	long      n_base  = 0;
+
+	if ( bname != NULL && ( n_base = baseline_read( bname, &base ) ) < 0 )
+	{
+		fprintf( stderr, "cannot read baseline '%s'\n", bname );
+		return 2;
+	}
+
+	if ( ghz <= 0.0 ) ghz = clock_ghz_query();
+
+	// Gather the thread counts.
+	dim_t nt_list[ 64 ];
+	int   n_nt = 0;
+
+	if ( nts == NULL )
+	{
+		nt_list[ n_nt++ ] = bli_max( bli_thread_get_num_threads(), 1 );
+	}
+	else
+	{
+		for ( const char* t = nts; *t != '\0' && n_nt < 64; )
+		{
+			char*      end;
+			const long nt = strtol( t, &end, 10 );
+
+			if ( end == t || nt < 1 || ( *end != ',' && *end != '\0' ) )
+			{
+				fprintf( stderr, "invalid thread count list '%s'\n", nts );
+				return 2;
+			}
+
+			nt_list[ n_nt++ ] = nt;
+			t = ( *end == ',' ? end + 1 : end );
+		}
+	}
+
+	FILE* fp = stdout;
+
+	if ( json )
+		fprintf( fp, "{\"arch\": \"%s\", \"ghz\": %.3f, \"results\": [",
+		         bli_arch_string( bli_arch_query_id() ), ghz );
+	else
+		fprintf( fp, "op,dt,stor,shape,m,n,k,nt,reps,gflops,gflops_mean,"
+		             "gflops_stddev,cv_pct,peak_gflops,pct_peak,"
+		             "baseline_gflops,change_pct,regression\n" );
+
+	long    n_prob   = 0;
+	long    n_regr   = 0;
+	double* gflops_r = malloc( reps * sizeof( double ) );
+
+	for ( int o = 0; o < OP_NUM; ++o )
+	{
+		if ( !op_on[ o ] ) continue;
+
+		for ( const char* d = dts; *d != '\0'; ++d )
+		for ( const char* s = stors; *s != '\0'; s += ( s[ 3 ] == ',' ? 4 : 3 ) )
+		for ( long size = first; size <= last; size += inc )
+		for ( int t = 0; t < n_nt; ++t )
+		{
+			const num_t dt = ( *d == 's' ? BLIS_FLOAT :
+			                   *d == 'd' ? BLIS_DOUBLE :
+			                   *d == 'c' ? BLIS_SCOMPLEX : BLIS_DCOMPLEX );
+			dim_t dims_done[ SHAPE_NUM ][ 3 ];
+			int   n_done = 0;
+
+			rntm_t rntm = BLIS_RNTM_INITIALIZER;
+			bli_rntm_set_num_threads( nt_list[ t ], &rntm );
+
+			for ( int sh = 0; sh < SHAPE_NUM; ++sh )
+			{
+				if ( !shape_on[ sh ] ) continue;
+
+				dim_t m, n, k;
+				shape_dims( sh, size, &m, &n, &k );
+				op_dims( o, &m, &n, &k );
+
+				// Skip shapes that this operation does not distinguish.
+				bool dup = FALSE;
+				for ( int i = 0; i < n_done; ++i )
+					dup = dup || ( dims_done[ i ][ 0 ] == m &&
+					               dims_done[ i ][ 1 ] == n &&
+					               dims_done[ i ][ 2 ] == k );
+				if ( dup ) continue;
+
+				dims_done[ n_done ][ 0 ] = m;
+				dims_done[ n_done ][ 1 ] = n;
+				dims_done[ n_done ][ 2 ] = k;
+				n_done += 1;
+
+				prob_t p;
+				prob_create( o, dt, s, m, n, k, &p );
+
+				// Warm up, then time each repetition.
+				prob_run( &p, &rntm );
+
+				const double flops = op_flops( o, dt, m, n, k );
+				double best = 0.0, mean = 0.0, var = 0.0;
+
+				for ( int r = 0; r < reps; ++r )
+				{
+					gflops_r[ r ] = flops / ( prob_run( &p, &rntm ) * 1.0e9 );
+					best  = bli_max( best, gflops_r[ r ] );
+					mean += gflops_r[ r ] / reps;
+				}
+				for ( int r = 0; r < reps; ++r )
+					var += ( gflops_r[ r ] - mean ) * ( gflops_r[ r ] - mean );
+				const double stddev = ( reps > 1 ? sqrt( var / ( reps - 1 ) ) : 0.0 );
+
+				prob_free( &p );
+
+				result_t res;
+				snprintf( res.op, sizeof( res.op ), "%s", op_strs[ o ] );
+				res.dt = *d;
+				snprintf( res.stor, sizeof( res.stor ), "%.3s", s );
+				snprintf( res.shape, sizeof( res.shape ), "%s", shape_strs[ sh ] );
+				res.m = m; res.n = n; res.k = k; res.nt = nt_list[ t ];
+				res.gflops = best;
+
+				// Compare with the baseline, allowing for the variance of
+				// this run.
+				const result_t* b = NULL;
+				for ( long i = 0; i < n_base && b == NULL; ++i )
+					if ( result_matches( &res, &base[ i ] ) ) b = &base[ i ];
+
+				const double cv    = ( mean > 0.0 ? stddev / mean : 0.0 );
+				const double slack = bli_max( tol / 100.0, 2.0 * cv );
+				const bool   regr  = ( b != NULL &&
+				                       best < ( 1.0 - slack ) * b->gflops );
+
+				print_result( fp, json, n_prob == 0, &res, reps, mean, stddev,
+				              peak_gflops_core( dt, ghz ) * nt_list[ t ], b, regr );
+				fflush( fp );
+
+				n_prob += 1;
+				n_regr += regr;
+			}
+		}
+	}
+
+	if ( json )
+		fprintf( fp, "%s]}\n", n_prob > 0 ? "\n  " : "" );
+
+	fflush( fp );
+
+	if ( bname != NULL )
+		fprintf( stderr, "%ld of %ld problems regressed relative to '%s'\n",
+		         n_regr, n_prob, bname );
+
+	free( gflops_r );
+	free( base );
+
+	bli_finalize();
+
+	return n_regr > 0 ? 1 : 0;
+}
+
@@ -0,0 +1,825 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "blis.h"
+#ifdef BLIS_ENABLE_CBLAS
+#include "cblas.h"
+#endif
+
+//
+// Small-call latency benchmark.
+//
+// For tiny problems, the cost of a call is dominated by the fixed overhead
+// of getting to the computation rather than by the computation itself. This
+// driver measures the time per call of gemm (m = n = k = s), gemv (m = n = s),
+// and axpyv (n = s) for each size s, through each API layer, from the
+// innermost outward:
+//
+//   object_ex  bli_gemm_ex() etc. with prebuilt objects and a context and
+//              runtime object queried once beforehand
+//   object     bli_gemm() etc. with prebuilt objects, which query the
+//              context and initialize a runtime object on every call
+//   typed      bli_?gemm() etc., which also initialize the objects
+//   blas       ?gemm_() etc., which also check and map the BLAS parameters
+//              and initialize BLIS if needed (if the BLAS compatibility layer
+//              is enabled)
+//   cblas      cblas_?gemm() etc. (if the CBLAS layer is enabled)
+//
+// so that the overhead added by each layer ("layer_ns", the difference from
+// the layer it is built on) can be read off directly. (The typed gemv and
+// axpyv call their variants directly rather than through the object API, so
+// no such difference is reported for them.) Each layer is also timed
+// with error checking disabled, and the difference is reported as
+// "check_ns". Finally, the steps common to most calls are timed on their own
+// (op "setup"):
+//
+//   init        bli_init() once BLIS is initialized, as done on entry to the
+//               BLAS layer
+//   cntx_query  bli_gks_query_cntx()
+//   rntm_init   bli_rntm_init_from_global()
+//   obj_init    initializing the two scalar and three matrix objects of gemm
+//
+// Each result is the fastest of several batches of calls, each batch taking
+// about a millisecond, on operands that stay in cache. If a baseline (a CSV
+// file written by an earlier run) is given, each result is compared with the
+// baseline result for the same problem and layer, and flagged as a
+// regression if it slowed down by more than the tolerance or, if larger,
+// twice its coefficient of variation. The driver then exits with status 1 if
+// any regression was flagged.
+//
+// Usage: bench_lat.x [-o ops] [-d dts] [-p sizes] [-r reps] [-f fmt]
+//                    [-b file] [-T pct]
+//
+//   -o ops     comma-separated operations, a subset of gemm,gemv,axpy,setup
+//              (default: all of them)
+//   -d dts     datatypes, a subset of "sdcz" (default: "d")
+//   -p sizes   comma-separated sizes (default: 1,2,4,8,16,32)
+//   -r reps    timed batches per result (default: 5)
+//   -f fmt     csv or json (default: csv)
+//   -b file    baseline CSV file to compare against
+//   -T pct     regression tolerance in percent (default: 10)
+//
+
+typedef enum
+{
+	OP_GEMM = 0,
+	OP_GEMV,
+	OP_AXPY,
+	OP_SETUP,
+	OP_NUM
+} op_t;
+
+static const char* op_strs[ OP_NUM ] =
+{
+	"gemm", "gemv", "axpy", "setup"
+};
+
+typedef enum
+{
+	LAYER_OBJECT_EX = 0,
+	LAYER_OBJECT,
+	LAYER_TYPED,
+	LAYER_BLAS,
+	LAYER_CBLAS,
+	LAYER_NUM
+} layer_t;
+
+static const char* layer_strs[ LAYER_NUM ] =
+{
+	"object_ex", "object", "typed", "blas", "cblas"
+};
+
+typedef enum
+{
+	STEP_INIT = 0,
+	STEP_CNTX_QUERY,
+	STEP_RNTM_INIT,
+	STEP_OBJ_INIT,
+	STEP_NUM
+} step_t;
+
+static const char* step_strs[ STEP_NUM ] =
+{
+	"init", "cntx_query", "rntm_init", "obj_init"
+};
+
+// A result of this run or of the baseline.
+typedef struct
+{
+	char   op[ 8 ];
+	char   dt;
+	char   layer[ 16 ];
+	dim_t  size;
+	double ns;
+} result_t;
+
+// A problem, with its operands and their objects.
+typedef struct
+{
+	op_t          op;
+	num_t         dt;
+	dim_t         s;
+	obj_t         a, b, c;
+	obj_t         alpha, beta;
+	const cntx_t* cntx;
+	rntm_t        rntm;
+} prob_t;
+
+// The objects initialized by the obj_init step, which are given external
+// linkage so that their initialization cannot be optimized away.
+obj_t bench_lat_objs[ 5 ];
+
+// -- BLAS and typed layers ----------------------------------------------------
+
+typedef void (*call_ft)( prob_t* p );
+
+#ifdef BLIS_ENABLE_BLAS
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTECH(ch,opname)( prob_t* p ) \
+{ \
+	const f77_int s   = p->s; \
+	const f77_int inc = 1; \
+	ctype*        a   = bli_obj_buffer( &p->a ); \
+	ctype*        b   = bli_obj_buffer( &p->b ); \
+	ctype*        c   = bli_obj_buffer( &p->c ); \
+	ctype*        one = bli_obj_buffer( &p->alpha ); \
+\
+	if      ( p->op == OP_GEMM ) \
+		PASTEF77(ch,gemm)( "N", "N", &s, &s, &s, one, a, &s, b, &s, one, c, &s ); \
+	else if ( p->op == OP_GEMV ) \
+		PASTEF77(ch,gemv)( "N", &s, &s, one, a, &s, b, &inc, one, c, &inc ); \
+	else \
+		PASTEF77(ch,axpy)( &s, one, b, &inc, c, &inc ); \
+}
+
+INSERT_GENTFUNC_BASIC0( _blas_call )
+
+static call_ft blas_call[ BLIS_NUM_FP_TYPES ] =
+{
+	s_blas_call, c_blas_call, d_blas_call, z_blas_call
+};
+
+#endif
+
+#ifdef BLIS_ENABLE_CBLAS
+
+static void cblas_call( prob_t* p )
+{
+	const f77_int s   = p->s;
+	void*         a   = bli_obj_buffer( &p->a );
+	void*         b   = bli_obj_buffer( &p->b );
+	void*         c   = bli_obj_buffer( &p->c );
+	void*         one = bli_obj_buffer( &p->alpha );
+
+	if ( p->op == OP_GEMM )
+	{
+		switch ( p->dt )
+		{
+			case BLIS_FLOAT:
+				cblas_sgemm( CblasColMajor, CblasNoTrans, CblasNoTrans, s, s, s,
+				             1.0f, a, s, b, s, 1.0f, c, s ); break;
+			case BLIS_DOUBLE:
+				cblas_dgemm( CblasColMajor, CblasNoTrans, CblasNoTrans, s, s, s,
+				             1.0, a, s, b, s, 1.0, c, s ); break;
+			case BLIS_SCOMPLEX:
+				cblas_cgemm( CblasColMajor, CblasNoTrans, CblasNoTrans, s, s, s,
+				             one, a, s, b, s, one, c, s ); break;
+			default:
+				cblas_zgemm( CblasColMajor, CblasNoTrans, CblasNoTrans, s, s, s,
+				             one, a, s, b, s, one, c, s ); break;
+		}
+	}
+	else if ( p->op == OP_GEMV )
+	{
+		switch ( p->dt )
+		{
+			case BLIS_FLOAT:
+				cblas_sgemv( CblasColMajor, CblasNoTrans, s, s,
+				             1.0f, a, s, b, 1, 1.0f, c, 1 ); break;
+			case BLIS_DOUBLE:
+				cblas_dgemv( CblasColMajor, CblasNoTrans, s, s,
+				             1.0, a, s, b, 1, 1.0, c, 1 ); break;
+			case BLIS_SCOMPLEX:
+				cblas_cgemv( CblasColMajor, CblasNoTrans, s, s,
+				             one, a, s, b, 1, one, c, 1 ); break;
+			default:
+				cblas_zgemv( CblasColMajor, CblasNoTrans, s, s,
+				             one, a, s, b, 1, one, c, 1 ); break;
+		}
+	}
+	else
+	{
+		switch ( p->dt )
+		{
+			case BLIS_FLOAT:    cblas_saxpy( s, 1.0f, b, 1, c, 1 ); break;
+			case BLIS_DOUBLE:   cblas_daxpy( s, 1.0,  b, 1, c, 1 ); break;
+			case BLIS_SCOMPLEX: cblas_caxpy( s, one,  b, 1, c, 1 ); break;
+			default:            cblas_zaxpy( s, one,  b, 1, c, 1 ); break;
+		}
+	}
+}
+
+#endif
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTECH(ch,opname)( prob_t* p ) \
+{ \
+	const dim_t s   = p->s; \
+	ctype*      a   = bli_obj_buffer( &p->a ); \
+	ctype*      b   = bli_obj_buffer( &p->b ); \
+	ctype*      c   = bli_obj_buffer( &p->c ); \
+	ctype*      one = bli_obj_buffer( &p->alpha ); \
+\
+	if      ( p->op == OP_GEMM ) \
+		PASTEMAC(ch,gemm)( BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE, s, s, s, \
+		                   one, a, 1, s, b, 1, s, one, c, 1, s ); \
+	else if ( p->op == OP_GEMV ) \
+		PASTEMAC(ch,gemv)( BLIS_NO_TRANSPOSE, BLIS_NO_CONJUGATE, s, s, \
+		                   one, a, 1, s, b, 1, one, c, 1 ); \
+	else \
+		PASTEMAC(ch,axpyv)( BLIS_NO_CONJUGATE, s, one, b, 1, c, 1 ); \
+}
+
+INSERT_GENTFUNC_BASIC0( _typed_call )
+
+static call_ft typed_call[ BLIS_NUM_FP_TYPES ] =
+{
+	s_typed_call, c_typed_call, d_typed_call, z_typed_call
+};
+
+// -- Object layers ------------------------------------------------------------
+
+static void object_call( prob_t* p )
+{
+	if      ( p->op == OP_GEMM ) bli_gemm( &p->alpha, &p->a, &p->b, &p->beta, &p->c );
+	else if ( p->op == OP_GEMV ) bli_gemv( &p->alpha, &p->a, &p->b, &p->beta, &p->c );
+	else                         bli_axpyv( &p->alpha, &p->b, &p->c );
+}
+
+static void object_ex_call( prob_t* p )
+{
+	if      ( p->op == OP_GEMM )
+		bli_gemm_ex( &p->alpha, &p->a, &p->b, &p->beta, &p->c, p->cntx, &p->rntm );
+	else if ( p->op == OP_GEMV )
+		bli_gemv_ex( &p->alpha, &p->a, &p->b, &p->beta, &p->c, p->cntx, &p->rntm );
+	else
+		bli_axpyv_ex( &p->alpha, &p->b, &p->c, p->cntx, &p->rntm );
+}
+
+// Return the layer that a layer is built on for an operation, or LAYER_NUM if
+// there is none.
+static layer_t layer_below( layer_t layer, op_t op )
+{
+	switch ( layer )
+	{
+		case LAYER_OBJECT: return LAYER_OBJECT_EX;
+		case LAYER_TYPED:  return ( op == OP_GEMM ? LAYER_OBJECT : LAYER_NUM );
+		case LAYER_BLAS:   return LAYER_TYPED;
+		case LAYER_CBLAS:  return LAYER_BLAS;
+		default:           return LAYER_NUM;
+	}
+}
+
+// Return the function that calls a problem through a layer, or NULL if the
+// layer is not available.
+static call_ft layer_call( layer_t layer, num_t dt )
+{
+	switch ( layer )
+	{
+		case LAYER_OBJECT_EX: return object_ex_call;
+		case LAYER_OBJECT:    return object_call;
+		case LAYER_TYPED:     return typed_call[ dt ];
+#ifdef BLIS_ENABLE_BLAS
+		case LAYER_BLAS:      return blas_call[ dt ];
+#endif
+#ifdef BLIS_ENABLE_CBLAS
+		case LAYER_CBLAS:     return cblas_call;
+#endif
+		default:              return NULL;
+	}
+}
+
+// -- Setup steps --------------------------------------------------------------
+
+static void step_run( step_t step, prob_t* p )
+{
+	switch ( step )
+	{
+		case STEP_INIT:
+			bli_init();
+			break;
+		case STEP_CNTX_QUERY:
+			p->cntx = bli_gks_query_cntx();
+			break;
+		case STEP_RNTM_INIT:
+			bli_rntm_init_from_global( &p->rntm );
+			break;
+		default:
+		{
+			void* a = bli_obj_buffer( &p->a );
+
+			bli_obj_init_finish_1x1( p->dt, bli_obj_buffer( &p->alpha ), &bench_lat_objs[ 0 ] );
+			bli_obj_init_finish_1x1( p->dt, bli_obj_buffer( &p->beta ),  &bench_lat_objs[ 1 ] );
+			bli_obj_init_finish( p->dt, p->s, p->s, a, 1, p->s, &bench_lat_objs[ 2 ] );
+			bli_obj_init_finish( p->dt, p->s, p->s, a, 1, p->s, &bench_lat_objs[ 3 ] );
+			bli_obj_init_finish( p->dt, p->s, p->s, a, 1, p->s, &bench_lat_objs[ 4 ] );
+			break;
+		}
+	}
+}
+
+// -- Problems -----------------------------------------------------------------
+
+static void prob_create( op_t op, num_t dt, dim_t s, prob_t* p )
+{
+	p->op = op;
+	p->dt = dt;
+	p->s  = s;
+
+	// A is s x s, and B and C are s x s for gemm and vectors of length s
+	// otherwise (x and y for gemv and axpyv).
+	const dim_t n = ( op == OP_GEMM ? s : 1 );
+
+	bli_obj_create( dt, s, s, 1, s, &p->a );
+	bli_obj_create( dt, s, n, 1, s, &p->b );
+	bli_obj_create( dt, s, n, 1, s, &p->c );
+	bli_obj_create_1x1( dt, &p->alpha );
+	bli_obj_create_1x1( dt, &p->beta );
+
+	bli_randm( &p->a );
+	bli_randm( &p->b );
+	bli_setm( &BLIS_ZERO, &p->c );
+	bli_setsc( 1.0, 0.0, &p->alpha );
+	bli_setsc( 1.0, 0.0, &p->beta );
+
+	p->cntx = bli_gks_query_cntx();
+	bli_rntm_init_from_global( &p->rntm );
+}
+
+static void prob_free( prob_t* p )
+{
+	bli_obj_free( &p->a );
+	bli_obj_free( &p->b );
+	bli_obj_free( &p->c );
+	bli_obj_free( &p->alpha );
+	bli_obj_free( &p->beta );
+}
+
+// Time reps batches of calls to f (or, if f is NULL, of the setup step),
+// storing the nanoseconds per call of each batch in ns_r.
+static void prob_time( prob_t* p, call_ft f, step_t step, int reps, double* ns_r )
+{
+	// Warm up, and estimate the cost of a call so that each batch takes about
+	// a millisecond.
+	const int n_warm = 16;
+	double    t      = bli_clock();
+
+	for ( int i = 0; i < n_warm; ++i )
+		if ( f != NULL ) f( p ); else step_run( step, p );
+
+	const double est     = bli_max( ( bli_clock() - t ) / n_warm, 1.0e-9 );
+	const long   n_calls = bli_max( ( long )( 1.0e-3 / est ), 1L );
+
+	for ( int r = 0; r < reps; ++r )
+	{
+		t = bli_clock();
+
+		if ( f != NULL ) for ( long i = 0; i < n_calls; ++i ) f( p );
+		else             for ( long i = 0; i < n_calls; ++i ) step_run( step, p );
+
+		ns_r[ r ] = 1.0e9 * ( bli_clock() - t ) / n_calls;
+	}
+}
+
+// -- Baseline -----------------------------------------------------------------
+
+static bool result_matches( const result_t* r1, const result_t* r2 )
+{
+	return strcmp( r1->op, r2->op ) == 0 && r1->dt == r2->dt &&
+	       strcmp( r1->layer, r2->layer ) == 0 && r1->size == r2->size;
+}
+
+// Read the results of a CSV file written by this driver, returning their
+// number, or -1 if the file cannot be read. The columns are located by name
+// in the header, so baselines written by versions of the driver with other
+// columns can still be read.
+static long baseline_read( const char* path, result_t** results )
+{
+	enum { C_OP, C_DT, C_SIZE, C_LAYER, C_NS, C_NUM };
+	static const char* names[ C_NUM ] =
+	{
+		"op", "dt", "size", "layer", "ns_per_call"
+	};
+	int   cols[ C_NUM ];
+	char  line[ 1024 ];
+	long  n = 0, n_alloc = 0;
+	FILE* fp = fopen( path, "r" );
+
+	*results = NULL;
+
+	if ( fp == NULL || fgets( line, sizeof( line ), fp ) == NULL )
+	{
+		if ( fp != NULL ) fclose( fp );
+		return -1;
+	}
+
+	// Locate the columns in the header.
+	for ( int j = 0; j < C_NUM; ++j ) cols[ j ] = -1;
+
+	int col = 0;
+	for ( char* tok = strtok( line, ",\r\n" ); tok != NULL;
+	      tok = strtok( NULL, ",\r\n" ), ++col )
+		for ( int j = 0; j < C_NUM; ++j )
+			if ( strcmp( tok, names[ j ] ) == 0 ) cols[ j ] = col;
+
+	for ( int j = 0; j < C_NUM; ++j )
+		if ( cols[ j ] < 0 ) { fclose( fp ); return -1; }
+
+	while ( fgets( line, sizeof( line ), fp ) != NULL )
+	{
+		result_t r;
+		int      found = 0;
+
+		memset( &r, 0, sizeof( r ) );
+
+		// Split the line on commas, keeping empty fields.
+		col = 0;
+		for ( char* tok = line; tok != NULL; ++col )
+		{
+			char* end = strpbrk( tok, ",\r\n" );
+			if ( end != NULL ) *end = '\0';
+
+			for ( int j = 0; j < C_NUM; ++j )
+			{
+				if ( cols[ j ] != col ) continue;
+
+				found += 1;
+
+				switch ( j )
+				{
+					case C_OP:    snprintf( r.op, sizeof( r.op ), "%.7s", tok ); break;
+					case C_DT:    r.dt = tok[ 0 ]; break;
+					case C_SIZE:  r.size = atol( tok ); break;
+					case C_LAYER: snprintf( r.layer, sizeof( r.layer ), "%.15s", tok ); break;
+					case C_NS:    r.ns = atof( tok ); break;
+				}
+			}
+
+			tok = ( end != NULL && *( end + 1 ) != '\0' ? end + 1 : NULL );
+		}
+
+		if ( found < C_NUM ) continue;
+
+		if ( n == n_alloc )
+		{
+			n_alloc = 2 * n_alloc + 64;
+			*results = realloc( *results, n_alloc * sizeof( result_t ) );
+		}
+
+		( *results )[ n++ ] = r;
+	}
+
+	fclose( fp );
+
+	return n;
+}
+
+// -- Output -------------------------------------------------------------------
+
+// Write a number, or an empty (CSV) or null (JSON) field if it is not known.
+static void print_num( FILE* fp, bool json, const char* fmt, double x, bool known )
+{
+	if      ( known ) fprintf( fp, fmt, x );
+	else if ( json )  fprintf( fp, "null" );
+}
+
+static double best_of( const double* ns_r, int reps )
+{
+	double best = ns_r[ 0 ];
+
+	for ( int i = 1; i < reps; ++i ) best = bli_min( best, ns_r[ i ] );
+
+	return best;
+}
+
+// Summarize the batches of a result, and compare it with the baseline,
+// printing it and returning whether it regressed.
+static bool report
+     (
+       FILE* fp, bool json, bool first, result_t* r, const double* ns_r,
+       int reps, double layer_ns, bool layer_known, double check_ns,
+       bool check_known, const result_t* base, long n_base, double tol
+     )
+{
+	const double best = best_of( ns_r, reps );
+	double       mean = 0.0, var = 0.0;
+
+	for ( int i = 0; i < reps; ++i ) mean += ns_r[ i ] / reps;
+	for ( int i = 0; i < reps; ++i )
+		var += ( ns_r[ i ] - mean ) * ( ns_r[ i ] - mean );
+
+	const double stddev = ( reps > 1 ? sqrt( var / ( reps - 1 ) ) : 0.0 );
+	const double cv     = ( mean > 0.0 ? stddev / mean : 0.0 );
+
+	r->ns = best;
+
+	// Compare with the baseline, allowing for the variance of this run.
+	const result_t* b = NULL;
+	for ( long i = 0; i < n_base && b == NULL; ++i )
+		if ( result_matches( r, &base[ i ] ) ) b = &base[ i ];
+
+	const double slack  = bli_max( tol / 100.0, 2.0 * cv );
+	const bool   regr   = ( b != NULL && best > ( 1.0 + slack ) * b->ns );
+	const double change = ( b != NULL && b->ns > 0.0 ?
+	                        100.0 * ( best / b->ns - 1.0 ) : 0.0 );
+	const bool   setup  = ( strcmp( r->op, "setup" ) == 0 );
+
+	if ( json )
+	{
+		fprintf( fp, "%s\n    {\"op\": \"%s\", \"dt\": \"%c\", \"size\": ",
+		         first ? "" : ",", r->op, r->dt );
+		print_num( fp, json, "%.0f", ( double )r->size, !setup );
+		fprintf( fp, ", \"layer\": \"%s\", \"ns_per_call\": %.1f, "
+		             "\"ns_mean\": %.1f, \"cv_pct\": %.2f, \"layer_ns\": ",
+		         r->layer, best, mean, 100.0 * cv );
+		print_num( fp, json, "%.1f", layer_ns, layer_known );
+		fprintf( fp, ", \"check_ns\": " );
+		print_num( fp, json, "%.1f", check_ns, check_known );
+		fprintf( fp, ", \"baseline_ns\": " );
+		print_num( fp, json, "%.1f", b ? b->ns : 0.0, b != NULL );
+		fprintf( fp, ", \"change_pct\": " );
+		print_num( fp, json, "%.2f", change, b != NULL );
+		fprintf( fp, ", \"regression\": %s}", regr ? "true" : "false" );
+	}
+	else
+	{
+		fprintf( fp, "%s,%c,", r->op, r->dt );
+		print_num( fp, json, "%.0f", ( double )r->size, !setup );
+		fprintf( fp, ",%s,%.1f,%.1f,%.2f,", r->layer, best, mean, 100.0 * cv );
+		print_num( fp, json, "%.1f", layer_ns, layer_known );
+		fprintf( fp, "," );
+		print_num( fp, json, "%.1f", check_ns, check_known );
+		fprintf( fp, "," );
+		print_num( fp, json, "%.1f", b ? b->ns : 0.0, b != NULL );
+		fprintf( fp, "," );
+		print_num( fp, json, "%.2f", change, b != NULL );
+		fprintf( fp, ",%d\n", regr ? 1 : 0 );
+	}
+
+	fflush( fp );
+
+	return regr;
+}
+
+// -- Driver -------------------------------------------------------------------
+
+// Parse a comma-separated list of names into flags, returning FALSE if a
+// name is not one of the n_names given.
+static bool parse_names( const char* list, const char** names, int n_names,
+                         bool* flags )
+{
+	char buf[ 256 ];
+
+	snprintf( buf, sizeof( buf ), "%s", list );
+
+	for ( int j = 0; j < n_names; ++j ) flags[ j ] = FALSE;
+
+	for ( char* tok = strtok( buf, "," ); tok != NULL; tok = strtok( NULL, "," ) )
+	{
+		int j;
+		for ( j = 0; j < n_names; ++j )
+			if ( strcmp( tok, names[ j ] ) == 0 ) { flags[ j ] = TRUE; break; }
+		if ( j == n_names ) return FALSE;
+	}
+
+	return TRUE;
+}
+
+int main( int argc, char** argv )
+{
+	const char* ops    = "gemm,gemv,axpy,setup";
+	const char* dts    = "d";
+	const char* sizes  = "1,2,4,8,16,32";
+	int         reps   = 5;
+	const char* fmt    = "csv";
+	const char* bname  = NULL;
+	double      tol    = 10.0;
+	bool        op_on[ OP_NUM ];
+
+	for ( int i = 1; i < argc; ++i )
+	{
+		if      ( strcmp( argv[ i ], "-o" ) == 0 && i + 1 < argc ) ops   = argv[ ++i ];
+		else if ( strcmp( argv[ i ], "-d" ) == 0 && i + 1 < argc ) dts   = argv[ ++i ];
+		else if ( strcmp( argv[ i ], "-p" ) == 0 && i + 1 < argc ) sizes = argv[ ++i ];
+		else if ( strcmp( argv[ i ], "-r" ) == 0 && i + 1 < argc ) reps  = atoi( argv[ ++i ] );
+		else if ( strcmp( argv[ i ], "-f" ) == 0 && i + 1 < argc ) fmt   = argv[ ++i ];
+		else if ( strcmp( argv[ i ], "-b" ) == 0 && i + 1 < argc ) bname = argv[ ++i ];
+		else if ( strcmp( argv[ i ], "-T" ) == 0 && i + 1 < argc ) tol   = atof( argv[ ++i ] );
+		else
+		{
+			fprintf( stderr, "usage: %s [-o ops] [-d dts] [-p sizes] [-r reps] [-f fmt]\n"
+			                 "       %*s [-b file] [-T pct]\n",
+			         argv[ 0 ], ( int )strlen( argv[ 0 ] ), "" );
+			return 2;
+		}
+	}
+
+	if ( !parse_names( ops, op_strs, OP_NUM, op_on ) )
+	{
+		fprintf( stderr, "invalid operation list '%s'\n", ops );
+		return 2;
+	}
+	for ( const char* d = dts; *d != '\0'; ++d )
+	{
+		if ( strchr( "sdcz", *d ) == NULL )
+		{
+			fprintf( stderr, "unknown datatype '%c'\n", *d );
+			return 2;
+		}
+	}
+
+	// Gather the sizes.
+	dim_t s_list[ 64 ];
+	int   n_s = 0;
+
+	for ( const char* t = sizes; *t != '\0' && n_s < 64; )
+	{
+		char*      end;
+		const long s = strtol( t, &end, 10 );
+
+		if ( end == t || s < 1 || ( *end != ',' && *end != '\0' ) )
+		{
+			fprintf( stderr, "invalid size list '%s'\n", sizes );
+			return 2;
+		}
+
+		s_list[ n_s++ ] = s;
+		t = ( *end == ',' ? end + 1 : end );
+	}
+	reps = bli_max( reps, 1 );
+
+	const bool json = ( strcmp( fmt, "json" ) == 0 );
+
+	if ( !json && strcmp( fmt, "csv" ) != 0 )
+	{
+		fprintf( stderr, "unknown format '%s'\n", fmt );
+		return 2;
+	}
+
+	bli_init();
+
+	// Read the baseline, if any.
+	result_t* base   = NULL;
+	long      n_base = 0;
+
+	if ( bname != NULL && ( n_base = baseline_read( bname, &base ) ) < 0 )
+	{
+		fprintf( stderr, "cannot read baseline '%s'\n", bname );
+		return 2;
+	}
+
+	FILE* fp = stdout;
+
+	if ( json )
+		fprintf( fp, "{\"arch\": \"%s\", \"results\": [",
+		         bli_arch_string( bli_arch_query_id() ) );
+	else
+		fprintf( fp, "op,dt,size,layer,ns_per_call,ns_mean,cv_pct,layer_ns,"
+		             "check_ns,baseline_ns,change_pct,regression\n" );
+
+	const errlev_t errlev = bli_error_checking_level();
+
+	long    n_res  = 0;
+	long    n_regr = 0;
+	double* ns_r   = malloc( reps * sizeof( double ) );
+
+	for ( int o = 0; o < OP_NUM; ++o )
+	{
+		if ( !op_on[ o ] ) continue;
+
+		for ( const char* d = dts; *d != '\0'; ++d )
+		{
+			num_t dt;
+			bli_param_map_char_to_blis_dt( *d, &dt );
+
+			// The setup steps do not depend on the size.
+			const int n_size = ( o == OP_SETUP ? 1 : n_s );
+
+			for ( int si = 0; si < n_size; ++si )
+			{
+				prob_t p;
+				prob_create( ( op_t )o, dt, s_list[ si ], &p );
+
+				result_t r;
+				snprintf( r.op, sizeof( r.op ), "%s", op_strs[ o ] );
+				r.dt   = *d;
+				r.size = ( o == OP_SETUP ? 0 : s_list[ si ] );
+
+				if ( o == OP_SETUP )
+				{
+					for ( int st = 0; st < STEP_NUM; ++st )
+					{
+						snprintf( r.layer, sizeof( r.layer ), "%s", step_strs[ st ] );
+						prob_time( &p, NULL, ( step_t )st, reps, ns_r );
+						n_regr += report( fp, json, n_res++ == 0, &r, ns_r, reps,
+						                  0.0, FALSE, 0.0, FALSE, base, n_base, tol );
+					}
+				}
+				else
+				{
+					double layer_ns[ LAYER_NUM ];
+
+					for ( int l = 0; l < LAYER_NUM; ++l )
+					{
+						layer_ns[ l ] = -1.0;
+
+						call_ft f = layer_call( ( layer_t )l, dt );
+
+						if ( f == NULL ) continue;
+
+						// Time the layer with error checking disabled, and
+						// then as usual.
+						bli_error_checking_level_set( BLIS_NO_ERROR_CHECKING );
+						prob_time( &p, f, STEP_INIT, reps, ns_r );
+						const double ns_nochk = best_of( ns_r, reps );
+						bli_error_checking_level_set( errlev );
+
+						prob_time( &p, f, STEP_INIT, reps, ns_r );
+						const double ns = best_of( ns_r, reps );
+
+						const layer_t lb    = layer_below( ( layer_t )l, ( op_t )o );
+						const double  ns_lb = ( lb < LAYER_NUM ? layer_ns[ lb ] : -1.0 );
+
+						snprintf( r.layer, sizeof( r.layer ), "%s", layer_strs[ l ] );
+						n_regr += report( fp, json, n_res++ == 0, &r, ns_r, reps,
+						                  ns - ns_lb, ns_lb >= 0.0,
+						                  ns - ns_nochk, TRUE,
+						                  base, n_base, tol );
+						layer_ns[ l ] = ns;
+					}
+				}
+
+				prob_free( &p );
+			}
+		}
+	}
+
+	if ( json )
+		fprintf( fp, "%s]}\n", n_res > 0 ? "\n  " : "" );
+
+	fflush( fp );
+
+	if ( bname != NULL )
+		fprintf( stderr, "%ld of %ld results regressed relative to '%s'\n",
+		         n_regr, n_res, bname );
+
+	free( ns_r );
+	free( base );
+
+	bli_finalize();
+
+	return n_regr > 0 ? 1 : 0;
+}
@@ -0,0 +1,580 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <setjmp.h>
+#include "blis.h"
+#include "bench_util.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAVE_TSC
+#endif
+
+//
+// Microkernel and packing kernel throughput harness.
+//
+// Each gemm microkernel, gemmsup kernel, and packm kernel registered in the
+// context of the running sub-configuration (or, with -A, in the context of
+// every sub-configuration registered in a fat build) is called in isolation
+// on operands that stay in cache, for each datatype, k, and storage variant:
+//
+//   gemm        an MR x NR microtile of C, row-stored ("r") or column-stored
+//               ("c"), updated from packed micropanels of A and B
+//   gemmsup     an MR x NR block of C (using the sup register blocksizes),
+//               for each storage combination of C, A, and B (e.g. "rcr")
+//   packm_mrxk  an MR x k micropanel of A packed from a row-stored ("r") or
+//               column-stored ("c") matrix
+//   packm_nrxk  likewise, an NR x k micropanel of B
+//
+// After a warm-up, each kernel is called in batches large enough to amortize
+// reading the cycle counter, and the fastest of the timed batches is reported
+// as cycles per call. For the gemm and gemmsup kernels, this is converted to
+// flops per cycle and the percentage of the peak FMA throughput of one core
+// (see bench_util.h); for the packm kernels, to bytes read and written per
+// cycle. The "impl" field tells whether the kernel is the reference kernel
+// of the running sub-configuration ("ref") or an optimized one ("opt"), and
+// is left empty for the other sub-configurations of a fat build. Kernels
+// that raise an illegal instruction (e.g. those of a sub-configuration the
+// processor does not support) are skipped.
+//
+// On x86, cycles are read from the time stamp counter, which ticks at the
+// nominal clock rate, so a core running above that rate may exceed 100% of
+// peak. Elsewhere, they are derived from the wall clock time and the clock
+// rate.
+//
+// Usage: bench_ukr.x [-A] [-u kers] [-d dts] [-k ks] [-r reps] [-c ghz]
+//                    [-f fmt]
+//
+//   -A         benchmark every registered sub-configuration (default: only
+//              the running one)
+//   -u kers    comma-separated kernels, a subset of gemm,gemmsup,packm
+//              (default: all of them)
+//   -d dts     datatypes, a subset of "sdcz" (default: "sdcz")
+//   -k ks      comma-separated values of k (default: 16,64,256)
+//   -r reps    timed batches per kernel (default: 5)
+//   -c ghz     clock rate in GHz, used only where there is no time stamp
+//              counter (default: as reported by cpufreq or /proc/cpuinfo)
+//   -f fmt     csv or json (default: csv)
+//
+
+typedef enum
+{
+	KER_GEMM = 0,
+	KER_GEMMSUP,
+	KER_PACKM,
+	KER_NUM
+} ker_t;
+
+static const char* ker_strs[ KER_NUM ] =
+{
+	"gemm", "gemmsup", "packm"
+};
+
+// One kernel call, with its operands.
+typedef struct
+{
+	const char* name;
+	void_fp     f;
+	num_t       dt;
+	char        dtc;
+	cntx_t*     cntx;
+	char        stor[ 4 ];
+	dim_t       m, n, k;
+	pack_t      schema;
+	obj_t       a, b, c, p;
+	inc_t       rs_a, cs_a, rs_b, cs_b, rs_c, cs_c, ldp;
+	dcomplex    alpha;   // Both hold one in the datatype of the call;
+	dcomplex    beta;    // the kernels take them as distinct pointers.
+	auxinfo_t   aux;
+	double      flops, bytes;
+} call_t;
+
+// -- Cycle counter ------------------------------------------------------------
+
+static double cycles_now( double ghz )
+{
+#ifdef BENCH_HAVE_TSC
+	( void )ghz;
+	return ( double )__rdtsc();
+#else
+	return bli_clock() * ghz * 1.0e9;
+#endif
+}
+
+// -- Kernel calls -------------------------------------------------------------
+
+static void buf_create( num_t dt, dim_t len, obj_t* x )
+{
+	bli_obj_create( dt, len, 1, 1, len, x );
+	bli_randv( x );
+}
+
+static void call_init_gemm( call_t* c, ker_t ker, stor3_t stor, dim_t k )
+{
+	const num_t dt   = c->dt;
+	const bool  sup  = ( ker == KER_GEMMSUP );
+	const dim_t mr   = ( sup ? bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_MR, c->cntx )
+	                         : bli_cntx_get_blksz_def_dt( dt, BLIS_MR, c->cntx ) );
+	const dim_t nr   = ( sup ? bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_NR, c->cntx )
+	                         : bli_cntx_get_blksz_def_dt( dt, BLIS_NR, c->cntx ) );
+	const bool  c_col = ( stor & 4 ) != 0;
+	const bool  a_col = ( stor & 2 ) != 0;
+	const bool  b_col = ( stor & 1 ) != 0;
+
+	c->name = ker_strs[ ker ];
+	c->m    = mr;
+	c->n    = nr;
+	c->k    = k;
+
+	if ( sup )
+	{
+		// A is m x k and B is k x n, stored as given.
+		snprintf( c->stor, sizeof( c->stor ), "%c%c%c",
+		          c_col ? 'c' : 'r', a_col ? 'c' : 'r', b_col ? 'c' : 'r' );
+		buf_create( dt, mr * k, &c->a );
+		buf_create( dt, k * nr, &c->b );
+		c->rs_a = ( a_col ? 1 : k  ); c->cs_a = ( a_col ? mr : 1 );
+		c->rs_b = ( b_col ? 1 : nr ); c->cs_b = ( b_col ? k  : 1 );
+	}
+	else
+	{
+		// A and B are packed micropanels.
+		const dim_t packmr = bli_cntx_get_blksz_max_dt( dt, BLIS_MR, c->cntx );
+		const dim_t packnr = bli_cntx_get_blksz_max_dt( dt, BLIS_NR, c->cntx );
+
+		snprintf( c->stor, sizeof( c->stor ), "%c", c_col ? 'c' : 'r' );
+		buf_create( dt, packmr * k, &c->a );
+		buf_create( dt, packnr * k, &c->b );
+	}
+
+	buf_create( dt, mr * nr, &c->c );
+	c->rs_c = ( c_col ? 1 : nr );
+	c->cs_c = ( c_col ? mr : 1 );
+
+	memset( &c->aux, 0, sizeof( c->aux ) );
+	bli_auxinfo_set_next_a( bli_obj_buffer( &c->a ), &c->aux );
+	bli_auxinfo_set_next_b( bli_obj_buffer( &c->b ), &c->aux );
+	bli_auxinfo_set_is_a( 1, &c->aux );
+	bli_auxinfo_set_is_b( 1, &c->aux );
+
+	c->flops = 2.0 * mr * nr * k * ( bli_is_complex( dt ) ? 4.0 : 1.0 );
+	c->bytes = 0.0;
+}
+
+static void call_init_packm( call_t* c, bool is_b, bool src_col, dim_t k )
+{
+	const num_t   dt   = c->dt;
+	const bszid_t bsid = ( is_b ? BLIS_NR : BLIS_MR );
+	const dim_t   mnr  = bli_cntx_get_blksz_def_dt( dt, bsid, c->cntx );
+
+	c->name   = ( is_b ? "packm_nrxk" : "packm_mrxk" );
+	c->schema = ( is_b ? BLIS_PACKED_COL_PANELS : BLIS_PACKED_ROW_PANELS );
+	c->m      = mnr;
+	c->n      = 0;
+	c->k      = k;
+	c->ldp    = bli_cntx_get_blksz_max_dt( dt, bsid, c->cntx );
+	snprintf( c->stor, sizeof( c->stor ), "%c", src_col ? 'c' : 'r' );
+
+	// The source is an mnr x k matrix, with inca the stride along mnr.
+	buf_create( dt, mnr * k, &c->a );
+	buf_create( dt, c->ldp * k, &c->p );
+	c->rs_a = ( src_col ? 1 : k );
+	c->cs_a = ( src_col ? mnr : 1 );
+
+	c->flops = 0.0;
+	c->bytes = ( double )( mnr + c->ldp ) * k * bli_dt_size( dt );
+}
+
+static void call_free( call_t* c, ker_t ker )
+{
+	bli_obj_free( &c->a );
+
+	if ( ker == KER_PACKM )
+	{
+		bli_obj_free( &c->p );
+	}
+	else
+	{
+		bli_obj_free( &c->b );
+		bli_obj_free( &c->c );
+	}
+}
+
+static void call_run( call_t* c, ker_t ker )
+{
+	void* alpha = &c->alpha;
+	void* beta  = &c->beta;
+
+	if ( ker == KER_GEMM )
+	{
+		( ( gemm_ukr_vft )c->f )
+		( c->m, c->n, c->k, alpha,
+		  bli_obj_buffer( &c->a ), bli_obj_buffer( &c->b ), beta,
+		  bli_obj_buffer( &c->c ), c->rs_c, c->cs_c, &c->aux, c->cntx );
+	}
+	else if ( ker == KER_GEMMSUP )
+	{
+		( ( gemmsup_ker_vft )c->f )
+		( BLIS_NO_CONJUGATE, BLIS_NO_CONJUGATE, c->m, c->n, c->k, alpha,
+		  bli_obj_buffer( &c->a ), c->rs_a, c->cs_a,
+		  bli_obj_buffer( &c->b ), c->rs_b, c->cs_b, beta,
+		  bli_obj_buffer( &c->c ), c->rs_c, c->cs_c, &c->aux, c->cntx );
+	}
+	else
+	{
+		( ( packm_cxk_ker_vft )c->f )
+		( BLIS_NO_CONJUGATE, c->schema, c->m, c->k, c->k, alpha,
+		  bli_obj_buffer( &c->a ), c->rs_a, c->cs_a,
+		  bli_obj_buffer( &c->p ), c->ldp, c->cntx );
+	}
+}
+
+// -- Timing -------------------------------------------------------------------
+
+static sigjmp_buf sigill_env;
+
+static void sigill_handler( int sig )
+{
+	( void )sig;
+	siglongjmp( sigill_env, 1 );
+}
+
+// Return the fewest cycles per call over reps batches of calls, or a
+// negative value if the kernel raised an illegal instruction.
+static double call_time( call_t* c, ker_t ker, int reps, double ghz )
+{
+	if ( sigsetjmp( sigill_env, 1 ) != 0 ) return -1.0;
+
+	// Warm up the caches (and estimate the cost of a call, so that each
+	// batch runs for roughly a million cycles).
+	const int n_warm = 8;
+	double    t0     = cycles_now( ghz );
+
+	for ( int i = 0; i < n_warm; ++i ) call_run( c, ker );
+
+	const double est     = bli_max( ( cycles_now( ghz ) - t0 ) / n_warm, 1.0 );
+	const long   n_calls = bli_max( ( long )( 1.0e6 / est ), 1L );
+	double       best    = -1.0;
+
+	for ( int r = 0; r < reps; ++r )
+	{
+		t0 = cycles_now( ghz );
+
+		for ( long i = 0; i < n_calls; ++i ) call_run( c, ker );
+
+		const double per_call = ( cycles_now( ghz ) - t0 ) / n_calls;
+
+		if ( best < 0.0 || per_call < best ) best = per_call;
+	}
+
+	return best;
+}
+
+// -- Driver -------------------------------------------------------------------
+
+static void print_num( FILE* fp, bool json, const char* fmt, double x, bool known )
+{
+	if      ( known ) fprintf( fp, fmt, x );
+	else if ( json )  fprintf( fp, "null" );
+}
+
+static void print_call
+     (
+       FILE* fp, bool json, bool first, arch_t arch, const call_t* c,
+       const char* impl, double cycles
+     )
+{
+	const bool   is_gemm = ( c->flops > 0.0 );
+	const double fpc     = c->flops / cycles;
+	const double peak    = peak_flops_per_cycle( arch, c->dt );
+
+	if ( json )
+	{
+		fprintf( fp, "%s\n    {\"arch\": \"%s\", \"kernel\": \"%s\", \"dt\": \"%c\", "
+		             "\"stor\": \"%s\", \"impl\": \"%s\", \"m\": %ld, \"n\": ",
+		         first ? "" : ",", bli_arch_string( arch ), c->name,
+		         c->dtc,
+		         c->stor, impl, ( long )c->m );
+		print_num( fp, json, "%.0f", ( double )c->n, is_gemm );
+		fprintf( fp, ", \"k\": %ld, \"cycles_per_call\": %.1f, \"flops_per_cycle\": ",
+		         ( long )c->k, cycles );
+		print_num( fp, json, "%.2f", fpc, is_gemm );
+		fprintf( fp, ", \"peak_flops_per_cycle\": " );
+		print_num( fp, json, "%.0f", peak, is_gemm && peak > 0.0 );
+		fprintf( fp, ", \"pct_peak\": " );
+		print_num( fp, json, "%.2f", 100.0 * fpc / peak, is_gemm && peak > 0.0 );
+		fprintf( fp, ", \"bytes_per_cycle\": " );
+		print_num( fp, json, "%.2f", c->bytes / cycles, !is_gemm );
+		fprintf( fp, "}" );
+	}
+	else
+	{
+		fprintf( fp, "%s,%s,%c,%s,%s,%ld,",
+		         bli_arch_string( arch ), c->name,
+		         c->dtc,
+		         c->stor, impl, ( long )c->m );
+		print_num( fp, json, "%.0f", ( double )c->n, is_gemm );
+		fprintf( fp, ",%ld,%.1f,", ( long )c->k, cycles );
+		print_num( fp, json, "%.2f", fpc, is_gemm );
+		fprintf( fp, "," );
+		print_num( fp, json, "%.0f", peak, is_gemm && peak > 0.0 );
+		fprintf( fp, "," );
+		print_num( fp, json, "%.2f", 100.0 * fpc / peak, is_gemm && peak > 0.0 );
+		fprintf( fp, "," );
+		print_num( fp, json, "%.2f", c->bytes / cycles, !is_gemm );
+		fprintf( fp, "\n" );
+	}
+}
+
+// Parse a comma-separated list of names into flags, returning FALSE if a
+// name is not one of the n_names given.
+static bool parse_names( const char* list, const char** names, int n_names,
+                         bool* flags )
+{
+	char buf[ 256 ];
+
+	snprintf( buf, sizeof( buf ), "%s", list );
+
+	for ( int j = 0; j < n_names; ++j ) flags[ j ] = FALSE;
+
+	for ( char* tok = strtok( buf, "," ); tok != NULL; tok = strtok( NULL, "," ) )
+	{
+		int j;
+		for ( j = 0; j < n_names; ++j )
+			if ( strcmp( tok, names[ j ] ) == 0 ) { flags[ j ] = TRUE; break; }
+		if ( j == n_names ) return FALSE;
+	}
+
+	return TRUE;
+}
+
+int main( int argc, char** argv )
+{
+	bool        all    = FALSE;
+	const char* kers   = "gemm,gemmsup,packm";
+	const char* dts    = "sdcz";
+	const char* ks     = "16,64,256";
+	int         reps   = 5;
+	double      ghz    = 0.0;
+	const char* fmt    = "csv";
+	bool        ker_on[ KER_NUM ];
+
+	for ( int i = 1; i < argc; ++i )
+	{
+		if      ( strcmp( argv[ i ], "-A" ) == 0 )                 all  = TRUE;
+		else if ( strcmp( argv[ i ], "-u" ) == 0 && i + 1 < argc ) kers = argv[ ++i ];
+		else if ( strcmp( argv[ i ], "-d" ) == 0 && i + 1 < argc ) dts  = argv[ ++i ];
+		else if ( strcmp( argv[ i ], "-k" ) == 0 && i + 1 < argc ) ks   = argv[ ++i ];
+		else if ( strcmp( argv[ i ], "-r" ) == 0 && i + 1 < argc ) reps = atoi( argv[ ++i ] );
+		else if ( strcmp( argv[ i ], "-c" ) == 0 && i + 1 < argc ) ghz  = atof( argv[ ++i ] );
+		else if ( strcmp( argv[ i ], "-f" ) == 0 && i + 1 < argc ) fmt  = argv[ ++i ];
+		else
+		{
+			fprintf( stderr, "usage: %s [-A] [-u kers] [-d dts] [-k ks] [-r reps] [-c ghz] [-f fmt]\n",
+			         argv[ 0 ] );
+			return 2;
+		}
+	}
+
+	if ( !parse_names( kers, ker_strs, KER_NUM, ker_on ) )
+	{
+		fprintf( stderr, "invalid kernel list '%s'\n", kers );
+		return 2;
+	}
+	for ( const char* d = dts; *d != '\0'; ++d )
+	{
+		if ( strchr( "sdcz", *d ) == NULL )
+		{
+			fprintf( stderr, "unknown datatype '%c'\n", *d );
+			return 2;
+		}
+	}
+
+	// Gather the values of k.
+	dim_t k_list[ 64 ];
+	int   n_k = 0;
+
+	for ( const char* t = ks; *t != '\0' && n_k < 64; )
+	{
+		char*      end;
+		const long k = strtol( t, &end, 10 );
+
+		if ( end == t || k < 1 || ( *end != ',' && *end != '\0' ) )
+		{
+			fprintf( stderr, "invalid list of k '%s'\n", ks );
+			return 2;
+		}
+
+		k_list[ n_k++ ] = k;
+		t = ( *end == ',' ? end + 1 : end );
+	}
+	reps = bli_max( reps, 1 );
+
+	const bool json = ( strcmp( fmt, "json" ) == 0 );
+
+	if ( !json && strcmp( fmt, "csv" ) != 0 )
+	{
+		fprintf( stderr, "unknown format '%s'\n", fmt );
+		return 2;
+	}
+
+#ifndef BENCH_HAVE_TSC
+	if ( ghz <= 0.0 ) ghz = clock_ghz_query();
+	if ( ghz <= 0.0 )
+	{
+		fprintf( stderr, "the clock rate is unknown; please give it with -c\n" );
+		return 2;
+	}
+#endif
+
+	bli_init();
+
+	// The reference kernels of the running sub-configuration, against which
+	// its registered kernels are compared.
+	const arch_t active = bli_arch_query_id();
+	cntx_t       ref_cntx;
+
+	bli_gks_init_ref_cntx( &ref_cntx );
+
+	signal( SIGILL, sigill_handler );
+
+	FILE* fp = stdout;
+
+	if ( json )
+		fprintf( fp, "{\"arch\": \"%s\", \"counter\": \"%s\", \"results\": [",
+		         bli_arch_string( active ),
+#ifdef BENCH_HAVE_TSC
+		         "tsc"
+#else
+		         "clock"
+#endif
+		       );
+	else
+		fprintf( fp, "arch,kernel,dt,stor,impl,m,n,k,cycles_per_call,"
+		             "flops_per_cycle,peak_flops_per_cycle,pct_peak,"
+		             "bytes_per_cycle\n" );
+
+	long n_call = 0;
+
+	for ( arch_t id = 0; id < BLIS_NUM_ARCHS; ++id )
+	{
+		if ( !all && id != active ) continue;
+		if ( bli_gks_lookup_id( id ) == NULL ) continue;
+
+		cntx_t* cntx = ( cntx_t* )bli_gks_lookup_nat_cntx( id );
+
+		for ( int ker = 0; ker < KER_NUM; ++ker )
+		{
+			if ( !ker_on[ ker ] ) continue;
+
+			for ( const char* d = dts; *d != '\0'; ++d )
+			{
+				num_t dt;
+				bli_param_map_char_to_blis_dt( *d, &dt );
+
+				// The storage variants (and, for packm, the kernel) to time.
+				const int n_var = ( ker == KER_GEMM    ? 2 :
+				                    ker == KER_GEMMSUP ? BLIS_XXX : 4 );
+
+				for ( int v = 0; v < n_var; ++v )
+				{
+					void_fp f, f_ref;
+					ukr_t   ukr_id;
+
+					if      ( ker == KER_GEMM )    ukr_id = BLIS_GEMM_UKR;
+					else if ( ker == KER_GEMMSUP ) ukr_id = bli_stor3_ukr( ( stor3_t )v );
+					else                           ukr_id = ( v < 2 ? BLIS_PACKM_MRXK_KER
+					                                                : BLIS_PACKM_NRXK_KER );
+
+					f     = bli_cntx_get_ukr_dt( dt, ukr_id, cntx );
+					f_ref = bli_cntx_get_ukr_dt( dt, ukr_id, &ref_cntx );
+
+					if ( f == NULL ) continue;
+					if ( ker == KER_GEMMSUP &&
+					     bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_MR, cntx ) < 1 ) continue;
+
+					const char* impl = ( id != active ? "" : f == f_ref ? "ref" : "opt" );
+
+					for ( int kk = 0; kk < n_k; ++kk )
+					{
+						call_t c;
+
+						c.f    = f;
+						c.dt   = dt;
+						c.dtc  = *d;
+						c.cntx = cntx;
+						memcpy( &c.alpha, bli_obj_buffer_for_const( dt, &BLIS_ONE ), bli_dt_size( dt ) );
+						memcpy( &c.beta,  bli_obj_buffer_for_const( dt, &BLIS_ONE ), bli_dt_size( dt ) );
+
+						if      ( ker == KER_GEMM )    call_init_gemm( &c, ker, v == 0 ? BLIS_RRR : BLIS_CCC, k_list[ kk ] );
+						else if ( ker == KER_GEMMSUP ) call_init_gemm( &c, ker, ( stor3_t )v, k_list[ kk ] );
+						else                           call_init_packm( &c, v >= 2, v % 2 == 1, k_list[ kk ] );
+
+						const double cycles = call_time( &c, ker, reps, ghz );
+
+						if ( cycles < 0.0 )
+						{
+							fprintf( stderr, "skipping %s %s kernel for '%c': illegal instruction\n",
+							         bli_arch_string( id ), c.name, *d );
+							call_free( &c, ker );
+							break;
+						}
+
+						print_call( fp, json, n_call == 0, id, &c, impl, cycles );
+						fflush( fp );
+
+						call_free( &c, ker );
+						n_call += 1;
+					}
+				}
+			}
+		}
+	}
+
+	if ( json )
+		fprintf( fp, "%s]}\n", n_call > 0 ? "\n  " : "" );
+
+	fflush( fp );
+
+	bli_finalize();
+
+	return 0;
+}
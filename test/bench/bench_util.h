@@ -0,0 +1,121 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+#ifndef BENCH_UTIL_H
+#define BENCH_UTIL_H
+
+//
+// Definitions shared by the benchmark drivers: the theoretical peak of each
+// sub-configuration and the clock rate of the processor.
+//
+
+// The width of the vector registers and the number of vector FMAs (or pairs
+// of vector additions and multiplications) issued per cycle by the cores
+// targeted by each sub-configuration. Sub-configurations that are not listed
+// have no theoretical peak.
+static const struct { arch_t arch; int vec_bytes; int n_fma; } peak_archs[] =
+{
+	{ BLIS_ARCH_SKX,         64, 2 },
+	{ BLIS_ARCH_KNL,         64, 2 },
+	{ BLIS_ARCH_HASWELL,     32, 2 },
+	{ BLIS_ARCH_SANDYBRIDGE, 32, 1 },
+	{ BLIS_ARCH_PENRYN,      16, 1 },
+	{ BLIS_ARCH_ZEN3,        32, 2 },
+	{ BLIS_ARCH_ZEN2,        32, 2 },
+	{ BLIS_ARCH_ZEN,         16, 2 },
+	{ BLIS_ARCH_A64FX,       64, 2 },
+	{ BLIS_ARCH_THUNDERX2,   16, 2 },
+	{ BLIS_ARCH_FIRESTORM,   16, 4 },
+};
+
+// The theoretical peak flops per cycle of one core of a sub-configuration
+// for a datatype, or zero if it is unknown. A complex FMA is counted as four
+// real ones, so real and complex datatypes of the same precision share a
+// peak.
+BLIS_INLINE double peak_flops_per_cycle( arch_t arch, num_t dt )
+{
+	for ( size_t i = 0; i < sizeof( peak_archs ) / sizeof( peak_archs[ 0 ] ); ++i )
+	{
+		if ( peak_archs[ i ].arch != arch ) continue;
+
+		const int elem_bytes = bli_dt_size( bli_dt_proj_to_real( dt ) );
+
+		return 2.0 * peak_archs[ i ].n_fma *
+		       ( peak_archs[ i ].vec_bytes / elem_bytes );
+	}
+
+	return 0.0;
+}
+
+// Query the maximum clock rate of the first processor, falling back to its
+// current clock rate, and returning zero if neither is known.
+BLIS_INLINE double clock_ghz_query( void )
+{
+	FILE*  fp;
+	char   line[ 256 ];
+	double mhz = 0.0;
+
+	fp = fopen( "/sys/devices/system/cpu/cpu0/cpufreq/cpuinfo_max_freq", "r" );
+
+	if ( fp != NULL )
+	{
+		// The maximum clock rate is given in kHz.
+		if ( fgets( line, sizeof( line ), fp ) != NULL ) mhz = atof( line ) / 1000.0;
+		fclose( fp );
+
+		if ( mhz > 0.0 ) return mhz / 1000.0;
+	}
+
+	fp = fopen( "/proc/cpuinfo", "r" );
+
+	if ( fp == NULL ) return 0.0;
+
+	while ( fgets( line, sizeof( line ), fp ) != NULL )
+	{
+		if ( strncmp( line, "cpu MHz", 7 ) == 0 )
+		{
+			const char* colon = strchr( line, ':' );
+			if ( colon != NULL ) mhz = atof( colon + 1 );
+			break;
+		}
+	}
+
+	fclose( fp );
+
+	return mhz / 1000.0;
+}
+
+#endif
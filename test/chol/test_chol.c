@@ -0,0 +1,330 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "blis.h"
+
+//
+// Accuracy and throughput of the Cholesky addon (bao_chol_ex()).
+//
+// With no arguments, each datatype, uplo, and storage of A is checked on
+// sizes that are and are not multiples of the algorithmic blocksize, with
+// one and with several threads (the latter exercises the lookahead and the
+// dynamic scheduling even on a single core). The residual A - L L^H (or
+// A - U^H U) is reported relative to n |A| u, as in the LAPACK test suite.
+// Matrices that are not positive definite are checked to report the order
+// of the first leading minor that is not.
+//
+// With "-p" followed by a list of problem sizes, the throughput of dpotrf
+// (lower, column-major) as computed by bao_chol() is compared with that of
+// the blocked algorithm of LAPACK's dpotrf, i.e. a serial factorization of
+// each diagonal block followed by calls to (multithreaded) dsyrk, dgemm,
+// and dtrsm on the same BLIS. If compiled with -DUSE_LAPACK (and linked
+// with a LAPACK library), dpotrf_() itself is used instead. The number of
+// threads is taken from the environment (e.g. BLIS_NUM_THREADS).
+//
+
+static char dt_char( num_t dt )
+{
+	return bli_dt_prec_is_single( dt ) ? ( bli_dt_dom_is_real( dt ) ? 's' : 'c' )
+	                                   : ( bli_dt_dom_is_real( dt ) ? 'd' : 'z' );
+}
+
+// Create a random Hermitian positive definite matrix of order m.
+static void create_hpd( num_t dt, dim_t m, bool row_a, obj_t* a )
+{
+	obj_t b;
+
+	if ( row_a ) bli_obj_create( dt, m, m, m, 1, a );
+	else         bli_obj_create( dt, m, m, 1, m, a );
+	bli_obj_create( dt, m, m, 0, 0, &b );
+
+	bli_randm( &b );
+
+	// A = B B^H + m I
+	bli_obj_set_struc( BLIS_HERMITIAN, a );
+	bli_obj_set_uplo( BLIS_LOWER, a );
+	bli_setm( &BLIS_ZERO, a );
+	bli_herk( &BLIS_ONE, &b, &BLIS_ZERO, a );
+	bli_mkherm( a );
+	bli_obj_set_uplo( BLIS_DENSE, a );
+
+	obj_t alpha;
+	bli_obj_scalar_init_detached( dt, &alpha );
+	bli_setsc( ( double )m, 0.0, &alpha );
+	bli_shiftd( &alpha, a );
+
+	bli_obj_free( &b );
+}
+
+static int test_chol( num_t dt, uplo_t uplo, bool row_a, dim_t m, dim_t nt )
+{
+	obj_t a, a0, f, norm;
+
+	create_hpd( dt, m, row_a, &a );
+	bli_obj_create( dt, m, m, 0, 0, &a0 );
+	bli_copym( &a, &a0 );
+	bli_obj_scalar_init_detached( bli_dt_proj_to_real( dt ), &norm );
+
+	rntm_t rntm = BLIS_RNTM_INITIALIZER;
+	bli_rntm_set_num_threads( nt, &rntm );
+
+	bli_obj_set_struc( BLIS_HERMITIAN, &a );
+	bli_obj_set_uplo( uplo, &a );
+
+	const dim_t info = bao_chol_ex( &a, NULL, &rntm );
+
+	// Form L L^H (or U^H U) from the triangle that holds the factor and
+	// subtract it from the original matrix.
+	bli_obj_create( dt, m, m, 0, 0, &f );
+	bli_obj_set_struc( BLIS_TRIANGULAR, &a );
+	bli_copym( &a, &f );
+	bli_obj_set_uplo( uplo, &f );
+	bli_mktrim( &f );
+	bli_obj_set_uplo( BLIS_DENSE, &f );
+
+	obj_t fh;
+	bli_obj_alias_to( &f, &fh );
+	bli_obj_set_conjtrans( BLIS_CONJ_TRANSPOSE, &fh );
+
+	double na, nd, ni;
+	double eps = bli_dt_prec_is_single( dt ) ? 5.96e-8 : 1.11e-16;
+
+	bli_normfm( &a0, &norm ); bli_getsc( &norm, &na, &ni );
+	if ( bli_is_lower( uplo ) ) bli_gemm( &BLIS_MINUS_ONE, &f, &fh, &BLIS_ONE, &a0 );
+	else                        bli_gemm( &BLIS_MINUS_ONE, &fh, &f, &BLIS_ONE, &a0 );
+	bli_normfm( &a0, &norm ); bli_getsc( &norm, &nd, &ni );
+
+	const double resid = nd / ( m * na * eps );
+	const int    fail  = ( info != 0 || !( resid < 30.0 ) );
+
+	printf( "%cchol uplo %c A %s nt %d m %4d: info = %d resid = %8.2e %s\n",
+	        dt_char( dt ), bli_is_lower( uplo ) ? 'l' : 'u',
+	        row_a ? "row" : "col", ( int )nt, ( int )m, ( int )info,
+	        resid, fail ? "FAIL" : "PASS" );
+
+	bli_obj_free( &a );
+	bli_obj_free( &a0 );
+	bli_obj_free( &f );
+
+	return fail;
+}
+
+// Check that the factorization of a matrix whose leading minor of order
+// k+1 is not positive definite (but whose smaller leading minors are)
+// reports k+1.
+static int test_chol_npd( num_t dt, uplo_t uplo, dim_t m, dim_t k, dim_t nt )
+{
+	obj_t a;
+
+	create_hpd( dt, m, FALSE, &a );
+
+	// Make the Schur complement of the leading k x k block with respect to
+	// element (k,k) negative by replacing that element with a negative one.
+	obj_t akk;
+	bli_acquire_mpart( k, k, 1, 1, &a, &akk );
+	bli_setsc( -1.0, 0.0, &akk );
+
+	rntm_t rntm = BLIS_RNTM_INITIALIZER;
+	bli_rntm_set_num_threads( nt, &rntm );
+
+	bli_obj_set_struc( BLIS_HERMITIAN, &a );
+	bli_obj_set_uplo( uplo, &a );
+
+	const dim_t info = bao_chol_ex( &a, NULL, &rntm );
+	const int   fail = ( info != k + 1 );
+
+	printf( "%cchol uplo %c not HPD at %4d nt %d m %4d: info = %d %s\n",
+	        dt_char( dt ), bli_is_lower( uplo ) ? 'l' : 'u', ( int )k,
+	        ( int )nt, ( int )m, ( int )info, fail ? "FAIL" : "PASS" );
+
+	bli_obj_free( &a );
+
+	return fail;
+}
+
+#ifdef USE_LAPACK
+void dpotrf_( const char* uplo, const int* n, double* a, const int* lda, int* info );
+#endif
+
+// LAPACK's blocked dpotrf (lower), with ILAENV's default blocksize and an
+// unblocked factorization of each diagonal block.
+static dim_t ref_dpotrf( dim_t n, double* a, inc_t lda )
+{
+#ifdef USE_LAPACK
+	int n_i = n, lda_i = lda, info;
+	dpotrf_( "L", &n_i, a, &lda_i, &info );
+	return info;
+#else
+	const dim_t nb = 64;
+
+	for ( dim_t j = 0; j < n; j += nb )
+	{
+		const dim_t jb = bli_min( nb, n - j );
+		double*     ajj = a + j + j * lda;
+
+		bli_dsyrk( BLIS_LOWER, BLIS_NO_TRANSPOSE, jb, j,
+		           bli_dm1, a + j, 1, lda, bli_d1, ajj, 1, lda );
+
+		for ( dim_t jj = 0; jj < jb; ++jj )
+		{
+			double* d = ajj + jj + jj * lda;
+			if ( !( *d > 0.0 ) ) return j + jj + 1;
+			*d = sqrt( *d );
+			for ( dim_t i = jj + 1; i < jb; ++i ) d[ i - jj ] /= *d;
+			for ( dim_t k = jj + 1; k < jb; ++k )
+			for ( dim_t i = k; i < jb; ++i )
+				ajj[ i + k * lda ] -= ajj[ i + jj * lda ] * ajj[ k + jj * lda ];
+		}
+
+		if ( j + jb < n )
+		{
+			bli_dgemm( BLIS_NO_TRANSPOSE, BLIS_TRANSPOSE, n - j - jb, jb, j,
+			           bli_dm1, a + j + jb, 1, lda, a + j, 1, lda,
+			           bli_d1, ajj + jb, 1, lda );
+			bli_dtrsm( BLIS_RIGHT, BLIS_LOWER, BLIS_TRANSPOSE, BLIS_NONUNIT_DIAG,
+			           n - j - jb, jb, bli_d1, ajj, 1, lda, ajj + jb, 1, lda );
+		}
+	}
+
+	return 0;
+#endif
+}
+
+static void time_chol( dim_t n, dim_t n_repeats, double* gflops_ref, double* gflops_bao )
+{
+	obj_t a, a0;
+
+	create_hpd( BLIS_DOUBLE, n, FALSE, &a0 );
+	bli_obj_create( BLIS_DOUBLE, n, n, 1, n, &a );
+
+	double dtime_ref = 1.0e9;
+	double dtime_bao = 1.0e9;
+
+	for ( dim_t r = 0; r < n_repeats; ++r )
+	{
+		bli_copym( &a0, &a );
+
+		double dtime = bli_clock();
+		ref_dpotrf( n, bli_obj_buffer( &a ), n );
+		dtime_ref = bli_clock_min_diff( dtime_ref, dtime );
+
+		bli_copym( &a0, &a );
+		bli_obj_set_struc( BLIS_HERMITIAN, &a );
+		bli_obj_set_uplo( BLIS_LOWER, &a );
+
+		dtime = bli_clock();
+		bao_chol( &a );
+		dtime_bao = bli_clock_min_diff( dtime_bao, dtime );
+
+		bli_obj_set_struc( BLIS_GENERAL, &a );
+		bli_obj_set_uplo( BLIS_DENSE, &a );
+	}
+
+	const double flops = ( double )n * n * n / 3.0;
+
+	*gflops_ref = flops / ( dtime_ref * 1.0e9 );
+	*gflops_bao = flops / ( dtime_bao * 1.0e9 );
+
+	bli_obj_free( &a );
+	bli_obj_free( &a0 );
+}
+
+int main( int argc, char** argv )
+{
+	bli_init();
+
+	if ( argc > 1 && strcmp( argv[ 1 ], "-p" ) == 0 )
+	{
+#ifdef USE_LAPACK
+		printf( "%6s %10s %10s\n", "n", "dpotrf", "bao_chol" );
+#else
+		printf( "%6s %10s %10s\n", "n", "ref", "bao_chol" );
+#endif
+
+		for ( int i = 2; i < argc; ++i )
+		{
+			dim_t  n = atoi( argv[ i ] );
+			double gf_ref, gf_bao;
+
+			time_chol( n, 3, &gf_ref, &gf_bao );
+
+			printf( "%6d %10.2f %10.2f\n", ( int )n, gf_ref, gf_bao );
+		}
+
+		bli_finalize();
+		return 0;
+	}
+
+	const num_t  dts[]   = { BLIS_FLOAT, BLIS_DOUBLE, BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+	const uplo_t uplos[] = { BLIS_LOWER, BLIS_UPPER };
+	const dim_t  sizes[] = { 1, 13, 64, 250, 511, 700 };
+	const dim_t  nts[]   = { 1, 3 };
+
+	int n_fail = 0, n_test = 0;
+
+	for ( int idt = 0; idt < 4; ++idt )
+	for ( int iu = 0; iu < 2; ++iu )
+	for ( int is = 0; is < 6; ++is )
+	for ( int ra = 0; ra < 2; ++ra )
+	for ( int it = 0; it < 2; ++it )
+	{
+		n_fail += test_chol( dts[ idt ], uplos[ iu ], ra, sizes[ is ], nts[ it ] );
+		++n_test;
+	}
+
+	const dim_t npd_ks[] = { 0, 5, 300, 599 };
+
+	for ( int idt = 0; idt < 4; ++idt )
+	for ( int iu = 0; iu < 2; ++iu )
+	for ( int ik = 0; ik < 4; ++ik )
+	for ( int it = 0; it < 2; ++it )
+	{
+		n_fail += test_chol_npd( dts[ idt ], uplos[ iu ], 600, npd_ks[ ik ], nts[ it ] );
+		++n_test;
+	}
+
+	printf( "%d of %d tests passed\n", n_test - n_fail, n_test );
+
+	bli_finalize();
+
+	return n_fail ? 1 : 0;
+}
+
@@ -0,0 +1,411 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "blis.h"
+
+//
+// Accuracy and throughput of the 2D convolution addon (bao_conv2d_ex()).
+//
+// With no arguments (or with the number of seeds), each test case draws a
+// random convolution (layout, batch size, image and filter dimensions,
+// strides, padding, and dilations), which is computed with bao_conv2d_ex()
+// (with one or three threads) and with simple loops in double precision.
+// Cases with beta = 0 (and Y initialized to NaN), alpha = 0, and larger
+// images and filters (for which the im2col matrix spans several blocks of
+// the gemm) are included.
+//
+// With "-p", the throughput of single-precision convolutions typical of
+// image classification networks is compared with that of forming the
+// im2col matrix explicitly and calling bli_sgemm(). The number of threads
+// is taken from the environment (e.g. BLIS_NUM_THREADS).
+//
+
+static double get_re( num_t dt, const void* x, inc_t off )
+{
+	if      ( dt == BLIS_FLOAT    ) return ( ( float*    )x )[ off ];
+	else if ( dt == BLIS_DOUBLE   ) return ( ( double*   )x )[ off ];
+	else if ( dt == BLIS_SCOMPLEX ) return ( ( scomplex* )x )[ off ].real;
+	else                            return ( ( dcomplex* )x )[ off ].real;
+}
+
+static double get_im( num_t dt, const void* x, inc_t off )
+{
+	if      ( dt == BLIS_SCOMPLEX ) return ( ( scomplex* )x )[ off ].imag;
+	else if ( dt == BLIS_DCOMPLEX ) return ( ( dcomplex* )x )[ off ].imag;
+	else                            return 0.0;
+}
+
+static void set_elem( num_t dt, void* x, inc_t off, double re, double im )
+{
+	if      ( dt == BLIS_FLOAT    ) ( ( float*  )x )[ off ] = re;
+	else if ( dt == BLIS_DOUBLE   ) ( ( double* )x )[ off ] = re;
+	else if ( dt == BLIS_SCOMPLEX ) { ( ( scomplex* )x )[ off ].real = re;
+	                                  ( ( scomplex* )x )[ off ].imag = im; }
+	else                            { ( ( dcomplex* )x )[ off ].real = re;
+	                                  ( ( dcomplex* )x )[ off ].imag = im; }
+}
+
+// Offsets of the elements of X, W, and Y in either layout.
+
+static inc_t x_off( const conv2d_t* cv, dim_t n, dim_t c, dim_t y, dim_t x )
+{
+	if ( cv->layout == BAO_CONV2D_NCHW )
+		return ( ( n * cv->c_in + c ) * cv->h + y ) * cv->w + x;
+	else
+		return ( ( n * cv->h + y ) * cv->w + x ) * cv->c_in + c;
+}
+
+static inc_t w_off( const conv2d_t* cv, dim_t o, dim_t c, dim_t r, dim_t s )
+{
+	if ( cv->layout == BAO_CONV2D_NCHW )
+		return ( ( o * cv->c_in + c ) * cv->kh + r ) * cv->kw + s;
+	else
+		return ( ( o * cv->kh + r ) * cv->kw + s ) * cv->c_in + c;
+}
+
+static inc_t y_off( const conv2d_t* cv, dim_t n, dim_t o, dim_t y, dim_t x )
+{
+	const dim_t h_out = bao_conv2d_h_out( cv );
+	const dim_t w_out = bao_conv2d_w_out( cv );
+
+	if ( cv->layout == BAO_CONV2D_NCHW )
+		return ( ( n * cv->c_out + o ) * h_out + y ) * w_out + x;
+	else
+		return ( ( n * h_out + y ) * w_out + x ) * cv->c_out + o;
+}
+
+static void fill_rand( num_t dt, void* x, dim_t size )
+{
+	for ( dim_t i = 0; i < size; ++i )
+		set_elem( dt, x, i, rand() / ( double )RAND_MAX - 0.5,
+		                    rand() / ( double )RAND_MAX - 0.5 );
+}
+
+static int test_conv2d( num_t dt, int seed, int kind )
+{
+	conv2d_t cv;
+
+	srand( 2000 + seed );
+
+	// Draw the convolution, redrawing until the filter fits.
+	do
+	{
+		const bool big = ( kind == 3 );
+
+		bao_conv2d_init( rand() % 2 ? BAO_CONV2D_NHWC : BAO_CONV2D_NCHW,
+		                 1 + rand() % 3,
+		                 big ? 24 + rand() % 16 : 1 + rand() % 8,
+		                 1 + rand() % ( big ? 40 : 20 ),
+		                 1 + rand() % ( big ? 40 : 20 ),
+		                 big ? 20 + rand() % 40 : 1 + rand() % 20,
+		                 1 + rand() % 4,
+		                 1 + rand() % 4,
+		                 &cv );
+
+		bao_conv2d_set_stride( 1 + rand() % 3, 1 + rand() % 3, &cv );
+		bao_conv2d_set_pad( rand() % 3, rand() % 3, &cv );
+		bao_conv2d_set_dilation( 1 + rand() % 2, 1 + rand() % 2, &cv );
+	}
+	while ( bao_conv2d_h_out( &cv ) < 1 || bao_conv2d_w_out( &cv ) < 1 );
+
+	const dim_t h_out  = bao_conv2d_h_out( &cv );
+	const dim_t w_out  = bao_conv2d_w_out( &cv );
+	const dim_t size_x = cv.n * cv.c_in * cv.h * cv.w;
+	const dim_t size_w = cv.c_out * cv.c_in * cv.kh * cv.kw;
+	const dim_t size_y = cv.n * cv.c_out * h_out * w_out;
+
+	siz_t   dt_size = bli_dt_size( dt );
+	void*   x       = malloc( size_x * dt_size );
+	void*   w       = malloc( size_w * dt_size );
+	void*   y       = malloc( size_y * dt_size );
+	double* y_ref   = malloc( 2 * size_y * sizeof( double ) );
+
+	fill_rand( dt, x, size_x );
+	fill_rand( dt, w, size_w );
+
+	for ( dim_t i = 0; i < size_y; ++i )
+	{
+		if ( kind == 1 ) set_elem( dt, y, i, NAN, NAN );
+		else             set_elem( dt, y, i, rand() / ( double )RAND_MAX - 0.5, rand() / ( double )RAND_MAX - 0.5 );
+		y_ref[ 2*i + 0 ] = get_re( dt, y, i );
+		y_ref[ 2*i + 1 ] = get_im( dt, y, i );
+	}
+
+	// kind 0: general alpha and beta; 1: beta = 0; 2: alpha = 0;
+	// 3: larger images and filters.
+	double alpha_r = ( kind == 2 ? 0.0 : 1.5 ), alpha_i = ( kind == 2 ? 0.0 : 0.5 );
+	double beta_r  = ( kind == 1 ? 0.0 : -0.5 ), beta_i  = ( kind == 1 ? 0.0 : 0.25 );
+	if ( bli_is_real( dt ) ) { alpha_i = 0.0; beta_i = 0.0; }
+
+	dcomplex alpha_buf[ 1 ], beta_buf[ 1 ];
+	set_elem( dt, alpha_buf, 0, alpha_r, alpha_i );
+	set_elem( dt, beta_buf,  0, beta_r,  beta_i );
+
+	const dim_t nt = ( seed % 2 ? 3 : 1 );
+
+	rntm_t rntm = BLIS_RNTM_INITIALIZER;
+	bli_rntm_set_num_threads( nt, &rntm );
+
+	bao_conv2d_ex( dt, &cv, alpha_buf, x, w, beta_buf, y, NULL, &rntm );
+
+	// Compute the reference result and the difference.
+	double diff = 0.0, nrm = 0.0;
+
+	for ( dim_t n = 0; n < cv.n; ++n )
+	for ( dim_t o = 0; o < cv.c_out; ++o )
+	for ( dim_t oy = 0; oy < h_out; ++oy )
+	for ( dim_t ox = 0; ox < w_out; ++ox )
+	{
+		double xw_r = 0.0, xw_i = 0.0;
+
+		for ( dim_t c = 0; c < cv.c_in; ++c )
+		for ( dim_t r = 0; r < cv.kh; ++r )
+		for ( dim_t s = 0; s < cv.kw; ++s )
+		{
+			dim_t iy = oy * cv.stride_h - cv.pad_h + r * cv.dil_h;
+			dim_t ix = ox * cv.stride_w - cv.pad_w + s * cv.dil_w;
+
+			if ( iy < 0 || cv.h <= iy || ix < 0 || cv.w <= ix ) continue;
+
+			inc_t  off_x = x_off( &cv, n, c, iy, ix );
+			inc_t  off_w = w_off( &cv, o, c, r, s );
+			double ar = get_re( dt, w, off_w ), ai = get_im( dt, w, off_w );
+			double br = get_re( dt, x, off_x ), bi = get_im( dt, x, off_x );
+
+			xw_r += ar * br - ai * bi;
+			xw_i += ar * bi + ai * br;
+			nrm  += fabs( ar * br ) + fabs( ai * bi );
+		}
+
+		inc_t  off_y = y_off( &cv, n, o, oy, ox );
+		double yr = y_ref[ 2*off_y + 0 ], yi = y_ref[ 2*off_y + 1 ];
+		double rr, ri;
+
+		if ( beta_r == 0.0 && beta_i == 0.0 ) { rr = 0.0; ri = 0.0; }
+		else { rr = beta_r * yr - beta_i * yi; ri = beta_r * yi + beta_i * yr; }
+
+		rr += alpha_r * xw_r - alpha_i * xw_i;
+		ri += alpha_r * xw_i + alpha_i * xw_r;
+
+		double dr = get_re( dt, y, off_y ) - rr;
+		double di = get_im( dt, y, off_y ) - ri;
+		double d  = sqrt( dr * dr + di * di );
+
+		if ( isnan( d ) ) d = INFINITY;
+		if ( d > diff ) diff = d;
+	}
+
+	// Report the difference relative to the average magnitude of the terms
+	// of each dot product and the unit roundoff.
+	double eps   = ( bli_is_single_prec( dt ) ? 5.96e-8 : 1.11e-16 );
+	double scale = ( nrm > 0.0 ? nrm / size_y : 1.0 ) * eps;
+	double resid = diff / scale;
+	bool   pass  = ( resid < 100.0 );
+
+	char dtc = ( dt == BLIS_FLOAT ? 's' : dt == BLIS_DOUBLE ? 'd' :
+	             dt == BLIS_SCOMPLEX ? 'c' : 'z' );
+
+	printf( "%cconv2d seed %3d kind %d %s nt %d n %d c %2d->%2d hw %2dx%2d k %dx%d "
+	        "s %dx%d p %dx%d d %dx%d: resid = %8.2f %s\n",
+	        dtc, seed, kind, cv.layout == BAO_CONV2D_NCHW ? "nchw" : "nhwc",
+	        ( int )nt, ( int )cv.n, ( int )cv.c_in, ( int )cv.c_out,
+	        ( int )cv.h, ( int )cv.w, ( int )cv.kh, ( int )cv.kw,
+	        ( int )cv.stride_h, ( int )cv.stride_w, ( int )cv.pad_h,
+	        ( int )cv.pad_w, ( int )cv.dil_h, ( int )cv.dil_w,
+	        resid, pass ? "PASS" : "FAIL" );
+
+	free( x );
+	free( w );
+	free( y );
+	free( y_ref );
+
+	return pass ? 0 : 1;
+}
+
+// Compute a single-precision convolution by forming the im2col matrix
+// explicitly (as a column-stored k x (n*h_out*w_out) matrix whose rows are
+// ordered as the taps of W) and calling bli_sgemm().
+static void conv2d_explicit( const conv2d_t* cv, float* x, float* w, float* y )
+{
+	const dim_t h_out = bao_conv2d_h_out( cv );
+	const dim_t w_out = bao_conv2d_w_out( cv );
+	const bool  nhwc  = ( cv->layout == BAO_CONV2D_NHWC );
+	const dim_t k     = cv->c_in * cv->kh * cv->kw;
+	const dim_t n_img = ( nhwc ? 1 : cv->n );
+	const dim_t n_pix = ( nhwc ? cv->n : 1 ) * h_out * w_out;
+
+	float* col = malloc( k * n_pix * sizeof( float ) );
+	float  one = 1.0f, zero = 0.0f;
+
+	for ( dim_t img = 0; img < n_img; ++img )
+	{
+		for ( dim_t p = 0; p < n_pix; ++p )
+		{
+			const dim_t ox = p % w_out;
+			const dim_t oy = ( p / w_out ) % h_out;
+			const dim_t n  = ( nhwc ? p / ( w_out * h_out ) : img );
+
+			for ( dim_t c = 0; c < cv->c_in; ++c )
+			for ( dim_t r = 0; r < cv->kh; ++r )
+			for ( dim_t s = 0; s < cv->kw; ++s )
+			{
+				dim_t iy  = oy * cv->stride_h - cv->pad_h + r * cv->dil_h;
+				dim_t ix  = ox * cv->stride_w - cv->pad_w + s * cv->dil_w;
+				dim_t tap = ( nhwc ? ( r * cv->kw + s ) * cv->c_in + c
+				                   : ( c * cv->kh + r ) * cv->kw + s );
+
+				col[ p * k + tap ] =
+				  ( iy < 0 || cv->h <= iy || ix < 0 || cv->w <= ix )
+				  ? 0.0f : x[ x_off( cv, n, c, iy, ix ) ];
+			}
+		}
+
+		if ( nhwc )
+			bli_sgemm( BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE, cv->c_out, n_pix, k,
+			           &one, w, k, 1, col, 1, k, &zero, y, 1, cv->c_out );
+		else
+			bli_sgemm( BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE, cv->c_out, n_pix, k,
+			           &one, w, k, 1, col, 1, k, &zero,
+			           y + img * cv->c_out * n_pix, n_pix, 1 );
+	}
+
+	free( col );
+}
+
+static void time_conv2d( conv2d_layout_t layout, dim_t n, dim_t c, dim_t hw, dim_t o,
+                         dim_t ks, dim_t stride )
+{
+	conv2d_t cv;
+
+	bao_conv2d_init( layout, n, c, hw, hw, o, ks, ks, &cv );
+	bao_conv2d_set_stride( stride, stride, &cv );
+	bao_conv2d_set_pad( ks / 2, ks / 2, &cv );
+
+	const dim_t h_out  = bao_conv2d_h_out( &cv );
+	const dim_t w_out  = bao_conv2d_w_out( &cv );
+	const dim_t size_x = n * c * hw * hw;
+	const dim_t size_w = o * c * ks * ks;
+	const dim_t size_y = n * o * h_out * w_out;
+
+	float* x = malloc( size_x * sizeof( float ) );
+	float* w = malloc( size_w * sizeof( float ) );
+	float* y = malloc( size_y * sizeof( float ) );
+	float  one = 1.0f, zero = 0.0f;
+
+	fill_rand( BLIS_FLOAT, x, size_x );
+	fill_rand( BLIS_FLOAT, w, size_w );
+
+	double dtime_exp = 1.0e9;
+	double dtime_bao = 1.0e9;
+
+	for ( int r = 0; r < 3; ++r )
+	{
+		double dtime = bli_clock();
+		conv2d_explicit( &cv, x, w, y );
+		dtime_exp = bli_clock_min_diff( dtime_exp, dtime );
+
+		dtime = bli_clock();
+		bao_conv2d( BLIS_FLOAT, &cv, &one, x, w, &zero, y );
+		dtime_bao = bli_clock_min_diff( dtime_bao, dtime );
+	}
+
+	const double flops = 2.0 * size_y * c * ks * ks;
+
+	printf( "%s %3d %3d %3d %3d %d %d %10.2f %10.2f %10.1f\n",
+	        layout == BAO_CONV2D_NCHW ? "nchw" : "nhwc", ( int )n, ( int )c,
+	        ( int )hw, ( int )o, ( int )ks, ( int )stride,
+	        flops / ( dtime_exp * 1.0e9 ), flops / ( dtime_bao * 1.0e9 ),
+	        c * ks * ks * n * h_out * w_out * sizeof( float ) / 1048576.0 );
+
+	free( x );
+	free( w );
+	free( y );
+}
+
+int main( int argc, char** argv )
+{
+	num_t dts[ 4 ] = { BLIS_FLOAT, BLIS_DOUBLE, BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+	int   n_test   = 0;
+	int   n_fail   = 0;
+
+	bli_init();
+
+	if ( argc > 1 && strcmp( argv[ 1 ], "-p" ) == 0 )
+	{
+		const dim_t layers[][5] = { {   3, 224,  64, 7, 2 }, {  64,  56,  64, 3, 1 },
+		                            {  64,  56, 256, 1, 1 }, { 128,  28, 128, 3, 1 },
+		                            { 256,  14, 256, 3, 1 }, { 512,   7, 512, 3, 1 } };
+
+		printf( "%s %3s %3s %3s %3s %s %s %10s %10s %10s\n", "layt", "n", "c",
+		        "hw", "o", "k", "s", "im2col", "bao", "im2col MB" );
+
+		for ( int l = 0; l < 2; ++l )
+		for ( int i = 0; i < 6; ++i )
+		{
+			const dim_t* ly = layers[ i ];
+
+			time_conv2d( l ? BAO_CONV2D_NHWC : BAO_CONV2D_NCHW,
+			             4, ly[ 0 ], ly[ 1 ], ly[ 2 ], ly[ 3 ], ly[ 4 ] );
+		}
+
+		bli_finalize();
+		return 0;
+	}
+
+	int n_seed = ( argc > 1 ? atoi( argv[ 1 ] ) : 40 );
+
+	for ( int d = 0; d < 4; ++d )
+	for ( int seed = 0; seed < n_seed; ++seed )
+	{
+		// Exercise the special cases on a few of the seeds.
+		int kind = ( seed % 10 < 4 ? seed % 10 : 0 );
+
+		n_fail += test_conv2d( dts[ d ], seed, kind );
+		n_test += 1;
+	}
+
+	printf( "%d of %d tests passed\n", n_test - n_fail, n_test );
+
+	bli_finalize();
+
+	return n_fail ? 1 : 0;
+}
+
@@ -0,0 +1,305 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#undef  _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "blis.h"
+
+//
+// The per-thread cache of dispatch decisions (bli_dcache_lookup() and
+// bli_dcache_insert()) and its use by bli_rntm_set_ways_for_op(),
+// bli_rntm_set_ways_from_rntm_sup(), and bli_gemmsup().
+//
+// Cached decisions must be indistinguishable from recomputed ones, must not
+// be shared between threads or survive an invalidation, a reinitialization
+// of BLIS, or a change to the blocksizes or sup thresholds of the native
+// context, and must not be made for contexts other than the native context
+// or for runtimes whose ways of parallelism were set by the caller.
+//
+
+static int n_test = 0;
+static int n_fail = 0;
+
+static void check( bool ok, const char* what )
+{
+	n_test += 1;
+
+	if ( !ok ) n_fail += 1;
+
+	printf( "%-56s %s\n", what, ok ? "PASS" : "FAIL" );
+}
+
+static void key_init( dim_t m, const cntx_t* cntx, dkey_t* key )
+{
+	bli_dkey_init( BLIS_DEC_SUP, BLIS_GEMM, BLIS_DOUBLE, BLIS_CCC, 0,
+	               m, 17, 19, 1, cntx, key );
+}
+
+static void* lookup_thread( void* arg )
+{
+	dkey_t key;
+	dim_t  vals[ BLIS_DCACHE_NUM_VALS ];
+
+	key_init( 1001, NULL, &key );
+
+	*( bool* )arg = bli_dcache_lookup( &key, vals );
+
+	return NULL;
+}
+
+// Compare the ways of parallelism of two runtimes.
+static bool rntm_ways_equal( const rntm_t* r1, const rntm_t* r2 )
+{
+	return bli_rntm_num_threads( r1 ) == bli_rntm_num_threads( r2 ) &&
+	       bli_rntm_auto_factor( r1 ) == bli_rntm_auto_factor( r2 ) &&
+	       bli_rntm_jc_ways( r1 ) == bli_rntm_jc_ways( r2 ) &&
+	       bli_rntm_pc_ways( r1 ) == bli_rntm_pc_ways( r2 ) &&
+	       bli_rntm_ic_ways( r1 ) == bli_rntm_ic_ways( r2 ) &&
+	       bli_rntm_jr_ways( r1 ) == bli_rntm_jr_ways( r2 ) &&
+	       bli_rntm_ir_ways( r1 ) == bli_rntm_ir_ways( r2 );
+}
+
+int main( int argc, char** argv )
+{
+	dkey_t key;
+	dim_t  vals[ BLIS_DCACHE_NUM_VALS ];
+	dim_t  vals_in[ BLIS_DCACHE_NUM_VALS ] = { 3, 1, 4, 1, 5, 9, 2, 6 };
+	bool   ok;
+
+	bli_init();
+
+	const cntx_t* cntx = bli_gks_query_cntx();
+
+	// Basic insertion and lookup.
+	key_init( 1001, NULL, &key );
+	ok = !bli_dcache_lookup( &key, vals );
+	bli_dcache_insert( &key, vals_in );
+	ok = ok && bli_dcache_lookup( &key, vals ) &&
+	     memcmp( vals, vals_in, sizeof( vals ) ) == 0;
+	check( ok, "inserted decision found" );
+
+	key_init( 1002, NULL, &key );
+	ok = !bli_dcache_lookup( &key, vals );
+	key_init( 1001, NULL, &key );
+	key.nt = 2;
+	ok = ok && !bli_dcache_lookup( &key, vals );
+	check( ok, "different keys not found" );
+
+	bool found_in_thread = TRUE;
+	pthread_t thread;
+	pthread_create( &thread, NULL, lookup_thread, &found_in_thread );
+	pthread_join( thread, NULL );
+#ifdef BLIS_HAS_THREAD_LOCAL
+	check( !found_in_thread, "decisions not shared between threads" );
+#endif
+
+	// Decisions depending on the native context are cached; those depending
+	// on any other context are not.
+	cntx_t cntx_copy = *cntx;
+
+	key_init( 1003, cntx, &key );
+	bli_dcache_insert( &key, vals_in );
+	ok = bli_dcache_lookup( &key, vals );
+	key_init( 1003, &cntx_copy, &key );
+	bli_dcache_insert( &key, vals_in );
+	ok = ok && !bli_dcache_lookup( &key, vals );
+	check( ok, "only native context decisions cached" );
+
+	// Invalidation and reinitialization discard all decisions.
+	key_init( 1001, NULL, &key );
+	bli_dcache_invalidate();
+	ok = !bli_dcache_lookup( &key, vals );
+	bli_dcache_insert( &key, vals_in );
+	bli_finalize();
+	bli_init();
+	ok = ok && !bli_dcache_lookup( &key, vals );
+	check( ok, "invalidation and reinitialization clear cache" );
+
+	cntx = bli_gks_query_cntx();
+
+	// A cached factorization is the one that would be computed.
+	const dim_t nts[]  = { 1, 4, 6, 12, 16 };
+	const dim_t dims[] = { 31, 400, 1000, 4000 };
+
+	ok = TRUE;
+	for ( int t = 0; t < 5; ++t )
+	for ( int i = 0; i < 4; ++i )
+	for ( int j = 0; j < 4; ++j )
+	for ( int rep = 0; rep < 2; ++rep )
+	{
+		rntm_t r1, r2;
+
+		bli_rntm_init( &r1 );
+		bli_rntm_set_num_threads( nts[ t ], &r1 );
+		r2 = r1;
+
+		bli_dcache_invalidate();
+		bli_rntm_set_ways_for_op( rep ? BLIS_TRSM : BLIS_GEMM, BLIS_RIGHT,
+		                          dims[ i ], dims[ j ], 200, &r1 );
+		bli_rntm_set_ways_for_op( rep ? BLIS_TRSM : BLIS_GEMM, BLIS_RIGHT,
+		                          dims[ i ], dims[ j ], 200, &r2 );
+		ok = ok && rntm_ways_equal( &r1, &r2 );
+
+		bli_rntm_init( &r1 );
+		bli_rntm_set_num_threads( nts[ t ], &r1 );
+		r2 = r1;
+
+		bli_dcache_invalidate();
+		bli_rntm_set_ways_from_rntm_sup( dims[ i ], dims[ j ], 200, &r1 );
+		bli_rntm_set_ways_from_rntm_sup( dims[ i ], dims[ j ], 200, &r2 );
+		ok = ok && rntm_ways_equal( &r1, &r2 );
+	}
+	check( ok, "cached ways equal computed ways" );
+
+	// Explicit ways are never replaced by a cached factorization.
+	{
+		rntm_t r1;
+
+		bli_rntm_init( &r1 );
+		bli_rntm_set_num_threads( 6, &r1 );
+		bli_rntm_set_ways_for_op( BLIS_GEMM, BLIS_LEFT, 600, 600, 600, &r1 );
+
+		bli_rntm_init( &r1 );
+		bli_rntm_set_ways( 1, 1, 6, 1, 1, &r1 );
+		bli_rntm_set_ways_for_op( BLIS_GEMM, BLIS_LEFT, 600, 600, 600, &r1 );
+
+		ok = bli_rntm_jc_ways( &r1 ) == 1 && bli_rntm_ic_ways( &r1 ) == 6 &&
+		     bli_rntm_num_threads( &r1 ) == 6 && !bli_rntm_auto_factor( &r1 );
+		check( ok, "explicit ways bypass cache" );
+	}
+
+	// The sup decision of bli_gemmsup() is cached for the native context,
+	// and repeated calls compute the same results.
+	{
+		const dim_t m = 37, n = 29, k = 41;
+		obj_t a, b, c1, c2;
+
+		bli_obj_create( BLIS_DOUBLE, m, k, 0, 0, &a );
+		bli_obj_create( BLIS_DOUBLE, k, n, 0, 0, &b );
+		bli_obj_create( BLIS_DOUBLE, m, n, 0, 0, &c1 );
+		bli_obj_create( BLIS_DOUBLE, m, n, 0, 0, &c2 );
+		bli_randm( &a );
+		bli_randm( &b );
+
+		rntm_t rntm;
+		bli_rntm_init( &rntm );
+		bli_rntm_set_num_threads( 1, &rntm );
+
+		bli_dcache_invalidate();
+		bli_gemm_ex( &BLIS_ONE, &a, &b, &BLIS_ZERO, &c1, NULL, &rntm );
+
+		// bli_gemmsup() looks up the storage combination after any
+		// transposition for the microkernel's preference. Uncalibrated
+		// thresholds do not depend on the number of threads, which is then
+		// omitted from the key.
+		const bool    row_pref = bli_cntx_ukr_prefers_rows_dt( BLIS_DOUBLE, BLIS_GEMM_VIR_UKR, cntx );
+		const stor3_t stor_id  = row_pref ? bli_stor3_trans( BLIS_CCC ) : BLIS_CCC;
+
+		bli_dkey_init( BLIS_DEC_SUP, BLIS_GEMM, BLIS_DOUBLE, stor_id, 0,
+		               row_pref ? n : m, row_pref ? m : n, k, 0, cntx, &key );
+		ok = bli_dcache_lookup( &key, vals ) &&
+		     ( bool )vals[ 0 ] == bli_cntx_l3_sup_thresh_is_met_st( BLIS_DOUBLE, stor_id, 1,
+		                                                            key.m, key.n, k, cntx );
+#ifdef BLIS_HAS_THREAD_LOCAL
+		check( ok, "sup decision cached" );
+#endif
+
+		bli_gemm_ex( &BLIS_ONE, &a, &b, &BLIS_ZERO, &c2, NULL, &rntm );
+
+		double resid, resid_i;
+		obj_t  norm;
+
+		bli_obj_scalar_init_detached( BLIS_DOUBLE, &norm );
+		bli_subm( &c1, &c2 );
+		bli_normfm( &c2, &norm );
+		bli_getsc( &norm, &resid, &resid_i );
+		check( resid == 0.0, "repeated gemm results identical" );
+
+		// Loading a tuning profile into the native context discards the
+		// cached decision: with thresholds that no longer admit this shape,
+		// the next call must decide (and cache) against sup.
+		char path[] = "/tmp/blis_dcache_XXXXXX";
+		int  fd     = mkstemp( path );
+		FILE* fp    = fdopen( fd, "w" );
+
+		fprintf( fp, "d thresh %s 1 2 2 2\n", bli_stor3_string( stor_id ) );
+		fclose( fp );
+
+		ok = bli_tune_read_file( path, ( cntx_t* )cntx ) == BLIS_SUCCESS &&
+		     !bli_cntx_l3_sup_thresh_is_met_st( BLIS_DOUBLE, stor_id, 1,
+		                                        key.m, key.n, k, cntx );
+		remove( path );
+
+		bli_gemm_ex( &BLIS_ONE, &a, &b, &BLIS_ZERO, &c2, NULL, &rntm );
+
+		key.nt = 1;
+		ok = ok && bli_dcache_lookup( &key, vals ) && !( bool )vals[ 0 ];
+#ifdef BLIS_HAS_THREAD_LOCAL
+		check( ok, "sup decision recomputed after loading profile" );
+#endif
+
+		// Likewise for a calibration of the thresholds.
+		bli_l3_sup_thresh_calibrate( BLIS_DOUBLE, BLIS_CCC, 1, ( cntx_t* )cntx );
+
+		const bool is_met = bli_cntx_l3_sup_thresh_is_met_st( BLIS_DOUBLE, stor_id, 1,
+		                                                      key.m, key.n, k, cntx );
+
+		bli_gemm_ex( &BLIS_ONE, &a, &b, &BLIS_ZERO, &c2, NULL, &rntm );
+
+		ok = bli_dcache_lookup( &key, vals ) && ( bool )vals[ 0 ] == is_met;
+#ifdef BLIS_HAS_THREAD_LOCAL
+		check( ok, "sup decision recomputed after calibration" );
+#endif
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c1 );
+		bli_obj_free( &c2 );
+	}
+
+	printf( "%d of %d tests passed\n", n_test - n_fail, n_test );
+
+	bli_finalize();
+
+	return n_fail == 0 ? 0 : 1;
+}
+
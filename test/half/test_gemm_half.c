@@ -0,0 +1,126 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <stdio.h>
+#include "blis.h"
+
+//
+// Exercise gemm with bfloat16 and float16 storage for A and B (and float
+// storage for C). The result is compared against sgemm applied to the same
+// operands after they are cast to float, which should agree to within
+// single precision rounding error since the conversion to float is exact.
+//
+
+static int test_gemm_half( num_t dt, bool row_a, bool row_b, dim_t m, dim_t n, dim_t k )
+{
+	obj_t a, b, af, bf, c, c_ref, norm;
+	obj_t alpha, beta;
+	float diff, ref;
+
+	const inc_t rs_a = row_a ? k : 1, cs_a = row_a ? 1 : m;
+	const inc_t rs_b = row_b ? n : 1, cs_b = row_b ? 1 : k;
+
+	bli_obj_create( dt,         m, k, rs_a, cs_a, &a );
+	bli_obj_create( dt,         k, n, rs_b, cs_b, &b );
+	bli_obj_create( BLIS_FLOAT, m, k, 0, 0, &af );
+	bli_obj_create( BLIS_FLOAT, k, n, 0, 0, &bf );
+	bli_obj_create( BLIS_FLOAT, m, n, 0, 0, &c );
+	bli_obj_create( BLIS_FLOAT, m, n, 0, 0, &c_ref );
+	bli_obj_create_1x1( BLIS_FLOAT, &norm );
+
+	bli_obj_scalar_init_detached( BLIS_FLOAT, &alpha );
+	bli_obj_scalar_init_detached( BLIS_FLOAT, &beta );
+	bli_setsc( 1.5, 0.0, &alpha );
+	bli_setsc( -0.5, 0.0, &beta );
+
+	// Round the random float operands to the 16-bit format and back so that
+	// the reference sgemm sees exactly the values stored in a and b.
+	bli_randm( &af );
+	bli_randm( &bf );
+	bli_castm( &af, &a );
+	bli_castm( &bf, &b );
+	bli_castm( &a, &af );
+	bli_castm( &b, &bf );
+
+	bli_randm( &c );
+	bli_copym( &c, &c_ref );
+
+	bli_gemm( &alpha, &a,  &b,  &beta, &c );
+	bli_gemm( &alpha, &af, &bf, &beta, &c_ref );
+
+	bli_normfm( &c_ref, &norm );
+	ref = *( float* )bli_obj_buffer( &norm );
+
+	bli_subm( &c_ref, &c );
+	bli_normfm( &c, &norm );
+	diff = *( float* )bli_obj_buffer( &norm );
+
+	const float resid = diff / ref;
+	const int   fail  = !( resid < 1e-5f );
+
+	printf( "%-8s A %s B %s m %4d n %4d k %4d: resid = %9.2e %s\n",
+	        bli_dt_string( dt ),
+	        row_a ? "row" : "col", row_b ? "row" : "col",
+	        ( int )m, ( int )n, ( int )k, resid, fail ? "FAILURE" : "PASS" );
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &af );
+	bli_obj_free( &bf );
+	bli_obj_free( &c );
+	bli_obj_free( &c_ref );
+	bli_obj_free( &norm );
+
+	return fail;
+}
+
+int main( int argc, char** argv )
+{
+	const num_t dts[] = { BLIS_BFLOAT16, BLIS_FLOAT16 };
+	const dim_t sizes[][3] = { { 1, 1, 1 }, { 37, 29, 41 }, { 200, 151, 300 } };
+	int         fails = 0;
+
+	for ( int d = 0; d < 2; ++d )
+	for ( int s = 0; s < 3; ++s )
+	for ( int ra = 0; ra < 2; ++ra )
+	for ( int rb = 0; rb < 2; ++rb )
+	{
+		fails += test_gemm_half( dts[d], ra, rb,
+		                         sizes[s][0], sizes[s][1], sizes[s][2] );
+	}
+
+	return fails ? 1 : 0;
+}
+
@@ -0,0 +1,179 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "blis.h"
+
+//
+// Hardware performance counters attributed to the level-3 statistics
+// (bli_hwc).
+//
+// Where the counters can be opened, a large gemm must accumulate cycles and
+// instructions in its packing and macrokernel events. Where they cannot
+// (e.g. in a container, or with a restrictive perf_event_paranoid), the
+// counters must remain disabled without affecting the other statistics.
+//
+
+static int n_test = 0;
+static int n_fail = 0;
+
+static void check( bool ok, const char* what )
+{
+	n_test += 1;
+
+	if ( !ok ) n_fail += 1;
+
+	printf( "%-56s %s\n", what, ok ? "PASS" : "FAIL" );
+}
+
+static void run_gemm( dim_t m, dim_t n, dim_t k )
+{
+	obj_t a, b, c;
+
+	bli_obj_create( BLIS_DOUBLE, m, k, 0, 0, &a );
+	bli_obj_create( BLIS_DOUBLE, k, n, 0, 0, &b );
+	bli_obj_create( BLIS_DOUBLE, m, n, 0, 0, &c );
+	bli_randm( &a );
+	bli_randm( &b );
+	bli_setm( &BLIS_ZERO, &c );
+
+	bli_gemm( &BLIS_ONE, &a, &b, &BLIS_ZERO, &c );
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+}
+
+static bool hwc_are_zero( const stats_t* stats )
+{
+	for ( dim_t j = 0; j < BLIS_STATS_NUM_EVENTS; ++j )
+	for ( dim_t c = 0; c < BLIS_HWC_NUM_COUNTERS; ++c )
+		if ( stats->hwc[ j ][ c ] != 0 ) return FALSE;
+
+	return TRUE;
+}
+
+static bool dump_has_counters( void )
+{
+	char  buf[ 8192 ];
+	FILE* file = tmpfile();
+
+	bli_stats_fprint( file );
+	rewind( file );
+	size_t len = fread( buf, 1, sizeof( buf ) - 1, file );
+	buf[ len ] = '\0';
+	fclose( file );
+
+	for ( dim_t c = 0; c < BLIS_HWC_NUM_COUNTERS; ++c )
+		if ( strstr( buf, bli_hwc_counter_string( c ) ) != NULL ) return TRUE;
+
+	return FALSE;
+}
+
+int main( int argc, char** argv )
+{
+	stats_t stats;
+	bool    ok;
+
+	bli_init();
+
+	bli_stats_enable();
+	bli_stats_reset();
+	bli_hwc_enable();
+
+	bool any_avail = FALSE;
+	for ( dim_t c = 0; c < BLIS_HWC_NUM_COUNTERS; ++c )
+		any_avail = any_avail || bli_hwc_is_available( c );
+
+	check( bli_hwc_is_enabled() == any_avail,
+	       "enabled exactly when some counter is available" );
+
+	if ( !bli_hwc_is_enabled() )
+	{
+		printf( "(hardware counters unavailable)\n" );
+
+		run_gemm( 600, 600, 600 );
+		bli_stats_get( &stats );
+
+		ok = stats.count[ BLIS_STATS_GEMM ] == bli_info_get_enable_stats() &&
+		     hwc_are_zero( &stats );
+		check( ok, "statistics collected without counters" );
+
+		check( !dump_has_counters(), "dump omits unavailable counters" );
+	}
+	else
+	{
+		run_gemm( 600, 600, 600 );
+		bli_stats_get( &stats );
+
+		ok = TRUE;
+		if ( bli_hwc_is_available( BLIS_HWC_CYCLES ) )
+			ok = ok && stats.hwc[ BLIS_STATS_MACROKER ][ BLIS_HWC_CYCLES ] > 0 &&
+			     stats.hwc[ BLIS_STATS_PACKB ][ BLIS_HWC_CYCLES ] > 0;
+		if ( bli_hwc_is_available( BLIS_HWC_INSTRUCTIONS ) )
+			ok = ok && stats.hwc[ BLIS_STATS_MACROKER ][ BLIS_HWC_INSTRUCTIONS ] > 0;
+		check( ok, "counters attributed to pack and macrokernel" );
+
+		ok = TRUE;
+		for ( dim_t c = 0; c < BLIS_HWC_NUM_COUNTERS; ++c )
+			ok = ok && ( bli_hwc_is_available( c ) ||
+			             stats.hwc[ BLIS_STATS_GEMM ][ c ] == 0 );
+		check( ok, "unavailable counters stay zero" );
+
+		check( dump_has_counters(), "dump contains available counters" );
+
+		bli_stats_reset();
+		bli_stats_get( &stats );
+		check( hwc_are_zero( &stats ), "counters cleared by reset" );
+
+		bli_hwc_disable();
+		run_gemm( 600, 600, 600 );
+		bli_stats_get( &stats );
+		ok = stats.count[ BLIS_STATS_GEMM ] == 1 && hwc_are_zero( &stats );
+		check( ok, "statistics without counters while disabled" );
+	}
+
+	bli_finalize();
+
+	check( !bli_hwc_is_enabled(), "counters disabled by finalization" );
+
+	printf( "%d of %d tests passed\n", n_test - n_fail, n_test );
+
+	return n_fail == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
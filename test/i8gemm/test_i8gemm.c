@@ -0,0 +1,241 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "blis.h"
+
+//
+// Exercise bli_i8gemm_ex() with and without zero points and requantization.
+// The result is compared against a naive reference, which should agree
+// exactly (or, when requantizing, to within one unit of rounding). The
+// elements of A and B span their full ranges so that any saturation of
+// intermediate sums within the micro-kernel is detected, and the elements of
+// A are also restricted to 0..127, for which micro-kernels may take a faster
+// path.
+//
+// With "-p" followed by a list of problem sizes, the throughput of i8gemm
+// (with A spanning 0..255 and 0..127) and of sgemm is reported for square
+// problems (in GOPS and GFLOPS, respectively, i.e. 2n^3 / time).
+//
+
+static int test_i8gemm( bool trans_a, bool row_c, bool use_zp, bool use_q,
+                        int a_max, dim_t m, dim_t n, dim_t k )
+{
+	// Strides of op(A), which is stored transposed when trans_a is TRUE.
+	const dim_t ld_k = bli_max( k, 1 );
+	const inc_t rs_a = trans_a ? 1 : ld_k, cs_a = trans_a ? m : 1;
+	const inc_t rs_b = 1,              cs_b = ld_k;
+	const inc_t rs_c = row_c ? n : 1,  cs_c = row_c ? 1 : m;
+
+	uint8_t* a     = malloc( m * k + 1 );
+	int8_t*  b     = malloc( k * n + 1 );
+	int32_t* c     = malloc( sizeof( int32_t ) * ( m * n + 1 ) );
+	int32_t* c_ref = malloc( sizeof( int32_t ) * ( m * n + 1 ) );
+	uint8_t* q     = malloc( m * n + 1 );
+	uint8_t* q_ref = malloc( m * n + 1 );
+	int32_t* za    = malloc( sizeof( int32_t ) * ( m + 1 ) );
+	int32_t* zb    = malloc( sizeof( int32_t ) * ( n + 1 ) );
+	float*   sm    = malloc( sizeof( float ) * ( m + 1 ) );
+
+	int32_t alpha = 3, beta = -2;
+	float   sn    = 1.0f / 4096.0f;
+
+	for ( dim_t i = 0; i < m * k; ++i ) a[ i ] = rand() % ( a_max + 1 );
+	for ( dim_t i = 0; i < k * n; ++i ) b[ i ] = rand() % 256 - 128;
+	for ( dim_t i = 0; i < m * n; ++i ) c[ i ] = c_ref[ i ] = rand() % 2001 - 1000;
+	for ( dim_t i = 0; i < m; ++i ) { za[ i ] = rand() % 16; sm[ i ] = 0.5f + ( rand() % 64 ) / 64.0f; }
+	for ( dim_t j = 0; j < n; ++j ) zb[ j ] = rand() % 16 - 8;
+
+	i8gemm_qparams_t qp = { 0 };
+	if ( use_zp )
+	{
+		qp.zp_a = za; qp.inc_zp_a = 1;
+		qp.zp_b = zb; qp.inc_zp_b = 1;
+	}
+	if ( use_q )
+	{
+		qp.q_c     = q; qp.rs_q = n; qp.cs_q = 1;
+		qp.scale_m = sm; qp.inc_scale_m = 1;
+		qp.scale_n = &sn; qp.inc_scale_n = 0;
+		qp.zp_q    = 128;
+	}
+
+	// Compute the reference result.
+	for ( dim_t i = 0; i < m; ++i )
+	for ( dim_t j = 0; j < n; ++j )
+	{
+		int32_t ab = 0;
+
+		for ( dim_t l = 0; l < k; ++l )
+			ab += ( ( int32_t )a[ i*rs_a + l*cs_a ] - ( use_zp ? za[ i ] : 0 ) ) *
+			      ( ( int32_t )b[ l*rs_b + j*cs_b ] - ( use_zp ? zb[ j ] : 0 ) );
+
+		const int32_t t = alpha * ab + beta * c_ref[ i*rs_c + j*cs_c ];
+
+		if ( use_q )
+		{
+			float r = 128.0f + nearbyintf( sm[ i ] * sn * ( float )t );
+			q_ref[ i*n + j ] = ( uint8_t )( r < 0.0f ? 0.0f : r > 255.0f ? 255.0f : r );
+		}
+		else c_ref[ i*rs_c + j*cs_c ] = t;
+	}
+
+	bli_i8gemm_ex( trans_a ? BLIS_TRANSPOSE : BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE,
+	               m, n, k, &alpha, a, trans_a ? cs_a : rs_a, trans_a ? rs_a : cs_a,
+	               b, rs_b, cs_b,
+	               &beta, c, rs_c, cs_c, &qp, NULL, NULL );
+
+	// Compare. Note that when requantizing, C must not be modified.
+	int max_diff = 0;
+	for ( dim_t i = 0; i < m; ++i )
+	for ( dim_t j = 0; j < n; ++j )
+	{
+		const int d = use_q ? abs( ( int )q[ i*n + j ] - ( int )q_ref[ i*n + j ] )
+		                    : abs( c[ i*rs_c + j*cs_c ] - c_ref[ i*rs_c + j*cs_c ] );
+		if ( d > max_diff ) max_diff = d;
+		if ( use_q && c[ i*rs_c + j*cs_c ] != c_ref[ i*rs_c + j*cs_c ] ) max_diff = 256;
+	}
+
+	const int fail = max_diff > ( use_q ? 1 : 0 );
+
+	printf( "i8gemm A %s u%d C %s zp %d q %d m %4d n %4d k %4d: max diff = %3d %s\n",
+	        trans_a ? "trn" : "row", a_max > 127 ? 8 : 7, row_c ? "row" : "col", use_zp, use_q,
+	        ( int )m, ( int )n, ( int )k, max_diff, fail ? "FAILURE" : "PASS" );
+
+	free( a ); free( b ); free( c ); free( c_ref );
+	free( q ); free( q_ref ); free( za ); free( zb ); free( sm );
+
+	return fail;
+}
+
+static double time_i8gemm( int a_max, dim_t n, dim_t n_repeats )
+{
+	uint8_t* a = malloc( n * n );
+	int8_t*  b = malloc( n * n );
+	int32_t* c = malloc( sizeof( int32_t ) * n * n );
+
+	int32_t alpha = 1, beta = 0;
+
+	for ( dim_t i = 0; i < n * n; ++i ) a[ i ] = rand() % ( a_max + 1 );
+	for ( dim_t i = 0; i < n * n; ++i ) b[ i ] = rand() % 256 - 128;
+
+	double dtime_best = 1.0e9;
+
+	for ( dim_t r = 0; r < n_repeats; ++r )
+	{
+		double dtime = bli_clock();
+
+		bli_i8gemm( BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE, n, n, n,
+		            &alpha, a, n, 1, b, 1, n, &beta, c, n, 1 );
+
+		dtime_best = bli_clock_min_diff( dtime_best, dtime );
+	}
+
+	free( a ); free( b ); free( c );
+
+	return 2.0 * n * n * n / ( dtime_best * 1.0e9 );
+}
+
+static double time_sgemm( dim_t n, dim_t n_repeats )
+{
+	obj_t a, b, c;
+
+	bli_obj_create( BLIS_FLOAT, n, n, 0, 0, &a );
+	bli_obj_create( BLIS_FLOAT, n, n, 0, 0, &b );
+	bli_obj_create( BLIS_FLOAT, n, n, 0, 0, &c );
+	bli_randm( &a );
+	bli_randm( &b );
+	bli_randm( &c );
+
+	double dtime_best = 1.0e9;
+
+	for ( dim_t r = 0; r < n_repeats; ++r )
+	{
+		double dtime = bli_clock();
+
+		bli_gemm( &BLIS_ONE, &a, &b, &BLIS_ZERO, &c );
+
+		dtime_best = bli_clock_min_diff( dtime_best, dtime );
+	}
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+
+	return 2.0 * n * n * n / ( dtime_best * 1.0e9 );
+}
+
+int main( int argc, char** argv )
+{
+	if ( argc > 1 && strcmp( argv[ 1 ], "-p" ) == 0 )
+	{
+		bli_init();
+
+		printf( "%6s %10s %10s %10s\n", "n", "i8gemm u8", "i8gemm u7", "sgemm" );
+
+		for ( int i = 2; i < argc; ++i )
+		{
+			dim_t n = atoi( argv[ i ] );
+
+			printf( "%6d %10.2f %10.2f %10.2f\n", ( int )n,
+			        time_i8gemm( 255, n, 3 ),
+			        time_i8gemm( 127, n, 3 ),
+			        time_sgemm( n, 3 ) );
+		}
+
+		bli_finalize();
+		return 0;
+	}
+
+	const dim_t sizes[][3] = { { 1, 1, 1 }, { 7, 5, 0 }, { 37, 29, 41 },
+	                           { 200, 151, 300 }, { 301, 257, 1501 } };
+	int         fails = 0;
+
+	for ( int s = 0; s < 5; ++s )
+	for ( int ta = 0; ta < 2; ++ta )
+	for ( int rc = 0; rc < 2; ++rc )
+	for ( int zp = 0; zp < 2; ++zp )
+	for ( int uq = 0; uq < 2; ++uq )
+	for ( int u7 = 0; u7 < 2; ++u7 )
+	{
+		fails += test_i8gemm( ta, rc, zp, uq, u7 ? 127 : 255,
+		                      sizes[s][0], sizes[s][1], sizes[s][2] );
+	}
+
+	return fails ? 1 : 0;
+}
@@ -0,0 +1,379 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "blis.h"
+
+//
+// Accuracy and throughput of the LU addon (bao_lu_ex()).
+//
+// With no arguments, each datatype and storage of A is checked on square
+// and rectangular shapes that are and are not multiples of the algorithmic
+// blocksize, with one and with several threads (the latter exercises the
+// lookahead and the dynamic scheduling even on a single core). The residual
+// P^T A - L U is reported relative to n |A| u, as in the LAPACK test suite.
+// Matrices with a zero column are checked to report the index of the first
+// zero pivot.
+//
+// With "-p" followed by a list of problem sizes, the throughput of dgetrf
+// (square, column-major) as computed by bao_lu() is compared with that of
+// the blocked algorithm of LAPACK's dgetrf, i.e. a recursive factorization
+// of each panel as in dgetrf2 followed by row interchanges (dlaswp) and
+// calls to (multithreaded) dtrsm and dgemm on the same BLIS. If compiled
+// with -DUSE_LAPACK (and linked with a LAPACK library), dgetrf_() itself is
+// used instead. The number of threads is taken from the environment (e.g.
+// BLIS_NUM_THREADS).
+//
+
+static char dt_char( num_t dt )
+{
+	return bli_dt_prec_is_single( dt ) ? ( bli_dt_dom_is_real( dt ) ? 's' : 'c' )
+	                                   : ( bli_dt_dom_is_real( dt ) ? 'd' : 'z' );
+}
+
+static void create_rand( num_t dt, dim_t m, dim_t n, bool row_a, obj_t* a )
+{
+	if ( row_a ) bli_obj_create( dt, m, n, n, 1, a );
+	else         bli_obj_create( dt, m, n, 1, m, a );
+
+	bli_randm( a );
+}
+
+// Apply the row interchanges in ipiv (in order) to A.
+static void apply_ipiv( dim_t k, const dim_t* ipiv, obj_t* a )
+{
+	const dim_t n = bli_obj_width( a );
+
+	for ( dim_t i = 0; i < k; ++i )
+	{
+		if ( ipiv[ i ] == i ) continue;
+
+		obj_t ri, rp;
+		bli_acquire_mpart( i,         0, 1, n, a, &ri );
+		bli_acquire_mpart( ipiv[ i ], 0, 1, n, a, &rp );
+		bli_swapv( &ri, &rp );
+	}
+}
+
+static int test_lu( num_t dt, bool row_a, dim_t m, dim_t n, dim_t nt )
+{
+	obj_t a, a0, l, u, lv, uv, norm;
+
+	const dim_t k = bli_min( m, n );
+
+	create_rand( dt, m, n, row_a, &a );
+	bli_obj_create( dt, m, n, 0, 0, &a0 );
+	bli_copym( &a, &a0 );
+	bli_obj_scalar_init_detached( bli_dt_proj_to_real( dt ), &norm );
+
+	dim_t* ipiv = malloc( k * sizeof( dim_t ) );
+
+	rntm_t rntm = BLIS_RNTM_INITIALIZER;
+	bli_rntm_set_num_threads( nt, &rntm );
+
+	const dim_t info = bao_lu_ex( &a, ipiv, NULL, &rntm );
+
+	// Every pivot index must refer to a row at or below the diagonal.
+	int bad_ipiv = 0;
+	for ( dim_t i = 0; i < k; ++i )
+		if ( ipiv[ i ] < i || m <= ipiv[ i ] ) bad_ipiv = 1;
+
+	// Extract the unit lower trapezoidal L and the upper trapezoidal U and
+	// subtract L U from the original matrix with its rows interchanged.
+	bli_obj_create( dt, m, k, 0, 0, &l );
+	bli_obj_create( dt, k, n, 0, 0, &u );
+	bli_acquire_mpart( 0, 0, m, k, &a, &lv );
+	bli_acquire_mpart( 0, 0, k, n, &a, &uv );
+	bli_obj_set_struc( BLIS_TRIANGULAR, &lv );
+	bli_obj_set_struc( BLIS_TRIANGULAR, &uv );
+	bli_obj_set_uplo( BLIS_LOWER, &lv );
+	bli_obj_set_uplo( BLIS_UPPER, &uv );
+	bli_setm( &BLIS_ZERO, &l );
+	bli_setm( &BLIS_ZERO, &u );
+	bli_copym( &lv, &l );
+	bli_copym( &uv, &u );
+	bli_setd( &BLIS_ONE, &l );
+
+	double na, nd, ni;
+	double eps = bli_dt_prec_is_single( dt ) ? 5.96e-8 : 1.11e-16;
+
+	bli_normfm( &a0, &norm ); bli_getsc( &norm, &na, &ni );
+	if ( !bad_ipiv ) apply_ipiv( k, ipiv, &a0 );
+	bli_gemm( &BLIS_MINUS_ONE, &l, &u, &BLIS_ONE, &a0 );
+	bli_normfm( &a0, &norm ); bli_getsc( &norm, &nd, &ni );
+
+	const double resid = nd / ( bli_max( m, n ) * na * eps );
+	const int    fail  = ( info != 0 || bad_ipiv || !( resid < 30.0 ) );
+
+	printf( "%clu A %s nt %d m %4d n %4d: info = %d resid = %8.2e %s\n",
+	        dt_char( dt ), row_a ? "row" : "col", ( int )nt, ( int )m,
+	        ( int )n, ( int )info, resid, fail ? "FAIL" : "PASS" );
+
+	free( ipiv );
+	bli_obj_free( &a );
+	bli_obj_free( &a0 );
+	bli_obj_free( &l );
+	bli_obj_free( &u );
+
+	return fail;
+}
+
+// Check that the factorization of a matrix whose column k is zero (and
+// whose leading k columns are linearly independent) reports k+1.
+static int test_lu_sing( num_t dt, dim_t m, dim_t k, dim_t nt )
+{
+	obj_t a, ak;
+
+	create_rand( dt, m, m, FALSE, &a );
+
+	bli_acquire_mpart( 0, k, m, 1, &a, &ak );
+	bli_setm( &BLIS_ZERO, &ak );
+
+	dim_t* ipiv = malloc( m * sizeof( dim_t ) );
+
+	rntm_t rntm = BLIS_RNTM_INITIALIZER;
+	bli_rntm_set_num_threads( nt, &rntm );
+
+	const dim_t info = bao_lu_ex( &a, ipiv, NULL, &rntm );
+	const int   fail = ( info != k + 1 );
+
+	printf( "%clu singular at %4d nt %d m %4d: info = %d %s\n",
+	        dt_char( dt ), ( int )k, ( int )nt, ( int )m, ( int )info,
+	        fail ? "FAIL" : "PASS" );
+
+	free( ipiv );
+	bli_obj_free( &a );
+
+	return fail;
+}
+
+#ifdef USE_LAPACK
+void dgetrf_( const int* m, const int* n, double* a, const int* lda, int* ipiv, int* info );
+#else
+// Interchange rows i and ipiv[i] of the n columns of a, for i in [i0,i1).
+static void ref_dlaswp( dim_t n, double* a, inc_t lda, dim_t i0, dim_t i1, const dim_t* ipiv )
+{
+	for ( dim_t i = i0; i < i1; ++i )
+	{
+		const dim_t p = ipiv[ i ];
+		if ( p != i )
+			bli_dswapv( n, a + i, lda, a + p, lda );
+	}
+}
+
+// LAPACK's recursive dgetrf2, with the pivot indices relative to a.
+static dim_t ref_dgetrf2( dim_t m, dim_t n, double* a, inc_t lda, dim_t* ipiv )
+{
+	if ( n == 1 )
+	{
+		dim_t p = 0;
+		for ( dim_t i = 1; i < m; ++i )
+			if ( fabs( a[ p ] ) < fabs( a[ i ] ) ) p = i;
+
+		ipiv[ 0 ] = p;
+		if ( a[ p ] == 0.0 ) return 1;
+
+		double t = a[ 0 ]; a[ 0 ] = a[ p ]; a[ p ] = t;
+		for ( dim_t i = 1; i < m; ++i ) a[ i ] /= a[ 0 ];
+		return 0;
+	}
+
+	const dim_t n1 = bli_min( m, n ) / 2;
+	const dim_t n2 = n - n1;
+	const dim_t k2 = bli_min( m - n1, n2 );
+
+	dim_t info = ref_dgetrf2( m, n1, a, lda, ipiv );
+
+	ref_dlaswp( n2, a + n1 * lda, lda, 0, n1, ipiv );
+	bli_dtrsm( BLIS_LEFT, BLIS_LOWER, BLIS_NO_TRANSPOSE, BLIS_UNIT_DIAG,
+	           n1, n2, bli_d1, a, 1, lda, a + n1 * lda, 1, lda );
+	bli_dgemm( BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE, m - n1, n2, n1,
+	           bli_dm1, a + n1, 1, lda, a + n1 * lda, 1, lda,
+	           bli_d1, a + n1 + n1 * lda, 1, lda );
+
+	const dim_t info2 = ref_dgetrf2( m - n1, n2, a + n1 + n1 * lda, lda, ipiv + n1 );
+
+	for ( dim_t i = n1; i < n1 + k2; ++i ) ipiv[ i ] += n1;
+	ref_dlaswp( n1, a, lda, n1, n1 + k2, ipiv );
+
+	if ( info == 0 && info2 != 0 ) info = n1 + info2;
+
+	return info;
+}
+#endif
+
+// LAPACK's blocked dgetrf (square), with ILAENV's default blocksize.
+static dim_t ref_dgetrf( dim_t n, double* a, inc_t lda, dim_t* ipiv )
+{
+#ifdef USE_LAPACK
+	int n_i = n, lda_i = lda, info;
+	int* ipiv_i = malloc( n * sizeof( int ) );
+	dgetrf_( &n_i, &n_i, a, &lda_i, ipiv_i, &info );
+	for ( dim_t i = 0; i < n; ++i ) ipiv[ i ] = ipiv_i[ i ] - 1;
+	free( ipiv_i );
+	return info;
+#else
+	const dim_t nb   = 64;
+	      dim_t info = 0;
+
+	for ( dim_t j = 0; j < n; j += nb )
+	{
+		const dim_t jb  = bli_min( nb, n - j );
+		double*     ajj = a + j + j * lda;
+
+		const dim_t info_j = ref_dgetrf2( n - j, jb, ajj, lda, ipiv + j );
+
+		for ( dim_t i = j; i < j + jb; ++i ) ipiv[ i ] += j;
+		if ( info == 0 && info_j != 0 ) info = j + info_j;
+
+		ref_dlaswp( j, a, lda, j, j + jb, ipiv );
+
+		if ( j + jb < n )
+		{
+			ref_dlaswp( n - j - jb, a + ( j + jb ) * lda, lda, j, j + jb, ipiv );
+			bli_dtrsm( BLIS_LEFT, BLIS_LOWER, BLIS_NO_TRANSPOSE, BLIS_UNIT_DIAG,
+			           jb, n - j - jb, bli_d1, ajj, 1, lda, ajj + jb * lda, 1, lda );
+			bli_dgemm( BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE, n - j - jb, n - j - jb, jb,
+			           bli_dm1, ajj + jb, 1, lda, ajj + jb * lda, 1, lda,
+			           bli_d1, ajj + jb + jb * lda, 1, lda );
+		}
+	}
+
+	return info;
+#endif
+}
+
+static void time_lu( dim_t n, dim_t n_repeats, double* gflops_ref, double* gflops_bao )
+{
+	obj_t a, a0;
+
+	create_rand( BLIS_DOUBLE, n, n, FALSE, &a0 );
+	bli_obj_create( BLIS_DOUBLE, n, n, 1, n, &a );
+
+	dim_t* ipiv = malloc( n * sizeof( dim_t ) );
+
+	double dtime_ref = 1.0e9;
+	double dtime_bao = 1.0e9;
+
+	for ( dim_t r = 0; r < n_repeats; ++r )
+	{
+		bli_copym( &a0, &a );
+
+		double dtime = bli_clock();
+		ref_dgetrf( n, bli_obj_buffer( &a ), n, ipiv );
+		dtime_ref = bli_clock_min_diff( dtime_ref, dtime );
+
+		bli_copym( &a0, &a );
+
+		dtime = bli_clock();
+		bao_lu( &a, ipiv );
+		dtime_bao = bli_clock_min_diff( dtime_bao, dtime );
+	}
+
+	const double flops = 2.0 * n * n * n / 3.0;
+
+	*gflops_ref = flops / ( dtime_ref * 1.0e9 );
+	*gflops_bao = flops / ( dtime_bao * 1.0e9 );
+
+	free( ipiv );
+	bli_obj_free( &a );
+	bli_obj_free( &a0 );
+}
+
+int main( int argc, char** argv )
+{
+	bli_init();
+
+	if ( argc > 1 && strcmp( argv[ 1 ], "-p" ) == 0 )
+	{
+#ifdef USE_LAPACK
+		printf( "%6s %10s %10s\n", "n", "dgetrf", "bao_lu" );
+#else
+		printf( "%6s %10s %10s\n", "n", "ref", "bao_lu" );
+#endif
+
+		for ( int i = 2; i < argc; ++i )
+		{
+			dim_t  n = atoi( argv[ i ] );
+			double gf_ref, gf_bao;
+
+			time_lu( n, 3, &gf_ref, &gf_bao );
+
+			printf( "%6d %10.2f %10.2f\n", ( int )n, gf_ref, gf_bao );
+		}
+
+		bli_finalize();
+		return 0;
+	}
+
+	const num_t dts[]      = { BLIS_FLOAT, BLIS_DOUBLE, BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+	const dim_t shapes[][2] = { {   1,   1 }, {  13,  13 }, {  13,   7 }, {   7,  13 },
+	                            {  64,  64 }, { 250, 250 }, { 511, 300 }, { 300, 511 },
+	                            {  13, 700 }, { 700, 700 } };
+	const dim_t nts[]      = { 1, 3 };
+
+	int n_fail = 0, n_test = 0;
+
+	for ( int idt = 0; idt < 4; ++idt )
+	for ( int is = 0; is < 10; ++is )
+	for ( int ra = 0; ra < 2; ++ra )
+	for ( int it = 0; it < 2; ++it )
+	{
+		n_fail += test_lu( dts[ idt ], ra, shapes[ is ][ 0 ], shapes[ is ][ 1 ], nts[ it ] );
+		++n_test;
+	}
+
+	const dim_t sing_ks[] = { 0, 5, 300, 599 };
+
+	for ( int idt = 0; idt < 4; ++idt )
+	for ( int ik = 0; ik < 4; ++ik )
+	for ( int it = 0; it < 2; ++it )
+	{
+		n_fail += test_lu_sing( dts[ idt ], 600, sing_ks[ ik ], nts[ it ] );
+		++n_test;
+	}
+
+	printf( "%d of %d tests passed\n", n_test - n_fail, n_test );
+
+	bli_finalize();
+
+	return n_fail ? 1 : 0;
+}
+
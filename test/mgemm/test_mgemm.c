@@ -0,0 +1,240 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "blis.h"
+
+//
+// Accuracy and throughput of the shared-A multiple gemm addon (bao_mgemm()).
+//
+// With no arguments, each datatype is checked against separate calls to
+// bli_gemm() for several shapes of A (including ones with more than MC rows
+// and KC columns) and several sets of widths of the B_i (including empty
+// ones and ones wider than NC), with and without transposition of A and of
+// the B_i, with different alpha_i and beta_i (including zero), and with one
+// and with several threads.
+//
+// With "-p" followed by a list of problem sizes k, the throughput of
+// double-precision bao_mgemm() with a 256 x k matrix A (row-stored) and
+// eight 512 x 64 matrices B_i is compared with that of eight calls to
+// bli_gemm(). The number of threads is taken from the environment (e.g.
+// BLIS_NUM_THREADS).
+//
+
+static char dt_char( num_t dt )
+{
+	return bli_dt_prec_is_single( dt ) ? ( bli_dt_dom_is_real( dt ) ? 's' : 'c' )
+	                                   : ( bli_dt_dom_is_real( dt ) ? 'd' : 'z' );
+}
+
+static void create_mat( num_t dt, dim_t m, dim_t n, bool trans, obj_t* a )
+{
+	// A transposed operand is stored as its transpose.
+	if ( trans ) bli_obj_create( dt, n, m, 0, 0, a );
+	else         bli_obj_create( dt, m, n, 0, 0, a );
+
+	bli_randm( a );
+
+	if ( trans ) bli_obj_set_onlytrans( BLIS_TRANSPOSE, a );
+}
+
+static int test_mgemm( num_t dt, dim_t m, dim_t k, dim_t nb, const dim_t* n,
+                       bool trans_a, bool trans_b, dim_t nt )
+{
+	obj_t  a, norm;
+	obj_t* alpha = malloc( nb * sizeof( obj_t ) );
+	obj_t* beta  = malloc( nb * sizeof( obj_t ) );
+	obj_t* b     = malloc( nb * sizeof( obj_t ) );
+	obj_t* c     = malloc( nb * sizeof( obj_t ) );
+	obj_t* c0    = malloc( nb * sizeof( obj_t ) );
+
+	create_mat( dt, m, k, trans_a, &a );
+	bli_obj_scalar_init_detached( bli_dt_proj_to_real( dt ), &norm );
+
+	for ( dim_t i = 0; i < nb; ++i )
+	{
+		create_mat( dt, k, n[ i ], trans_b, &b[ i ] );
+		create_mat( dt, m, n[ i ], FALSE, &c[ i ] );
+		bli_obj_create( dt, m, n[ i ], 0, 0, &c0[ i ] );
+		bli_copym( &c[ i ], &c0[ i ] );
+
+		bli_obj_scalar_init_detached( dt, &alpha[ i ] );
+		bli_obj_scalar_init_detached( dt, &beta[ i ] );
+		bli_setsc( 1.0 + 0.25 * i, -0.5, &alpha[ i ] );
+		bli_setsc( i % 3 == 1 ? 0.0 : 0.5, i % 3 == 1 ? 0.0 : 0.25, &beta[ i ] );
+	}
+
+	rntm_t rntm = BLIS_RNTM_INITIALIZER;
+	bli_rntm_set_num_threads( nt, &rntm );
+
+	bao_mgemm_ex( nb, alpha, &a, b, beta, c, NULL, &rntm );
+
+	double resid = 0.0;
+
+	for ( dim_t i = 0; i < nb; ++i )
+	{
+		double nr, nd, ni;
+
+		bli_gemm( &alpha[ i ], &a, &b[ i ], &beta[ i ], &c0[ i ] );
+		bli_normfm( &c0[ i ], &norm ); bli_getsc( &norm, &nr, &ni );
+		bli_subm( &c[ i ], &c0[ i ] );
+		bli_normfm( &c0[ i ], &norm ); bli_getsc( &norm, &nd, &ni );
+
+		double eps = bli_dt_prec_is_single( dt ) ? 5.96e-8 : 1.11e-16;
+		resid = bli_max( resid, nd / ( ( nr > 0.0 ? nr : 1.0 ) * ( k + 1 ) * eps ) );
+
+		bli_obj_free( &b[ i ] );
+		bli_obj_free( &c[ i ] );
+		bli_obj_free( &c0[ i ] );
+	}
+
+	int fail = !( resid < 10.0 );
+
+	printf( "%cmgemm A %s B %s nt %d m %4d k %4d nb %d n0 %4d: resid = %8.2e %s\n",
+	        dt_char( dt ), trans_a ? "t" : "n", trans_b ? "t" : "n", ( int )nt,
+	        ( int )m, ( int )k, ( int )nb, ( int )n[ 0 ], resid, fail ? "FAIL" : "PASS" );
+
+	bli_obj_free( &a );
+	free( alpha ); free( beta ); free( b ); free( c ); free( c0 );
+
+	return fail;
+}
+
+static void time_mgemm( dim_t k, double* gflops_ref, double* gflops_bao )
+{
+	const dim_t m  = 256;
+	const dim_t nb = 8;
+	const dim_t n  = 64;
+
+	obj_t a, b[ nb ], c[ nb ], alpha[ nb ], beta[ nb ];
+
+	bli_obj_create( BLIS_DOUBLE, m, k, k, 1, &a );
+	bli_randm( &a );
+
+	for ( dim_t i = 0; i < nb; ++i )
+	{
+		bli_obj_create( BLIS_DOUBLE, k, n, n, 1, &b[ i ] );
+		bli_obj_create( BLIS_DOUBLE, m, n, n, 1, &c[ i ] );
+		bli_randm( &b[ i ] );
+		bli_randm( &c[ i ] );
+		bli_obj_scalar_init_detached_copy_of( BLIS_DOUBLE, BLIS_NO_CONJUGATE, &BLIS_ONE, &alpha[ i ] );
+		bli_obj_scalar_init_detached_copy_of( BLIS_DOUBLE, BLIS_NO_CONJUGATE, &BLIS_ONE, &beta[ i ] );
+	}
+
+	double dtime_ref = 1.0e9;
+	double dtime_bao = 1.0e9;
+
+	for ( int r = 0; r < 3; ++r )
+	{
+		double dtime = bli_clock();
+		for ( dim_t i = 0; i < nb; ++i )
+			bli_gemm( &BLIS_ONE, &a, &b[ i ], &BLIS_ONE, &c[ i ] );
+		dtime_ref = bli_clock_min_diff( dtime_ref, dtime );
+
+		dtime = bli_clock();
+		bao_mgemm( nb, alpha, &a, b, beta, c );
+		dtime_bao = bli_clock_min_diff( dtime_bao, dtime );
+	}
+
+	const double flops = 2.0 * m * k * n * nb;
+
+	*gflops_ref = flops / ( dtime_ref * 1.0e9 );
+	*gflops_bao = flops / ( dtime_bao * 1.0e9 );
+
+	bli_obj_free( &a );
+	for ( dim_t i = 0; i < nb; ++i )
+	{
+		bli_obj_free( &b[ i ] );
+		bli_obj_free( &c[ i ] );
+	}
+}
+
+int main( int argc, char** argv )
+{
+	bli_init();
+
+	if ( argc > 1 && strcmp( argv[ 1 ], "-p" ) == 0 )
+	{
+		printf( "%8s %10s %10s\n", "k", "gemm", "mgemm" );
+
+		for ( int i = 2; i < argc; ++i )
+		{
+			dim_t  k = atoi( argv[ i ] );
+			double gf_ref, gf_bao;
+
+			time_mgemm( k, &gf_ref, &gf_bao );
+
+			printf( "%8d %10.2f %10.2f\n", ( int )k, gf_ref, gf_bao );
+		}
+
+		bli_finalize();
+		return 0;
+	}
+
+	const num_t dts[]       = { BLIS_FLOAT, BLIS_DOUBLE, BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+	const dim_t shapes[][2] = { {   1,   1 }, {  17,  33 }, { 100, 300 },
+	                            { 300, 700 }, {  40,   0 } };
+	const dim_t widths[][5] = { {   1,   1,   1,   1,   1 }, {  64,   3,   0,  17, 100 },
+	                            { 4500,  9,   0,   0,   0 }, {  24,  24,  24,  24,  24 } };
+	const dim_t nbs[]       = { 5, 5, 2, 5 };
+	const dim_t nts[]       = { 1, 3 };
+
+	int n_fail = 0, n_test = 0;
+
+	for ( int idt = 0; idt < 4; ++idt )
+	for ( int is = 0; is < 5; ++is )
+	for ( int iw = 0; iw < 4; ++iw )
+	for ( int it = 0; it < 2; ++it )
+	{
+		// Only test the widest B_i with the smaller shapes of A.
+		if ( iw == 2 && shapes[ is ][ 0 ] * shapes[ is ][ 1 ] > 10000 ) continue;
+
+		n_fail += test_mgemm( dts[ idt ], shapes[ is ][ 0 ], shapes[ is ][ 1 ],
+		                      nbs[ iw ], widths[ iw ], ( is + iw ) & 1,
+		                      ( ( is + iw ) >> 1 ) & 1, nts[ it ] );
+		++n_test;
+	}
+
+	printf( "%d of %d tests passed\n", n_test - n_fail, n_test );
+
+	bli_finalize();
+
+	return n_fail ? 1 : 0;
+}
+
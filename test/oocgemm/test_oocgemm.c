@@ -0,0 +1,307 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#undef  _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "blis.h"
+
+//
+// Accuracy and throughput of the out-of-core gemm addon (bao_oocgemm_ex()).
+//
+// With no arguments, each datatype is checked against bli_gemm() for
+// several shapes, with each of A, B, and C stored (at a nonzero offset) in
+// a temporary file and accessed either through its descriptor or through a
+// mapping of the file, with row- and column-storage, and with beta zero and
+// nonzero. The cache blocksizes are small, so that A and B are fetched in
+// many blocks and panels, and so is the budget, so that C is divided into
+// several tiles. With "-t", each check is repeated with three threads.
+//
+// With "-p" followed by a list of problem sizes n, the time taken by double-
+// precision bao_oocgemm_ex() for n x n matrices in files accessed through
+// their descriptors, with a budget of a quarter of the size of C, is
+// reported with and without the prefetching of the next blocks of A and
+// panels of B. The number of threads is taken from the environment (e.g.
+// BLIS_NUM_THREADS).
+//
+
+static char dt_char( num_t dt )
+{
+	return bli_dt_prec_is_single( dt ) ? ( bli_dt_dom_is_real( dt ) ? 's' : 'c' )
+	                                   : ( bli_dt_dom_is_real( dt ) ? 'd' : 'z' );
+}
+
+// The offset of each matrix in its file.
+#define OFFSET 4104
+
+// A matrix in memory and its copy in a temporary file.
+typedef struct
+{
+	obj_t    x;
+	int      fd;
+	void*    map;
+	size_t   size;
+	oocmat_t ooc;
+} fmat_t;
+
+static void create_fmat( num_t dt, dim_t m, dim_t n, bool row, bool fd, fmat_t* f )
+{
+	char name[] = "/tmp/test_oocgemm_XXXXXX";
+
+	const size_t es = bli_dt_size( dt );
+	const inc_t  rs = ( row ? n : 1 );
+	const inc_t  cs = ( row ? 1 : m );
+
+	bli_obj_create( dt, m, n, rs, cs, &f->x );
+	bli_randm( &f->x );
+
+	f->fd   = mkstemp( name );
+	f->size = OFFSET + m * n * es;
+	unlink( name );
+
+	if ( m * n > 0 &&
+	     pwrite( f->fd, bli_obj_buffer( &f->x ), m * n * es, OFFSET ) != ( ssize_t )( m * n * es ) )
+	{
+		printf( "write failed\n" );
+		exit( 1 );
+	}
+
+	if ( ftruncate( f->fd, f->size ) != 0 ) exit( 1 );
+
+	f->map = NULL;
+
+	if ( fd )
+	{
+		bao_oocmat_init_fd( dt, m, n, f->fd, OFFSET, rs, cs, &f->ooc );
+	}
+	else
+	{
+		f->map = mmap( NULL, f->size, PROT_READ | PROT_WRITE, MAP_SHARED, f->fd, 0 );
+		bao_oocmat_init_map( dt, m, n, ( char* )f->map + OFFSET, rs, cs, &f->ooc );
+	}
+}
+
+// Copy the contents of the file back into memory.
+static void sync_fmat( fmat_t* f )
+{
+	const size_t len = bli_obj_length( &f->x ) * bli_obj_width( &f->x ) *
+	                   bli_obj_elem_size( &f->x );
+
+	if ( len > 0 && pread( f->fd, bli_obj_buffer( &f->x ), len, OFFSET ) != ( ssize_t )len )
+	{
+		printf( "read failed\n" );
+		exit( 1 );
+	}
+}
+
+static void free_fmat( fmat_t* f )
+{
+	if ( f->map != NULL ) munmap( f->map, f->size );
+	close( f->fd );
+	bli_obj_free( &f->x );
+}
+
+// A context with small cache blocksizes (of a few micro-tiles), so that
+// small problems span many blocks.
+static cntx_t cntx_small;
+
+static void init_cntx_small( void )
+{
+	cntx_small = *bli_gks_query_cntx();
+
+	for ( num_t dt = BLIS_FLOAT; dt <= BLIS_DCOMPLEX; ++dt )
+	{
+		const dim_t MR = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, &cntx_small );
+		const dim_t NR = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, &cntx_small );
+
+		bli_cntx_set_blksz_def_dt( dt, BLIS_MC, 3 * MR, &cntx_small );
+		bli_cntx_set_blksz_max_dt( dt, BLIS_MC, 4 * MR, &cntx_small );
+		bli_cntx_set_blksz_def_dt( dt, BLIS_NC, 3 * NR, &cntx_small );
+		bli_cntx_set_blksz_max_dt( dt, BLIS_NC, 4 * NR, &cntx_small );
+		bli_cntx_set_blksz_def_dt( dt, BLIS_KC, 24,     &cntx_small );
+		bli_cntx_set_blksz_max_dt( dt, BLIS_KC, 32,     &cntx_small );
+	}
+}
+
+static int test_oocgemm( num_t dt, dim_t m, dim_t n, dim_t k, int kinds, int rows,
+                         bool beta0, dim_t nt )
+{
+	fmat_t a, b, c;
+	obj_t  c0, alpha, beta, norm;
+
+	create_fmat( dt, m, k, rows & 1, kinds & 1, &a );
+	create_fmat( dt, k, n, rows & 2, kinds & 2, &b );
+	create_fmat( dt, m, n, rows & 4, kinds & 4, &c );
+
+	bli_obj_create( dt, m, n, 0, 0, &c0 );
+	bli_copym( &c.x, &c0 );
+
+	bli_obj_scalar_init_detached( dt, &alpha );
+	bli_obj_scalar_init_detached( dt, &beta );
+	bli_obj_scalar_init_detached( bli_dt_proj_to_real( dt ), &norm );
+	bli_setsc( 1.5, -0.5, &alpha );
+	bli_setsc( beta0 ? 0.0 : 0.75, beta0 ? 0.0 : 0.25, &beta );
+
+	rntm_t rntm = BLIS_RNTM_INITIALIZER;
+	bli_rntm_set_num_threads( nt, &rntm );
+
+	// A budget of 48 x 48 elements for the tiles of C.
+	const siz_t mem_max = 48 * 48 * bli_dt_size( dt );
+
+	err_t e = bao_oocgemm_ex( &alpha, &a.ooc, &b.ooc, &beta, &c.ooc, mem_max,
+	                          &cntx_small, &rntm );
+
+	sync_fmat( &c );
+
+	double nr, nd, ni;
+
+	bli_gemm( &alpha, &a.x, &b.x, &beta, &c0 );
+	bli_normfm( &c0, &norm ); bli_getsc( &norm, &nr, &ni );
+	bli_subm( &c.x, &c0 );
+	bli_normfm( &c0, &norm ); bli_getsc( &norm, &nd, &ni );
+
+	double eps   = bli_dt_prec_is_single( dt ) ? 5.96e-8 : 1.11e-16;
+	double resid = nd / ( ( nr > 0.0 ? nr : 1.0 ) * ( k + 1 ) * eps );
+	int    fail  = !( resid < 10.0 ) || e != BLIS_SUCCESS;
+
+	printf( "%coocgemm A %s %s B %s %s C %s %s beta %s nt %d m %4d n %4d k %4d: "
+	        "resid = %8.2e %s\n",
+	        dt_char( dt ),
+	        kinds & 1 ? "fd " : "map", rows & 1 ? "row" : "col",
+	        kinds & 2 ? "fd " : "map", rows & 2 ? "row" : "col",
+	        kinds & 4 ? "fd " : "map", rows & 4 ? "row" : "col",
+	        beta0 ? "0" : "x", ( int )nt, ( int )m, ( int )n, ( int )k,
+	        resid, fail ? "FAIL" : "PASS" );
+
+	free_fmat( &a );
+	free_fmat( &b );
+	free_fmat( &c );
+	bli_obj_free( &c0 );
+
+	return fail;
+}
+
+static void time_oocgemm( dim_t n, double* dtime_sync, double* dtime_bao )
+{
+	fmat_t a, b, c;
+
+	create_fmat( BLIS_DOUBLE, n, n, FALSE, TRUE, &a );
+	create_fmat( BLIS_DOUBLE, n, n, FALSE, TRUE, &b );
+	create_fmat( BLIS_DOUBLE, n, n, FALSE, TRUE, &c );
+
+	const siz_t mem_max = n * n * sizeof( double ) / 4;
+
+	*dtime_sync = 1.0e9;
+	*dtime_bao  = 1.0e9;
+
+	for ( int r = 0; r < 3; ++r )
+	{
+		setenv( "BAO_OOCGEMM_PREFETCH", "0", 1 );
+
+		double dtime = bli_clock();
+		bao_oocgemm_ex( &BLIS_ONE, &a.ooc, &b.ooc, &BLIS_ZERO, &c.ooc, mem_max, NULL, NULL );
+		*dtime_sync = bli_clock_min_diff( *dtime_sync, dtime );
+
+		unsetenv( "BAO_OOCGEMM_PREFETCH" );
+
+		dtime = bli_clock();
+		bao_oocgemm_ex( &BLIS_ONE, &a.ooc, &b.ooc, &BLIS_ZERO, &c.ooc, mem_max, NULL, NULL );
+		*dtime_bao = bli_clock_min_diff( *dtime_bao, dtime );
+	}
+
+	free_fmat( &a );
+	free_fmat( &b );
+	free_fmat( &c );
+}
+
+int main( int argc, char** argv )
+{
+	bli_init();
+
+	if ( argc > 1 && strcmp( argv[ 1 ], "-p" ) == 0 )
+	{
+		printf( "%8s %12s %12s\n", "n", "no pref (s)", "prefetch (s)" );
+
+		for ( int i = 2; i < argc; ++i )
+		{
+			dim_t  n = atoi( argv[ i ] );
+			double t_sync, t_bao;
+
+			time_oocgemm( n, &t_sync, &t_bao );
+
+			printf( "%8d %12.3f %12.3f\n", ( int )n, t_sync, t_bao );
+		}
+
+		bli_finalize();
+		return 0;
+	}
+
+	const num_t dts[]       = { BLIS_FLOAT, BLIS_DOUBLE, BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+	const dim_t shapes[][3] = { {   1,   1,   1 }, { 100,  70,  90 },
+	                            {  37, 200, 130 }, {  50,  10,   0 } };
+	const int   kinds[]     = { 0, 7, 5, 2 };
+	const dim_t nts[]       = { 1, 3 };
+	const int   n_nt        = ( argc > 1 && strcmp( argv[ 1 ], "-t" ) == 0 ? 2 : 1 );
+
+	int n_fail = 0, n_test = 0;
+
+	init_cntx_small();
+
+	for ( int idt = 0; idt < 4; ++idt )
+	for ( int is = 0; is < 4; ++is )
+	for ( int ik = 0; ik < 4; ++ik )
+	for ( int it = 0; it < n_nt; ++it )
+	{
+		const dim_t* s = shapes[ is ];
+
+		n_fail += test_oocgemm( dts[ idt ], s[ 0 ], s[ 1 ], s[ 2 ], kinds[ ik ],
+		                        ( is * 3 + ik * 5 ) % 8, ( is + ik ) % 3 == 0, nts[ it ] );
+		++n_test;
+	}
+
+	printf( "%d of %d tests passed\n", n_test - n_fail, n_test );
+
+	bli_finalize();
+
+	return n_fail ? 1 : 0;
+}
+
@@ -0,0 +1,150 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "blis.h"
+
+//
+// Exercise gemm with a weight-only quantized (int8 or uint4) B operand. The
+// result is compared against sgemm applied to a float copy of B that was
+// dequantized up front, which should agree to within single precision
+// rounding error.
+//
+
+static int test_gemm_quant( quant_t qtype, bool row_b, bool row_c, bool use_zero,
+                            dim_t gs, dim_t m, dim_t n, dim_t k )
+{
+	obj_t a, b, bf, c, c_ref, norm;
+	obj_t alpha, beta;
+	float diff, ref;
+
+	// Strides of B are in units of (possibly 4-bit) elements.
+	const inc_t rs_b = row_b ? n : 1, cs_b = row_b ? 1 : k;
+	const dim_t n_grp = ( k + gs - 1 ) / gs;
+
+	uint8_t* q     = malloc( k * n );
+	float*   scale = malloc( sizeof( float ) * n_grp * n );
+	float*   zero  = malloc( sizeof( float ) * n_grp * n );
+
+	for ( dim_t i = 0; i < k * n; ++i ) q[ i ] = rand() % 256;
+	for ( dim_t i = 0; i < n_grp * n; ++i )
+	{
+		scale[ i ] = ( 1 + rand() % 32 ) / 256.0f;
+		zero[ i ]  = qtype == BLIS_QUANT_INT8 ? rand() % 16 - 8 : 8.0f;
+	}
+
+	// Wrap the quantized B and attach its scales (stored by rows, one row
+	// per group) and zero points.
+	packm_quant_params_t qp;
+
+	bli_obj_create_without_buffer( BLIS_FLOAT, k, n, &b );
+	bli_obj_attach_buffer( q, rs_b, cs_b, 1, &b );
+	bli_obj_attach_quant_params( qtype, gs, scale, n, 1,
+	                             use_zero ? zero : NULL, n, 1, &qp, &b );
+
+	bli_obj_create( BLIS_FLOAT, m, k, 0, 0, &a );
+	bli_obj_create( BLIS_FLOAT, k, n, 0, 0, &bf );
+	bli_obj_create( BLIS_FLOAT, m, n, row_c ? n : 1, row_c ? 1 : m, &c );
+	bli_obj_create( BLIS_FLOAT, m, n, row_c ? n : 1, row_c ? 1 : m, &c_ref );
+	bli_obj_create_1x1( BLIS_FLOAT, &norm );
+
+	bli_obj_scalar_init_detached( BLIS_FLOAT, &alpha );
+	bli_obj_scalar_init_detached( BLIS_FLOAT, &beta );
+	bli_setsc( 1.5, 0.0, &alpha );
+	bli_setsc( -0.5, 0.0, &beta );
+
+	// Dequantize B up front for the reference computation.
+	for ( dim_t l = 0; l < k; ++l )
+	for ( dim_t j = 0; j < n; ++j )
+	{
+		const dim_t g = l / gs;
+		const float x = bli_quant_get( qtype, q, l*rs_b + j*cs_b );
+		const float z = use_zero ? zero[ g*n + j ] : 0.0f;
+
+		bli_setijm( scale[ g*n + j ] * ( x - z ), 0.0, l, j, &bf );
+	}
+
+	bli_randm( &a );
+	bli_randm( &c );
+	bli_copym( &c, &c_ref );
+
+	bli_gemm( &alpha, &a, &b,  &beta, &c );
+	bli_gemm( &alpha, &a, &bf, &beta, &c_ref );
+
+	bli_normfm( &c_ref, &norm );
+	ref = *( float* )bli_obj_buffer( &norm );
+
+	bli_subm( &c_ref, &c );
+	bli_normfm( &c, &norm );
+	diff = *( float* )bli_obj_buffer( &norm );
+
+	const float resid = diff / ref;
+	const int   fail  = !( resid < 1e-5f );
+
+	printf( "%-5s B %s C %s zero %d gs %3d m %4d n %4d k %4d: resid = %9.2e %s\n",
+	        qtype == BLIS_QUANT_INT8 ? "int8" : "uint4",
+	        row_b ? "row" : "col", row_c ? "row" : "col", use_zero,
+	        ( int )gs, ( int )m, ( int )n, ( int )k, resid, fail ? "FAILURE" : "PASS" );
+
+	bli_obj_free( &a );
+	bli_obj_free( &bf );
+	bli_obj_free( &c );
+	bli_obj_free( &c_ref );
+	bli_obj_free( &norm );
+	free( q ); free( scale ); free( zero );
+
+	return fail;
+}
+
+int main( int argc, char** argv )
+{
+	const quant_t qtypes[] = { BLIS_QUANT_INT8, BLIS_QUANT_UINT4 };
+	const dim_t   sizes[][4] = { { 1, 1, 1, 1 }, { 37, 29, 41, 8 },
+	                             { 200, 151, 300, 32 }, { 96, 512, 1000, 128 } };
+	int           fails = 0;
+
+	for ( int t = 0; t < 2; ++t )
+	for ( int s = 0; s < 4; ++s )
+	for ( int rb = 0; rb < 2; ++rb )
+	for ( int rc = 0; rc < 2; ++rc )
+	for ( int z = 0; z < 2; ++z )
+	{
+		fails += test_gemm_quant( qtypes[t], rb, rc, z, sizes[s][3],
+		                          sizes[s][0], sizes[s][1], sizes[s][2] );
+	}
+
+	return fails ? 1 : 0;
+}
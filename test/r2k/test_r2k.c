@@ -0,0 +1,163 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "blis.h"
+
+//
+// Exercise her2k and syr2k, which are computed as a single gemmt over
+// concatenated operands whenever possible. The result is compared against
+// two gemmt invocations, one for each of the rank-k updates. Values of k
+// that are not multiples of the kc blocksize ensure that some micropanels
+// straddle the boundary between the two operands.
+//
+
+static int test_r2k( num_t dt, bool herm, uplo_t uploc, trans_t transab,
+                     bool row_c, dim_t m, dim_t k )
+{
+	obj_t a0, a, b, bh, ah, c, c_ref, norm;
+	obj_t alpha, alphah, beta;
+	double diff, ref, ignore;
+
+	const num_t dt_r = bli_dt_proj_to_real( dt );
+
+	const dim_t m_a = bli_does_trans( transab ) ? k : m;
+	const dim_t n_a = bli_does_trans( transab ) ? m : k;
+
+	// Create A as a view into a larger object so that nonzero offsets are
+	// exercised. B is stored with the opposite (row or column) storage.
+	bli_obj_create( dt, m_a + 3, n_a + 5, 0, 0, &a0 );
+	bli_obj_create( dt, m_a, n_a, n_a, 1, &b );
+	bli_randm( &a0 );
+	bli_randm( &b );
+
+	bli_acquire_mpart( 3, 5, m_a, n_a, &a0, &a );
+	bli_obj_set_conjtrans( transab, &a );
+	bli_obj_set_conjtrans( transab, &b );
+
+	bli_obj_create( dt, m, m, row_c ? m : 1, row_c ? 1 : m, &c );
+	bli_obj_create( dt, m, m, row_c ? m : 1, row_c ? 1 : m, &c_ref );
+	bli_obj_create_1x1( dt_r, &norm );
+
+	bli_obj_set_struc( herm ? BLIS_HERMITIAN : BLIS_SYMMETRIC, &c );
+	bli_obj_set_struc( herm ? BLIS_HERMITIAN : BLIS_SYMMETRIC, &c_ref );
+	bli_obj_set_uplo( uploc, &c );
+	bli_obj_set_uplo( uploc, &c_ref );
+
+	bli_obj_scalar_init_detached( dt, &alpha );
+	bli_obj_scalar_init_detached( dt, &beta );
+	bli_setsc( 1.5, 0.5, &alpha );
+	bli_setsc( -0.5, 0.0, &beta );
+
+	bli_randm( &c );
+	bli_copym( &c, &c_ref );
+
+	if ( herm ) bli_her2k( &alpha, &a, &b, &beta, &c );
+	else        bli_syr2k( &alpha, &a, &b, &beta, &c );
+
+	const trans_t trans = herm ? BLIS_CONJ_TRANSPOSE : BLIS_TRANSPOSE;
+
+	bli_obj_alias_with_trans( trans, &a, &ah );
+	bli_obj_alias_with_trans( trans, &b, &bh );
+	bli_obj_alias_with_conj( herm ? BLIS_CONJUGATE : BLIS_NO_CONJUGATE, &alpha, &alphah );
+
+	bli_gemmt( &alpha,  &a, &bh, &beta,     &c_ref );
+	bli_gemmt( &alphah, &b, &ah, &BLIS_ONE, &c_ref );
+	if ( herm ) bli_setid( &BLIS_ZERO, &c_ref );
+
+	bli_normfm( &c_ref, &norm );
+	bli_getsc( &norm, &ref, &ignore );
+
+	bli_subm( &c_ref, &c );
+	bli_normfm( &c, &norm );
+	bli_getsc( &norm, &diff, &ignore );
+
+	const double resid = diff / ref;
+	const double tol   = bli_dt_prec_is_single( dt ) ? 1e-5 : 1e-13;
+	const int    fail  = !( resid < tol );
+
+	char dt_ch;
+	bli_param_map_blis_to_char_dt( dt, &dt_ch );
+
+	printf( "%c%s uplo %c trans %c C %s m %4d k %4d: resid = %9.2e %s\n",
+	        dt_ch, herm ? "her2k" : "syr2k",
+	        bli_is_lower( uploc ) ? 'l' : 'u', bli_does_trans( transab ) ? 't' : 'n',
+	        row_c ? "row" : "col", ( int )m, ( int )k, resid, fail ? "FAILURE" : "PASS" );
+
+	bli_obj_free( &a0 );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+	bli_obj_free( &c_ref );
+	bli_obj_free( &norm );
+
+	return fail;
+}
+
+int main( int argc, char** argv )
+{
+	const num_t dts[]      = { BLIS_FLOAT, BLIS_DOUBLE, BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+	const dim_t sizes[][2] = { { 1, 1 }, { 37, 29 }, { 150, 300 }, { 500, 700 } };
+	int         fails = 0;
+
+	// The second pass enables 1m, in which case complex problems must not be
+	// fused (but must still be computed correctly).
+	for ( int im = 0; im < 2; ++im )
+	{
+		if ( im ) bli_ind_enable( BLIS_1M );
+
+		for ( int t = 0; t < 4; ++t )
+		for ( int h = 0; h < 2; ++h )
+		for ( int s = 0; s < 4; ++s )
+		for ( int u = 0; u < 2; ++u )
+		for ( int tr = 0; tr < 2; ++tr )
+		for ( int rc = 0; rc < 2; ++rc )
+		{
+			// her2k is the same as syr2k in the real domain.
+			if ( h && bli_is_real( dts[t] ) ) continue;
+			if ( im && bli_is_real( dts[t] ) ) continue;
+
+			fails += test_r2k( dts[t], h, u ? BLIS_UPPER : BLIS_LOWER,
+			                   tr ? ( h ? BLIS_CONJ_TRANSPOSE : BLIS_TRANSPOSE )
+			                      : BLIS_NO_TRANSPOSE,
+			                   rc, sizes[s][0], sizes[s][1] );
+		}
+
+		if ( im ) bli_ind_disable( BLIS_1M );
+	}
+
+	return fails ? 1 : 0;
+}
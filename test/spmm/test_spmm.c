@@ -0,0 +1,315 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "blis.h"
+
+//
+// Accuracy and throughput of the SpMM addon (bao_spmm_ex()).
+//
+// With no arguments, each datatype is checked for matrices A in CSR and BSR
+// format (with various block sizes) against the product of the equivalent
+// dense matrix computed by bli_gemm(), with row- and column-stored B and C,
+// and with one and with several threads. Some block rows of A are dense,
+// so that the nnz-weighted partitioning of the rows is exercised, and some
+// are empty. Widths of C greater than NC exercise the packing of several
+// blocks of B.
+//
+// With "-p" followed by a list of problem sizes m, the throughput of double-
+// precision SpMM with an m x m matrix A with 16 nonzeros per row (in CSR
+// format, and in BSR format with 4 x 4 blocks) and 64 columns of B and C
+// (all row-stored) is compared with that of a straightforward loop over
+// the nonzeros of A. The number of threads is taken from the environment
+// (e.g. BLIS_NUM_THREADS).
+//
+
+static char dt_char( num_t dt )
+{
+	return bli_dt_prec_is_single( dt ) ? ( bli_dt_dom_is_real( dt ) ? 's' : 'c' )
+	                                   : ( bli_dt_dom_is_real( dt ) ? 'd' : 'z' );
+}
+
+typedef struct
+{
+	spmat_t a;
+	dim_t*  row_ptr;
+	dim_t*  col_ind;
+	obj_t   val;
+} sp_t;
+
+// Create a random m x k sparse matrix with bm x bn blocks, each of which is
+// nonzero with probability density (except that every 7th block row is
+// dense and every 5th is empty), along with its dense equivalent ad.
+static void create_sparse( num_t dt, dim_t m, dim_t k, dim_t bm, dim_t bn,
+                           double density, sp_t* s, obj_t* ad )
+{
+	const dim_t mb = m / bm;
+	const dim_t kb = k / bn;
+
+	s->row_ptr = malloc( ( mb + 1 ) * sizeof( dim_t ) );
+	s->col_ind = malloc( ( mb * kb + 1 ) * sizeof( dim_t ) );
+
+	dim_t nnzb = 0;
+
+	for ( dim_t i = 0; i < mb; ++i )
+	{
+		s->row_ptr[ i ] = nnzb;
+
+		for ( dim_t j = 0; j < kb; ++j )
+		{
+			const bool keep = ( i % 7 == 3 ) ||
+			                  ( i % 5 != 1 && rand() < density * RAND_MAX );
+			if ( keep ) s->col_ind[ nnzb++ ] = j;
+		}
+	}
+	s->row_ptr[ mb ] = nnzb;
+
+	// The values are stored (block by block) in a vector.
+	bli_obj_create( dt, nnzb * bm * bn + 1, 1, 0, 0, &s->val );
+	bli_randv( &s->val );
+
+	bao_spmat_init_bsr( dt, m, k, bm, bn, s->row_ptr, s->col_ind,
+	                    bli_obj_buffer( &s->val ), &s->a );
+
+	// Scatter the blocks into the dense matrix.
+	bli_obj_create( dt, m, k, 0, 0, ad );
+	bli_setm( &BLIS_ZERO, ad );
+
+	for ( dim_t i = 0; i < mb; ++i )
+	for ( dim_t p = s->row_ptr[ i ]; p < s->row_ptr[ i + 1 ]; ++p )
+	{
+		obj_t blk, vblk;
+
+		bli_acquire_mpart( i * bm, s->col_ind[ p ] * bn, bm, bn, ad, &blk );
+
+		// View the values of block p as a row-stored bm x bn matrix.
+		bli_obj_create_with_attached_buffer( dt, bm, bn,
+		    ( char* )bli_obj_buffer( &s->val ) + p * bm * bn * bli_dt_size( dt ),
+		    bn, 1, &vblk );
+
+		bli_copym( &vblk, &blk );
+	}
+}
+
+static void free_sparse( sp_t* s )
+{
+	free( s->row_ptr );
+	free( s->col_ind );
+	bli_obj_free( &s->val );
+}
+
+static void create_mat( num_t dt, dim_t m, dim_t n, bool row, obj_t* a )
+{
+	if ( row ) bli_obj_create( dt, m, n, n, 1, a );
+	else       bli_obj_create( dt, m, n, 1, m, a );
+
+	bli_randm( a );
+}
+
+static int test_spmm( num_t dt, dim_t m, dim_t k, dim_t n, dim_t bm, dim_t bn,
+                      bool row_b, bool row_c, bool beta0, dim_t nt )
+{
+	sp_t  s;
+	obj_t ad, b, c, c0, alpha, beta, norm;
+
+	create_sparse( dt, m, k, bm, bn, 0.2, &s, &ad );
+	create_mat( dt, k, n, row_b, &b );
+	create_mat( dt, m, n, row_c, &c );
+	bli_obj_create( dt, m, n, 0, 0, &c0 );
+	bli_copym( &c, &c0 );
+
+	bli_obj_scalar_init_detached( dt, &alpha );
+	bli_obj_scalar_init_detached( dt, &beta );
+	bli_obj_scalar_init_detached( bli_dt_proj_to_real( dt ), &norm );
+	bli_setsc( 1.5, -0.5, &alpha );
+	bli_setsc( beta0 ? 0.0 : 0.75, 0.25, &beta );
+
+	// If beta is zero, C must not be read.
+	if ( beta0 ) bli_setsc( 0.0, 0.0, &beta );
+
+	rntm_t rntm = BLIS_RNTM_INITIALIZER;
+	bli_rntm_set_num_threads( nt, &rntm );
+
+	bao_spmm_ex( &alpha, &s.a, &b, &beta, &c, NULL, &rntm );
+
+	double nr, nd, ni;
+
+	bli_gemm( &alpha, &ad, &b, &beta, &c0 );
+	bli_normfm( &c0, &norm ); bli_getsc( &norm, &nr, &ni );
+	bli_subm( &c, &c0 );
+	bli_normfm( &c0, &norm ); bli_getsc( &norm, &nd, &ni );
+
+	double eps   = bli_dt_prec_is_single( dt ) ? 5.96e-8 : 1.11e-16;
+	double resid = nd / ( ( nr > 0.0 ? nr : 1.0 ) * k * eps );
+	int    fail  = !( resid < 10.0 );
+
+	printf( "%cspmm %dx%d blocks B %s C %s beta %s nt %d m %4d k %4d n %4d: "
+	        "resid = %8.2e %s\n",
+	        dt_char( dt ), ( int )bm, ( int )bn, row_b ? "row" : "col",
+	        row_c ? "row" : "col", beta0 ? "0" : "x", ( int )nt, ( int )m,
+	        ( int )k, ( int )n, resid, fail ? "FAIL" : "PASS" );
+
+	free_sparse( &s );
+	bli_obj_free( &ad );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+	bli_obj_free( &c0 );
+
+	return fail;
+}
+
+// C := C + A B, with A in BSR format and row-stored B and C.
+static void ref_dbsrmm( dim_t m, dim_t n, dim_t bm, dim_t bn, const dim_t* row_ptr,
+                        const dim_t* col_ind, const double* val,
+                        const double* b, double* c )
+{
+	for ( dim_t i = 0; i < m / bm; ++i )
+	for ( dim_t p = row_ptr[ i ]; p < row_ptr[ i + 1 ]; ++p )
+	for ( dim_t ii = 0; ii < bm; ++ii )
+	for ( dim_t kk = 0; kk < bn; ++kk )
+	{
+		const double  v  = val[ ( p * bm + ii ) * bn + kk ];
+		const double* bk = b + ( col_ind[ p ] * bn + kk ) * n;
+		double*       ci = c + ( i * bm + ii ) * n;
+
+		for ( dim_t j = 0; j < n; ++j ) ci[ j ] += v * bk[ j ];
+	}
+}
+
+static void time_spmm( dim_t m, dim_t bs, double* gflops_ref, double* gflops_bao )
+{
+	const dim_t n   = 64;
+	const dim_t mb  = m / bs;
+	const dim_t nzr = 16 / bs; // blocks per block row
+
+	dim_t*  row_ptr = malloc( ( mb + 1 ) * sizeof( dim_t ) );
+	dim_t*  col_ind = malloc( mb * nzr * sizeof( dim_t ) );
+	double* val     = malloc( mb * nzr * bs * bs * sizeof( double ) );
+
+	for ( dim_t i = 0; i <= mb; ++i ) row_ptr[ i ] = i * nzr;
+	for ( dim_t p = 0; p < mb * nzr; ++p ) col_ind[ p ] = rand() % mb;
+	for ( dim_t p = 0; p < mb * nzr * bs * bs; ++p ) val[ p ] = 1.0 / ( 1 + p % 7 );
+
+	obj_t b, c;
+	create_mat( BLIS_DOUBLE, m, n, TRUE, &b );
+	create_mat( BLIS_DOUBLE, m, n, TRUE, &c );
+
+	spmat_t a;
+	bao_spmat_init_bsr( BLIS_DOUBLE, m, m, bs, bs, row_ptr, col_ind, val, &a );
+
+	double dtime_ref = 1.0e9;
+	double dtime_bao = 1.0e9;
+
+	for ( int r = 0; r < 3; ++r )
+	{
+		double dtime = bli_clock();
+		ref_dbsrmm( m, n, bs, bs, row_ptr, col_ind, val,
+		            bli_obj_buffer( &b ), bli_obj_buffer( &c ) );
+		dtime_ref = bli_clock_min_diff( dtime_ref, dtime );
+
+		dtime = bli_clock();
+		bao_spmm( &BLIS_ONE, &a, &b, &BLIS_ONE, &c );
+		dtime_bao = bli_clock_min_diff( dtime_bao, dtime );
+	}
+
+	const double flops = 2.0 * mb * nzr * bs * bs * n;
+
+	*gflops_ref = flops / ( dtime_ref * 1.0e9 );
+	*gflops_bao = flops / ( dtime_bao * 1.0e9 );
+
+	free( row_ptr );
+	free( col_ind );
+	free( val );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+}
+
+int main( int argc, char** argv )
+{
+	bli_init();
+
+	if ( argc > 1 && strcmp( argv[ 1 ], "-p" ) == 0 )
+	{
+		printf( "%8s %10s %10s %10s %10s\n", "m", "csr ref", "csr bao",
+		        "bsr4 ref", "bsr4 bao" );
+
+		for ( int i = 2; i < argc; ++i )
+		{
+			dim_t  m = atoi( argv[ i ] );
+			double gf_ref1, gf_bao1, gf_ref4, gf_bao4;
+
+			time_spmm( m, 1, &gf_ref1, &gf_bao1 );
+			time_spmm( m, 4, &gf_ref4, &gf_bao4 );
+
+			printf( "%8d %10.2f %10.2f %10.2f %10.2f\n", ( int )m,
+			        gf_ref1, gf_bao1, gf_ref4, gf_bao4 );
+		}
+
+		bli_finalize();
+		return 0;
+	}
+
+	const num_t dts[]      = { BLIS_FLOAT, BLIS_DOUBLE, BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+	const dim_t shapes[][5] = { {   1,   1,    1,  1,  1 }, { 100,  80,   17,  1,  1 },
+	                            { 300, 500,   64,  1,  1 }, {  37,  41, 4100,  1,  1 },
+	                            {  96, 120,   30,  6,  4 }, {  64,  64,  100,  8,  8 },
+	                            {  90,  35,   50,  3,  5 }, {  48,  48, 4100, 16, 16 } };
+	const dim_t nts[]      = { 1, 3 };
+
+	int n_fail = 0, n_test = 0;
+
+	for ( int idt = 0; idt < 4; ++idt )
+	for ( int is = 0; is < 8; ++is )
+	for ( int st = 0; st < 4; ++st )
+	for ( int it = 0; it < 2; ++it )
+	{
+		const dim_t* s = shapes[ is ];
+
+		n_fail += test_spmm( dts[ idt ], s[ 0 ], s[ 1 ], s[ 2 ], s[ 3 ], s[ 4 ],
+		                     st & 1, st >> 1, ( is + st ) % 3 == 0, nts[ it ] );
+		++n_test;
+	}
+
+	printf( "%d of %d tests passed\n", n_test - n_fail, n_test );
+
+	bli_finalize();
+
+	return n_fail ? 1 : 0;
+}
+
@@ -0,0 +1,199 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#undef  _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "blis.h"
+
+//
+// The per-thread performance counters of level-3 operations (bli_stats).
+//
+// When BLIS is configured with --enable-stats, a large gemm must be counted
+// as a conventional gemm with packing, macrokernel, and barrier events, and a
+// small gemm as a sup gemm; nothing may be counted while collection is
+// disabled at runtime or after a reset. Otherwise, all statistics must stay
+// zero.
+//
+
+static int n_test = 0;
+static int n_fail = 0;
+
+static void check( bool ok, const char* what )
+{
+	n_test += 1;
+
+	if ( !ok ) n_fail += 1;
+
+	printf( "%-56s %s\n", what, ok ? "PASS" : "FAIL" );
+}
+
+static void run_gemm( dim_t m, dim_t n, dim_t k )
+{
+	obj_t a, b, c;
+
+	bli_obj_create( BLIS_DOUBLE, m, k, 0, 0, &a );
+	bli_obj_create( BLIS_DOUBLE, k, n, 0, 0, &b );
+	bli_obj_create( BLIS_DOUBLE, m, n, 0, 0, &c );
+	bli_randm( &a );
+	bli_randm( &b );
+	bli_setm( &BLIS_ZERO, &c );
+
+	bli_gemm( &BLIS_ONE, &a, &b, &BLIS_ZERO, &c );
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+}
+
+static bool stats_are_zero( const stats_t* stats )
+{
+	for ( dim_t i = 0; i < BLIS_STATS_NUM_EVENTS; ++i )
+		if ( stats->count[ i ] != 0 || stats->time[ i ] != 0.0 ) return FALSE;
+
+	return TRUE;
+}
+
+int main( int argc, char** argv )
+{
+	stats_t stats, stats_t0;
+	bool    ok;
+
+	bli_init();
+
+	bli_stats_enable();
+	bli_stats_reset();
+
+	bli_stats_get( &stats );
+	check( stats_are_zero( &stats ) && bli_stats_num_threads() == 0,
+	       "statistics are zero after a reset" );
+
+	if ( !bli_info_get_enable_stats() )
+	{
+		check( !bli_stats_is_enabled(), "collection stays disabled" );
+
+		run_gemm( 400, 400, 400 );
+		bli_stats_get( &stats );
+		check( stats_are_zero( &stats ), "nothing counted when not configured" );
+	}
+	else
+	{
+		check( bli_stats_is_enabled(), "collection enabled at runtime" );
+
+		// A gemm that is too large for the sup code path.
+		run_gemm( 600, 600, 600 );
+		bli_stats_get( &stats );
+
+		ok = stats.count[ BLIS_STATS_GEMM ] == 1 &&
+		     stats.count[ BLIS_STATS_GEMMSUP ] == 0;
+		check( ok, "large gemm counted as conventional" );
+
+		ok = stats.count[ BLIS_STATS_PACKA ] > 0 &&
+		     stats.count[ BLIS_STATS_PACKB ] > 0 &&
+		     stats.count[ BLIS_STATS_MACROKER ] > 0 &&
+		     stats.count[ BLIS_STATS_BARRIER ] > 0;
+		check( ok, "packing, macrokernel and barrier events counted" );
+
+		ok = stats.time[ BLIS_STATS_GEMM ] > 0.0 &&
+		     stats.time[ BLIS_STATS_MACROKER ] <= stats.time[ BLIS_STATS_GEMM ] *
+		                                           bli_stats_num_threads();
+		check( ok, "gemm timed and bounds its macrokernels" );
+
+		// Per-thread statistics must sum to the totals.
+		stats_t sum;
+		memset( &sum, 0, sizeof( sum ) );
+		for ( dim_t t = 0; t < bli_stats_num_threads(); ++t )
+		{
+			bli_stats_get_thread( t, &stats_t0 );
+			for ( dim_t i = 0; i < BLIS_STATS_NUM_EVENTS; ++i )
+			{
+				sum.count[ i ] += stats_t0.count[ i ];
+				sum.time[ i ]  += stats_t0.time[ i ];
+			}
+		}
+		ok = memcmp( sum.count, stats.count, sizeof( sum.count ) ) == 0;
+		for ( dim_t i = 0; i < BLIS_STATS_NUM_EVENTS; ++i )
+			ok = ok && bli_fabs( sum.time[ i ] - stats.time[ i ] ) <=
+			           1.0e-9 * ( 1.0 + stats.time[ i ] );
+		check( ok, "per-thread statistics sum to the totals" );
+
+		// A small gemm is handled by the sup code path.
+		bli_stats_reset();
+		run_gemm( 8, 8, 8 );
+		bli_stats_get( &stats );
+		ok = stats.count[ BLIS_STATS_GEMMSUP ] == 1 &&
+		     stats.count[ BLIS_STATS_GEMM ] == 0 &&
+		     stats.count[ BLIS_STATS_PACKA ] == 0;
+		check( ok, "small gemm counted as sup" );
+
+		// Nothing is counted while collection is disabled.
+		bli_stats_reset();
+		bli_stats_disable();
+		run_gemm( 600, 600, 600 );
+		bli_stats_get( &stats );
+		check( !bli_stats_is_enabled() && stats_are_zero( &stats ),
+		       "nothing counted while disabled" );
+		bli_stats_enable();
+
+		// The dump names every event.
+		run_gemm( 600, 600, 600 );
+
+		char   buf[ 8192 ];
+		FILE*  file = tmpfile();
+
+		bli_stats_fprint( file );
+		rewind( file );
+		size_t len = fread( buf, 1, sizeof( buf ) - 1, file );
+		buf[ len ] = '\0';
+		fclose( file );
+
+		ok = buf[ 0 ] == '{' && strstr( buf, "\"threads\"" ) != NULL &&
+		     strstr( buf, "\"total\"" ) != NULL;
+		for ( dim_t i = 0; i < BLIS_STATS_NUM_EVENTS; ++i )
+			ok = ok && strstr( buf, bli_stats_event_string( i ) ) != NULL;
+		check( ok, "dump contains threads, total and all events" );
+	}
+
+	bli_finalize();
+
+	printf( "%d of %d tests passed\n", n_test - n_fail, n_test );
+
+	return n_fail == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
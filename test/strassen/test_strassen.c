@@ -0,0 +1,200 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "blis.h"
+
+//
+// Accuracy and throughput of the Strassen addon (bao_strassen_ex()) relative
+// to bli_gemm().
+//
+// With no arguments, each datatype, number of levels, storage combination,
+// and transposition is checked on sizes that are and are not multiples of
+// 2^levels against bli_gemm(). The difference is reported relative to
+// k |A| |B| u (with max-norms and u the unit roundoff), which is expected to
+// grow with the number of levels but remain small.
+//
+// With "-p" followed by a list of problem sizes, the throughput of dgemm and
+// of one level, two levels, and the automatic crossover is reported for
+// square problems (in "effective" GFLOPS, i.e. 2n^3 / time).
+//
+
+static int test_strassen( num_t dt, dim_t levels, bool trans_a, bool trans_b,
+                          bool row_c, dim_t m, dim_t n, dim_t k )
+{
+	obj_t alpha, beta, a, b, c, c_ref, norm;
+
+	bli_obj_create( dt, 1, 1, 0, 0, &alpha );
+	bli_obj_create( dt, 1, 1, 0, 0, &beta );
+	bli_obj_scalar_init_detached( bli_dt_proj_to_real( dt ), &norm );
+
+	bli_setsc(  1.5, 0.5, &alpha );
+	bli_setsc( -0.5, 0.0, &beta );
+
+	if ( trans_a ) bli_obj_create( dt, k, m, 0, 0, &a );
+	else           bli_obj_create( dt, m, k, 0, 0, &a );
+	if ( trans_b ) bli_obj_create( dt, n, k, 0, 0, &b );
+	else           bli_obj_create( dt, k, n, 0, 0, &b );
+
+	if ( row_c ) bli_obj_create( dt, m, n, n, 1, &c );
+	else         bli_obj_create( dt, m, n, 1, m, &c );
+	bli_obj_create( dt, m, n, 0, 0, &c_ref );
+
+	bli_randm( &a );
+	bli_randm( &b );
+	bli_randm( &c );
+	bli_copym( &c, &c_ref );
+
+	if ( trans_a ) bli_obj_set_onlytrans( BLIS_TRANSPOSE, &a );
+	if ( trans_b ) bli_obj_set_conjtrans( BLIS_CONJ_TRANSPOSE, &b );
+
+	bao_strassen_ex( &alpha, &a, &b, &beta, &c, levels, NULL, NULL );
+	bli_gemm( &alpha, &a, &b, &beta, &c_ref );
+
+	double na, nb, nd, ni;
+	double eps = bli_dt_prec_is_single( dt ) ? 5.96e-8 : 1.11e-16;
+
+	bli_normim( &a, &norm ); bli_getsc( &norm, &na, &ni );
+	bli_normim( &b, &norm ); bli_getsc( &norm, &nb, &ni );
+	bli_subm( &c_ref, &c );
+	bli_normim( &c, &norm ); bli_getsc( &norm, &nd, &ni );
+
+	// The infinity norms of A and B already include a factor of k (or n),
+	// so only the growth due to the additions of each level remains.
+	const double resid = nd / ( na * nb * eps );
+	const int    fail  = !( resid < 1000.0 );
+
+	char dt_ch = bli_dt_prec_is_single( dt ) ? ( bli_dt_dom_is_real( dt ) ? 's' : 'c' )
+	                                         : ( bli_dt_dom_is_real( dt ) ? 'd' : 'z' );
+
+	printf( "%cstrassen L %d A %c B %c C %s m %4d n %4d k %4d: resid = %8.2f %s\n",
+	        dt_ch, ( int )levels, trans_a ? 't' : 'n', trans_b ? 'h' : 'n',
+	        row_c ? "row" : "col", ( int )m, ( int )n, ( int )k,
+	        resid, fail ? "FAIL" : "PASS" );
+
+	bli_obj_free( &alpha );
+	bli_obj_free( &beta );
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+	bli_obj_free( &c_ref );
+
+	return fail;
+}
+
+static double time_gemm( dim_t levels, dim_t n, dim_t n_repeats )
+{
+	obj_t a, b, c;
+
+	bli_obj_create( BLIS_DOUBLE, n, n, 0, 0, &a );
+	bli_obj_create( BLIS_DOUBLE, n, n, 0, 0, &b );
+	bli_obj_create( BLIS_DOUBLE, n, n, 0, 0, &c );
+	bli_randm( &a );
+	bli_randm( &b );
+	bli_randm( &c );
+
+	double dtime_best = 1.0e9;
+
+	for ( dim_t r = 0; r < n_repeats; ++r )
+	{
+		double dtime = bli_clock();
+
+		if ( levels < 0 && levels != BAO_STRASSEN_AUTO )
+			bli_gemm( &BLIS_ONE, &a, &b, &BLIS_ONE, &c );
+		else
+			bao_strassen_ex( &BLIS_ONE, &a, &b, &BLIS_ONE, &c, levels, NULL, NULL );
+
+		dtime_best = bli_clock_min_diff( dtime_best, dtime );
+	}
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+
+	return 2.0 * n * n * n / ( dtime_best * 1.0e9 );
+}
+
+int main( int argc, char** argv )
+{
+	bli_init();
+
+	if ( argc > 1 && strcmp( argv[ 1 ], "-p" ) == 0 )
+	{
+		printf( "%6s %10s %10s %10s %10s\n", "n", "dgemm", "L=1", "L=2", "auto" );
+
+		for ( int i = 2; i < argc; ++i )
+		{
+			dim_t n = atoi( argv[ i ] );
+
+			printf( "%6d %10.2f %10.2f %10.2f %10.2f\n", ( int )n,
+			        time_gemm( -2, n, 3 ),
+			        time_gemm(  1, n, 3 ),
+			        time_gemm(  2, n, 3 ),
+			        time_gemm( BAO_STRASSEN_AUTO, n, 3 ) );
+		}
+
+		bli_finalize();
+		return 0;
+	}
+
+	const num_t dts[]   = { BLIS_FLOAT, BLIS_DOUBLE, BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+	const dim_t sizes[][3] = { {  64,  64,  64 }, { 256, 200, 300 },
+	                           { 333, 517, 258 }, { 601, 403, 799 },
+	                           {   3,  50,  50 } };
+
+	int n_fail = 0, n_test = 0;
+
+	for ( int idt = 0; idt < 4; ++idt )
+	for ( dim_t levels = 1; levels <= BAO_STRASSEN_MAX_LEVELS; ++levels )
+	for ( int is = 0; is < 5; ++is )
+	for ( int ta = 0; ta < 2; ++ta )
+	for ( int tb = 0; tb < 2; ++tb )
+	for ( int rc = 0; rc < 2; ++rc )
+	{
+		n_fail += test_strassen( dts[ idt ], levels, ta, tb, rc,
+		                         sizes[ is ][ 0 ], sizes[ is ][ 1 ], sizes[ is ][ 2 ] );
+		++n_test;
+	}
+
+	printf( "%d of %d tests passed\n", n_test - n_fail, n_test );
+
+	bli_finalize();
+
+	return n_fail ? 1 : 0;
+}
+
@@ -0,0 +1,176 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "blis.h"
+
+//
+// Exercise syrkd and herkd, which compute C := beta * C + alpha * A * D * A^T
+// (or A * D * A^H) for a diagonal matrix D. The result is compared against
+// gemmt applied to an explicitly scaled copy of A. Small problems exercise
+// the sup code path; the sup code path may also be disabled via the rntm_t
+// so that the conventional (packed) code path is exercised for all sizes.
+//
+
+static int test_syrkd( num_t dt, bool herm, uplo_t uploc, trans_t transa,
+                       bool sup, dim_t m, dim_t k )
+{
+	obj_t a0, a, ad, at, d0, d, c, c_ref, norm;
+	obj_t alpha, beta;
+	double diff, ref, ignore;
+
+	const num_t dt_r = bli_dt_proj_to_real( dt );
+
+	// Create A (and D) as views into larger objects so that nonzero offsets
+	// (and, for D, a non-unit increment) are exercised.
+	const dim_t m_a = bli_does_trans( transa ) ? k : m;
+	const dim_t n_a = bli_does_trans( transa ) ? m : k;
+
+	bli_obj_create( dt, m_a + 3, n_a + 5, 0, 0, &a0 );
+	bli_obj_create( dt, 2, k + 1, 0, 0, &d0 );
+	bli_randm( &a0 );
+	bli_randm( &d0 );
+
+	bli_acquire_mpart( 3, 5, m_a, n_a, &a0, &a );
+	bli_acquire_mpart( 1, 1, 1, k, &d0, &d );
+	bli_obj_set_onlytrans( transa, &a );
+
+	bli_obj_create( dt, m, k, 0, 0, &ad );
+	bli_obj_create( dt, m, m, 0, 0, &c );
+	bli_obj_create( dt, m, m, 0, 0, &c_ref );
+	bli_obj_create_1x1( dt_r, &norm );
+
+	bli_obj_set_struc( herm ? BLIS_HERMITIAN : BLIS_SYMMETRIC, &c );
+	bli_obj_set_struc( herm ? BLIS_HERMITIAN : BLIS_SYMMETRIC, &c_ref );
+	bli_obj_set_uplo( uploc, &c );
+	bli_obj_set_uplo( uploc, &c_ref );
+
+	bli_obj_scalar_init_detached( dt, &alpha );
+	bli_obj_scalar_init_detached( dt, &beta );
+	bli_setsc( 1.5, 0.0, &alpha );
+	bli_setsc( -0.5, 0.0, &beta );
+
+	bli_randm( &c );
+	bli_copym( &c, &c_ref );
+
+	// Form A * D explicitly for the reference computation.
+	bli_copym( &a, &ad );
+
+	for ( dim_t l = 0; l < k; ++l )
+	{
+		obj_t d1, d1_r, ad1;
+
+		bli_acquire_vpart_f2b( BLIS_SUBPART1, l, 1, &d, &d1 );
+		bli_acquire_mpart_l2r( BLIS_SUBPART1, l, 1, &ad, &ad1 );
+		bli_obj_real_part( &d1, &d1_r );
+
+		bli_scalv( herm ? &d1_r : &d1, &ad1 );
+	}
+
+	bli_obj_alias_with_trans( herm ? BLIS_CONJ_TRANSPOSE : BLIS_TRANSPOSE, &a, &at );
+
+	rntm_t rntm = BLIS_RNTM_INITIALIZER;
+	if ( !sup ) bli_rntm_disable_l3_sup( &rntm );
+
+	if ( herm ) bli_herkd_ex( &alpha, &a, &d, &beta, &c, NULL, &rntm );
+	else        bli_syrkd_ex( &alpha, &a, &d, &beta, &c, NULL, &rntm );
+
+	bli_gemmt( &alpha, &ad, &at, &beta, &c_ref );
+	if ( herm ) bli_setid( &BLIS_ZERO, &c_ref );
+
+	bli_normfm( &c_ref, &norm );
+	bli_getsc( &norm, &ref, &ignore );
+
+	bli_subm( &c_ref, &c );
+	bli_normfm( &c, &norm );
+	bli_getsc( &norm, &diff, &ignore );
+
+	const double resid = diff / ref;
+	const double tol   = bli_dt_prec_is_single( dt ) ? 1e-5 : 1e-13;
+	const int    fail  = !( resid < tol );
+
+	char dt_ch;
+	bli_param_map_blis_to_char_dt( dt, &dt_ch );
+
+	printf( "%c%s uplo %c trans %c sup %d m %4d k %4d: resid = %9.2e %s\n",
+	        dt_ch, herm ? "herkd" : "syrkd",
+	        bli_is_lower( uploc ) ? 'l' : 'u', bli_does_trans( transa ) ? 't' : 'n',
+	        sup, ( int )m, ( int )k, resid, fail ? "FAILURE" : "PASS" );
+
+	bli_obj_free( &a0 );
+	bli_obj_free( &d0 );
+	bli_obj_free( &ad );
+	bli_obj_free( &c );
+	bli_obj_free( &c_ref );
+	bli_obj_free( &norm );
+
+	return fail;
+}
+
+int main( int argc, char** argv )
+{
+	const num_t dts[]      = { BLIS_FLOAT, BLIS_DOUBLE, BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+	const dim_t sizes[][2] = { { 1, 1 }, { 37, 29 }, { 150, 211 }, { 700, 400 } };
+	int         fails = 0;
+
+	// The second pass enables 1m, which complex problems that do not take
+	// the sup code path then use.
+	for ( int im = 0; im < 2; ++im )
+	{
+		if ( im ) bli_ind_enable( BLIS_1M );
+
+		for ( int t = 0; t < 4; ++t )
+		for ( int h = 0; h < 2; ++h )
+		for ( int s = 0; s < 4; ++s )
+		for ( int u = 0; u < 2; ++u )
+		for ( int tr = 0; tr < 2; ++tr )
+		for ( int sup = 0; sup < 2; ++sup )
+		{
+			// herkd is the same as syrkd in the real domain.
+			if ( h && bli_is_real( dts[t] ) ) continue;
+			if ( im && bli_is_real( dts[t] ) ) continue;
+
+			fails += test_syrkd( dts[t], h, u ? BLIS_UPPER : BLIS_LOWER,
+			                     tr ? BLIS_TRANSPOSE : BLIS_NO_TRANSPOSE, sup,
+			                     sizes[s][0], sizes[s][1] );
+		}
+
+		if ( im ) bli_ind_disable( BLIS_1M );
+	}
+
+	return fails ? 1 : 0;
+}
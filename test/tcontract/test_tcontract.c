@@ -0,0 +1,298 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "blis.h"
+
+//
+// Accuracy of the tensor contraction addon (bao_tcontract()) relative to a
+// naive reference implementation.
+//
+// Each test case draws a random number of m, n, and k indices (zero to
+// three of each) with random lengths, and lays out each of A, B, and C with
+// its indices in a random order, optionally with padding between them. The
+// same contraction is then computed with bao_tcontract() and with simple
+// loops in double precision. Cases with beta = 0 (and C initialized to NaN),
+// alpha = 0, and an empty k dimension are included.
+//
+
+#define MAX_NDIM 3
+#define MAX_LEN  400
+
+static double get_re( num_t dt, const void* x, inc_t off )
+{
+	if      ( dt == BLIS_FLOAT    ) return ( ( float*    )x )[ off ];
+	else if ( dt == BLIS_DOUBLE   ) return ( ( double*   )x )[ off ];
+	else if ( dt == BLIS_SCOMPLEX ) return ( ( scomplex* )x )[ off ].real;
+	else                            return ( ( dcomplex* )x )[ off ].real;
+}
+
+static double get_im( num_t dt, const void* x, inc_t off )
+{
+	if      ( dt == BLIS_SCOMPLEX ) return ( ( scomplex* )x )[ off ].imag;
+	else if ( dt == BLIS_DCOMPLEX ) return ( ( dcomplex* )x )[ off ].imag;
+	else                            return 0.0;
+}
+
+static void set_elem( num_t dt, void* x, inc_t off, double re, double im )
+{
+	if      ( dt == BLIS_FLOAT    ) ( ( float*  )x )[ off ] = re;
+	else if ( dt == BLIS_DOUBLE   ) ( ( double* )x )[ off ] = re;
+	else if ( dt == BLIS_SCOMPLEX ) { ( ( scomplex* )x )[ off ].real = re;
+	                                  ( ( scomplex* )x )[ off ].imag = im; }
+	else                            { ( ( dcomplex* )x )[ off ].real = re;
+	                                  ( ( dcomplex* )x )[ off ].imag = im; }
+}
+
+// Compute the offset of element i of an index group (first index fastest).
+static inc_t group_off( int ndim, const dim_t* len, const inc_t* stride, dim_t i )
+{
+	inc_t off = 0;
+
+	for ( int d = 0; d < ndim; ++d )
+	{
+		off += ( i % len[ d ] ) * stride[ d ];
+		i   /= len[ d ];
+	}
+
+	return off;
+}
+
+static dim_t group_len( int ndim, const dim_t* len )
+{
+	dim_t l = 1;
+	for ( int d = 0; d < ndim; ++d ) l *= len[ d ];
+	return l;
+}
+
+// Lay out a tensor whose indices are the union of two groups by assigning
+// strides in a random order of the indices, with random padding, and return
+// the number of elements needed.
+static dim_t layout( int ndim0, const dim_t* len0, inc_t* stride0,
+                     int ndim1, const dim_t* len1, inc_t* stride1 )
+{
+	int   perm[ 2 * MAX_NDIM ];
+	int   ndim = ndim0 + ndim1;
+	inc_t s    = 1;
+
+	for ( int i = 0; i < ndim; ++i ) perm[ i ] = i;
+	for ( int i = ndim - 1; i > 0; --i )
+	{
+		int j = rand() % ( i + 1 );
+		int t = perm[ i ]; perm[ i ] = perm[ j ]; perm[ j ] = t;
+	}
+
+	for ( int i = 0; i < ndim; ++i )
+	{
+		int   p = perm[ i ];
+		dim_t l = ( p < ndim0 ? len0[ p ] : len1[ p - ndim0 ] );
+
+		if ( p < ndim0 ) stride0[ p ]         = s;
+		else             stride1[ p - ndim0 ] = s;
+
+		s *= l + ( rand() % 4 == 0 ? 1 : 0 );
+	}
+
+	return s;
+}
+
+static int test_tcontract( num_t dt, int seed, int kind )
+{
+	int   ndim_m, ndim_n, ndim_k;
+	dim_t len_m[ MAX_NDIM ], len_n[ MAX_NDIM ], len_k[ MAX_NDIM ];
+	inc_t stride_a_m[ MAX_NDIM ], stride_a_k[ MAX_NDIM ];
+	inc_t stride_b_k[ MAX_NDIM ], stride_b_n[ MAX_NDIM ];
+	inc_t stride_c_m[ MAX_NDIM ], stride_c_n[ MAX_NDIM ];
+
+	srand( 1000 + seed );
+
+	// Draw the index groups, limiting the size of each.
+	do
+	{
+		ndim_m = rand() % ( MAX_NDIM + 1 );
+		ndim_n = rand() % ( MAX_NDIM + 1 );
+		ndim_k = rand() % ( MAX_NDIM + 1 );
+
+		for ( int i = 0; i < MAX_NDIM; ++i )
+		{
+			len_m[ i ] = 1 + rand() % 13;
+			len_n[ i ] = 1 + rand() % 13;
+			len_k[ i ] = 1 + rand() % 13;
+		}
+	}
+	while ( group_len( ndim_m, len_m ) > MAX_LEN ||
+	        group_len( ndim_n, len_n ) > MAX_LEN ||
+	        group_len( ndim_k, len_k ) > MAX_LEN );
+
+	// An empty k dimension.
+	if ( kind == 3 ) { ndim_k = 1; len_k[ 0 ] = 0; }
+
+	const dim_t m = group_len( ndim_m, len_m );
+	const dim_t n = group_len( ndim_n, len_n );
+	const dim_t k = group_len( ndim_k, len_k );
+
+	dim_t size_a = layout( ndim_m, len_m, stride_a_m, ndim_k, len_k, stride_a_k );
+	dim_t size_b = layout( ndim_k, len_k, stride_b_k, ndim_n, len_n, stride_b_n );
+	dim_t size_c = layout( ndim_m, len_m, stride_c_m, ndim_n, len_n, stride_c_n );
+
+	siz_t dt_size = bli_dt_size( dt );
+	void* a       = malloc( bli_max( size_a, 1 ) * dt_size );
+	void* b       = malloc( bli_max( size_b, 1 ) * dt_size );
+	void* c       = malloc( bli_max( size_c, 1 ) * dt_size );
+	double* c_ref = malloc( 2 * bli_max( size_c, 1 ) * sizeof( double ) );
+
+	for ( dim_t i = 0; i < size_a; ++i )
+		set_elem( dt, a, i, rand() / ( double )RAND_MAX - 0.5, rand() / ( double )RAND_MAX - 0.5 );
+	for ( dim_t i = 0; i < size_b; ++i )
+		set_elem( dt, b, i, rand() / ( double )RAND_MAX - 0.5, rand() / ( double )RAND_MAX - 0.5 );
+	for ( dim_t i = 0; i < size_c; ++i )
+	{
+		if ( kind == 1 ) set_elem( dt, c, i, NAN, NAN );
+		else             set_elem( dt, c, i, rand() / ( double )RAND_MAX - 0.5, rand() / ( double )RAND_MAX - 0.5 );
+		c_ref[ 2*i + 0 ] = get_re( dt, c, i );
+		c_ref[ 2*i + 1 ] = get_im( dt, c, i );
+	}
+
+	// kind 0: general alpha and beta; 1: beta = 0; 2: alpha = 0;
+	// 3: empty k dimension.
+	double alpha_r = ( kind == 2 ? 0.0 : 1.5 ), alpha_i = ( kind == 2 ? 0.0 : 0.5 );
+	double beta_r  = ( kind == 1 ? 0.0 : -0.5 ), beta_i  = ( kind == 1 ? 0.0 : 0.25 );
+	if ( bli_is_real( dt ) ) { alpha_i = 0.0; beta_i = 0.0; }
+
+	dcomplex alpha_buf[ 1 ], beta_buf[ 1 ];
+	set_elem( dt, alpha_buf, 0, alpha_r, alpha_i );
+	set_elem( dt, beta_buf,  0, beta_r,  beta_i );
+
+	bao_tcontract( dt, ndim_m, len_m, ndim_n, len_n, ndim_k, len_k,
+	               alpha_buf,
+	               a, stride_a_m, stride_a_k,
+	               b, stride_b_k, stride_b_n,
+	               beta_buf,
+	               c, stride_c_m, stride_c_n );
+
+	// Compute the reference result and the difference.
+	double diff = 0.0, nrm = 0.0;
+
+	for ( dim_t j = 0; j < n; ++j )
+	for ( dim_t i = 0; i < m; ++i )
+	{
+		inc_t off_c = group_off( ndim_m, len_m, stride_c_m, i ) +
+		              group_off( ndim_n, len_n, stride_c_n, j );
+		double ab_r = 0.0, ab_i = 0.0;
+
+		for ( dim_t p = 0; p < k; ++p )
+		{
+			inc_t off_a = group_off( ndim_m, len_m, stride_a_m, i ) +
+			              group_off( ndim_k, len_k, stride_a_k, p );
+			inc_t off_b = group_off( ndim_k, len_k, stride_b_k, p ) +
+			              group_off( ndim_n, len_n, stride_b_n, j );
+			double ar = get_re( dt, a, off_a ), ai = get_im( dt, a, off_a );
+			double br = get_re( dt, b, off_b ), bi = get_im( dt, b, off_b );
+
+			ab_r += ar * br - ai * bi;
+			ab_i += ar * bi + ai * br;
+			nrm  += fabs( ar * br ) + fabs( ai * bi );
+		}
+
+		double cr = c_ref[ 2*off_c + 0 ], ci = c_ref[ 2*off_c + 1 ];
+		double rr, ri;
+
+		if ( beta_r == 0.0 && beta_i == 0.0 ) { rr = 0.0; ri = 0.0; }
+		else { rr = beta_r * cr - beta_i * ci; ri = beta_r * ci + beta_i * cr; }
+
+		rr += alpha_r * ab_r - alpha_i * ab_i;
+		ri += alpha_r * ab_i + alpha_i * ab_r;
+
+		double dr = get_re( dt, c, off_c ) - rr;
+		double di = get_im( dt, c, off_c ) - ri;
+		double d  = sqrt( dr * dr + di * di );
+
+		if ( isnan( d ) ) d = INFINITY;
+		if ( d > diff ) diff = d;
+	}
+
+	// Report the difference relative to the average magnitude of the terms
+	// of each dot product and the unit roundoff.
+	double eps   = ( bli_is_single_prec( dt ) ? 5.96e-8 : 1.11e-16 );
+	double scale = ( m * n > 0 && k > 0 ? nrm / ( m * n ) : 1.0 ) * eps;
+	double resid = diff / ( scale > 0.0 ? scale : eps );
+	bool   pass  = ( resid < 100.0 );
+
+	char dtc = ( dt == BLIS_FLOAT ? 's' : dt == BLIS_DOUBLE ? 'd' :
+	             dt == BLIS_SCOMPLEX ? 'c' : 'z' );
+
+	printf( "%ctcontract seed %3d kind %d ndim %d %d %d m %4d n %4d k %4d: resid = %8.2f %s\n",
+	        dtc, seed, kind, ndim_m, ndim_n, ndim_k, ( int )m, ( int )n, ( int )k,
+	        resid, pass ? "PASS" : "FAIL" );
+
+	free( a );
+	free( b );
+	free( c );
+	free( c_ref );
+
+	return pass ? 0 : 1;
+}
+
+int main( int argc, char** argv )
+{
+	num_t dts[ 4 ] = { BLIS_FLOAT, BLIS_DOUBLE, BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+	int   n_seed   = ( argc > 1 ? atoi( argv[ 1 ] ) : 40 );
+	int   n_test   = 0;
+	int   n_fail   = 0;
+
+	bli_init();
+
+	for ( int d = 0; d < 4; ++d )
+	for ( int seed = 0; seed < n_seed; ++seed )
+	{
+		// Exercise the special cases on a few of the seeds.
+		int kind = ( seed % 10 < 4 ? seed % 10 : 0 );
+
+		n_fail += test_tcontract( dts[ d ], seed, kind );
+		n_test += 1;
+	}
+
+	printf( "%d of %d tests passed\n", n_test - n_fail, n_test );
+
+	bli_finalize();
+
+	return n_fail ? 1 : 0;
+}
+
@@ -0,0 +1,251 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#undef  _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "blis.h"
+
+//
+// The per-thread timeline of level-3 operations (bli_trace).
+//
+// When BLIS is configured with --enable-stats, the trace must contain the
+// loop, pack, macrokernel, and barrier events of the conventional and sup
+// code paths, must keep only the most recent events of each thread, and must
+// be written by bli_finalize() when BLIS_TRACE names a file. Otherwise, the
+// trace must stay empty.
+//
+
+static int n_test = 0;
+static int n_fail = 0;
+
+static void check( bool ok, const char* what )
+{
+	n_test += 1;
+
+	if ( !ok ) n_fail += 1;
+
+	printf( "%-56s %s\n", what, ok ? "PASS" : "FAIL" );
+}
+
+static void run_gemm( dim_t m, dim_t n, dim_t k )
+{
+	obj_t a, b, c;
+
+	bli_obj_create( BLIS_DOUBLE, m, k, 0, 0, &a );
+	bli_obj_create( BLIS_DOUBLE, k, n, 0, 0, &b );
+	bli_obj_create( BLIS_DOUBLE, m, n, 0, 0, &c );
+	bli_randm( &a );
+	bli_randm( &b );
+	bli_setm( &BLIS_ZERO, &c );
+
+	bli_gemm( &BLIS_ONE, &a, &b, &BLIS_ZERO, &c );
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+}
+
+static void run_trsm( dim_t m, dim_t n )
+{
+	obj_t a, b;
+
+	bli_obj_create( BLIS_DOUBLE, m, m, 0, 0, &a );
+	bli_obj_create( BLIS_DOUBLE, m, n, 0, 0, &b );
+	bli_randm( &a );
+	bli_randm( &b );
+	bli_obj_set_struc( BLIS_TRIANGULAR, &a );
+	bli_obj_set_uplo( BLIS_LOWER, &a );
+	bli_shiftd( bli_obj_length( &a ) > 0 ? &BLIS_TWO : &BLIS_ONE, &a );
+
+	bli_trsm( BLIS_LEFT, &BLIS_ONE, &a, &b );
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+}
+
+// Read the trace into a string, which the caller must free.
+static char* trace_string( void )
+{
+	FILE* file = tmpfile();
+
+	bli_trace_fprint( file );
+
+	long len = ftell( file );
+	char* buf = malloc( len + 1 );
+
+	rewind( file );
+	len = fread( buf, 1, len, file );
+	buf[ len ] = '\0';
+	fclose( file );
+
+	return buf;
+}
+
+static long count_str( const char* s, const char* what )
+{
+	long n = 0;
+
+	for ( s = strstr( s, what ); s != NULL; s = strstr( s + 1, what ) ) n += 1;
+
+	return n;
+}
+
+int main( int argc, char** argv )
+{
+	char* buf;
+	bool  ok;
+
+	// A trace is written to the file named by BLIS_TRACE by bli_finalize().
+	char path[] = "/tmp/test_trace_XXXXXX";
+	int  fd     = mkstemp( path );
+	close( fd );
+
+	setenv( "BLIS_TRACE", path, 1 );
+	bli_init();
+	run_gemm( 300, 300, 300 );
+	bli_finalize();
+	unsetenv( "BLIS_TRACE" );
+
+	FILE* file = fopen( path, "r" );
+	char  head[ 256 ] = { 0 };
+	if ( file != NULL ) { ok = fread( head, 1, sizeof( head ) - 1, file ) > 0; fclose( file ); }
+	else                ok = FALSE;
+	remove( path );
+	ok = ok && strncmp( head, "{\"traceEvents\": [", 17 ) == 0;
+	if ( bli_info_get_enable_stats() )
+		ok = ok && strstr( head, "\"ph\": \"X\"" ) != NULL;
+	check( ok, "trace written at finalization" );
+
+	bli_init();
+
+	check( !bli_trace_is_enabled(), "tracing disabled by default" );
+
+	if ( !bli_info_get_enable_stats() )
+	{
+		bli_trace_enable();
+		run_gemm( 300, 300, 300 );
+		buf = trace_string();
+		check( !bli_trace_is_enabled() && count_str( buf, "\"ph\"" ) == 0,
+		       "nothing traced when not configured" );
+		free( buf );
+	}
+	else
+	{
+		bli_trace_enable();
+		bli_trace_reset();
+		bli_stats_disable();
+		bli_stats_reset();
+
+		run_gemm( 600, 600, 600 );
+		run_trsm( 600, 300 );
+
+		buf = trace_string();
+		ok = strstr( buf, "\"gemm_blk_var1\"" ) != NULL &&
+		     strstr( buf, "\"gemm_blk_var2\"" ) != NULL &&
+		     strstr( buf, "\"gemm_blk_var3\"" ) != NULL;
+		check( ok, "conventional gemm loop events recorded" );
+
+		ok = strstr( buf, "\"trsm_blk_var1 (trsm)\"" ) != NULL &&
+		     strstr( buf, "\"trsm_blk_var1 (gemm)\"" ) != NULL;
+		check( ok, "trsm diagonal block events recorded" );
+
+		ok = strstr( buf, "\"packa\"" ) != NULL &&
+		     strstr( buf, "\"packb\"" ) != NULL &&
+		     strstr( buf, "\"macroker\"" ) != NULL &&
+		     strstr( buf, "\"barrier\"" ) != NULL;
+		check( ok, "pack, macrokernel and barrier events recorded" );
+
+		// The threads are given either as a total or as ways of parallelism.
+		dim_t n_threads_exp = bli_thread_get_num_threads();
+		if ( n_threads_exp < 1 )
+			n_threads_exp = bli_max( bli_thread_get_jc_nt(), 1 ) *
+			                bli_max( bli_thread_get_pc_nt(), 1 ) *
+			                bli_max( bli_thread_get_ic_nt(), 1 ) *
+			                bli_max( bli_thread_get_jr_nt(), 1 ) *
+			                bli_max( bli_thread_get_ir_nt(), 1 );
+
+		const long n_threads = count_str( buf, "\"thread_name\"" );
+		ok = n_threads == n_threads_exp &&
+		     strstr( buf, "\"dropped_events\": 0}" ) != NULL;
+		check( ok, "one timeline per thread, nothing dropped" );
+		free( buf );
+
+		stats_t stats;
+		bli_stats_get( &stats );
+		check( stats.count[ BLIS_STATS_GEMM ] == 0,
+		       "tracing does not update disabled statistics" );
+
+		// Sup calls trace their loops, packing (if any), and the call itself.
+		bli_trace_reset();
+		run_gemm( 8, 8, 8 );
+		buf = trace_string();
+		ok = strstr( buf, "\"gemmsup_ref_var" ) != NULL &&
+		     strstr( buf, "\"gemmsup\"" ) != NULL &&
+		     strstr( buf, "\"gemm_blk_var" ) == NULL;
+		check( ok, "sup loop events recorded" );
+		free( buf );
+
+		// Each thread keeps only its most recent events.
+		bli_thread_set_ways( 1, 1, 1, 1, 1 );
+		bli_trace_reset();
+		for ( dim_t i = 0; i < BLIS_TRACE_BUF_LEN; ++i ) run_gemm( 8, 8, 8 );
+		buf = trace_string();
+		ok = count_str( buf, "\"ph\": \"X\"" ) == BLIS_TRACE_BUF_LEN &&
+		     strstr( buf, "\"dropped_events\": 0}" ) == NULL;
+		check( ok, "ring buffer keeps the most recent events" );
+		free( buf );
+
+		// Nothing is recorded after a reset or while tracing is disabled.
+		bli_trace_reset();
+		bli_trace_disable();
+		run_gemm( 300, 300, 300 );
+		buf = trace_string();
+		check( count_str( buf, "\"ph\"" ) == 0, "nothing traced while disabled" );
+		free( buf );
+	}
+
+	bli_finalize();
+
+	printf( "%d of %d tests passed\n", n_test - n_fail, n_test );
+
+	return n_fail == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
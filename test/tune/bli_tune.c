@@ -0,0 +1,331 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "blis.h"
+
+//
+// Empirical blocksize tuner.
+//
+// For each requested datatype, the cache blocksizes of the native context
+// of the running sub-configuration are tuned by coordinate descent: KC, then
+// MC, then NC are each swept over multiples of their default values (from
+// one half to twice the default, rounded to the appropriate register
+// blocksize), keeping the fastest. The conventional gemm path is timed on
+// n x n x n problems with sup disabled. The sup blocksizes (KC_SUP, MC_SUP,
+// NC_SUP) are then swept in the same way, timing the sup path on problems
+// whose m dimension is just below the sup threshold MT. NC (NC_SUP) is only
+// swept when n exceeds the smallest candidate.
+//
+// The result is written as a tuning profile that BLIS applies at
+// initialization when it is named by the BLIS_TUNING_FILE environment
+// variable.
+//
+// If -t is given, the sup thresholds (MT, NT, KT) are also calibrated with
+// bli_l3_sup_thresh_calibrate() for each of the given thread counts and for
+// each storage combination whose output storage the microkernel prefers
+// (bli_gemmsup() transposes the others), and the resulting decision surface
+// is printed. Otherwise the thresholds are written unchanged.
+//
+// Usage: bli_tune.x [-o file] [-d dts] [-n size] [-r reps] [-t nts] [-s]
+//
+//   -o file   profile to write (default: blis_<arch>.tune)
+//   -d dts    datatypes to tune, a subset of "sdcz" (default: "sd")
+//   -n size   problem size n (default: 1536)
+//   -r reps   repetitions per timing, of which the best is kept (default: 3)
+//   -t nts    comma-separated thread counts for which to calibrate the sup
+//             thresholds (e.g. "1,4")
+//   -s        print the sup decision surface in effect and exit
+//
+// The number of threads used to tune the blocksizes is taken from the
+// environment (e.g. BLIS_NUM_THREADS), and the blocksizes are only valid
+// for similar thread counts.
+//
+
+static const double fracs[] = { 0.5, 0.75, 1.0, 1.25, 1.5, 2.0 };
+
+static const dim_t n_fracs = sizeof( fracs ) / sizeof( fracs[ 0 ] );
+
+static char dt_char( num_t dt )
+{
+	return bli_dt_prec_is_single( dt ) ? ( bli_dt_dom_is_real( dt ) ? 's' : 'c' )
+	                                   : ( bli_dt_dom_is_real( dt ) ? 'd' : 'z' );
+}
+
+typedef struct
+{
+	num_t  dt;
+	dim_t  m, n, k;
+	bool   sup;
+	int    reps;
+	obj_t  a, b, c;
+} prob_t;
+
+static void prob_create( num_t dt, dim_t m, dim_t n, dim_t k, bool sup, int reps, prob_t* p )
+{
+	p->dt = dt; p->m = m; p->n = n; p->k = k; p->sup = sup; p->reps = reps;
+
+	bli_obj_create( dt, m, k, 0, 0, &p->a );
+	bli_obj_create( dt, k, n, 0, 0, &p->b );
+	bli_obj_create( dt, m, n, 0, 0, &p->c );
+
+	bli_randm( &p->a );
+	bli_randm( &p->b );
+	bli_randm( &p->c );
+}
+
+static void prob_free( prob_t* p )
+{
+	bli_obj_free( &p->a );
+	bli_obj_free( &p->b );
+	bli_obj_free( &p->c );
+}
+
+// Return the best time of several gemms computed with a given context.
+static double prob_time( prob_t* p, const cntx_t* cntx )
+{
+	rntm_t rntm;
+	double t_best = 1.0e9;
+
+	bli_rntm_init_from_global( &rntm );
+	bli_rntm_set_l3_sup( p->sup, &rntm );
+
+	for ( int r = 0; r < p->reps; ++r )
+	{
+		double t = bli_clock();
+
+		bli_gemm_ex( &BLIS_ONE, &p->a, &p->b, &BLIS_ZERO, &p->c, cntx, &rntm );
+
+		t_best = bli_clock_min_diff( t_best, t );
+	}
+
+	return t_best;
+}
+
+// Set the default blocksize of a context, scaling its maximum as
+// bli_tune_read_file() does.
+static void set_bsz( num_t dt, bszid_t bs_id, dim_t def_new, const cntx_t* cntx_orig, cntx_t* cntx )
+{
+	const dim_t def = bli_cntx_get_blksz_def_dt( dt, bs_id, cntx_orig );
+	const dim_t max = bli_cntx_get_blksz_max_dt( dt, bs_id, cntx_orig );
+
+	dim_t max_new = def_new;
+
+	if ( max > def ) max_new = ( dim_t )( ( ( double )max / def ) * def_new );
+
+	bli_cntx_set_blksz_def_dt( dt, bs_id, def_new, cntx );
+	bli_cntx_set_blksz_max_dt( dt, bs_id, max_new, cntx );
+}
+
+// Sweep one blocksize, leaving the fastest value in cntx.
+static void sweep( prob_t* p, bszid_t bs_id, const char* name, const cntx_t* cntx_orig, cntx_t* cntx )
+{
+	const num_t dt    = p->dt;
+	const dim_t def   = bli_cntx_get_blksz_def_dt( dt, bs_id, cntx_orig );
+	const dim_t bmult = bli_cntx_get_blksz_def_dt( dt, bli_cntx_get_bmult_id( bs_id, cntx_orig ), cntx_orig );
+
+	// Skip blocksizes that are not used by the sub-configuration.
+	if ( def <= 0 || bmult <= 0 ) return;
+
+	const dim_t bs_init = bli_cntx_get_blksz_def_dt( dt, bs_id, cntx );
+
+	dim_t  bs_best = bs_init;
+	double t_best  = prob_time( p, cntx );
+	dim_t  bs_prev = 0;
+
+	printf( "%c %-6s %6ld: %8.4f s\n", dt_char( dt ), name, ( long )bs_best, t_best );
+
+	for ( dim_t i = 0; i < n_fracs; ++i )
+	{
+		dim_t bs = ( ( dim_t )( fracs[ i ] * def ) / bmult ) * bmult;
+
+		if ( bs < bmult ) bs = bmult;
+
+		// Skip repeated candidates, and candidates that have no effect on
+		// this problem.
+		if ( bs == bs_prev || bs == bs_init ) continue;
+		if ( ( bs_id == BLIS_NC || bs_id == BLIS_NC_SUP ) &&
+		     bs >= p->n && bs_best >= p->n ) continue;
+
+		bs_prev = bs;
+
+		set_bsz( dt, bs_id, bs, cntx_orig, cntx );
+
+		const double t = prob_time( p, cntx );
+
+		printf( "  %6s %6ld: %8.4f s\n", "", ( long )bs, t );
+
+		// Require a clear improvement so that timing noise alone does not
+		// move a blocksize away from its default.
+		if ( t < 0.98 * t_best ) { t_best = t; bs_best = bs; }
+	}
+
+	set_bsz( dt, bs_id, bs_best, cntx_orig, cntx );
+}
+
+int main( int argc, char** argv )
+{
+	const char* dts    = "sd";
+	const char* fname  = NULL;
+	dim_t       n      = 1536;
+	int         reps   = 3;
+	const char* nts    = NULL;
+	bool        surf   = FALSE;
+	char        fname_def[ 128 ];
+
+	for ( int i = 1; i < argc; ++i )
+	{
+		if      ( strcmp( argv[ i ], "-o" ) == 0 && i + 1 < argc ) fname = argv[ ++i ];
+		else if ( strcmp( argv[ i ], "-d" ) == 0 && i + 1 < argc ) dts   = argv[ ++i ];
+		else if ( strcmp( argv[ i ], "-n" ) == 0 && i + 1 < argc ) n     = atol( argv[ ++i ] );
+		else if ( strcmp( argv[ i ], "-r" ) == 0 && i + 1 < argc ) reps  = atoi( argv[ ++i ] );
+		else if ( strcmp( argv[ i ], "-t" ) == 0 && i + 1 < argc ) nts   = argv[ ++i ];
+		else if ( strcmp( argv[ i ], "-s" ) == 0 )                 surf  = TRUE;
+		else
+		{
+			fprintf( stderr, "usage: %s [-o file] [-d dts] [-n size] [-r reps] [-t nts] [-s]\n", argv[ 0 ] );
+			return 1;
+		}
+	}
+
+	bli_init();
+
+	const cntx_t* cntx_orig = bli_gks_query_cntx();
+	cntx_t        cntx      = *cntx_orig;
+
+	if ( surf )
+	{
+		bli_l3_sup_thresh_fprint( stdout, cntx_orig );
+		bli_finalize();
+		return 0;
+	}
+
+	if ( fname == NULL )
+	{
+		snprintf( fname_def, sizeof( fname_def ), "blis_%s.tune",
+		          bli_arch_string( bli_arch_query_id() ) );
+		fname = fname_def;
+	}
+
+	const dim_t nt = bli_max( bli_thread_get_num_threads(), 1 );
+
+	printf( "tuning '%s' with %ld thread(s), n = %ld\n",
+	        bli_arch_string( bli_arch_query_id() ), ( long )nt, ( long )n );
+
+	for ( const char* d = dts; *d != '\0'; ++d )
+	{
+		num_t  dt;
+		prob_t p;
+
+		if      ( *d == 's' ) dt = BLIS_FLOAT;
+		else if ( *d == 'd' ) dt = BLIS_DOUBLE;
+		else if ( *d == 'c' ) dt = BLIS_SCOMPLEX;
+		else if ( *d == 'z' ) dt = BLIS_DCOMPLEX;
+		else { fprintf( stderr, "unknown datatype '%c'\n", *d ); return 1; }
+
+		// Conventional path.
+		prob_create( dt, n, n, n, FALSE, reps, &p );
+		sweep( &p, BLIS_KC, "KC", cntx_orig, &cntx );
+		sweep( &p, BLIS_MC, "MC", cntx_orig, &cntx );
+		sweep( &p, BLIS_NC, "NC", cntx_orig, &cntx );
+		prob_free( &p );
+
+		// Sup path, if the sub-configuration enables it for this datatype.
+		const dim_t mt = bli_cntx_get_blksz_def_dt( dt, BLIS_MT, &cntx );
+
+		if ( mt > 1 )
+		{
+			prob_create( dt, mt - 1, n, n, TRUE, reps, &p );
+			sweep( &p, BLIS_KC_SUP, "KC_SUP", cntx_orig, &cntx );
+			sweep( &p, BLIS_MC_SUP, "MC_SUP", cntx_orig, &cntx );
+			sweep( &p, BLIS_NC_SUP, "NC_SUP", cntx_orig, &cntx );
+			prob_free( &p );
+		}
+
+		// Sup thresholds, for each thread count and each storage
+		// combination that bli_gemmsup() does not transpose.
+		for ( const char* t = nts; t != NULL && *t != '\0'; )
+		{
+			char*       end;
+			const dim_t nt_cal = strtol( t, &end, 10 );
+
+			if ( end == t || nt_cal < 1 )
+			{
+				fprintf( stderr, "invalid thread count list '%s'\n", nts );
+				return 1;
+			}
+
+			for ( stor3_t stor_id = BLIS_RRR; stor_id < BLIS_XXX; ++stor_id )
+			{
+				const bool c_is_row = ( stor_id & 0x4 ) == 0;
+
+				if ( c_is_row != bli_cntx_ukr_prefers_rows_dt( dt, BLIS_GEMM_VIR_UKR, &cntx ) )
+					continue;
+
+				bli_l3_sup_thresh_calibrate( dt, stor_id, nt_cal, &cntx );
+
+				const dim_t* th = bli_cntx_get_l3_sup_thresh_st
+				(
+				  dt, stor_id, bli_cntx_l3_sup_nt_class( nt_cal ), &cntx
+				);
+
+				printf( "%c %s %3ld thread(s): MT %4ld  NT %4ld  KT %4ld\n",
+				        dt_char( dt ), bli_stor3_string( stor_id ), ( long )nt_cal,
+				        ( long )th[ 0 ], ( long )th[ 1 ], ( long )th[ 2 ] );
+			}
+
+			t = ( *end == ',' ? end + 1 : end );
+		}
+	}
+
+	if ( nts != NULL ) bli_l3_sup_thresh_fprint( stdout, &cntx );
+
+	if ( bli_tune_write_file( fname, &cntx ) != BLIS_SUCCESS )
+	{
+		fprintf( stderr, "could not write '%s'\n", fname );
+		return 1;
+	}
+
+	printf( "wrote '%s'; use it with BLIS_TUNING_FILE=%s\n", fname, fname );
+
+	bli_finalize();
+
+	return 0;
+}
+
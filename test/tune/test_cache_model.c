@@ -0,0 +1,351 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#undef  _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include "blis.h"
+
+//
+// Cache discovery (bli_cpuid_query_caches()) and the analytical blocksize
+// model (bli_tune_cache_model()).
+//
+// The model is applied to copies of the sub-configuration's default context
+// for several synthetic cache hierarchies and thread factorizations, and the
+// resulting blocksizes are checked for admissibility and for how they should
+// respond to larger caches and to caches shared among threads. gemm is then
+// checked with modeled blocksizes, and the blocksizes installed at
+// initialization are checked against the defaults (unless BLIS_CACHE_MODEL=1
+// is set) and against the model applied to the discovered caches (if it is),
+// as are those of a context flagged as untuned.
+//
+
+static int n_test = 0;
+static int n_fail = 0;
+
+static void check( bool ok, const char* what )
+{
+	n_test += 1;
+
+	if ( !ok ) n_fail += 1;
+
+	printf( "%-60s %s\n", what, ok ? "PASS" : "FAIL" );
+}
+
+static cpuid_cache_t make_cache( uint32_t level, uint32_t size, uint32_t ways, uint32_t n_sharing )
+{
+	cpuid_cache_t c;
+
+	c.level     = level;
+	c.size      = size;
+	c.ways      = ways;
+	c.line_size = 64;
+	c.sets      = size / ( ways * 64 );
+	c.n_sharing = n_sharing;
+
+	return c;
+}
+
+// The default context, saved before any model is applied.
+static cntx_t cntx_def;
+
+// Apply the model for a three-level hierarchy and a (jc,ic) factorization.
+static void model
+     (
+       uint32_t l1, uint32_t l2, uint32_t l2_sharing,
+       uint32_t l3, uint32_t l3_sharing,
+       dim_t jc, dim_t ic,
+       cntx_t* cntx
+     )
+{
+	cpuid_cache_t caches[ 3 ];
+	rntm_t        rntm;
+
+	caches[ 0 ] = make_cache( 1, l1, 8,  l2_sharing );
+	caches[ 1 ] = make_cache( 2, l2, 16, l2_sharing );
+	caches[ 2 ] = make_cache( 3, l3, 16, l3_sharing );
+
+	bli_rntm_init( &rntm );
+	bli_rntm_set_ways_only( jc, 1, ic, 1, 1, &rntm );
+
+	*cntx = cntx_def;
+
+	bli_tune_cache_model( caches, l3 > 0 ? 3 : 2, &rntm, cntx );
+}
+
+static dim_t bsz( num_t dt, bszid_t bs_id, const cntx_t* cntx )
+{
+	return bli_cntx_get_blksz_def_dt( dt, bs_id, cntx );
+}
+
+// Check that the modeled blocksizes are multiples of their register
+// blocksizes and within a factor of four of the defaults.
+static bool admissible( const cntx_t* cntx )
+{
+	const bszid_t ids[] = { BLIS_MC, BLIS_KC, BLIS_NC };
+
+	for ( num_t dt = BLIS_FLOAT; dt <= BLIS_DCOMPLEX; ++dt )
+	for ( int i = 0; i < 3; ++i )
+	{
+		const dim_t bs    = bsz( dt, ids[ i ], cntx );
+		const dim_t def   = bsz( dt, ids[ i ], &cntx_def );
+		const dim_t bmult = bli_cntx_get_bmult_dt( dt, ids[ i ], cntx );
+
+		if ( def <= 0 || bmult <= 0 ) continue;
+
+		if ( bs % bmult != 0 || bs < def / 4 - bmult || bs > 4 * def ||
+		     bli_cntx_get_blksz_max_dt( dt, ids[ i ], cntx ) < bs ) return FALSE;
+	}
+
+	return TRUE;
+}
+
+static bool gemm_matches( num_t dt, const cntx_t* cntx )
+{
+	const dim_t m = 411, n = 377, k = 523;
+	obj_t a, b, c, c_ref, norm;
+	double resid, resid_i;
+
+	bli_obj_create( dt, m, k, 0, 0, &a );
+	bli_obj_create( dt, k, n, 0, 0, &b );
+	bli_obj_create( dt, m, n, 0, 0, &c );
+	bli_obj_create( dt, m, n, 0, 0, &c_ref );
+	bli_obj_scalar_init_detached( bli_dt_proj_to_real( dt ), &norm );
+
+	bli_randm( &a );
+	bli_randm( &b );
+	bli_randm( &c );
+	bli_copym( &c, &c_ref );
+
+	rntm_t rntm;
+	bli_rntm_init_from_global( &rntm );
+	bli_rntm_disable_l3_sup( &rntm );
+
+	bli_gemm_ex( &BLIS_ONE, &a, &b, &BLIS_ONE, &c,     cntx,      &rntm );
+	bli_gemm_ex( &BLIS_ONE, &a, &b, &BLIS_ONE, &c_ref, &cntx_def, &rntm );
+
+	bli_subm( &c_ref, &c );
+	bli_normfm( &c, &norm );
+	bli_getsc( &norm, &resid, &resid_i );
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+	bli_obj_free( &c_ref );
+
+	return resid < ( bli_dt_prec_is_single( dt ) ? 1e-2 : 1e-10 );
+}
+
+int main( int argc, char** argv )
+{
+	const uint32_t K = 1024, M = 1024 * 1024;
+	const num_t    dt = BLIS_DOUBLE;
+	cntx_t         c1, c2, c3;
+
+	// Obtain the sub-configuration's defaults by initializing without the
+	// model, and check that these are also installed when the model is not
+	// requested at all (if the sub-configuration's blocksizes are tuned).
+	setenv( "BLIS_CACHE_MODEL", "0", 1 );
+	bli_init();
+	cntx_def = *bli_gks_query_cntx();
+	bli_finalize();
+
+	unsetenv( "BLIS_CACHE_MODEL" );
+	bli_init();
+	c1 = *bli_gks_query_cntx();
+	bli_finalize();
+
+	setenv( "BLIS_CACHE_MODEL", "1", 1 );
+	bli_init();
+
+	// Discovery.
+	cpuid_cache_t caches[ BLIS_CPUID_MAX_CACHES ];
+	const dim_t   n_caches = bli_cpuid_query_caches( caches, BLIS_CPUID_MAX_CACHES );
+	bool          ok       = TRUE;
+
+	for ( dim_t i = 0; i < n_caches; ++i )
+	{
+		printf( "L%u: %u bytes, %u-way, %u sets, %u-byte lines, shared by %u\n",
+		        caches[ i ].level, caches[ i ].size, caches[ i ].ways,
+		        caches[ i ].sets, caches[ i ].line_size, caches[ i ].n_sharing );
+
+		ok = ok && caches[ i ].size == caches[ i ].ways * caches[ i ].sets * caches[ i ].line_size;
+		ok = ok && ( i == 0 || caches[ i ].level >= caches[ i - 1 ].level );
+	}
+
+	check( ok, "discovered cache geometry is consistent" );
+
+	ok = TRUE;
+	for ( num_t dti = BLIS_FLOAT; dti <= BLIS_DCOMPLEX; ++dti )
+	{
+		ok = ok && bsz( dti, BLIS_MC, &c1 ) == bsz( dti, BLIS_MC, &cntx_def );
+		ok = ok && bsz( dti, BLIS_KC, &c1 ) == bsz( dti, BLIS_KC, &cntx_def );
+		ok = ok && bsz( dti, BLIS_NC, &c1 ) == bsz( dti, BLIS_NC, &cntx_def );
+	}
+	if ( !bli_cntx_untuned_blkszs( &cntx_def ) )
+		check( ok, "model not applied by default" );
+
+	// A single thread with private caches.
+	model( 32*K, 256*K, 1, 8*M, 1, 1, 1, &c1 );
+	check( admissible( &c1 ), "blocksizes admissible (8 MB L3)" );
+
+	// A larger L3 cache yields a larger NC but leaves MC and KC unchanged.
+	model( 32*K, 256*K, 1, 24*M, 1, 1, 1, &c2 );
+	check( admissible( &c2 ), "blocksizes admissible (24 MB L3)" );
+	check( bsz( dt, BLIS_NC, &c2 ) > bsz( dt, BLIS_NC, &c1 ) &&
+	       bsz( dt, BLIS_MC, &c2 ) == bsz( dt, BLIS_MC, &c1 ) &&
+	       bsz( dt, BLIS_KC, &c2 ) == bsz( dt, BLIS_KC, &c1 ),
+	       "larger L3 yields larger NC only" );
+
+	// A larger L2 cache yields a larger MC.
+	model( 32*K, 1*M, 1, 8*M, 1, 1, 1, &c2 );
+	check( bsz( dt, BLIS_MC, &c2 ) > bsz( dt, BLIS_MC, &c1 ),
+	       "larger L2 yields larger MC" );
+
+	// Four threads that share an L3 cache: with 4 ways of jc parallelism
+	// each thread needs its own panel of B, so NC shrinks; with 4 ways of ic
+	// parallelism the threads share one panel, so NC shrinks less (if at
+	// all), since only the blocks of A compete with it.
+	model( 32*K, 256*K, 1, 24*M, 4, 4, 1, &c2 );
+	model( 32*K, 256*K, 1, 24*M, 4, 1, 4, &c3 );
+	model( 32*K, 256*K, 1, 24*M, 4, 1, 1, &c1 );
+	check( bsz( dt, BLIS_NC, &c2 ) < bsz( dt, BLIS_NC, &c3 ) &&
+	       bsz( dt, BLIS_NC, &c3 ) <= bsz( dt, BLIS_NC, &c1 ),
+	       "NC accounts for threads sharing L3" );
+
+	// Two threads with distinct blocks of A that share L1 and L2 caches (as
+	// with simultaneous multithreading) each get half of them, so the block
+	// of A (MC x KC) shrinks.
+	model( 32*K, 256*K, 2, 8*M, 2, 1, 2, &c2 );
+	model( 32*K, 256*K, 1, 8*M, 1, 1, 2, &c1 );
+	check( bsz( dt, BLIS_MC, &c2 ) * bsz( dt, BLIS_KC, &c2 ) <
+	       bsz( dt, BLIS_MC, &c1 ) * bsz( dt, BLIS_KC, &c1 ) &&
+	       bsz( dt, BLIS_KC, &c2 ) < bsz( dt, BLIS_KC, &c1 ),
+	       "MC and KC account for threads sharing L1 and L2" );
+
+	// Without an L3 cache NC is left unchanged, and without an L2 cache the
+	// context is left unchanged.
+	model( 32*K, 256*K, 1, 0, 1, 1, 1, &c2 );
+	check( bsz( dt, BLIS_NC, &c2 ) == bsz( dt, BLIS_NC, &cntx_def ),
+	       "no L3 leaves NC unchanged" );
+	{
+		cpuid_cache_t l1 = make_cache( 1, 32*K, 8, 1 );
+		rntm_t        rntm;
+
+		bli_rntm_init( &rntm );
+		bli_rntm_set_ways_only( 1, 1, 1, 1, 1, &rntm );
+		c2 = cntx_def;
+		bli_tune_cache_model( &l1, 1, &rntm, &c2 );
+		check( bsz( dt, BLIS_MC, &c2 ) == bsz( dt, BLIS_MC, &cntx_def ) &&
+		       bsz( dt, BLIS_KC, &c2 ) == bsz( dt, BLIS_KC, &cntx_def ),
+		       "no L2 leaves context unchanged" );
+	}
+
+	// gemm remains correct with very small and very large caches, which
+	// drive the blocksizes to either end of their admissible range.
+	model( 4*K, 16*K, 1, 256*K, 1, 1, 1, &c2 );
+	check( admissible( &c2 ), "blocksizes admissible (tiny caches)" );
+	check( gemm_matches( BLIS_DOUBLE, &c2 ) && gemm_matches( BLIS_FLOAT, &c2 ),
+	       "gemm with blocksizes for tiny caches" );
+
+	model( 128*K, 8*M, 1, 512*M, 1, 1, 1, &c2 );
+	check( admissible( &c2 ), "blocksizes admissible (huge caches)" );
+	check( gemm_matches( BLIS_DOUBLE, &c2 ) && gemm_matches( BLIS_FLOAT, &c2 ),
+	       "gemm with blocksizes for huge caches" );
+
+	// At initialization, the model is applied to the discovered caches with
+	// the threading requested in the environment.
+	{
+		rntm_t rntm;
+
+		bli_rntm_init( &rntm );
+		bli_thread_init_rntm_from_env( &rntm );
+		bli_rntm_set_ways_for_op( BLIS_GEMM, BLIS_LEFT, 4096, 4096, 4096, &rntm );
+
+		c2 = cntx_def;
+		if ( n_caches > 0 ) bli_tune_cache_model( caches, n_caches, &rntm, &c2 );
+
+		const cntx_t* cntx = bli_gks_query_cntx();
+
+		ok = TRUE;
+		for ( num_t dti = BLIS_FLOAT; dti <= BLIS_DCOMPLEX; ++dti )
+		{
+			ok = ok && bsz( dti, BLIS_MC, cntx ) == bsz( dti, BLIS_MC, &c2 );
+			ok = ok && bsz( dti, BLIS_KC, cntx ) == bsz( dti, BLIS_KC, &c2 );
+			ok = ok && bsz( dti, BLIS_NC, cntx ) == bsz( dti, BLIS_NC, &c2 );
+		}
+		check( ok, "modeled blocksizes installed at init" );
+
+		// A sub-configuration whose blocksizes are flagged as untuned gets
+		// the model without BLIS_CACHE_MODEL, but not with BLIS_CACHE_MODEL=0.
+		c3 = cntx_def;
+		bli_cntx_set_untuned_blkszs( TRUE, &c3 );
+		unsetenv( "BLIS_CACHE_MODEL" );
+		bli_tune_init( &c3 );
+
+		ok = TRUE;
+		for ( num_t dti = BLIS_FLOAT; dti <= BLIS_DCOMPLEX; ++dti )
+		{
+			ok = ok && bsz( dti, BLIS_MC, &c3 ) == bsz( dti, BLIS_MC, &c2 );
+			ok = ok && bsz( dti, BLIS_KC, &c3 ) == bsz( dti, BLIS_KC, &c2 );
+			ok = ok && bsz( dti, BLIS_NC, &c3 ) == bsz( dti, BLIS_NC, &c2 );
+		}
+		check( ok, "model applied by default if untuned" );
+
+		c3 = cntx_def;
+		bli_cntx_set_untuned_blkszs( TRUE, &c3 );
+		setenv( "BLIS_CACHE_MODEL", "0", 1 );
+		bli_tune_init( &c3 );
+
+		ok = TRUE;
+		for ( num_t dti = BLIS_FLOAT; dti <= BLIS_DCOMPLEX; ++dti )
+		{
+			ok = ok && bsz( dti, BLIS_MC, &c3 ) == bsz( dti, BLIS_MC, &cntx_def );
+			ok = ok && bsz( dti, BLIS_KC, &c3 ) == bsz( dti, BLIS_KC, &cntx_def );
+			ok = ok && bsz( dti, BLIS_NC, &c3 ) == bsz( dti, BLIS_NC, &cntx_def );
+		}
+		check( ok, "BLIS_CACHE_MODEL=0 overrides untuned" );
+	}
+
+	printf( "%d of %d tests passed\n", n_test - n_fail, n_test );
+
+	bli_finalize();
+
+	return n_fail == 0 ? 0 : 1;
+}
+
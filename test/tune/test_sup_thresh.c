@@ -0,0 +1,333 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#undef  _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "blis.h"
+
+//
+// Sup thresholds indexed by datatype, storage combination, and number of
+// threads (bli_cntx_set_l3_sup_thresh_st() and
+// bli_cntx_l3_sup_thresh_is_met_st()), their calibration by
+// bli_l3_sup_thresh_calibrate(), and their persistence in tuning profiles.
+//
+// Whether bli_gemm_ex() dispatches to the sup code path is observed through
+// a sup handler that counts its calls and then declines the problem, so
+// that the conventional code path computes the result.
+//
+
+static char path[] = "/tmp/blis_sup_thresh_XXXXXX";
+
+static int n_test = 0;
+static int n_fail = 0;
+
+static int n_sup_calls = 0;
+
+static void check( bool ok, const char* what )
+{
+	n_test += 1;
+
+	if ( !ok ) n_fail += 1;
+
+	printf( "%-56s %s\n", what, ok ? "PASS" : "FAIL" );
+}
+
+static err_t counting_gemmsup
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c,
+       const cntx_t* cntx,
+             rntm_t* rntm
+     )
+{
+	n_sup_calls += 1;
+
+	return BLIS_FAILURE;
+}
+
+// Report whether a column-stored double-precision gemm of the given size
+// and number of threads is offered to the sup handler of cntx.
+static bool goes_sup( dim_t m, dim_t n, dim_t k, dim_t nt, const cntx_t* cntx )
+{
+	obj_t  a, b, c;
+	rntm_t rntm;
+
+	bli_obj_create( BLIS_DOUBLE, m, k, 0, 0, &a );
+	bli_obj_create( BLIS_DOUBLE, k, n, 0, 0, &b );
+	bli_obj_create( BLIS_DOUBLE, m, n, 0, 0, &c );
+	bli_randm( &a );
+	bli_randm( &b );
+
+	bli_rntm_init( &rntm );
+	bli_rntm_set_num_threads( nt, &rntm );
+
+	const int n_calls = n_sup_calls;
+
+	bli_gemm_ex( &BLIS_ONE, &a, &b, &BLIS_ZERO, &c, cntx, &rntm );
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+
+	return n_sup_calls > n_calls;
+}
+
+// Likewise for a column-stored lower-triangular m x m gemmt with a k
+// dimension of length k. Since bli_gemmt_ex() does not yet use the sup code
+// path, bli_gemmtsup() is called directly.
+static bool gemmt_goes_sup( dim_t m, dim_t k, dim_t nt, const cntx_t* cntx )
+{
+	obj_t  a, b, c;
+	rntm_t rntm;
+
+	bli_obj_create( BLIS_DOUBLE, m, k, 0, 0, &a );
+	bli_obj_create( BLIS_DOUBLE, k, m, 0, 0, &b );
+	bli_obj_create( BLIS_DOUBLE, m, m, 0, 0, &c );
+	bli_obj_set_struc( BLIS_TRIANGULAR, &c );
+	bli_obj_set_uplo( BLIS_LOWER, &c );
+	bli_randm( &a );
+	bli_randm( &b );
+
+	bli_rntm_init( &rntm );
+	bli_rntm_set_num_threads( nt, &rntm );
+
+	const int n_calls = n_sup_calls;
+
+	bli_gemmtsup( &BLIS_ONE, &a, &b, &BLIS_ZERO, &c, cntx, &rntm );
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+
+	return n_sup_calls > n_calls;
+}
+
+int main( int argc, char** argv )
+{
+	bool ok;
+
+	bli_init();
+
+	const int fd = mkstemp( path );
+
+	if ( fd < 0 ) { perror( path ); return 1; }
+
+	close( fd );
+
+	const cntx_t* cntx_def = bli_gks_query_cntx();
+	const dim_t   mt       = bli_cntx_get_blksz_def_dt( BLIS_DOUBLE, BLIS_MT, cntx_def );
+	const dim_t   nt       = bli_cntx_get_blksz_def_dt( BLIS_DOUBLE, BLIS_NT, cntx_def );
+	const dim_t   kt       = bli_cntx_get_blksz_def_dt( BLIS_DOUBLE, BLIS_KT, cntx_def );
+	cntx_t        cntx     = *cntx_def;
+
+	// The storage combination under which column-stored problems are looked
+	// up, taking into account the transposition performed by bli_gemmsup()
+	// if the microkernel prefers row-stored C.
+	const stor3_t ccc = bli_cntx_ukr_prefers_rows_dt( BLIS_DOUBLE, BLIS_GEMM_VIR_UKR, &cntx )
+	                    ? bli_stor3_trans( BLIS_CCC ) : BLIS_CCC;
+
+	ok = bli_cntx_l3_sup_nt_class( 1 ) == 0 && bli_cntx_l3_sup_nt_class( 2 ) == 1 &&
+	     bli_cntx_l3_sup_nt_class( 3 ) == 1 && bli_cntx_l3_sup_nt_class( 4 ) == 2 &&
+	     bli_cntx_l3_sup_nt_class( 1000 ) == BLIS_NUM_SUP_NT_CLASSES - 1;
+	check( ok, "thread count classes" );
+
+	// Small problems are offered to the sup handler both when no runtime is
+	// given and when the runtime is initialized from the global runtime,
+	// which therefore must enable sup.
+	{
+		cntx_t cntx_cnt = *cntx_def;
+		obj_t  a, b, c;
+		rntm_t rntm;
+
+		cntx_cnt.l3_sup_handlers[ BLIS_GEMM ] = ( void_fp )counting_gemmsup;
+
+		bli_obj_create( BLIS_DOUBLE, 4, 4, 0, 0, &a );
+		bli_obj_create( BLIS_DOUBLE, 4, 4, 0, 0, &b );
+		bli_obj_create( BLIS_DOUBLE, 4, 4, 0, 0, &c );
+		bli_randm( &a );
+		bli_randm( &b );
+
+		bli_rntm_init_from_global( &rntm );
+
+		const int n_calls = n_sup_calls;
+
+		bli_gemm_ex( &BLIS_ONE, &a, &b, &BLIS_ZERO, &c, &cntx_cnt, NULL );
+		bli_gemm_ex( &BLIS_ONE, &a, &b, &BLIS_ZERO, &c, &cntx_cnt, &rntm );
+
+		ok = bli_rntm_l3_sup( &rntm ) && n_sup_calls == n_calls + 2;
+		check( ok, "small gemm with global runtime goes sup" );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+	}
+
+	ok = TRUE;
+	for ( dim_t i = 1; i < 3 * mt; i += 7 )
+		ok = ok && bli_cntx_l3_sup_thresh_is_met_st( BLIS_DOUBLE, ccc, 4, i, 2 * i, 3 * i, &cntx ) ==
+		           bli_cntx_l3_sup_thresh_is_met( BLIS_DOUBLE, i, 2 * i, 3 * i, &cntx );
+	check( ok, "uncalibrated thresholds fall back to MT/NT/KT" );
+
+	// Calibrate four threads only; every thread count then uses it.
+	bli_cntx_set_l3_sup_thresh_st( BLIS_DOUBLE, ccc, 2, 100, 50, 20, &cntx );
+
+	ok = bli_cntx_l3_sup_thresh_is_met_st( BLIS_DOUBLE, ccc, 4, 99, 500, 500, &cntx ) &&
+	     bli_cntx_l3_sup_thresh_is_met_st( BLIS_DOUBLE, ccc, 4, 500, 49, 500, &cntx ) &&
+	     bli_cntx_l3_sup_thresh_is_met_st( BLIS_DOUBLE, ccc, 4, 500, 500, 19, &cntx ) &&
+	     !bli_cntx_l3_sup_thresh_is_met_st( BLIS_DOUBLE, ccc, 4, 100, 50, 20, &cntx );
+	check( ok, "calibrated thresholds are used" );
+
+	ok = bli_cntx_l3_sup_thresh_is_met_st( BLIS_DOUBLE, ccc, 1, 99, 500, 500, &cntx ) &&
+	     !bli_cntx_l3_sup_thresh_is_met_st( BLIS_DOUBLE, ccc, 64, 100, 50, 20, &cntx );
+	check( ok, "single calibrated class used for all threads" );
+
+	ok = bli_cntx_l3_sup_thresh_is_met_st( BLIS_DOUBLE, BLIS_RCR, 4, 100, 50, 20, &cntx ) ==
+	     bli_cntx_l3_sup_thresh_is_met( BLIS_DOUBLE, 100, 50, 20, &cntx );
+	ok = ok &&
+	     bli_cntx_l3_sup_thresh_is_met_st( BLIS_FLOAT, ccc, 4, 100, 50, 20, &cntx ) ==
+	     bli_cntx_l3_sup_thresh_is_met( BLIS_FLOAT, 100, 50, 20, &cntx );
+	check( ok, "other storage and datatypes unaffected" );
+
+	// With one thread calibrated as well, two threads prefer the one-thread
+	// class and eight threads the four-thread class.
+	bli_cntx_set_l3_sup_thresh_st( BLIS_DOUBLE, ccc, 0, 300, 300, 300, &cntx );
+
+	ok = bli_cntx_l3_sup_thresh_is_met_st( BLIS_DOUBLE, ccc, 2, 299, 500, 500, &cntx ) &&
+	     !bli_cntx_l3_sup_thresh_is_met_st( BLIS_DOUBLE, ccc, 8, 299, 500, 500, &cntx );
+	check( ok, "nearest calibrated class chosen" );
+
+	// The decision reaches bli_gemm_ex(), including the number of threads
+	// from the rntm_t.
+	cntx.l3_sup_handlers[ BLIS_GEMM ] = ( void_fp )counting_gemmsup;
+
+	ok = goes_sup( 120, 120, 120, 1, &cntx ) && !goes_sup( 120, 120, 120, 4, &cntx );
+	check( ok, "gemm dispatch follows calibrated thresholds" );
+
+	bli_cntx_clear_l3_sup_thresh_st( BLIS_DOUBLE, ccc, 0, &cntx );
+	bli_cntx_clear_l3_sup_thresh_st( BLIS_DOUBLE, ccc, 2, &cntx );
+
+	ok = goes_sup( mt - 1, 2 * nt, 2 * kt, 1, &cntx ) == ( mt > 1 ) &&
+	     !goes_sup( 2 * mt, 2 * nt, 2 * kt, 1, &cntx );
+	check( ok, "gemm dispatch falls back to MT/NT/KT" );
+
+	// gemmt looks up its thresholds under the same (possibly transposed)
+	// storage combination as gemm.
+	cntx.l3_sup_handlers[ BLIS_GEMMT ] = ( void_fp )counting_gemmsup;
+
+	bli_cntx_set_l3_sup_thresh_st( BLIS_DOUBLE, ccc, 0, 300, 300, 300, &cntx );
+	if ( ccc != BLIS_CCC )
+		bli_cntx_set_l3_sup_thresh_st( BLIS_DOUBLE, BLIS_CCC, 0, 2, 2, 2, &cntx );
+
+	ok = gemmt_goes_sup( 120, 120, 1, &cntx ) && !gemmt_goes_sup( 400, 400, 1, &cntx );
+	check( ok, "gemmt dispatch follows calibrated thresholds" );
+
+	bli_cntx_clear_l3_sup_thresh_st( BLIS_DOUBLE, ccc, 0, &cntx );
+	bli_cntx_clear_l3_sup_thresh_st( BLIS_DOUBLE, BLIS_CCC, 0, &cntx );
+
+	// Calibrated thresholds survive a profile round trip, and invalid
+	// threshold lines are rejected.
+	cntx = *cntx_def;
+	bli_cntx_set_l3_sup_thresh_st( BLIS_DOUBLE, BLIS_RCR, 3, 123, 45, 67, &cntx );
+	bli_cntx_set_l3_sup_thresh_st( BLIS_FLOAT,  BLIS_CCC, 0, 11, 22, 33, &cntx );
+
+	cntx_t cntx_rt = *cntx_def;
+
+	ok = bli_tune_write_file( path, &cntx ) == BLIS_SUCCESS &&
+	     bli_tune_read_file( path, &cntx_rt ) == BLIS_SUCCESS &&
+	     memcmp( cntx_rt.l3_sup_thresh, cntx.l3_sup_thresh, sizeof( cntx.l3_sup_thresh ) ) == 0;
+	check( ok, "thresholds survive profile round trip" );
+
+	const char* invalid[] =
+	{
+		"d thresh ccc 4 100 50\n",
+		"d thresh cxc 4 100 50 20\n",
+		"d thresh ccc 0 100 50 20\n",
+		"d thresh ccc 4 100 -5 20\n",
+		"q thresh ccc 4 100 50 20\n",
+	};
+
+	ok = TRUE;
+	for ( int i = 0; i < ( int )( sizeof( invalid ) / sizeof( invalid[ 0 ] ) ); ++i )
+	{
+		FILE* fp = fopen( path, "w" );
+
+		if ( fp == NULL ) { perror( path ); return 1; }
+
+		fputs( invalid[ i ], fp );
+		fclose( fp );
+
+		cntx_rt = *cntx_def;
+		ok = ok && bli_tune_read_file( path, &cntx_rt ) != BLIS_SUCCESS &&
+		     memcmp( &cntx_rt, cntx_def, sizeof( cntx_t ) ) == 0;
+	}
+	check( ok, "invalid threshold lines rejected" );
+
+	// Calibration stores thresholds for the requested class (under the
+	// storage combination by which bli_gemmsup() looks them up) within the
+	// range of sizes it considers.
+	cntx = *cntx_def;
+	bli_l3_sup_thresh_calibrate( BLIS_DOUBLE, BLIS_CCC, 1, &cntx );
+
+	const dim_t* t = bli_cntx_get_l3_sup_thresh_st( BLIS_DOUBLE, ccc, 0, &cntx );
+
+	ok = t[ 0 ] >= 8 && t[ 0 ] <= 1024 &&
+	     t[ 1 ] >= 8 && t[ 1 ] <= 1024 &&
+	     t[ 2 ] >= 8 && t[ 2 ] <= 1024 &&
+	     bli_cntx_get_l3_sup_thresh_st( BLIS_DOUBLE, ccc, 1, &cntx )[ 0 ] == 0;
+	check( ok, "calibration stores plausible thresholds" );
+
+	ok = bli_cntx_get_blksz_def_dt( BLIS_DOUBLE, BLIS_MT, &cntx ) == mt &&
+	     bli_cntx_get_blksz_def_dt( BLIS_DOUBLE, BLIS_KC, &cntx ) ==
+	     bli_cntx_get_blksz_def_dt( BLIS_DOUBLE, BLIS_KC, cntx_def );
+	check( ok, "calibration leaves blocksizes unchanged" );
+
+	remove( path );
+
+	printf( "%d of %d tests passed\n", n_test - n_fail, n_test );
+
+	bli_finalize();
+
+	return n_fail == 0 ? 0 : 1;
+}
+
@@ -0,0 +1,249 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2026, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+
+#undef  _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "blis.h"
+
+//
+// Reading, writing, and applying tuning profiles (bli_tune_read_file(),
+// bli_tune_write_file(), and the BLIS_TUNING_FILE environment variable).
+//
+// Each test writes a profile to a temporary file and checks which
+// blocksizes, if any, it changes in a copy of the native context. Invalid
+// profiles must leave the context untouched. Finally, gemm is checked
+// against the default context when run with a tuned context, and the
+// profile named by BLIS_TUNING_FILE is checked to reach the gks across a
+// bli_finalize()/bli_init() cycle.
+//
+
+static char path[] = "/tmp/blis_tune_XXXXXX";
+
+static int n_test = 0;
+static int n_fail = 0;
+
+static void check( bool ok, const char* what )
+{
+	n_test += 1;
+
+	if ( !ok ) n_fail += 1;
+
+	printf( "%-56s %s\n", what, ok ? "PASS" : "FAIL" );
+}
+
+static void write_profile( const char* text )
+{
+	FILE* fp = fopen( path, "w" );
+
+	if ( fp == NULL ) { perror( path ); exit( 1 ); }
+
+	fputs( text, fp );
+	fclose( fp );
+}
+
+static bool cntx_blkszs_equal( const cntx_t* c1, const cntx_t* c2 )
+{
+	const bszid_t ids[] = { BLIS_MC, BLIS_KC, BLIS_NC,
+	                        BLIS_MC_SUP, BLIS_KC_SUP, BLIS_NC_SUP,
+	                        BLIS_MT, BLIS_NT, BLIS_KT };
+
+	for ( num_t dt = BLIS_FLOAT; dt <= BLIS_DCOMPLEX; ++dt )
+	for ( int i = 0; i < ( int )( sizeof( ids ) / sizeof( ids[ 0 ] ) ); ++i )
+	{
+		if ( bli_cntx_get_blksz_def_dt( dt, ids[ i ], c1 ) !=
+		     bli_cntx_get_blksz_def_dt( dt, ids[ i ], c2 ) ||
+		     bli_cntx_get_blksz_max_dt( dt, ids[ i ], c1 ) !=
+		     bli_cntx_get_blksz_max_dt( dt, ids[ i ], c2 ) ) return FALSE;
+	}
+
+	return TRUE;
+}
+
+// Apply a profile to a copy of the native context and report whether it
+// was accepted. The copy is returned in cntx.
+static bool apply( const char* text, cntx_t* cntx )
+{
+	*cntx = *bli_gks_query_cntx();
+
+	write_profile( text );
+
+	return bli_tune_read_file( path, cntx ) == BLIS_SUCCESS;
+}
+
+// Compare gemm computed with a tuned context against the default context.
+static bool gemm_matches( num_t dt, const cntx_t* cntx )
+{
+	const dim_t m = 301, n = 257, k = 389;
+	obj_t a, b, c, c_ref, norm;
+	double resid, resid_i;
+
+	bli_obj_create( dt, m, k, 0, 0, &a );
+	bli_obj_create( dt, k, n, 0, 0, &b );
+	bli_obj_create( dt, m, n, 0, 0, &c );
+	bli_obj_create( dt, m, n, 0, 0, &c_ref );
+	bli_obj_scalar_init_detached( bli_dt_proj_to_real( dt ), &norm );
+
+	bli_randm( &a );
+	bli_randm( &b );
+	bli_randm( &c );
+	bli_copym( &c, &c_ref );
+
+	// Disable sup so that the conventional blocksizes are exercised.
+	rntm_t rntm;
+	bli_rntm_init_from_global( &rntm );
+	bli_rntm_disable_l3_sup( &rntm );
+
+	bli_gemm_ex( &BLIS_ONE, &a, &b, &BLIS_ONE, &c,     cntx, &rntm );
+	bli_gemm_ex( &BLIS_ONE, &a, &b, &BLIS_ONE, &c_ref, NULL, &rntm );
+
+	bli_subm( &c_ref, &c );
+	bli_normfm( &c, &norm );
+	bli_getsc( &norm, &resid, &resid_i );
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+	bli_obj_free( &c_ref );
+
+	return resid < ( bli_dt_prec_is_single( dt ) ? 1e-2 : 1e-10 );
+}
+
+int main( int argc, char** argv )
+{
+	bli_init();
+
+	int fd = mkstemp( path );
+
+	if ( fd < 0 ) { perror( "mkstemp" ); return 1; }
+
+	close( fd );
+
+	const cntx_t* cntx_def = bli_gks_query_cntx();
+	const char*   arch     = bli_arch_string( bli_arch_query_id() );
+	cntx_t        cntx;
+	char          text[ 1024 ];
+	bool          ok;
+
+	const dim_t mr   = bli_cntx_get_blksz_def_dt( BLIS_DOUBLE, BLIS_MR, cntx_def );
+	const dim_t mc   = bli_cntx_get_blksz_def_dt( BLIS_DOUBLE, BLIS_MC, cntx_def );
+	const dim_t mc_n = ( mc / mr / 2 + 1 ) * mr;
+	const dim_t kc   = bli_cntx_get_blksz_def_dt( BLIS_DOUBLE, BLIS_KC, cntx_def );
+
+	// A profile written from the native context reproduces it exactly.
+	cntx = *cntx_def;
+	ok   = bli_tune_write_file( path, &cntx ) == BLIS_SUCCESS;
+	ok   = ok && bli_tune_read_file( path, &cntx ) == BLIS_SUCCESS;
+	check( ok && cntx_blkszs_equal( &cntx, cntx_def ), "round trip" );
+
+	// Valid overrides are applied, with comments and blank lines ignored,
+	// and the maximum blocksize is scaled along with the default.
+	snprintf( text, sizeof( text ),
+	          "# comment\n\narch %s\nd MC %ld # trailing comment\n"
+	          "d KC 100\nd MT -1\n", arch, ( long )mc_n );
+	ok = apply( text, &cntx );
+	ok = ok && bli_cntx_get_blksz_def_dt( BLIS_DOUBLE, BLIS_MC, &cntx ) == mc_n;
+	ok = ok && bli_cntx_get_blksz_max_dt( BLIS_DOUBLE, BLIS_MC, &cntx ) >= mc_n;
+	ok = ok && bli_cntx_get_blksz_def_dt( BLIS_DOUBLE, BLIS_KC, &cntx ) == 100;
+	ok = ok && bli_cntx_get_blksz_def_dt( BLIS_DOUBLE, BLIS_MT, &cntx ) == -1;
+	ok = ok && bli_cntx_get_blksz_def_dt( BLIS_FLOAT,  BLIS_MC, &cntx ) ==
+	           bli_cntx_get_blksz_def_dt( BLIS_FLOAT,  BLIS_MC, cntx_def );
+	check( ok, "valid overrides" );
+
+	// gemm remains correct with the tuned blocksizes.
+	check( gemm_matches( BLIS_DOUBLE, &cntx ), "dgemm with tuned context" );
+
+	snprintf( text, sizeof( text ), "s KC 96\ns MC %ld\n",
+	          ( long )( 2 * bli_cntx_get_blksz_def_dt( BLIS_FLOAT, BLIS_MR, cntx_def ) ) );
+	ok = apply( text, &cntx );
+	check( ok && gemm_matches( BLIS_FLOAT, &cntx ), "sgemm with tuned context" );
+
+	// Each invalid profile is rejected in full, including any valid lines
+	// that precede the invalid one.
+	const char* invalid[] =
+	{
+		"d KC 100\nd MC %ld\n",       // not a multiple of MR
+		"d KC 100\nd MC 0\n",         // not positive
+		"d KC 100\nd QC 64\n",        // unknown blocksize
+		"d KC 100\nq MC 64\n",        // unknown datatype
+		"d KC 100\nd MC 64x\n",       // malformed value
+		"d KC 100\nd MC\n",           // missing value
+		"d KC 100\narch nonesuch\n",  // wrong sub-configuration
+	};
+
+	for ( int i = 0; i < ( int )( sizeof( invalid ) / sizeof( invalid[ 0 ] ) ); ++i )
+	{
+		char what[ 64 ];
+
+		snprintf( text, sizeof( text ), invalid[ i ], ( long )( mc_n + 1 ) );
+		snprintf( what, sizeof( what ), "invalid profile %d rejected", i );
+
+		ok = !apply( text, &cntx );
+		check( ok && cntx_blkszs_equal( &cntx, cntx_def ), what );
+	}
+
+	cntx = *cntx_def;
+	ok   = bli_tune_read_file( "/nonexistent/blis_tune", &cntx ) != BLIS_SUCCESS;
+	check( ok && cntx_blkszs_equal( &cntx, cntx_def ), "missing profile rejected" );
+
+	// A profile named by BLIS_TUNING_FILE is applied to the gks at
+	// initialization, and removed by reinitializing without it.
+	write_profile( "d KC 128\n" );
+	setenv( "BLIS_TUNING_FILE", path, 1 );
+	bli_finalize();
+	bli_init();
+	ok = bli_cntx_get_blksz_def_dt( BLIS_DOUBLE, BLIS_KC, bli_gks_query_cntx() ) == 128;
+	check( ok, "BLIS_TUNING_FILE applied at init" );
+
+	unsetenv( "BLIS_TUNING_FILE" );
+	bli_finalize();
+	bli_init();
+	ok = bli_cntx_get_blksz_def_dt( BLIS_DOUBLE, BLIS_KC, bli_gks_query_cntx() ) == kc;
+	check( ok, "defaults restored without BLIS_TUNING_FILE" );
+
+	remove( path );
+
+	printf( "%d of %d tests passed\n", n_test - n_fail, n_test );
+
+	bli_finalize();
+
+	return n_fail == 0 ? 0 : 1;
+}
+
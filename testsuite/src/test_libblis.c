@@ -550,6 +550,14 @@ void libblis_test_read_params_file( char* input_filename, test_params_t* params
 	libblis_test_read_next_line( buffer, input_stream );
 	sscanf( buffer, "%u ", &(params->p_inc) );
 
+	// Read whether to enable 3m.
+	libblis_test_read_next_line( buffer, input_stream );
+	sscanf( buffer, "%u ", &(params->ind_enable[ BLIS_3M ]) );
+
+	// Read whether to enable 4m.
+	libblis_test_read_next_line( buffer, input_stream );
+	sscanf( buffer, "%u ", &(params->ind_enable[ BLIS_4M ]) );
+
 	// Read whether to enable 1m.
 	libblis_test_read_next_line( buffer, input_stream );
 	sscanf( buffer, "%u ", &(params->ind_enable[ BLIS_1M ]) );
@@ -569,13 +577,17 @@ void libblis_test_read_params_file( char* input_filename, test_params_t* params
 	// threads.
 	if ( params->n_app_threads > 1 )
 	{
-		if ( params->ind_enable[ BLIS_1M ] )
+		if ( params->ind_enable[ BLIS_3M ] ||
+		     params->ind_enable[ BLIS_4M ] ||
+		     params->ind_enable[ BLIS_1M ] )
 		{
 			// Due to an inherent race condition in the way induced methods
 			// are enabled and disabled at runtime, all induced methods must be
 			// disabled when simulating multiple application threads.
 			libblis_test_printf_infoc( "simulating multiple application threads; disabling induced methods.\n" );
 
+			params->ind_enable[ BLIS_3M   ] = 0;
+			params->ind_enable[ BLIS_4M   ] = 0;
 			params->ind_enable[ BLIS_1M   ] = 0;
 		}
 	}
@@ -838,6 +850,8 @@ void libblis_test_output_params_struct( FILE* os, test_params_t* params )
 	libblis_test_fprintf_c( os, "  enabled for packing blocks?  %d\n", ( int )bli_info_get_enable_pba_pools() );
 	libblis_test_fprintf_c( os, "  enabled for small blocks?    %d\n", ( int )bli_info_get_enable_sba_pools() );
 	libblis_test_fprintf_c( os, "\n" );
+	libblis_test_fprintf_c( os, "level-3 statistics enabled?    %d\n", ( int )bli_info_get_enable_stats() );
+	libblis_test_fprintf_c( os, "\n" );
 	libblis_test_fprintf_c( os, "memory alignment (bytes)         \n" );
 	libblis_test_fprintf_c( os, "  stack address                %d\n", ( int )bli_info_get_stack_buf_align_size() );
 	libblis_test_fprintf_c( os, "  obj_t address                %d\n", ( int )bli_info_get_heap_addr_align_size() );
@@ -1200,6 +1214,8 @@ void libblis_test_output_params_struct( FILE* os, test_params_t* params )
 	libblis_test_fprintf_c( os, "problem size: max to test    %u\n", params->p_max );
 	libblis_test_fprintf_c( os, "problem size increment       %u\n", params->p_inc );
 	libblis_test_fprintf_c( os, "complex implementations        \n" );
+	libblis_test_fprintf_c( os, "  3m?                        %u\n", params->ind_enable[ BLIS_3M ] );
+	libblis_test_fprintf_c( os, "  4m?                        %u\n", params->ind_enable[ BLIS_4M ] );
 	libblis_test_fprintf_c( os, "  1m?                        %u\n", params->ind_enable[ BLIS_1M ] );
 	libblis_test_fprintf_c( os, "  native?                    %u\n", params->ind_enable[ BLIS_NAT ] );
 	libblis_test_fprintf_c( os, "simulated app-level threads  %u\n", params->n_app_threads );
@@ -1572,6 +1588,9 @@ void libblis_test_op_driver
 	unsigned int  indi, pci, sci, dci, i, j, o;
 	unsigned int  is_mixed_dt;
 
+	thresh_t      thresh_ind[ BLIS_NUM_FP_TYPES ];
+	double        thresh_scale;
+
 	double        perf, resid;
 	char*         pass_str;
 	char*         ind_str;
@@ -2169,6 +2188,13 @@ void libblis_test_op_driver
 						else if ( has_samep && has_cd_only ) { ; }
 						else { continue; }
 					}
+					// Likewise, the 3m and 4m methods are only implemented
+					// for gemm where all operands have the same datatype.
+					else if ( indi == BLIS_3M || indi == BLIS_4M )
+					{
+						if ( op->opid == BLIS_GEMM && has_samep && has_cd_only ) { ; }
+						else { continue; }
+					}
 					else { ; }
 				}
 				else { continue; }
@@ -2180,6 +2206,18 @@ void libblis_test_op_driver
 				// not level-3, we will always get back the native string.
 				ind_str = ( char* )bli_ind_oper_get_avail_impl_string( op->opid, datatype );
 
+				// Relax the thresholds for the induced methods that are
+				// inherently less accurate than native execution.
+				if      ( indi == BLIS_3M ) thresh_scale = BLIS_TEST_3M_THRESH_SCALE;
+				else if ( indi == BLIS_4M ) thresh_scale = BLIS_TEST_4M_THRESH_SCALE;
+				else                        thresh_scale = 1.0;
+
+				for ( i = 0; i < BLIS_NUM_FP_TYPES; ++i )
+				{
+					thresh_ind[ i ].failwarn = thresh_scale * thresh[ i ].failwarn;
+					thresh_ind[ i ].warnpass = thresh_scale * thresh[ i ].warnpass;
+				}
+
 				// Loop over the requested parameter combinations.
 				for ( pci = 0; pci < n_param_combos; ++pci )
 				{
@@ -2214,7 +2252,7 @@ void libblis_test_op_driver
 						// position relative to the thresholds.
 						pass_str = libblis_test_get_string_for_result( resid,
 						                                               dt_check,
-						                                               thresh );
+						                                               thresh_ind );
 
 						// Build a string unique to the operation, datatype combo,
 						// parameter combo, and storage combo being tested.
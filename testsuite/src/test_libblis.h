@@ -88,6 +88,13 @@
 
 #define SECONDS_TO_SLEEP             3
 
+// The 3m and 4m induced methods form the real and imaginary parts of a
+// complex product from sums and differences of real products, so they
+// lose a few more bits than native or 1m execution. Their residuals are
+// checked against the operation's thresholds relaxed by these factors.
+#define BLIS_TEST_3M_THRESH_SCALE    10.0
+#define BLIS_TEST_4M_THRESH_SCALE    2.0
+
 #define DISABLE                      0
 #define ENABLE                       1
 #define ENABLE_ONLY                  2